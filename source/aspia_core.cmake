@@ -37,11 +37,17 @@ list(APPEND SOURCE_BASE
     ${PROJECT_SOURCE_DIR}/base/locale_loader.cc
     ${PROJECT_SOURCE_DIR}/base/locale_loader.h
     ${PROJECT_SOURCE_DIR}/base/message_serialization.h
+    ${PROJECT_SOURCE_DIR}/base/metrics.cc
+    ${PROJECT_SOURCE_DIR}/base/metrics.h
     ${PROJECT_SOURCE_DIR}/base/service.h
     ${PROJECT_SOURCE_DIR}/base/service_controller.cc
     ${PROJECT_SOURCE_DIR}/base/service_controller.h
     ${PROJECT_SOURCE_DIR}/base/service_impl.h
     ${PROJECT_SOURCE_DIR}/base/service_impl_win.cc
+    ${PROJECT_SOURCE_DIR}/base/sliding_window.cc
+    ${PROJECT_SOURCE_DIR}/base/sliding_window.h
+    ${PROJECT_SOURCE_DIR}/base/trace_event.cc
+    ${PROJECT_SOURCE_DIR}/base/trace_event.h
     ${PROJECT_SOURCE_DIR}/base/typed_buffer.h)
 
 list(APPEND SOURCE_BASE_WIN
@@ -54,6 +60,16 @@ list(APPEND SOURCE_BASE_WIN
     ${PROJECT_SOURCE_DIR}/base/win/security_helpers.cc
     ${PROJECT_SOURCE_DIR}/base/win/security_helpers.h)
 
+list(APPEND SOURCE_BENCHMARK
+    ${PROJECT_SOURCE_DIR}/benchmark/benchmark_host.cc
+    ${PROJECT_SOURCE_DIR}/benchmark/benchmark_host.h
+    ${PROJECT_SOURCE_DIR}/benchmark/file_transfer_benchmark.cc
+    ${PROJECT_SOURCE_DIR}/benchmark/file_transfer_benchmark.h
+    ${PROJECT_SOURCE_DIR}/benchmark/file_transfer_benchmark_main.cc
+    ${PROJECT_SOURCE_DIR}/benchmark/file_transfer_benchmark_main.h
+    ${PROJECT_SOURCE_DIR}/benchmark/file_transfer_link.cc
+    ${PROJECT_SOURCE_DIR}/benchmark/file_transfer_link.h)
+
 list(APPEND SOURCE_CLIENT
     ${PROJECT_SOURCE_DIR}/client/client.cc
     ${PROJECT_SOURCE_DIR}/client/client.h
@@ -70,6 +86,8 @@ list(APPEND SOURCE_CLIENT
     ${PROJECT_SOURCE_DIR}/client/computer_factory.h
     ${PROJECT_SOURCE_DIR}/client/connect_data.cc
     ${PROJECT_SOURCE_DIR}/client/connect_data.h
+    ${PROJECT_SOURCE_DIR}/client/file_list_cache.cc
+    ${PROJECT_SOURCE_DIR}/client/file_list_cache.h
     ${PROJECT_SOURCE_DIR}/client/file_remove_queue_builder.cc
     ${PROJECT_SOURCE_DIR}/client/file_remove_queue_builder.h
     ${PROJECT_SOURCE_DIR}/client/file_remove_task.cc
@@ -102,13 +120,12 @@ list(APPEND SOURCE_CLIENT_UI
     ${PROJECT_SOURCE_DIR}/client/ui/desktop_widget.h
     ${PROJECT_SOURCE_DIR}/client/ui/desktop_window.cc
     ${PROJECT_SOURCE_DIR}/client/ui/desktop_window.h
-    ${PROJECT_SOURCE_DIR}/client/ui/file_item.cc
-    ${PROJECT_SOURCE_DIR}/client/ui/file_item.h
-    ${PROJECT_SOURCE_DIR}/client/ui/file_item_delegate.h
     ${PROJECT_SOURCE_DIR}/client/ui/file_item_drag.cc
     ${PROJECT_SOURCE_DIR}/client/ui/file_item_drag.h
     ${PROJECT_SOURCE_DIR}/client/ui/file_item_mime_data.cc
     ${PROJECT_SOURCE_DIR}/client/ui/file_item_mime_data.h
+    ${PROJECT_SOURCE_DIR}/client/ui/file_list_model.cc
+    ${PROJECT_SOURCE_DIR}/client/ui/file_list_model.h
     ${PROJECT_SOURCE_DIR}/client/ui/file_manager_window.cc
     ${PROJECT_SOURCE_DIR}/client/ui/file_manager_window.h
     ${PROJECT_SOURCE_DIR}/client/ui/file_manager_window.ui
@@ -121,8 +138,8 @@ list(APPEND SOURCE_CLIENT_UI
     ${PROJECT_SOURCE_DIR}/client/ui/file_transfer_dialog.cc
     ${PROJECT_SOURCE_DIR}/client/ui/file_transfer_dialog.h
     ${PROJECT_SOURCE_DIR}/client/ui/file_transfer_dialog.ui
-    ${PROJECT_SOURCE_DIR}/client/ui/file_tree_widget.cc
-    ${PROJECT_SOURCE_DIR}/client/ui/file_tree_widget.h
+    ${PROJECT_SOURCE_DIR}/client/ui/file_tree_view.cc
+    ${PROJECT_SOURCE_DIR}/client/ui/file_tree_view.h
     ${PROJECT_SOURCE_DIR}/client/ui/key_sequence_dialog.cc
     ${PROJECT_SOURCE_DIR}/client/ui/key_sequence_dialog.h
     ${PROJECT_SOURCE_DIR}/client/ui/key_sequence_dialog.ui
@@ -198,6 +215,8 @@ list(APPEND SOURCE_CONSOLE
     ${PROJECT_SOURCE_DIR}/console/console_window.cc
     ${PROJECT_SOURCE_DIR}/console/console_window.h
     ${PROJECT_SOURCE_DIR}/console/console_window.ui
+    ${PROJECT_SOURCE_DIR}/console/key_derivation_dialog.cc
+    ${PROJECT_SOURCE_DIR}/console/key_derivation_dialog.h
     ${PROJECT_SOURCE_DIR}/console/open_address_book_dialog.cc
     ${PROJECT_SOURCE_DIR}/console/open_address_book_dialog.h
     ${PROJECT_SOURCE_DIR}/console/open_address_book_dialog.ui)
@@ -207,6 +226,8 @@ list(APPEND SOURCE_CRYPTO
     ${PROJECT_SOURCE_DIR}/crypto/data_encryptor.h
     ${PROJECT_SOURCE_DIR}/crypto/encryptor.cc
     ${PROJECT_SOURCE_DIR}/crypto/encryptor.h
+    ${PROJECT_SOURCE_DIR}/crypto/generic_hash.cc
+    ${PROJECT_SOURCE_DIR}/crypto/generic_hash.h
 	${PROJECT_SOURCE_DIR}/crypto/random.cc
     ${PROJECT_SOURCE_DIR}/crypto/random.h
 	${PROJECT_SOURCE_DIR}/crypto/secure_memory.cc
@@ -216,6 +237,8 @@ list(APPEND SOURCE_DESKTOP_CAPTURE
     ${PROJECT_SOURCE_DIR}/desktop_capture/capture_scheduler.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/capture_scheduler.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/capturer.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/capturer_fake.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/capturer_fake.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/capturer_gdi.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/capturer_gdi.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame.cc
@@ -224,6 +247,8 @@ list(APPEND SOURCE_DESKTOP_CAPTURE
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_aligned.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_dib.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_dib.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_queue.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_queue.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_qimage.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_qimage.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_avx2.cc
@@ -248,16 +273,26 @@ list(APPEND SOURCE_DESKTOP_CAPTURE_WIN
     ${PROJECT_SOURCE_DIR}/desktop_capture/win/scoped_thread_desktop.h)
 
 list(APPEND SOURCE_HOST
+    ${PROJECT_SOURCE_DIR}/host/file_delta.cc
+    ${PROJECT_SOURCE_DIR}/host/file_delta.h
     ${PROJECT_SOURCE_DIR}/host/file_depacketizer.cc
     ${PROJECT_SOURCE_DIR}/host/file_depacketizer.h
+    ${PROJECT_SOURCE_DIR}/host/file_io_thread.cc
+    ${PROJECT_SOURCE_DIR}/host/file_io_thread.h
     ${PROJECT_SOURCE_DIR}/host/file_packetizer.cc
     ${PROJECT_SOURCE_DIR}/host/file_packetizer.h
     ${PROJECT_SOURCE_DIR}/host/file_platform_util_win.cc
     ${PROJECT_SOURCE_DIR}/host/file_platform_util.h
+    ${PROJECT_SOURCE_DIR}/host/file_read_ahead.cc
+    ${PROJECT_SOURCE_DIR}/host/file_read_ahead.h
     ${PROJECT_SOURCE_DIR}/host/file_request.cc
     ${PROJECT_SOURCE_DIR}/host/file_request.h
+    ${PROJECT_SOURCE_DIR}/host/file_transfer_journal.cc
+    ${PROJECT_SOURCE_DIR}/host/file_transfer_journal.h
     ${PROJECT_SOURCE_DIR}/host/file_worker.cc
     ${PROJECT_SOURCE_DIR}/host/file_worker.h
+    ${PROJECT_SOURCE_DIR}/host/file_write_behind.cc
+    ${PROJECT_SOURCE_DIR}/host/file_write_behind.h
     ${PROJECT_SOURCE_DIR}/host/host_config_main.cc
     ${PROJECT_SOURCE_DIR}/host/host_config_main.h
     ${PROJECT_SOURCE_DIR}/host/host_notifier.cc
@@ -325,6 +360,8 @@ list(APPEND SOURCE_IPC
 list(APPEND SOURCE_NETWORK
     ${PROJECT_SOURCE_DIR}/network/firewall_manager.cc
     ${PROJECT_SOURCE_DIR}/network/firewall_manager.h
+    ${PROJECT_SOURCE_DIR}/network/metrics_exporter.cc
+    ${PROJECT_SOURCE_DIR}/network/metrics_exporter.h
     ${PROJECT_SOURCE_DIR}/network/network_channel.cc
     ${PROJECT_SOURCE_DIR}/network/network_channel.h
     ${PROJECT_SOURCE_DIR}/network/network_server.cc
@@ -0,0 +1,241 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/metrics.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "base/metrics.h"
+
+#include <QDebug>
+
+#include <algorithm>
+
+namespace aspia {
+
+namespace {
+
+std::string joinLabels(const std::string& first, const std::string& second)
+{
+    if (first.empty())
+        return second;
+
+    if (second.empty())
+        return first;
+
+    return first + ',' + second;
+}
+
+void appendSample(const std::string& name, const std::string& labels, const QByteArray& value,
+                  QByteArray* output)
+{
+    output->append(name.c_str());
+
+    if (!labels.empty())
+    {
+        output->append('{');
+        output->append(labels.c_str());
+        output->append('}');
+    }
+
+    output->append(' ');
+    output->append(value);
+    output->append('\n');
+}
+
+} // namespace
+
+void MetricsCounter::format(const std::string& name, const std::string& labels,
+                            QByteArray* output) const
+{
+    appendSample(name, labels, QByteArray::number(value()), output);
+}
+
+void MetricsGauge::format(const std::string& name, const std::string& labels,
+                          QByteArray* output) const
+{
+    appendSample(name, labels, QByteArray::number(value()), output);
+}
+
+MetricsHistogram::MetricsHistogram(const std::vector<qint64>& bounds)
+    : bounds_(bounds),
+      buckets_(new std::atomic<quint64>[bounds.size() + 1])
+{
+    Q_ASSERT(std::is_sorted(bounds_.begin(), bounds_.end()));
+
+    for (size_t i = 0; i <= bounds_.size(); ++i)
+        buckets_[i].store(0, std::memory_order_relaxed);
+}
+
+void MetricsHistogram::observe(qint64 value)
+{
+    size_t index = std::lower_bound(bounds_.begin(), bounds_.end(), value) - bounds_.begin();
+
+    buckets_[index].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+void MetricsHistogram::format(const std::string& name, const std::string& labels,
+                              QByteArray* output) const
+{
+    const std::string bucket_name = name + "_bucket";
+    quint64 count = 0;
+
+    for (size_t i = 0; i <= bounds_.size(); ++i)
+    {
+        count += buckets_[i].load(std::memory_order_relaxed);
+
+        std::string le = (i < bounds_.size()) ? std::to_string(bounds_[i]) : "+Inf";
+
+        appendSample(bucket_name, joinLabels(labels, "le=\"" + le + '"'),
+                     QByteArray::number(count), output);
+    }
+
+    appendSample(name + "_sum", labels,
+                 QByteArray::number(sum_.load(std::memory_order_relaxed)), output);
+    appendSample(name + "_count", labels, QByteArray::number(count), output);
+}
+
+// static
+const char* MetricsRegistry::typeToString(Type type)
+{
+    switch (type)
+    {
+        case Type::Counter:
+            return "counter";
+
+        case Type::Gauge:
+            return "gauge";
+
+        default:
+            return "histogram";
+    }
+}
+
+// static
+MetricsRegistry* MetricsRegistry::instance()
+{
+    static MetricsRegistry registry;
+    return &registry;
+}
+
+MetricsCounter* MetricsRegistry::counter(const std::string& name, const char* help)
+{
+    return static_cast<MetricsCounter*>(metric(name, help, Type::Counter, {}));
+}
+
+MetricsGauge* MetricsRegistry::gauge(const std::string& name, const char* help)
+{
+    return static_cast<MetricsGauge*>(metric(name, help, Type::Gauge, {}));
+}
+
+MetricsHistogram* MetricsRegistry::histogram(const std::string& name, const char* help,
+                                             const std::vector<qint64>& bounds)
+{
+    return static_cast<MetricsHistogram*>(metric(name, help, Type::Histogram, bounds));
+}
+
+void MetricsRegistry::remove(const std::string& name)
+{
+    size_t pos = name.find('{');
+
+    std::string family_name = name.substr(0, pos);
+    std::string labels;
+
+    if (pos != std::string::npos)
+        labels = name.substr(pos + 1, name.size() - pos - 2);
+
+    std::scoped_lock lock(lock_);
+
+    auto family = families_.find(family_name);
+    if (family == families_.end())
+        return;
+
+    family->second.metrics.erase(labels);
+
+    if (family->second.metrics.empty())
+        families_.erase(family);
+}
+
+QByteArray MetricsRegistry::format(const std::string& extra_labels) const
+{
+    QByteArray output;
+
+    std::scoped_lock lock(lock_);
+
+    for (const auto& family : families_)
+    {
+        output.append("# HELP ");
+        output.append(family.first.c_str());
+        output.append(' ');
+        output.append(family.second.help);
+        output.append('\n');
+
+        output.append("# TYPE ");
+        output.append(family.first.c_str());
+        output.append(' ');
+        output.append(typeToString(family.second.type));
+        output.append('\n');
+
+        for (const auto& metric : family.second.metrics)
+        {
+            metric.second->format(family.first,
+                                  joinLabels(metric.first, extra_labels),
+                                  &output);
+        }
+    }
+
+    return output;
+}
+
+Metric* MetricsRegistry::metric(const std::string& name, const char* help, Type type,
+                                const std::vector<qint64>& bounds)
+{
+    size_t pos = name.find('{');
+
+    std::string family_name = name.substr(0, pos);
+    std::string labels;
+
+    if (pos != std::string::npos)
+    {
+        Q_ASSERT(name.back() == '}');
+        labels = name.substr(pos + 1, name.size() - pos - 2);
+    }
+
+    std::scoped_lock lock(lock_);
+
+    auto family = families_.find(family_name);
+    if (family == families_.end())
+    {
+        family = families_.emplace(family_name, Family()).first;
+        family->second.type = type;
+        family->second.help = help;
+    }
+    else if (family->second.type != type)
+    {
+        qFatal("Metric %s is registered with a different type", family_name.c_str());
+    }
+
+    std::unique_ptr<Metric>& metric = family->second.metrics[labels];
+    if (!metric)
+    {
+        switch (type)
+        {
+            case Type::Counter:
+                metric.reset(new MetricsCounter());
+                break;
+
+            case Type::Gauge:
+                metric.reset(new MetricsGauge());
+                break;
+
+            case Type::Histogram:
+                metric.reset(new MetricsHistogram(bounds));
+                break;
+        }
+    }
+
+    return metric.get();
+}
+
+} // namespace aspia
@@ -0,0 +1,143 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/metrics.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__METRICS_H
+#define _ASPIA_BASE__METRICS_H
+
+#include <QByteArray>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace aspia {
+
+class Metric
+{
+public:
+    virtual ~Metric() = default;
+
+    // Appends the samples of the metric in the Prometheus text format to |output|.
+    virtual void format(const std::string& name, const std::string& labels,
+                        QByteArray* output) const = 0;
+};
+
+// A value which only goes up (number of frames, bytes, errors).
+class MetricsCounter : public Metric
+{
+public:
+    MetricsCounter() = default;
+
+    void increment(quint64 value = 1) { value_.fetch_add(value, std::memory_order_relaxed); }
+    quint64 value() const { return value_.load(std::memory_order_relaxed); }
+
+    // Metric implementation.
+    void format(const std::string& name, const std::string& labels,
+                QByteArray* output) const override;
+
+private:
+    std::atomic<quint64> value_{ 0 };
+
+    Q_DISABLE_COPY(MetricsCounter)
+};
+
+// A value which can go up and down (number of sessions, queue size).
+class MetricsGauge : public Metric
+{
+public:
+    MetricsGauge() = default;
+
+    void set(qint64 value) { value_.store(value, std::memory_order_relaxed); }
+    void add(qint64 value) { value_.fetch_add(value, std::memory_order_relaxed); }
+    qint64 value() const { return value_.load(std::memory_order_relaxed); }
+
+    // Metric implementation.
+    void format(const std::string& name, const std::string& labels,
+                QByteArray* output) const override;
+
+private:
+    std::atomic<qint64> value_{ 0 };
+
+    Q_DISABLE_COPY(MetricsGauge)
+};
+
+// Counts observed values in buckets with fixed upper bounds (durations, packet sizes).
+class MetricsHistogram : public Metric
+{
+public:
+    explicit MetricsHistogram(const std::vector<qint64>& bounds);
+
+    void observe(qint64 value);
+
+    // Metric implementation.
+    void format(const std::string& name, const std::string& labels,
+                QByteArray* output) const override;
+
+private:
+    const std::vector<qint64> bounds_;
+
+    // The last bucket counts the values greater than all bounds.
+    std::unique_ptr<std::atomic<quint64>[]> buckets_;
+    std::atomic<qint64> sum_{ 0 };
+
+    Q_DISABLE_COPY(MetricsHistogram)
+};
+
+// Process-wide set of metrics. Metrics are looked up once by name (for example, when the owning
+// object is created) and the returned pointer is used on hot paths, where updating a metric is a
+// single relaxed atomic operation. The name may contain labels in the Prometheus form:
+// aspia_host_sessions{type="desktop_manage"}. Metrics live until the end of the process unless
+// they are removed with |remove|.
+class MetricsRegistry
+{
+public:
+    static MetricsRegistry* instance();
+
+    MetricsCounter* counter(const std::string& name, const char* help);
+    MetricsGauge* gauge(const std::string& name, const char* help);
+    MetricsHistogram* histogram(const std::string& name, const char* help,
+                                const std::vector<qint64>& bounds);
+
+    // Removes the metric. Pointers previously returned for |name| become invalid.
+    void remove(const std::string& name);
+
+    // Returns all metrics in the Prometheus text exposition format. If |extra_labels| is not
+    // empty (for example, pid="1234"), it is added to the labels of each sample.
+    QByteArray format(const std::string& extra_labels = std::string()) const;
+
+private:
+    MetricsRegistry() = default;
+    ~MetricsRegistry() = default;
+
+    enum class Type { Counter, Gauge, Histogram };
+
+    struct Family
+    {
+        Type type;
+        const char* help;
+
+        // Metrics of the family by their labels.
+        std::map<std::string, std::unique_ptr<Metric>> metrics;
+    };
+
+    static const char* typeToString(Type type);
+
+    Metric* metric(const std::string& name, const char* help, Type type,
+                   const std::vector<qint64>& bounds);
+
+    mutable std::mutex lock_;
+    std::map<std::string, Family> families_;
+
+    Q_DISABLE_COPY(MetricsRegistry)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__METRICS_H
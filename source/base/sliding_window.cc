@@ -0,0 +1,59 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/sliding_window.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "base/sliding_window.h"
+
+namespace aspia {
+
+SlidingWindow::SlidingWindow(const std::chrono::milliseconds& window)
+    : window_(window)
+{
+    Q_ASSERT(window_.count() > 0);
+}
+
+void SlidingWindow::add(qint64 value)
+{
+    samples_.emplace_back(Clock::now(), value);
+    sum_ += value;
+
+    removeExpired();
+}
+
+qint64 SlidingWindow::countPerSecond()
+{
+    removeExpired();
+    return static_cast<qint64>(samples_.size()) * 1000 / window_.count();
+}
+
+qint64 SlidingWindow::sumPerSecond()
+{
+    removeExpired();
+    return sum_ * 1000 / window_.count();
+}
+
+qint64 SlidingWindow::average()
+{
+    removeExpired();
+
+    if (samples_.empty())
+        return 0;
+
+    return sum_ / static_cast<qint64>(samples_.size());
+}
+
+void SlidingWindow::removeExpired()
+{
+    const Clock::time_point expire_time = Clock::now() - window_;
+
+    while (!samples_.empty() && samples_.front().first < expire_time)
+    {
+        sum_ -= samples_.front().second;
+        samples_.pop_front();
+    }
+}
+
+} // namespace aspia
@@ -0,0 +1,53 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/sliding_window.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__SLIDING_WINDOW_H
+#define _ASPIA_BASE__SLIDING_WINDOW_H
+
+#include <QtGlobal>
+
+#include <chrono>
+#include <deque>
+#include <utility>
+
+namespace aspia {
+
+// Keeps the samples added during the last |window| and calculates statistics over them.
+// The class is not thread-safe.
+class SlidingWindow
+{
+public:
+    explicit SlidingWindow(const std::chrono::milliseconds& window = std::chrono::seconds(2));
+    ~SlidingWindow() = default;
+
+    void add(qint64 value);
+
+    // Number of samples per second.
+    qint64 countPerSecond();
+
+    // Sum of samples per second.
+    qint64 sumPerSecond();
+
+    // Average value of samples. Returns 0 if there are no samples in the window.
+    qint64 average();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void removeExpired();
+
+    const std::chrono::milliseconds window_;
+
+    std::deque<std::pair<Clock::time_point, qint64>> samples_;
+    qint64 sum_ = 0;
+
+    Q_DISABLE_COPY(SlidingWindow)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__SLIDING_WINDOW_H
@@ -0,0 +1,149 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/trace_event.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "base/trace_event.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+
+#include <atomic>
+#include <chrono>
+
+namespace aspia {
+
+namespace {
+
+// The buffer keeps the last spans. Each span takes 32 bytes.
+constexpr size_t kMaxEvents = 128 * 1024;
+
+const std::chrono::steady_clock::time_point kStartTime = std::chrono::steady_clock::now();
+
+int currentThreadId()
+{
+    static std::atomic_int last_thread_id = 0;
+    thread_local int thread_id = ++last_thread_id;
+    return thread_id;
+}
+
+} // namespace
+
+TraceLog::TraceLog()
+    : events_(kMaxEvents)
+{
+    // Nothing
+}
+
+// static
+TraceLog* TraceLog::instance()
+{
+    static TraceLog trace_log;
+    return &trace_log;
+}
+
+// static
+qint64 TraceLog::now()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - kStartTime).count();
+}
+
+void TraceLog::addEvent(const char* name, qint64 begin_time, quint32 id)
+{
+    const qint64 end_time = now();
+    const int thread_id = currentThreadId();
+
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    Event& event = events_[next_event_];
+
+    event.name = name;
+    event.begin_time = begin_time;
+    event.duration = end_time - begin_time;
+    event.id = id;
+    event.thread_id = thread_id;
+
+    if (++next_event_ == events_.size())
+    {
+        next_event_ = 0;
+        wrapped_ = true;
+    }
+}
+
+bool TraceLog::writeToFile(const QString& file_path)
+{
+    QFile file(file_path);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate))
+    {
+        qWarning() << "Unable to open file for trace: " << file.errorString();
+        return false;
+    }
+
+    std::vector<Event> events;
+
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        if (wrapped_)
+        {
+            events.assign(events_.begin() + next_event_, events_.end());
+            events.insert(events.end(), events_.begin(), events_.begin() + next_event_);
+        }
+        else
+        {
+            events.assign(events_.begin(), events_.begin() + next_event_);
+        }
+    }
+
+    const qint64 process_id = QCoreApplication::applicationPid();
+
+    QByteArray buffer("{\"traceEvents\":[");
+
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        const Event& event = events[i];
+
+        if (i != 0)
+            buffer += ",\n";
+
+        buffer += "{\"name\":\"" + QByteArray(event.name) +
+                  "\",\"ph\":\"X\",\"ts\":" + QByteArray::number(event.begin_time) +
+                  ",\"dur\":" + QByteArray::number(event.duration) +
+                  ",\"pid\":" + QByteArray::number(process_id) +
+                  ",\"tid\":" + QByteArray::number(event.thread_id);
+
+        if (event.id)
+            buffer += ",\"args\":{\"frame_id\":" + QByteArray::number(event.id) + "}";
+
+        buffer += "}";
+    }
+
+    buffer += "]}\n";
+
+    if (file.write(buffer) != buffer.size())
+    {
+        qWarning() << "Unable to write trace: " << file.errorString();
+        return false;
+    }
+
+    return true;
+}
+
+void TraceLog::dump()
+{
+    QString file_path = QDir::temp().filePath(
+        QStringLiteral("aspia_trace_%1_%2.json")
+        .arg(QCoreApplication::applicationPid())
+        .arg(QDateTime::currentDateTime().toString(QStringLiteral("yyyyMMdd_hhmmss"))));
+
+    if (writeToFile(file_path))
+        qDebug() << "Trace written to " << file_path;
+}
+
+} // namespace aspia
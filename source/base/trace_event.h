@@ -0,0 +1,123 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/trace_event.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__TRACE_EVENT_H
+#define _ASPIA_BASE__TRACE_EVENT_H
+
+#include <QString>
+
+#include <mutex>
+#include <vector>
+
+namespace aspia {
+
+// Collects the duration of code spans into a ring buffer, which can be dumped in the Chrome
+// trace_event format (open it with chrome://tracing). Spans are added with the TRACE_EVENT
+// macros below. They compile to nothing unless ASPIA_ENABLE_TRACING is defined.
+class TraceLog
+{
+public:
+    static TraceLog* instance();
+
+    // Returns the current time in microseconds since the start of the process.
+    static qint64 now();
+
+    // Adds a span which started at |begin_time| and ends now. |name| must be a string literal.
+    // If |id| is not zero, it is written to the span arguments as frame_id.
+    void addEvent(const char* name, qint64 begin_time, quint32 id = 0);
+
+    // Writes the collected spans to |file_path| in the Chrome trace_event JSON format.
+    bool writeToFile(const QString& file_path);
+
+    // Writes the collected spans to a new file in the temporary directory.
+    void dump();
+
+private:
+    TraceLog();
+    ~TraceLog() = default;
+
+    struct Event
+    {
+        const char* name = nullptr;
+        qint64 begin_time = 0;
+        qint64 duration = 0;
+        quint32 id = 0;
+        int thread_id = 0;
+    };
+
+    std::mutex lock_;
+    std::vector<Event> events_;
+    size_t next_event_ = 0;
+    bool wrapped_ = false;
+
+    Q_DISABLE_COPY(TraceLog)
+};
+
+class TraceScope
+{
+public:
+    explicit TraceScope(const char* name, quint32 id = 0)
+        : name_(name),
+          id_(id),
+          begin_time_(TraceLog::now())
+    {
+        // Nothing
+    }
+
+    ~TraceScope()
+    {
+        TraceLog::instance()->addEvent(name_, begin_time_, id_);
+    }
+
+    void setId(quint32 id) { id_ = id; }
+
+private:
+    const char* const name_;
+    quint32 id_;
+    const qint64 begin_time_;
+
+    Q_DISABLE_COPY(TraceScope)
+};
+
+} // namespace aspia
+
+#define TRACE_CONCAT_INTERNAL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INTERNAL(a, b)
+
+#if defined(ASPIA_ENABLE_TRACING)
+
+// Traces the rest of the current scope.
+#define TRACE_EVENT(name) \
+    aspia::TraceScope TRACE_CONCAT(trace_scope_, __LINE__)(name)
+
+// Same as TRACE_EVENT, but the span is tagged with the frame ID.
+#define TRACE_EVENT_ID(name, id) \
+    aspia::TraceScope TRACE_CONCAT(trace_scope_, __LINE__)(name, id)
+
+// Traces a span which starts and ends in different places (for example, an asynchronous write).
+// TRACE_EVENT_BEGIN stores the start time to |begin_time| and TRACE_EVENT_COMPLETE adds the span.
+#define TRACE_EVENT_BEGIN(begin_time) \
+    begin_time = aspia::TraceLog::now()
+
+#define TRACE_EVENT_COMPLETE(name, begin_time, id) \
+    aspia::TraceLog::instance()->addEvent(name, begin_time, id)
+
+// Writes the collected spans to a new file in the temporary directory.
+#define TRACE_DUMP() \
+    aspia::TraceLog::instance()->dump()
+
+#else // defined(ASPIA_ENABLE_TRACING)
+
+#define TRACE_EVENT(name)
+#define TRACE_EVENT_ID(name, id)
+#define TRACE_EVENT_BEGIN(begin_time)
+#define TRACE_EVENT_COMPLETE(name, begin_time, id)
+#define TRACE_DUMP()
+
+#endif // defined(ASPIA_ENABLE_TRACING)
+
+#endif // _ASPIA_BASE__TRACE_EVENT_H
@@ -0,0 +1,93 @@
+//
+// PROJECT:         Aspia
+// FILE:            benchmark/benchmark_host.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "benchmark/benchmark_host.h"
+
+#include "base/message_serialization.h"
+#include "host/file_worker.h"
+#include "network/network_channel.h"
+#include "network/network_server.h"
+#include "protocol/file_transfer_session.pb.h"
+
+namespace aspia {
+
+namespace {
+
+enum MessageId { ReplyMessageId };
+
+} // namespace
+
+BenchmarkHost::BenchmarkHost(QObject* parent)
+    : QObject(parent),
+      worker_(new FileWorker(this))
+{
+    // Nothing
+}
+
+void BenchmarkHost::executeRequest(const QByteArray& buffer)
+{
+    proto::file_transfer::Request request;
+
+    if (!parseMessage(buffer, request))
+    {
+        emit errorOccurred(QStringLiteral("Invalid request"));
+        return;
+    }
+
+    emit replyReady(serializeMessage(worker_->doRequest(request)));
+}
+
+void BenchmarkHost::startServer(quint16 port)
+{
+    server_ = new NetworkServer(this);
+
+    connect(server_, &NetworkServer::newChannelReady, this, &BenchmarkHost::onNewChannelReady);
+
+    if (!server_->start(port))
+    {
+        emit errorOccurred(QStringLiteral("Unable to listen on port %1").arg(port));
+        return;
+    }
+
+    emit listening(port);
+}
+
+void BenchmarkHost::onNewChannelReady()
+{
+    NetworkChannel* channel = server_->nextReadyChannel();
+    if (!channel || channel_)
+        return;
+
+    channel_ = channel;
+
+    connect(channel_, &NetworkChannel::messageReceived, this, &BenchmarkHost::onMessageReceived);
+    connect(channel_, &NetworkChannel::messageWritten, this, &BenchmarkHost::onMessageWritten);
+
+    channel_->readMessage();
+}
+
+void BenchmarkHost::onMessageReceived(const QByteArray& buffer)
+{
+    proto::file_transfer::Request request;
+
+    if (!parseMessage(buffer, request))
+    {
+        emit errorOccurred(QStringLiteral("Invalid request"));
+        return;
+    }
+
+    // The next request is read after the reply is written, as HostSessionFileTransfer does.
+    channel_->writeMessage(ReplyMessageId, serializeMessage(worker_->doRequest(request)));
+}
+
+void BenchmarkHost::onMessageWritten(int message_id)
+{
+    Q_ASSERT(message_id == ReplyMessageId);
+    channel_->readMessage();
+}
+
+} // namespace aspia
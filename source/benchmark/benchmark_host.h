@@ -0,0 +1,61 @@
+//
+// PROJECT:         Aspia
+// FILE:            benchmark/benchmark_host.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BENCHMARK__BENCHMARK_HOST_H
+#define _ASPIA_BENCHMARK__BENCHMARK_HOST_H
+
+#include <QByteArray>
+#include <QObject>
+#include <QPointer>
+
+namespace aspia {
+
+class FileWorker;
+class NetworkChannel;
+class NetworkServer;
+
+// The host side of the file transfer benchmark. It is moved to its own thread and executes the
+// requests with its own FileWorker, as the host process does. The requests are received either
+// directly from FileTransferLink (like HostSessionFakeFileTransfer receives them) or through
+// a NetworkChannel connected over the loopback interface (like HostSessionFileTransfer).
+class BenchmarkHost : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit BenchmarkHost(QObject* parent = nullptr);
+    ~BenchmarkHost() = default;
+
+public slots:
+    // Executes the serialized request and emits |replyReady| with the serialized reply.
+    void executeRequest(const QByteArray& buffer);
+
+    // Starts listening on |port|. When the server is started, |listening| is emitted. Only one
+    // channel is accepted.
+    void startServer(quint16 port);
+
+signals:
+    void replyReady(const QByteArray& buffer);
+    void listening(quint16 port);
+    void errorOccurred(const QString& message);
+
+private slots:
+    void onNewChannelReady();
+    void onMessageReceived(const QByteArray& buffer);
+    void onMessageWritten(int message_id);
+
+private:
+    QPointer<FileWorker> worker_;
+    QPointer<NetworkServer> server_;
+    QPointer<NetworkChannel> channel_;
+
+    Q_DISABLE_COPY(BenchmarkHost)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BENCHMARK__BENCHMARK_HOST_H
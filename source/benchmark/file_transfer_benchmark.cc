@@ -0,0 +1,555 @@
+//
+// PROJECT:         Aspia
+// FILE:            benchmark/file_transfer_benchmark.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "benchmark/file_transfer_benchmark.h"
+
+#if defined(Q_OS_WIN)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif // defined(Q_OS_WIN)
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QThread>
+#include <QTimer>
+
+#include <cmath>
+#include <cstdio>
+
+#include "benchmark/benchmark_host.h"
+#include "client/client_session_file_transfer.h"
+#include "host/file_worker.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr qint64 kMegabyte = 1024 * 1024;
+
+// The files are written with this buffer.
+constexpr qint64 kWriteBufferSize = kMegabyte;
+
+// Each directory of the small files contains this number of files.
+constexpr int kSmallFilesPerDirectory = 200;
+
+// The generated data does not compress, so the compression does not change the results.
+class RandomGenerator
+{
+public:
+    explicit RandomGenerator(quint64 seed)
+        : state_(seed * 2685821657736338717ULL + 1)
+    {
+        // Nothing
+    }
+
+    quint64 next()
+    {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 2685821657736338717ULL;
+    }
+
+    void fill(char* data, qint64 size)
+    {
+        for (qint64 i = 0; i < size; i += sizeof(quint64))
+        {
+            const quint64 value = next();
+            memcpy(data + i, &value, qMin<qint64>(sizeof(value), size - i));
+        }
+    }
+
+private:
+    quint64 state_;
+};
+
+// Returns the CPU time of all threads of the process in microseconds.
+qint64 processCpuTime()
+{
+#if defined(Q_OS_WIN)
+    FILETIME creation_time;
+    FILETIME exit_time;
+    FILETIME kernel_time;
+    FILETIME user_time;
+
+    if (!GetProcessTimes(GetCurrentProcess(),
+                         &creation_time, &exit_time, &kernel_time, &user_time))
+    {
+        return 0;
+    }
+
+    auto toMicroseconds = [](const FILETIME& time)
+    {
+        ULARGE_INTEGER value;
+        value.LowPart = time.dwLowDateTime;
+        value.HighPart = time.dwHighDateTime;
+
+        // The time is in 100-nanosecond intervals.
+        return static_cast<qint64>(value.QuadPart / 10);
+    };
+
+    return toMicroseconds(kernel_time) + toMicroseconds(user_time);
+#else
+    rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000LL +
+        usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+#endif // defined(Q_OS_WIN)
+}
+
+bool writeFile(const QString& path, qint64 size, RandomGenerator* random)
+{
+    QFile file(path);
+
+    if (!file.open(QFile::WriteOnly | QFile::Truncate))
+        return false;
+
+    QByteArray buffer;
+    buffer.resize(qMin(size, kWriteBufferSize));
+
+    while (size > 0)
+    {
+        const qint64 part_size = qMin(size, kWriteBufferSize);
+
+        random->fill(buffer.data(), part_size);
+
+        if (file.write(buffer.constData(), part_size) != part_size)
+            return false;
+
+        size -= part_size;
+    }
+
+    return true;
+}
+
+void countFiles(const QString& path, int* file_count, qint64* total_size)
+{
+    *file_count = 0;
+    *total_size = 0;
+
+    QDirIterator it(path, QDir::Files | QDir::Hidden, QDirIterator::Subdirectories);
+
+    while (it.hasNext())
+    {
+        it.next();
+
+        ++*file_count;
+        *total_size += it.fileInfo().size();
+    }
+}
+
+bool isSameFile(const QString& source_path, const QString& target_path)
+{
+    QFile source_file(source_path);
+    QFile target_file(target_path);
+
+    if (!source_file.open(QFile::ReadOnly) || !target_file.open(QFile::ReadOnly) ||
+        source_file.size() != target_file.size())
+    {
+        return false;
+    }
+
+    while (!source_file.atEnd())
+    {
+        const QByteArray source_data = source_file.read(kWriteBufferSize);
+
+        if (source_data.isEmpty() || target_file.read(kWriteBufferSize) != source_data)
+            return false;
+    }
+
+    return true;
+}
+
+// Returns the number of the files of the source which are missing in the target or differ from
+// the target files.
+int countMismatches(const QString& source_path, const QString& target_path)
+{
+    const QDir source_directory(source_path);
+    const QDir target_directory(target_path);
+
+    int count = 0;
+
+    QDirIterator it(source_path, QDir::Files | QDir::Hidden, QDirIterator::Subdirectories);
+
+    while (it.hasNext())
+    {
+        it.next();
+
+        const QString target_file_path =
+            target_directory.filePath(source_directory.relativeFilePath(it.filePath()));
+
+        if (!isSameFile(it.filePath(), target_file_path))
+            ++count;
+    }
+
+    return count;
+}
+
+const char* typeName(FileTransfer::Type type)
+{
+    return type == FileTransfer::Downloader ? "download" : "upload";
+}
+
+const char* plumbingName(FileTransferLink::Plumbing plumbing)
+{
+    return plumbing == FileTransferLink::Plumbing::Memory ? "memory" : "channel";
+}
+
+const char* distributionName(FileTransferBenchmark::Distribution distribution)
+{
+    switch (distribution)
+    {
+        case FileTransferBenchmark::Distribution::Large:
+            return "large";
+
+        case FileTransferBenchmark::Distribution::Medium:
+            return "medium";
+
+        case FileTransferBenchmark::Distribution::Small:
+            return "small";
+
+        case FileTransferBenchmark::Distribution::Mixed:
+            return "mixed";
+    }
+
+    return "";
+}
+
+void printLine(const QString& line)
+{
+    fprintf(stdout, "%s\n", qPrintable(line));
+    fflush(stdout);
+}
+
+} // namespace
+
+FileTransferBenchmark::FileTransferBenchmark(const QString& temp_path,
+                                             double scale,
+                                             QObject* parent)
+    : QObject(parent),
+      temp_path_(temp_path),
+      scale_(scale)
+{
+    qRegisterMetaType<proto::file_transfer::Request>();
+    qRegisterMetaType<proto::file_transfer::Reply>();
+}
+
+FileTransferBenchmark::~FileTransferBenchmark()
+{
+    cleanup();
+}
+
+void FileTransferBenchmark::addScenario(const Scenario& scenario)
+{
+    scenarios_.push_back(scenario);
+}
+
+void FileTransferBenchmark::start()
+{
+    // The source files are read from the page cache after they are generated, so the results
+    // show the cost of the transfer rather than of the disk.
+    printLine(QStringLiteral("direction plumbing     rtt  bandwidth distribution   files"
+                             "       size      time        speed         rate"
+                             "          cpu        link"));
+
+    current_scenario_ = 0;
+    startNextScenario();
+}
+
+void FileTransferBenchmark::onLinkReady()
+{
+    const Scenario& scenario = scenarios_[current_scenario_];
+    const Dataset& data = datasets_[scenario.distribution];
+
+    cpu_time_ = processCpuTime();
+    timer_.start();
+
+    QList<FileTransfer::Item> items;
+    items.append(FileTransfer::Item(QStringLiteral("data"), 0, true));
+
+    transfer_->start(data.directory->path(), target_directory_->path(), items);
+}
+
+void FileTransferBenchmark::onLinkError(const QString& message)
+{
+    if (error_.isEmpty())
+        error_ = message;
+
+    // The transfer can not continue.
+    QTimer::singleShot(0, this, &FileTransferBenchmark::finishScenario);
+}
+
+void FileTransferBenchmark::onTransferError(FileTransfer* transfer,
+                                            FileTransfer::Error error_type,
+                                            const QString& message)
+{
+    if (error_.isEmpty())
+        error_ = message;
+
+    // The action is applied after the signal is handled.
+    QTimer::singleShot(0, transfer, [transfer, error_type]()
+    {
+        transfer->applyAction(error_type, FileTransfer::Abort);
+    });
+}
+
+void FileTransferBenchmark::onTransferFinished()
+{
+    // The transfer is deleted after the signal is handled.
+    QTimer::singleShot(0, this, &FileTransferBenchmark::finishScenario);
+}
+
+const FileTransferBenchmark::Dataset* FileTransferBenchmark::dataset(Distribution distribution)
+{
+    auto result = datasets_.find(distribution);
+    if (result != datasets_.end())
+        return &result->second;
+
+    int file_count = 0;
+
+    switch (distribution)
+    {
+        case Distribution::Large:
+            file_count = 4;
+            break;
+
+        case Distribution::Medium:
+            file_count = 128;
+            break;
+
+        case Distribution::Small:
+            file_count = 2000;
+            break;
+
+        case Distribution::Mixed:
+            file_count = 400;
+            break;
+    }
+
+    file_count = qMax(1, static_cast<int>(std::lround(file_count * scale_)));
+
+    Dataset data;
+    data.directory = std::make_unique<QTemporaryDir>(
+        QDir(temp_path_).filePath(QStringLiteral("aspia-benchmark-XXXXXX")));
+
+    if (!data.directory->isValid())
+        return nullptr;
+
+    QDir data_directory(data.directory->path());
+
+    if (!data_directory.mkdir(QStringLiteral("data")) ||
+        !data_directory.cd(QStringLiteral("data")))
+    {
+        return nullptr;
+    }
+
+    RandomGenerator random(static_cast<quint64>(distribution) + 1);
+
+    for (int i = 0; i < file_count; ++i)
+    {
+        QString file_path = data_directory.filePath(QStringLiteral("file_%1").arg(i));
+        qint64 file_size;
+
+        switch (distribution)
+        {
+            case Distribution::Large:
+                file_size = 32 * kMegabyte;
+                break;
+
+            case Distribution::Medium:
+                file_size = kMegabyte;
+                break;
+
+            case Distribution::Small:
+            {
+                const QString directory_name =
+                    QStringLiteral("directory_%1").arg(i / kSmallFilesPerDirectory);
+
+                if (i % kSmallFilesPerDirectory == 0 && !data_directory.mkdir(directory_name))
+                    return nullptr;
+
+                file_path = data_directory.filePath(
+                    directory_name + QStringLiteral("/file_%1").arg(i));
+                file_size = 4 * 1024;
+            }
+            break;
+
+            case Distribution::Mixed:
+            default:
+            {
+                // From 256 bytes to 2 MB.
+                const double exponent = 8.0 + 13.0 * (random.next() >> 11) / 9007199254740992.0;
+                file_size = static_cast<qint64>(std::pow(2.0, exponent));
+            }
+            break;
+        }
+
+        if (!writeFile(file_path, file_size, &random))
+            return nullptr;
+
+        ++data.file_count;
+        data.total_size += file_size;
+    }
+
+    return &(datasets_[distribution] = std::move(data));
+}
+
+void FileTransferBenchmark::startNextScenario()
+{
+    if (current_scenario_ >= scenarios_.size())
+    {
+        emit finished();
+        return;
+    }
+
+    const Scenario& scenario = scenarios_[current_scenario_];
+
+    error_.clear();
+    timer_.invalidate();
+
+    target_directory_ = std::make_unique<QTemporaryDir>(
+        QDir(temp_path_).filePath(QStringLiteral("aspia-benchmark-XXXXXX")));
+
+    if (!dataset(scenario.distribution) || !target_directory_->isValid())
+    {
+        printLine(QStringLiteral("Unable to create the files in %1").arg(temp_path_));
+        emit finished();
+        return;
+    }
+
+    // The local requests are executed on a separate thread, as in the client.
+    local_thread_ = new QThread(this);
+    local_worker_ = new FileWorker();
+    local_worker_->moveToThread(local_thread_);
+    local_thread_->start();
+
+    host_thread_ = new QThread(this);
+    host_ = new BenchmarkHost();
+    host_->moveToThread(host_thread_);
+    connect(host_thread_, &QThread::finished, host_, &BenchmarkHost::deleteLater);
+    host_thread_->start();
+
+    link_ = new FileTransferLink(scenario.link, host_, this);
+
+    connect(link_, &FileTransferLink::ready, this, &FileTransferBenchmark::onLinkReady);
+    connect(link_, &FileTransferLink::errorOccurred, this, &FileTransferBenchmark::onLinkError);
+
+    transfer_ = new FileTransfer(scenario.type, this);
+
+    connect(transfer_, &FileTransfer::localRequest, local_worker_, &FileWorker::executeRequest);
+    connect(transfer_, &FileTransfer::remoteRequest, link_, &FileTransferLink::remoteRequest);
+    connect(transfer_, &FileTransfer::error, this, &FileTransferBenchmark::onTransferError);
+    connect(transfer_, &FileTransfer::finished, this, &FileTransferBenchmark::onTransferFinished);
+
+    link_->start();
+}
+
+void FileTransferBenchmark::finishScenario()
+{
+    // The link and the transfer can both report the end.
+    if (!transfer_)
+        return;
+
+    const Scenario& scenario = scenarios_[current_scenario_];
+    const Dataset& data = datasets_[scenario.distribution];
+
+    const double time = timer_.isValid() ? timer_.nsecsElapsed() / 1e9 : 0.0;
+    const double cpu_time = (processCpuTime() - cpu_time_) / 1e6;
+    const double link_size = (link_->sentBytes() + link_->receivedBytes()) /
+        static_cast<double>(kMegabyte);
+
+    int file_count;
+    qint64 total_size;
+    countFiles(target_directory_->path(), &file_count, &total_size);
+
+    // The contents are compared only if the transfer succeeded.
+    int mismatch_count = 0;
+    if (error_.isEmpty() && file_count == data.file_count && total_size == data.total_size)
+    {
+        mismatch_count = countMismatches(
+            QDir(data.directory->path()).filePath(QStringLiteral("data")),
+            QDir(target_directory_->path()).filePath(QStringLiteral("data")));
+    }
+
+    cleanup();
+
+    QString bandwidth = QStringLiteral("unlimited");
+    if (scenario.link.bandwidth)
+    {
+        bandwidth = QString::asprintf(
+            "%.0f MB/s", scenario.link.bandwidth / static_cast<double>(kMegabyte));
+    }
+
+    QString line = QString::asprintf("%-9s %-8s %4d ms %10s %-12s",
+                                     typeName(scenario.type),
+                                     plumbingName(scenario.link.plumbing),
+                                     scenario.link.round_trip_time,
+                                     qPrintable(bandwidth),
+                                     distributionName(scenario.distribution));
+
+    if (!error_.isEmpty() || file_count != data.file_count || total_size != data.total_size)
+    {
+        line += QStringLiteral(" FAILED: %1 of %2 files received. %3")
+            .arg(file_count).arg(data.file_count).arg(error_);
+    }
+    else if (mismatch_count)
+    {
+        line += QStringLiteral(" FAILED: %1 of %2 files differ from the source.")
+            .arg(mismatch_count).arg(data.file_count);
+    }
+    else
+    {
+        const double size = data.total_size / static_cast<double>(kMegabyte);
+
+        line += QString::asprintf(" %7d %7.1f MB %7.2f s %7.1f MB/s %7.1f files/s"
+                                  " %6.2f s %3.0f%% %7.1f MB",
+                                  data.file_count, size, time,
+                                  time > 0 ? size / time : 0.0,
+                                  time > 0 ? data.file_count / time : 0.0,
+                                  cpu_time,
+                                  time > 0 ? cpu_time * 100.0 / time : 0.0,
+                                  link_size);
+    }
+
+    printLine(line);
+
+    ++current_scenario_;
+    QTimer::singleShot(0, this, &FileTransferBenchmark::startNextScenario);
+}
+
+void FileTransferBenchmark::cleanup()
+{
+    delete transfer_;
+    delete link_;
+
+    // The host is deleted in its thread when the thread is finished.
+    if (host_thread_)
+    {
+        host_thread_->quit();
+        host_thread_->wait();
+        delete host_thread_;
+    }
+
+    if (local_thread_)
+    {
+        local_thread_->quit();
+        local_thread_->wait();
+        delete local_thread_;
+    }
+
+    delete local_worker_;
+
+    target_directory_.reset();
+}
+
+} // namespace aspia
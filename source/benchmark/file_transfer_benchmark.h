@@ -0,0 +1,115 @@
+//
+// PROJECT:         Aspia
+// FILE:            benchmark/file_transfer_benchmark.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BENCHMARK__FILE_TRANSFER_BENCHMARK_H
+#define _ASPIA_BENCHMARK__FILE_TRANSFER_BENCHMARK_H
+
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QTemporaryDir>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "benchmark/file_transfer_link.h"
+#include "client/file_transfer.h"
+
+class QThread;
+
+namespace aspia {
+
+class BenchmarkHost;
+class FileWorker;
+
+// Measures the file transfer without a remote host. The client FileTransfer engine transfers
+// the generated files between two temporary directories: the local side is served by a
+// FileWorker on its own thread, as in the client, and the remote side by BenchmarkHost through
+// FileTransferLink, which adds the network delay and the bandwidth limit. The scenarios are run
+// one after another and the results are written to the standard output. After each scenario the
+// received files are compared with the source byte by byte.
+class FileTransferBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class Distribution
+    {
+        Large,  // A few files of tens of megabytes.
+        Medium, // Files of one megabyte.
+        Small,  // Thousands of files of a few kilobytes in several directories.
+        Mixed   // Sizes from hundreds of bytes to megabytes with the log-uniform distribution.
+    };
+
+    struct Scenario
+    {
+        FileTransfer::Type type;
+        Distribution distribution;
+        FileTransferLink::Config link;
+    };
+
+    // The files are generated in |temp_path|. The number of the files of each distribution is
+    // multiplied by |scale|.
+    FileTransferBenchmark(const QString& temp_path, double scale, QObject* parent = nullptr);
+    ~FileTransferBenchmark();
+
+    void addScenario(const Scenario& scenario);
+
+public slots:
+    void start();
+
+signals:
+    void finished();
+
+private slots:
+    void onLinkReady();
+    void onLinkError(const QString& message);
+    void onTransferError(FileTransfer* transfer,
+                         FileTransfer::Error error_type,
+                         const QString& message);
+    void onTransferFinished();
+
+private:
+    struct Dataset
+    {
+        std::unique_ptr<QTemporaryDir> directory;
+        int file_count = 0;
+        qint64 total_size = 0;
+    };
+
+    const Dataset* dataset(Distribution distribution);
+    void startNextScenario();
+    void finishScenario();
+    void cleanup();
+
+    const QString temp_path_;
+    const double scale_;
+
+    std::vector<Scenario> scenarios_;
+    size_t current_scenario_ = 0;
+
+    std::map<Distribution, Dataset> datasets_;
+
+    // The objects of the current scenario.
+    std::unique_ptr<QTemporaryDir> target_directory_;
+    QPointer<QThread> local_thread_;
+    QPointer<FileWorker> local_worker_;
+    QPointer<QThread> host_thread_;
+    QPointer<BenchmarkHost> host_;
+    QPointer<FileTransferLink> link_;
+    QPointer<FileTransfer> transfer_;
+
+    QElapsedTimer timer_;
+    qint64 cpu_time_ = 0;
+    QString error_;
+
+    Q_DISABLE_COPY(FileTransferBenchmark)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BENCHMARK__FILE_TRANSFER_BENCHMARK_H
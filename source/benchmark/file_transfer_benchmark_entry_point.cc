@@ -0,0 +1,13 @@
+//
+// PROJECT:         Aspia
+// FILE:            benchmark/file_transfer_benchmark_entry_point.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "benchmark/file_transfer_benchmark_main.h"
+
+int main(int argc, char *argv[])
+{
+    return aspia::fileTransferBenchmarkMain(argc, argv);
+}
@@ -0,0 +1,205 @@
+//
+// PROJECT:         Aspia
+// FILE:            benchmark/file_transfer_benchmark_main.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "benchmark/file_transfer_benchmark_main.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QDir>
+#include <QTimer>
+
+#include "benchmark/file_transfer_benchmark.h"
+#include "version.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr quint16 kDefaultPort = 18050;
+
+bool parseList(const QString& value,
+               const QStringList& allowed,
+               QStringList* list)
+{
+    *list = value.split(QLatin1Char(','), QString::SkipEmptyParts);
+
+    for (const auto& item : *list)
+    {
+        if (!allowed.contains(item))
+            return false;
+    }
+
+    return !list->isEmpty();
+}
+
+bool parseNumbers(const QString& value, QList<double>* list)
+{
+    list->clear();
+
+    for (const auto& item : value.split(QLatin1Char(','), QString::SkipEmptyParts))
+    {
+        bool ok;
+
+        const double number = item.toDouble(&ok);
+        if (!ok || number < 0)
+            return false;
+
+        list->append(number);
+    }
+
+    return !list->isEmpty();
+}
+
+} // namespace
+
+int fileTransferBenchmarkMain(int argc, char *argv[])
+{
+    QCoreApplication application(argc, argv);
+    application.setOrganizationName(QStringLiteral("Aspia"));
+    application.setApplicationName(QStringLiteral("File Transfer Benchmark"));
+    application.setApplicationVersion(QStringLiteral(ASPIA_VERSION_STRING));
+
+    QCommandLineOption direction_option(
+        QStringLiteral("direction"),
+        QStringLiteral("Comma-separated list of directions: download, upload."),
+        QStringLiteral("list"),
+        QStringLiteral("download,upload"));
+
+    QCommandLineOption plumbing_option(
+        QStringLiteral("plumbing"),
+        QStringLiteral("Comma-separated list of plumbings: memory, channel."),
+        QStringLiteral("list"),
+        QStringLiteral("memory,channel"));
+
+    QCommandLineOption distribution_option(
+        QStringLiteral("distribution"),
+        QStringLiteral("Comma-separated list of file distributions: large, medium, small, mixed."),
+        QStringLiteral("list"),
+        QStringLiteral("large,medium,small,mixed"));
+
+    QCommandLineOption rtt_option(
+        QStringLiteral("rtt"),
+        QStringLiteral("Comma-separated list of round-trip times in milliseconds."),
+        QStringLiteral("list"),
+        QStringLiteral("0,20"));
+
+    QCommandLineOption bandwidth_option(
+        QStringLiteral("bandwidth"),
+        QStringLiteral("Comma-separated list of bandwidths in MB/s. Zero means unlimited."),
+        QStringLiteral("list"),
+        QStringLiteral("0"));
+
+    QCommandLineOption port_option(
+        QStringLiteral("port"),
+        QStringLiteral("The port of the loopback channel."),
+        QStringLiteral("port"),
+        QString::number(kDefaultPort));
+
+    QCommandLineOption temp_option(
+        QStringLiteral("temp"),
+        QStringLiteral("The directory for the generated files."),
+        QStringLiteral("path"),
+        QDir::tempPath());
+
+    QCommandLineOption scale_option(
+        QStringLiteral("scale"),
+        QStringLiteral("The multiplier of the number of files."),
+        QStringLiteral("scale"),
+        QStringLiteral("1"));
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addOption(direction_option);
+    parser.addOption(plumbing_option);
+    parser.addOption(distribution_option);
+    parser.addOption(rtt_option);
+    parser.addOption(bandwidth_option);
+    parser.addOption(port_option);
+    parser.addOption(temp_option);
+    parser.addOption(scale_option);
+    parser.process(application);
+
+    QStringList directions;
+    QStringList plumbings;
+    QStringList distributions;
+    QList<double> round_trip_times;
+    QList<double> bandwidths;
+
+    bool port_ok;
+    bool scale_ok;
+
+    const quint16 port = parser.value(port_option).toUShort(&port_ok);
+    const double scale = parser.value(scale_option).toDouble(&scale_ok);
+
+    if (!parseList(parser.value(direction_option),
+                   { QStringLiteral("download"), QStringLiteral("upload") },
+                   &directions) ||
+        !parseList(parser.value(plumbing_option),
+                   { QStringLiteral("memory"), QStringLiteral("channel") },
+                   &plumbings) ||
+        !parseList(parser.value(distribution_option),
+                   { QStringLiteral("large"), QStringLiteral("medium"),
+                     QStringLiteral("small"), QStringLiteral("mixed") },
+                   &distributions) ||
+        !parseNumbers(parser.value(rtt_option), &round_trip_times) ||
+        !parseNumbers(parser.value(bandwidth_option), &bandwidths) ||
+        !port_ok || !port || !scale_ok || scale <= 0)
+    {
+        qWarning("Invalid command line parameters");
+        parser.showHelp(1);
+    }
+
+    FileTransferBenchmark benchmark(parser.value(temp_option), scale);
+
+    for (const auto& distribution : distributions)
+    {
+        for (const auto& plumbing : plumbings)
+        {
+            for (const auto& direction : directions)
+            {
+                for (double round_trip_time : round_trip_times)
+                {
+                    for (double bandwidth : bandwidths)
+                    {
+                        FileTransferBenchmark::Scenario scenario;
+
+                        scenario.type = direction == QLatin1String("download") ?
+                            FileTransfer::Downloader : FileTransfer::Uploader;
+
+                        if (distribution == QLatin1String("large"))
+                            scenario.distribution = FileTransferBenchmark::Distribution::Large;
+                        else if (distribution == QLatin1String("medium"))
+                            scenario.distribution = FileTransferBenchmark::Distribution::Medium;
+                        else if (distribution == QLatin1String("small"))
+                            scenario.distribution = FileTransferBenchmark::Distribution::Small;
+                        else
+                            scenario.distribution = FileTransferBenchmark::Distribution::Mixed;
+
+                        scenario.link.plumbing = plumbing == QLatin1String("memory") ?
+                            FileTransferLink::Plumbing::Memory :
+                            FileTransferLink::Plumbing::Channel;
+                        scenario.link.round_trip_time = static_cast<int>(round_trip_time);
+                        scenario.link.bandwidth = static_cast<qint64>(bandwidth * 1024 * 1024);
+                        scenario.link.port = port;
+
+                        benchmark.addScenario(scenario);
+                    }
+                }
+            }
+        }
+    }
+
+    QObject::connect(&benchmark, &FileTransferBenchmark::finished,
+                     &application, &QCoreApplication::quit, Qt::QueuedConnection);
+
+    QTimer::singleShot(0, &benchmark, &FileTransferBenchmark::start);
+
+    return application.exec();
+}
+
+} // namespace aspia
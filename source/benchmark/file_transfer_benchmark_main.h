@@ -0,0 +1,19 @@
+//
+// PROJECT:         Aspia
+// FILE:            benchmark/file_transfer_benchmark_main.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BENCHMARK__FILE_TRANSFER_BENCHMARK_MAIN_H
+#define _ASPIA_BENCHMARK__FILE_TRANSFER_BENCHMARK_MAIN_H
+
+#include "core_export.h"
+
+namespace aspia {
+
+int CORE_EXPORT fileTransferBenchmarkMain(int argc, char *argv[]);
+
+} // namespace aspia
+
+#endif // _ASPIA_BENCHMARK__FILE_TRANSFER_BENCHMARK_MAIN_H
@@ -0,0 +1,220 @@
+//
+// PROJECT:         Aspia
+// FILE:            benchmark/file_transfer_link.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "benchmark/file_transfer_link.h"
+
+#include <QTimerEvent>
+
+#include "base/message_serialization.h"
+#include "benchmark/benchmark_host.h"
+#include "network/network_channel.h"
+
+namespace aspia {
+
+FileTransferLink::FileTransferLink(const Config& config, BenchmarkHost* host, QObject* parent)
+    : QObject(parent),
+      config_(config),
+      host_(host)
+{
+    Q_ASSERT(host_);
+    clock_.start();
+}
+
+FileTransferLink::~FileTransferLink()
+{
+    if (channel_)
+        channel_->stop();
+
+    for (auto task : tasks_)
+        delete task;
+    tasks_.clear();
+}
+
+void FileTransferLink::start()
+{
+    connect(host_, &BenchmarkHost::errorOccurred, this, &FileTransferLink::errorOccurred);
+
+    if (config_.plumbing == Plumbing::Memory)
+    {
+        connect(this, &FileTransferLink::requestReady, host_, &BenchmarkHost::executeRequest);
+        connect(host_, &BenchmarkHost::replyReady, this, &FileTransferLink::onReplyReceived);
+
+        emit ready();
+        return;
+    }
+
+    Q_ASSERT(config_.plumbing == Plumbing::Channel);
+
+    connect(host_, &BenchmarkHost::listening, this, &FileTransferLink::onHostListening);
+
+    QMetaObject::invokeMethod(host_, "startServer", Qt::QueuedConnection,
+                              Q_ARG(quint16, config_.port));
+}
+
+void FileTransferLink::remoteRequest(FileRequest* request)
+{
+    tasks_.push_back(QPointer<FileRequest>(request));
+    sendMessage(&requests_, serializeMessage(request->request()));
+}
+
+void FileTransferLink::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() != timer_id_)
+        return;
+
+    deliverMessages();
+}
+
+void FileTransferLink::onHostListening(quint16 port)
+{
+    channel_ = NetworkChannel::createClient(this);
+
+    connect(channel_, &NetworkChannel::connected, this, &FileTransferLink::ready);
+    connect(channel_, &NetworkChannel::errorOccurred, this, &FileTransferLink::errorOccurred);
+    connect(channel_, &NetworkChannel::messageReceived,
+            this, &FileTransferLink::onChannelMessageReceived);
+
+    channel_->connectToHost(QStringLiteral("127.0.0.1"), port);
+}
+
+void FileTransferLink::onReplyReceived(const QByteArray& buffer)
+{
+    sendMessage(&replies_, buffer);
+}
+
+void FileTransferLink::onChannelMessageReceived(const QByteArray& buffer)
+{
+    read_pending_ = false;
+    --channel_requests_;
+
+    onReplyReceived(buffer);
+    readNextReply();
+}
+
+qint64 FileTransferLink::currentTime() const
+{
+    return clock_.nsecsElapsed() / 1000;
+}
+
+void FileTransferLink::sendMessage(Direction* direction, const QByteArray& buffer)
+{
+    direction->bytes += buffer.size();
+
+    // The message is sent after the previous one.
+    qint64 sent_time = qMax(currentTime(), direction->sent_time);
+
+    if (config_.bandwidth)
+        sent_time += buffer.size() * 1000000LL / config_.bandwidth;
+
+    direction->sent_time = sent_time;
+    direction->messages.push_back({ sent_time + config_.round_trip_time * 1000LL / 2, buffer });
+
+    scheduleDelivery();
+}
+
+void FileTransferLink::deliverMessages()
+{
+    const qint64 current_time = currentTime();
+
+    // Delivering a reply can send new requests. They are delivered on the next pass.
+    while (!requests_.messages.empty() &&
+           requests_.messages.front().arrival_time <= current_time)
+    {
+        QByteArray buffer = std::move(requests_.messages.front().buffer);
+        requests_.messages.pop_front();
+
+        deliverRequest(buffer);
+    }
+
+    while (!replies_.messages.empty() &&
+           replies_.messages.front().arrival_time <= current_time)
+    {
+        QByteArray buffer = std::move(replies_.messages.front().buffer);
+        replies_.messages.pop_front();
+
+        deliverReply(buffer);
+    }
+
+    scheduleDelivery();
+}
+
+void FileTransferLink::scheduleDelivery()
+{
+    if (timer_id_)
+    {
+        killTimer(timer_id_);
+        timer_id_ = 0;
+    }
+
+    qint64 next_time = -1;
+
+    for (const Direction* direction : { &requests_, &replies_ })
+    {
+        if (direction->messages.empty())
+            continue;
+
+        const qint64 arrival_time = direction->messages.front().arrival_time;
+        if (next_time == -1 || arrival_time < next_time)
+            next_time = arrival_time;
+    }
+
+    if (next_time == -1)
+        return;
+
+    // The messages are delivered from the event loop even without the delay, as they are
+    // delivered by the network.
+    const qint64 delay = qMax(0LL, next_time - currentTime());
+    timer_id_ = startTimer(static_cast<int>((delay + 999) / 1000), Qt::PreciseTimer);
+}
+
+void FileTransferLink::deliverRequest(const QByteArray& buffer)
+{
+    if (config_.plumbing == Plumbing::Memory)
+    {
+        emit requestReady(buffer);
+        return;
+    }
+
+    if (!channel_)
+        return;
+
+    ++channel_requests_;
+
+    channel_->writeMessage(-1, buffer);
+    readNextReply();
+}
+
+void FileTransferLink::deliverReply(const QByteArray& buffer)
+{
+    proto::file_transfer::Reply reply;
+
+    if (!parseMessage(buffer, reply) || tasks_.isEmpty())
+    {
+        emit errorOccurred(QStringLiteral("Invalid reply"));
+        return;
+    }
+
+    QPointer<FileRequest> request = tasks_.front();
+    tasks_.pop_front();
+
+    if (!request.isNull())
+    {
+        request->sendReply(reply);
+        delete request;
+    }
+}
+
+void FileTransferLink::readNextReply()
+{
+    if (read_pending_ || !channel_requests_)
+        return;
+
+    read_pending_ = true;
+    channel_->readMessage();
+}
+
+} // namespace aspia
@@ -0,0 +1,128 @@
+//
+// PROJECT:         Aspia
+// FILE:            benchmark/file_transfer_link.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BENCHMARK__FILE_TRANSFER_LINK_H
+#define _ASPIA_BENCHMARK__FILE_TRANSFER_LINK_H
+
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QQueue>
+
+#include <deque>
+
+#include "host/file_request.h"
+
+namespace aspia {
+
+class BenchmarkHost;
+class NetworkChannel;
+
+// Delivers the remote requests of FileTransfer to BenchmarkHost and the replies back, as
+// ClientSessionFileTransfer does in the client. The link emulates a network: each direction
+// sends one message at a time with the limited bandwidth, and each message arrives half of the
+// round-trip time after it is sent.
+class FileTransferLink : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class Plumbing
+    {
+        // The messages are passed to the host thread by the queued signals.
+        Memory,
+
+        // The messages are sent through NetworkChannel over the loopback interface.
+        Channel
+    };
+
+    struct Config
+    {
+        Plumbing plumbing = Plumbing::Memory;
+        int round_trip_time = 0; // Milliseconds.
+        qint64 bandwidth = 0; // Bytes per second. Zero means unlimited.
+        quint16 port = 0; // The port of the loopback channel.
+    };
+
+    // |host| must live in another thread.
+    FileTransferLink(const Config& config, BenchmarkHost* host, QObject* parent = nullptr);
+    ~FileTransferLink();
+
+    // Connects to the host. When the link is ready, |ready| is emitted.
+    void start();
+
+    // The size of the serialized requests and replies which passed the link.
+    qint64 sentBytes() const { return requests_.bytes; }
+    qint64 receivedBytes() const { return replies_.bytes; }
+
+public slots:
+    void remoteRequest(FileRequest* request);
+
+signals:
+    void ready();
+    void errorOccurred(const QString& message);
+
+    // Passes the request to the host in the memory plumbing.
+    void requestReady(const QByteArray& buffer);
+
+protected:
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+
+private slots:
+    void onHostListening(quint16 port);
+    void onReplyReceived(const QByteArray& buffer);
+    void onChannelMessageReceived(const QByteArray& buffer);
+
+private:
+    struct Message
+    {
+        qint64 arrival_time;
+        QByteArray buffer;
+    };
+
+    struct Direction
+    {
+        // The time when the previous message is completely sent.
+        qint64 sent_time = 0;
+
+        std::deque<Message> messages;
+        qint64 bytes = 0;
+    };
+
+    // Returns the time since the start of the link in microseconds.
+    qint64 currentTime() const;
+
+    void sendMessage(Direction* direction, const QByteArray& buffer);
+    void deliverMessages();
+    void scheduleDelivery();
+    void deliverRequest(const QByteArray& buffer);
+    void deliverReply(const QByteArray& buffer);
+    void readNextReply();
+
+    const Config config_;
+    QPointer<BenchmarkHost> host_;
+    QPointer<NetworkChannel> channel_;
+
+    QElapsedTimer clock_;
+    Direction requests_;
+    Direction replies_;
+    int timer_id_ = 0;
+
+    // Requests which are sent to the host and are waiting for the reply. The replies are
+    // received in the same order.
+    QQueue<QPointer<FileRequest>> tasks_;
+
+    // The channel reads one message at a time.
+    int channel_requests_ = 0;
+    bool read_pending_ = false;
+
+    Q_DISABLE_COPY(FileTransferLink)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BENCHMARK__FILE_TRANSFER_LINK_H
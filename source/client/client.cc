@@ -126,11 +126,11 @@ void Client::onAuthorizationFinished(proto::auth::Status status)
     switch (connect_data_.sessionType())
     {
         case proto::auth::SESSION_TYPE_DESKTOP_MANAGE:
-            session_ = new ClientSessionDesktopManage(&connect_data_, this);
+            session_ = new ClientSessionDesktopManage(&connect_data_, network_channel_, this);
             break;
 
         case proto::auth::SESSION_TYPE_DESKTOP_VIEW:
-            session_ = new ClientSessionDesktopView(&connect_data_, this);
+            session_ = new ClientSessionDesktopView(&connect_data_, network_channel_, this);
             break;
 
         case proto::auth::SESSION_TYPE_FILE_TRANSFER:
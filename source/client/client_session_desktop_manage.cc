@@ -27,8 +27,9 @@ const quint32 kSupportedFeatures =
 } // namespace
 
 ClientSessionDesktopManage::ClientSessionDesktopManage(ConnectData* connect_data,
+                                                       NetworkChannel* network_channel,
                                                        QObject* parent)
-    : ClientSessionDesktopView(connect_data, parent)
+    : ClientSessionDesktopView(connect_data, network_channel, parent)
 {
     connect(desktop_window_, &DesktopWindow::sendKeyEvent,
             this, &ClientSessionDesktopManage::onSendKeyEvent);
@@ -78,6 +79,10 @@ void ClientSessionDesktopManage::messageReceived(const QByteArray& buffer)
     {
         readConfigRequest(message.config_request());
     }
+    else if (message.has_statistics())
+    {
+        readStatistics(message.statistics());
+    }
     else
     {
         // Unknown messages are ignored.
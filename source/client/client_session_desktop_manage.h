@@ -19,7 +19,9 @@ class ClientSessionDesktopManage : public ClientSessionDesktopView
     Q_OBJECT
 
 public:
-    ClientSessionDesktopManage(ConnectData* connect_data, QObject* parent);
+    ClientSessionDesktopManage(ConnectData* connect_data,
+                               NetworkChannel* network_channel,
+                               QObject* parent);
 
     static quint32 supportedVideoEncodings();
     static quint32 supportedFeatures();
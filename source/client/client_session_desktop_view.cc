@@ -8,7 +8,9 @@
 #include "client/client_session_desktop_view.h"
 
 #include "base/message_serialization.h"
+#include "base/trace_event.h"
 #include "client/ui/desktop_window.h"
+#include "network/network_channel.h"
 
 namespace aspia {
 
@@ -23,18 +25,28 @@ const quint32 kSupportedVideoEncodings =
 
 const quint32 kSupportedFeatures = 0;
 
+qint64 currentTime()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 } // namespace
 
 ClientSessionDesktopView::ClientSessionDesktopView(
-    ConnectData* connect_data, QObject* parent)
+    ConnectData* connect_data, NetworkChannel* network_channel, QObject* parent)
     : ClientSession(parent),
-      connect_data_(connect_data)
+      connect_data_(connect_data),
+      network_channel_(network_channel)
 {
     desktop_window_ = new DesktopWindow(connect_data_);
 
     connect(desktop_window_, &DesktopWindow::sendConfig,
             this, &ClientSessionDesktopView::onSendConfig);
 
+    connect(desktop_window_, &DesktopWindow::sendStatisticsRequest,
+            this, &ClientSessionDesktopView::onSendStatisticsRequest);
+
     // When the window is closed, we close the session.
     connect(desktop_window_, &DesktopWindow::windowClose,
             this, &ClientSessionDesktopView::closedByUser);
@@ -75,6 +87,10 @@ void ClientSessionDesktopView::messageReceived(const QByteArray& buffer)
     {
         readConfigRequest(message.config_request());
     }
+    else if (message.has_statistics())
+    {
+        readStatistics(message.statistics());
+    }
     else
     {
         // Unknown messages are ignored.
@@ -113,6 +129,13 @@ void ClientSessionDesktopView::onSendConfig(const proto::desktop::Config& config
     emit writeMessage(ConfigMessageId, serializeMessage(message));
 }
 
+void ClientSessionDesktopView::onSendStatisticsRequest()
+{
+    proto::desktop::ClientToHost message;
+    message.mutable_statistics_request()->set_timestamp(currentTime());
+    emit writeMessage(-1, serializeMessage(message));
+}
+
 void ClientSessionDesktopView::readVideoPacket(const proto::desktop::VideoPacket& packet)
 {
     if (video_encoding_ != packet.encoding())
@@ -147,15 +170,37 @@ void ClientSessionDesktopView::readVideoPacket(const proto::desktop::VideoPacket
         return;
     }
 
-    if (!video_decoder_->decode(packet, frame))
     {
-        emit errorOccurred(tr("Session error: The video packet could not be decoded."));
-        return;
+        TRACE_EVENT_ID("VideoDecoder::decode", packet.frame_id());
+
+        const std::chrono::steady_clock::time_point begin_time = std::chrono::steady_clock::now();
+
+        if (!video_decoder_->decode(packet, frame))
+        {
+            emit errorOccurred(tr("Session error: The video packet could not be decoded."));
+            return;
+        }
+
+        decode_time_.add(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin_time).count());
     }
 
     desktop_window_->drawDesktopFrame();
 }
 
+void ClientSessionDesktopView::readStatistics(const proto::desktop::Statistics& statistics)
+{
+    NetworkChannel::Statistics network_statistics;
+
+    if (!network_channel_.isNull())
+        network_statistics = network_channel_->statistics();
+
+    desktop_window_->showStatistics(statistics,
+                                    network_statistics,
+                                    currentTime() - statistics.timestamp(),
+                                    decode_time_.average());
+}
+
 void ClientSessionDesktopView::readConfigRequest(
     const proto::desktop::ConfigRequest& config_request)
 {
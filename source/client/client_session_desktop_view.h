@@ -11,6 +11,7 @@
 #include <QPointer>
 #include <QThread>
 
+#include "base/sliding_window.h"
 #include "client/client_session.h"
 #include "client/connect_data.h"
 #include "codec/video_decoder.h"
@@ -19,13 +20,16 @@
 namespace aspia {
 
 class DesktopWindow;
+class NetworkChannel;
 
 class ClientSessionDesktopView : public ClientSession
 {
     Q_OBJECT
 
 public:
-    ClientSessionDesktopView(ConnectData* connect_data, QObject* parent);
+    ClientSessionDesktopView(ConnectData* connect_data,
+                             NetworkChannel* network_channel,
+                             QObject* parent);
     virtual ~ClientSessionDesktopView();
 
     static quint32 supportedVideoEncodings();
@@ -39,9 +43,11 @@ public slots:
     void closeSession() override;
 
     virtual void onSendConfig(const proto::desktop::Config& config);
+    void onSendStatisticsRequest();
 
 protected:
     void readVideoPacket(const proto::desktop::VideoPacket& packet);
+    void readStatistics(const proto::desktop::Statistics& statistics);
 
     ConnectData* connect_data_;
     QPointer<DesktopWindow> desktop_window_;
@@ -52,6 +58,9 @@ private:
     proto::desktop::VideoEncoding video_encoding_ = proto::desktop::VIDEO_ENCODING_UNKNOWN;
     std::unique_ptr<VideoDecoder> video_decoder_;
 
+    QPointer<NetworkChannel> network_channel_;
+    SlidingWindow decode_time_;
+
     Q_DISABLE_COPY(ClientSessionDesktopView)
 };
 
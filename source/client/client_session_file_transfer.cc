@@ -65,14 +65,24 @@ void ClientSessionFileTransfer::messageReceived(const QByteArray& buffer)
         return;
     }
 
-    tasks_.front()->sendReply(reply);
+    read_pending_ = false;
+
+    QPointer<FileRequest> request = tasks_.front();
     tasks_.pop_front();
+
+    if (!request.isNull())
+    {
+        request->sendReply(reply);
+        delete request;
+    }
+
+    readNextReply();
 }
 
 void ClientSessionFileTransfer::messageWritten(int message_id)
 {
     Q_ASSERT(message_id == RequestMessageId);
-    emit readMessage();
+    readNextReply();
 }
 
 void ClientSessionFileTransfer::startSession()
@@ -114,4 +124,14 @@ void ClientSessionFileTransfer::remoteRequest(FileRequest* request)
     emit writeMessage(RequestMessageId, serializeMessage(request->request()));
 }
 
+void ClientSessionFileTransfer::readNextReply()
+{
+    // The channel reads one message at a time.
+    if (read_pending_ || tasks_.isEmpty())
+        return;
+
+    read_pending_ = true;
+    emit readMessage();
+}
+
 } // namespace aspia
@@ -43,13 +43,18 @@ private slots:
     void remoteRequest(FileRequest* request);
 
 private:
+    void readNextReply();
+
     ConnectData* connect_data_;
     QPointer<FileManagerWindow> file_manager_;
 
     QPointer<FileWorker> worker_;
     QPointer<QThread> worker_thread_;
 
+    // Requests which are sent to the host and are waiting for the reply. Several requests can be
+    // sent without waiting for the replies. The replies are received in the same order.
     QQueue<QPointer<FileRequest>> tasks_;
+    bool read_pending_ = false;
 
     Q_DISABLE_COPY(ClientSessionFileTransfer)
 };
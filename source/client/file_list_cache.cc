@@ -0,0 +1,105 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/file_list_cache.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/file_list_cache.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace aspia {
+
+namespace {
+
+// The listing has at most one page of items, so the cache takes a few megabytes at most.
+constexpr int kMaxCachedLists = 32;
+
+} // namespace
+
+const proto::file_transfer::FileList* FileListCache::find(const QString& path)
+{
+    auto list = lists_.find(path);
+    if (list == lists_.end())
+        return nullptr;
+
+    order_.removeOne(path);
+    order_.prepend(path);
+
+    return &list.value();
+}
+
+void FileListCache::insert(const QString& path, const proto::file_transfer::FileList& list)
+{
+    Q_ASSERT(list.version());
+
+    order_.removeOne(path);
+    order_.prepend(path);
+
+    lists_.insert(path, list);
+
+    if (order_.size() > kMaxCachedLists)
+        lists_.remove(order_.takeLast());
+}
+
+bool FileListCache::update(const QString& path, const proto::file_transfer::FileList& delta)
+{
+    auto list = lists_.find(path);
+    if (list == lists_.end())
+        return false;
+
+    std::unordered_map<std::string, const proto::file_transfer::FileList::Item*> changed;
+    std::unordered_set<std::string> removed;
+
+    for (int i = 0; i < delta.item_size(); ++i)
+        changed.emplace(delta.item(i).name(), &delta.item(i));
+
+    for (int i = 0; i < delta.removed_item_size(); ++i)
+        removed.insert(delta.removed_item(i).name());
+
+    proto::file_transfer::FileList updated;
+
+    for (int i = 0; i < list->item_size(); ++i)
+    {
+        const proto::file_transfer::FileList::Item& item = list->item(i);
+
+        if (removed.count(item.name()))
+            continue;
+
+        auto changed_item = changed.find(item.name());
+        if (changed_item != changed.end())
+        {
+            *updated.add_item() = *changed_item->second;
+            changed.erase(changed_item);
+        }
+        else
+        {
+            *updated.add_item() = item;
+        }
+    }
+
+    // The rest of the changed items are new.
+    for (int i = 0; i < delta.item_size(); ++i)
+    {
+        if (changed.count(delta.item(i).name()))
+            *updated.add_item() = delta.item(i);
+    }
+
+    updated.set_version(delta.version());
+    list->Swap(&updated);
+
+    order_.removeOne(path);
+    order_.prepend(path);
+
+    return true;
+}
+
+void FileListCache::remove(const QString& path)
+{
+    order_.removeOne(path);
+    lists_.remove(path);
+}
+
+} // namespace aspia
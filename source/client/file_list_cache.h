@@ -0,0 +1,51 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/file_list_cache.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__FILE_LIST_CACHE_H
+#define _ASPIA_CLIENT__FILE_LIST_CACHE_H
+
+#include <QHash>
+#include <QList>
+#include <QString>
+
+#include "protocol/file_transfer_session.pb.h"
+
+namespace aspia {
+
+// Keeps the listings of the recently visited directories. The cached listing is shown at once
+// when the directory is visited again and then validated by the peer with its version.
+class FileListCache
+{
+public:
+    FileListCache() = default;
+    ~FileListCache() = default;
+
+    // Returns the cached listing of the directory or nullptr. The listing becomes the most
+    // recently used one.
+    const proto::file_transfer::FileList* find(const QString& path);
+
+    // Adds the listing which has a version. The least recently used listing is removed if there
+    // are too many of them.
+    void insert(const QString& path, const proto::file_transfer::FileList& list);
+
+    // Applies the changes of the directory received from the peer. Returns false if there is no
+    // listing of the directory.
+    bool update(const QString& path, const proto::file_transfer::FileList& delta);
+
+    void remove(const QString& path);
+
+private:
+    // The most recently used directory is at the front.
+    QList<QString> order_;
+    QHash<QString, proto::file_transfer::FileList> lists_;
+
+    Q_DISABLE_COPY(FileListCache)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__FILE_LIST_CACHE_H
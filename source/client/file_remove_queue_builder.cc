@@ -57,18 +57,28 @@ void FileRemoveQueueBuilder::reply(const proto::file_transfer::Request& request,
         return;
     }
 
-    QString path = QString::fromStdString(request.file_list_request().path());
-    path.replace('\\', '/');
-    if (!path.endsWith('/'))
-        path += '/';
+    const proto::file_transfer::FileList& file_list = reply.file_list();
 
-    for (int i = 0; i < reply.file_list().item_size(); ++i)
+    for (int i = 0; i < file_list.item_size(); ++i)
     {
-        const proto::file_transfer::FileList::Item& item = reply.file_list().item(i);
+        const proto::file_transfer::FileList::Item& item = file_list.item(i);
 
-        pending_tasks_.push_back(
-            FileRemoveTask(path + QString::fromStdString(item.name()),
-                           item.is_directory()));
+        FileRemoveTask task(listed_path_ + QString::fromStdString(item.name()),
+                            item.is_directory());
+
+        // The recursive listing contains the whole subtree with the directories before their
+        // contents. Added to the front of the queue, the contents are removed first.
+        if (file_list.recursive())
+            tasks_.push_front(std::move(task));
+        else
+            pending_tasks_.push_back(std::move(task));
+    }
+
+    if (file_list.continuation())
+    {
+        emit request(FileRequest::nextFileListRequest(
+            this, file_list.continuation(), kReplySlot));
+        return;
     }
 
     processNextPendingTask();
@@ -92,7 +102,12 @@ void FileRemoveQueueBuilder::processNextPendingTask()
         return;
     }
 
-    emit request(FileRequest::fileListRequest(this, current.path(), kReplySlot));
+    listed_path_ = current.path();
+    listed_path_.replace('\\', '/');
+    if (!listed_path_.endsWith('/'))
+        listed_path_ += '/';
+
+    emit request(FileRequest::recursiveFileListRequest(this, current.path(), kReplySlot));
 }
 
 void FileRemoveQueueBuilder::processError(const QString& message)
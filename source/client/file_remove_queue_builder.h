@@ -52,6 +52,9 @@ private:
     QQueue<FileRemoveTask> pending_tasks_;
     QQueue<FileRemoveTask> tasks_;
 
+    // The directory which is being listed.
+    QString listed_path_;
+
     Q_DISABLE_COPY(FileRemoveQueueBuilder)
 };
 
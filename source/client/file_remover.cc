@@ -26,10 +26,29 @@ FileRemover::FileRemover(QObject* parent)
 
 void FileRemover::start(const QString& path, const QList<Item>& items)
 {
-    builder_ = new FileRemoveQueueBuilder();
+    emit started();
+
+    for (const auto& item : items)
+        tasks_.push_back(FileRemoveTask(path + item.name, item.is_directory));
+
+    tasks_count_ = tasks_.size();
+
+    processTask();
+}
+
+void FileRemover::startQueueBuilder()
+{
+    recursive_supported_ = false;
+
+    // The rest of the tasks starting from the current one.
+    QList<Item> items;
+
+    for (const auto& task : tasks_)
+        items.push_back(Item(task.path(), task.isDirectory()));
+
+    tasks_.clear();
 
-    connect(builder_, &FileRemoveQueueBuilder::started,
-            this, &FileRemover::started);
+    builder_ = new FileRemoveQueueBuilder();
 
     connect(builder_, &FileRemoveQueueBuilder::error,
             this, &FileRemover::taskQueueError);
@@ -43,7 +62,7 @@ void FileRemover::start(const QString& path, const QList<Item>& items)
     connect(builder_, &FileRemoveQueueBuilder::request,
             this, &FileRemover::request);
 
-    builder_->start(path, items);
+    builder_->start(QString(), items);
 }
 
 void FileRemover::applyAction(Action action)
@@ -51,13 +70,24 @@ void FileRemover::applyAction(Action action)
     switch (action)
     {
         case Skip:
-            processNextTask();
-            break;
-
         case SkipAll:
-            failure_action_ = action;
-            processNextTask();
-            break;
+        {
+            if (action == SkipAll)
+                failure_action_ = action;
+
+            // The failed entry of the directory which is removed by the peer is skipped. The
+            // removal of the directory continues.
+            if (!failures_.isEmpty())
+            {
+                failures_.pop_front();
+                processFailures();
+            }
+            else
+            {
+                processNextTask();
+            }
+        }
+        break;
 
         case Abort:
             emit finished();
@@ -80,31 +110,42 @@ void FileRemover::reply(const proto::file_transfer::Request& request,
 
     if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
     {
-        Actions actions;
-
-        switch (reply.status())
+        // The peer which does not support the recursive removal could not remove the directory
+        // because it is not empty.
+        if (request.remove_request().recursive() && !reply.has_remove_progress() &&
+            reply.status() == proto::file_transfer::STATUS_ACCESS_DENIED)
         {
-            case proto::file_transfer::STATUS_PATH_NOT_FOUND:
-            case proto::file_transfer::STATUS_ACCESS_DENIED:
-            {
-                if (failure_action_ != Ask)
-                {
-                    applyAction(failure_action_);
-                    return;
-                }
+            startQueueBuilder();
+            return;
+        }
 
-                actions = Abort | Skip | SkipAll;
-            }
-            break;
+        processError(reply.status(), tasks_.front().path());
+        return;
+    }
+
+    if (reply.has_remove_progress())
+    {
+        const proto::file_transfer::RemoveProgress& progress = reply.remove_progress();
+
+        Q_ASSERT(tasks_count_ != 0);
 
-            default:
-                actions = Abort;
-                break;
+        int percentage = (tasks_count_ - tasks_.size()) * 100;
+
+        if (progress.total())
+        {
+            percentage += static_cast<int>(
+                static_cast<quint64>(progress.processed()) * 100 / progress.total());
         }
 
-        emit error(this, actions, tr("Failed to delete \"%1\": %2.")
-                   .arg(QString::fromStdString(request.remove_request().path()))
-                   .arg(fileStatusToString(reply.status())));
+        emit progressChanged(QString::fromStdString(progress.current_path()),
+                             percentage / tasks_count_);
+
+        for (int i = 0; i < progress.failure_size(); ++i)
+            failures_.push_back(progress.failure(i));
+
+        continuation_ = progress.continuation();
+
+        processFailures();
         return;
     }
 
@@ -138,8 +179,14 @@ void FileRemover::processTask()
 
     int percentage = (tasks_count_ - tasks_.size()) * 100 / tasks_count_;
 
-    emit progressChanged(tasks_.front().path(), percentage);
-    emit request(FileRequest::removeRequest(this, tasks_.front().path(), kReplySlot));
+    const FileRemoveTask& task = tasks_.front();
+
+    emit progressChanged(task.path(), percentage);
+
+    if (task.isDirectory() && recursive_supported_)
+        emit request(FileRequest::recursiveRemoveRequest(this, task.path(), kReplySlot));
+    else
+        emit request(FileRequest::removeRequest(this, task.path(), kReplySlot));
 }
 
 void FileRemover::processNextTask()
@@ -150,4 +197,48 @@ void FileRemover::processNextTask()
     processTask();
 }
 
+void FileRemover::processFailures()
+{
+    if (!failures_.isEmpty())
+    {
+        const proto::file_transfer::RemoveProgress::Failure& failure = failures_.front();
+        processError(failure.status(), QString::fromStdString(failure.path()));
+        return;
+    }
+
+    if (continuation_)
+        emit request(FileRequest::nextRemoveRequest(this, continuation_, kReplySlot));
+    else
+        processNextTask();
+}
+
+void FileRemover::processError(proto::file_transfer::Status status, const QString& path)
+{
+    Actions actions;
+
+    switch (status)
+    {
+        case proto::file_transfer::STATUS_PATH_NOT_FOUND:
+        case proto::file_transfer::STATUS_ACCESS_DENIED:
+        {
+            if (failure_action_ != Ask)
+            {
+                applyAction(failure_action_);
+                return;
+            }
+
+            actions = Abort | Skip | SkipAll;
+        }
+        break;
+
+        default:
+            actions = Abort;
+            break;
+    }
+
+    emit error(this, actions, tr("Failed to delete \"%1\": %2.")
+               .arg(path)
+               .arg(fileStatusToString(status)));
+}
+
 } // namespace aspia
@@ -67,12 +67,24 @@ private slots:
     void taskQueueReady();
 
 private:
+    void startQueueBuilder();
     void processTask();
     void processNextTask();
+    void processFailures();
+    void processError(proto::file_transfer::Status status, const QString& path);
 
     FileRemoveQueueBuilder* builder_ = nullptr;
     QQueue<FileRemoveTask> tasks_;
 
+    // The directories are removed by the peer with all their contents. If the peer does not
+    // support it, the contents are listed and removed one by one.
+    bool recursive_supported_ = true;
+
+    // The entries of the directory which the peer could not remove. They are reported one by one
+    // before the removal is continued.
+    QQueue<proto::file_transfer::RemoveProgress::Failure> failures_;
+    quint64 continuation_ = 0;
+
     Action failure_action_ = Ask;
     int tasks_count_ = 0;
 
@@ -17,11 +17,37 @@ namespace {
 const char* kSourceReplySlot = "sourceReply";
 const char* kTargetReplySlot = "targetReply";
 
+constexpr qint64 kMinPacketSize = 16 * 1024; // 16 kB
+constexpr qint64 kMaxPacketSize = 2 * 1024 * 1024; // 2 MB
+
+// The time which the transfer of one packet should take.
+constexpr std::chrono::milliseconds kPacketTime(100);
+
+// The window which the client asks for. 8 MB allow to transfer 160 MB/s over a link with
+// a round-trip time of 50 ms and hold several packets of the maximum size.
+constexpr quint32 kWindowSize = 8 * 1024 * 1024; // 8 MB
+
+// For smaller files computing of the checksums takes longer than the transfer of the file.
+constexpr qint64 kMinDeltaFileSize = 64 * 1024; // 64 kB
+
+// A delta packet can reference only the blocks of the target file which it fully contains.
+constexpr qint64 kMinDeltaBlocksPerPacket = 4;
+
+// The number of files which are transferred at the same time if the peers support it.
+constexpr int kMaxStreamCount = 8;
+
+// Files which are transferred faster than the round trip of the requests are sent in bundles.
+// A bundle is read by the source into memory, so its size is limited.
+constexpr qint64 kMaxBundleFileSize = 64 * 1024; // 64 kB
+constexpr qint64 kMaxBundleSize = 4 * 1024 * 1024; // 4 MB
+constexpr int kMaxBundleEntries = 1000;
+
 } // namespace
 
 FileTransfer::FileTransfer(Type type, QObject* parent)
     : QObject(parent),
-      type_(type)
+      type_(type),
+      packet_size_(kMinPacketSize)
 {
     actions_.insert(OtherError, QPair<Actions, Action>(Abort, Ask));
     actions_.insert(DirectoryCreateError,
@@ -79,30 +105,91 @@ void FileTransfer::setDefaultAction(Error error_type, Action action)
     actions_[error_type].second = action;
 }
 
-FileTransferTask& FileTransfer::currentTask()
-{
-    return tasks_.front();
-}
-
 void FileTransfer::targetReply(const proto::file_transfer::Request& request,
                                const proto::file_transfer::Reply& reply)
 {
-    if (request.has_create_directory_request())
+    Stream* stream = replyStream(request, false);
+    if (!stream)
+        return;
+
+    const FileTransferTask& task = *stream->task;
+
+    if (request.has_block_checksums_request())
+    {
+        const proto::file_transfer::BlockChecksums& checksums = reply.block_checksums();
+
+        // If the checksums can not be received (for example, the peer does not support them),
+        // the file is transferred completely.
+        if (reply.status() == proto::file_transfer::STATUS_SUCCESS &&
+            checksums.block_size() && checksums.checksum_size())
+        {
+            stream->delta_block_size = checksums.block_size();
+
+            sourceRequest(stream, FileRequest::deltaDownloadRequest(
+                this, task.sourcePath(), kWindowSize, checksums, kSourceReplySlot));
+        }
+        else
+        {
+            sourceRequest(stream, FileRequest::downloadRequest(
+                this, task.sourcePath(), kWindowSize, kSourceReplySlot));
+        }
+    }
+    else if (request.has_resume_request())
+    {
+        // The target has the beginning of the file from the interrupted transfer. The source
+        // checks that it has the same data.
+        if (reply.status() == proto::file_transfer::STATUS_SUCCESS && reply.offset())
+        {
+            sourceRequest(stream, FileRequest::resumeDownloadRequest(
+                this,
+                task.sourcePath(),
+                kWindowSize,
+                reply.offset(),
+                reply.tail_hash(),
+                kSourceReplySlot));
+            return;
+        }
+
+        processError(stream, FileAlreadyExists,
+                     tr("Failed to create file \"%1\": %2")
+                     .arg(task.targetPath())
+                     .arg(fileStatusToString(proto::file_transfer::STATUS_PATH_ALREADY_EXISTS)));
+    }
+    else if (request.has_create_directory_request())
     {
         if (reply.status() == proto::file_transfer::STATUS_SUCCESS ||
             reply.status() == proto::file_transfer::STATUS_PATH_ALREADY_EXISTS)
         {
-            processNextTask();
+            finishTask(stream);
             return;
         }
 
-        processError(DirectoryCreateError,
+        processError(stream, DirectoryCreateError,
                      tr("Failed to create directory \"%1\": %2")
-                     .arg(currentTask().targetPath())
+                     .arg(task.targetPath())
                      .arg(fileStatusToString(reply.status())));
     }
     else if (request.has_upload_request())
     {
+        if (!stream->bundle.empty() && reply.status() != proto::file_transfer::STATUS_SUCCESS)
+        {
+            failBundle(stream);
+            return;
+        }
+
+        if (reply.status() == proto::file_transfer::STATUS_PATH_ALREADY_EXISTS &&
+            !request.upload_request().overwrite())
+        {
+            // The existing file may be left by an interrupted transfer.
+            targetRequest(stream, FileRequest::resumeRequest(
+                this,
+                task.targetPath(),
+                stream->file_size,
+                stream->modification_time,
+                kTargetReplySlot));
+            return;
+        }
+
         if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
         {
             Error error_type = FileCreateError;
@@ -110,52 +197,87 @@ void FileTransfer::targetReply(const proto::file_transfer::Request& request,
             if (reply.status() == proto::file_transfer::STATUS_PATH_ALREADY_EXISTS)
                 error_type = FileAlreadyExists;
 
-            processError(error_type,
+            processError(stream, error_type,
                          tr("Failed to create file \"%1\": %2")
-                         .arg(currentTask().targetPath())
+                         .arg(task.targetPath())
                          .arg(fileStatusToString(reply.status())));
             return;
         }
 
-        sourceRequest(FileRequest::packetRequest(this, kSourceReplySlot));
+        // Peers which do not support the window reply with zero. Packets are transferred one at
+        // a time for them (see requestPackets).
+        stream->window_size = qMin(stream->window_size, static_cast<qint64>(reply.window_size()));
+        stream->compression = reply.compression();
+        stream->packets_allowed = true;
+
+        target_streams_ = qMax(1, static_cast<int>(reply.max_streams()));
+        target_bundles_ = reply.bundles();
+
+        requestPackets(stream);
+
+        // The first file tells whether the peers support several streams.
+        startTasks();
     }
     else if (request.has_packet())
     {
+        if (!stream->bundle.empty() && reply.status() != proto::file_transfer::STATUS_SUCCESS)
+        {
+            failBundle(stream);
+            requestAllPackets();
+            return;
+        }
+
         if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
         {
-            processError(FileWriteError,
+            processError(stream, FileWriteError,
                          tr("Failed to write file \"%1\": %2")
-                         .arg(currentTask().targetPath())
+                         .arg(task.targetPath())
                          .arg(fileStatusToString(reply.status())));
             return;
         }
 
-        if (currentTask().size() && total_size_)
-        {
-            qint64 packet_size = request.packet().data().size();
+        const proto::file_transfer::Packet& packet = request.packet();
 
-            task_transfered_size_ += packet_size;
-            total_transfered_size_ += packet_size;
+        qint64 packet_size = packet.data().size();
+        if (packet.operation_size())
+            packet_size = packet.delta_size();
+        else if (packet.compression() != proto::file_transfer::COMPRESSION_NONE)
+            packet_size = packet.uncompressed_size();
 
-            int task_percentage = task_transfered_size_ * 100 / currentTask().size();
-            int total_percentage = total_transfered_size_ * 100 / total_size_;
+        // Without the window the packets are not counted as in flight.
+        if (stream->window_size)
+        {
+            stream->in_flight_size -= packet_size;
+            in_flight_size_ -= packet_size;
+        }
 
-            if (task_percentage != task_percentage_ || total_percentage != total_percentage_)
-            {
-                task_percentage_ = task_percentage;
-                total_percentage_ = total_percentage;
+        updatePacketSize(packet_size);
 
-                emit progressChanged(total_percentage_, task_percentage_);
-            }
+        // The bundle also contains the headers of the files.
+        if (!stream->bundle.empty())
+        {
+            updateProgress(stream, qMin(packet_size,
+                                        task.size() - stream->task_transfered_size));
+        }
+        else
+        {
+            updateProgress(stream, packet_size);
         }
 
-        if (request.packet().flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET)
+        if (packet.flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET)
         {
-            processNextTask();
-            return;
+            const proto::file_transfer::Bundle& failures = reply.bundle_failures();
+
+            // The files which were not written are transferred separately. The errors are
+            // reported for them as usual.
+            for (int i = failures.entry_size() - 1; i >= 0; --i)
+                requeueBundleEntry(stream, failures.entry(i).index());
+
+            finishTask(stream);
         }
 
-        sourceRequest(FileRequest::packetRequest(this, kSourceReplySlot));
+        // The window is shared by all streams.
+        requestAllPackets();
     }
     else
     {
@@ -166,35 +288,108 @@ void FileTransfer::targetReply(const proto::file_transfer::Request& request,
 void FileTransfer::sourceReply(const proto::file_transfer::Request& request,
                                const proto::file_transfer::Reply& reply)
 {
+    Stream* stream = replyStream(request, true);
+    if (!stream)
+        return;
+
+    const FileTransferTask& task = *stream->task;
+
     if (request.has_download_request())
     {
+        if (!stream->bundle.empty() && reply.status() != proto::file_transfer::STATUS_SUCCESS)
+        {
+            failBundle(stream);
+            return;
+        }
+
         if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
         {
-            processError(FileOpenError,
+            processError(stream, FileOpenError,
                          tr("Failed to open file \"%1\": %2")
-                         .arg(currentTask().sourcePath()
-                         .arg(fileStatusToString(reply.status()))));
+                         .arg(task.sourcePath())
+                         .arg(fileStatusToString(reply.status())));
             return;
         }
 
-        targetRequest(FileRequest::uploadRequest(
-            this,
-            currentTask().targetPath(),
-            currentTask().overwrite(),
-            kTargetReplySlot));
+        stream->window_size = reply.window_size();
+        stream->file_size = reply.file_size();
+        stream->modification_time = reply.modification_time();
+
+        source_streams_ = qMax(1, static_cast<int>(reply.max_streams()));
+        source_bundles_ = reply.bundles();
+
+        const quint64 offset = request.download_request().offset();
+
+        if (!stream->bundle.empty())
+        {
+            targetRequest(stream, FileRequest::bundleUploadRequest(
+                this, kWindowSize, kTargetReplySlot));
+        }
+        else if (offset)
+        {
+            // The source has different data or does not support resuming.
+            if (reply.offset() != offset)
+            {
+                processError(stream, FileAlreadyExists,
+                             tr("Failed to create file \"%1\": %2")
+                             .arg(task.targetPath())
+                             .arg(fileStatusToString(
+                                 proto::file_transfer::STATUS_PATH_ALREADY_EXISTS)));
+                return;
+            }
+
+            stream->requested_size = offset;
+            updateProgress(stream, offset);
+
+            targetRequest(stream, FileRequest::resumeUploadRequest(
+                this,
+                task.targetPath(),
+                kWindowSize,
+                offset,
+                stream->file_size,
+                stream->modification_time,
+                kTargetReplySlot));
+        }
+        else if (stream->delta_block_size)
+        {
+            targetRequest(stream, FileRequest::deltaUploadRequest(
+                this,
+                task.targetPath(),
+                kWindowSize,
+                stream->delta_block_size,
+                kTargetReplySlot));
+        }
+        else
+        {
+            targetRequest(stream, FileRequest::uploadRequest(
+                this,
+                task.targetPath(),
+                task.overwrite(),
+                kWindowSize,
+                stream->file_size,
+                stream->modification_time,
+                kTargetReplySlot));
+        }
     }
     else if (request.has_packet_request())
     {
+        if (!stream->bundle.empty() && reply.status() != proto::file_transfer::STATUS_SUCCESS)
+        {
+            failBundle(stream);
+            requestAllPackets();
+            return;
+        }
+
         if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
         {
-            processError(FileReadError,
+            processError(stream, FileReadError,
                          tr("Failed to read file \"%1\": %2")
-                         .arg(currentTask().sourcePath())
+                         .arg(task.sourcePath())
                          .arg(fileStatusToString(reply.status())));
             return;
         }
 
-        targetRequest(FileRequest::packet(this, reply.packet(), kTargetReplySlot));
+        targetRequest(stream, FileRequest::packet(this, reply.packet(), kTargetReplySlot));
     }
     else
     {
@@ -216,91 +411,413 @@ void FileTransfer::taskQueueReady()
     for (const auto& task : tasks_)
         total_size_ += task.size();
 
-    processTask(false);
+    startTasks();
 }
 
 void FileTransfer::applyAction(Error error_type, Action action)
 {
-    switch (action)
+    Stream* stream = error_stream_;
+    error_stream_ = nullptr;
+
+    if (!stream)
     {
-        case Action::Abort:
-            emit finished();
-            break;
+        // The error does not belong to a file (for example, the task queue can not be built).
+        Q_ASSERT(action == Action::Abort);
+        finished_ = true;
+        emit finished();
+        return;
+    }
 
-        case Action::Replace:
-        case Action::ReplaceAll:
+    applyStreamAction(stream, error_type, action);
+    showNextError();
+}
+
+void FileTransfer::startTasks()
+{
+    while (!finished_ && !directory_pending_ && !tasks_.isEmpty())
+    {
+        Stream* stream = nullptr;
+
+        for (int i = 0; i < streamCount(); ++i)
         {
-            if (action == Action::ReplaceAll)
-                setDefaultAction(error_type, action);
+            if (i == static_cast<int>(streams_.size()))
+                streams_.emplace_back(std::make_unique<Stream>(i));
 
-            processTask(true);
+            if (!streams_[i]->task)
+            {
+                stream = streams_[i].get();
+                break;
+            }
         }
-        break;
 
-        case Action::Skip:
-        case Action::SkipAll:
-        {
-            if (action == Action::SkipAll)
-                setDefaultAction(error_type, action);
+        // All streams are busy.
+        if (!stream)
+            return;
 
-            processNextTask();
+        if (!startBundle(stream))
+        {
+            stream->task = std::make_unique<FileTransferTask>(tasks_.dequeue());
+            processTask(stream, false);
         }
-        break;
+    }
 
-        default:
-            qFatal("Unexpected action");
+    if (finished_ || !tasks_.isEmpty())
+        return;
+
+    for (const auto& stream : streams_)
+    {
+        if (stream->task)
+            return;
+    }
+
+    finished_ = true;
+    emit finished();
+}
+
+bool FileTransfer::startBundle(Stream* stream)
+{
+    if (!source_bundles_ || !target_bundles_)
+        return false;
+
+    int count = 0;
+    qint64 bundle_size = 0;
+
+    while (count < tasks_.size() && count < kMaxBundleEntries)
+    {
+        const FileTransferTask& task = tasks_.at(count);
+
+        if (!task.bundleAllowed())
             break;
+
+        if (!task.isDirectory())
+        {
+            if (task.size() > kMaxBundleFileSize || bundle_size + task.size() > kMaxBundleSize)
+                break;
+
+            bundle_size += task.size();
+        }
+
+        ++count;
     }
+
+    // A single file is transferred faster without the bundle.
+    if (count < 2)
+        return false;
+
+    resetStream(stream);
+
+    proto::file_transfer::Bundle bundle;
+
+    for (int i = 0; i < count; ++i)
+    {
+        stream->bundle.emplace_back(tasks_.dequeue());
+
+        const FileTransferTask& task = stream->bundle.back();
+
+        proto::file_transfer::BundleEntry* entry = bundle.add_entry();
+        entry->set_index(i);
+        entry->set_source_path(task.sourcePath().toStdString());
+        entry->set_target_path(task.targetPath().toStdString());
+        entry->set_is_directory(task.isDirectory());
+
+        // The files of the directories can be transferred only after the bundle.
+        if (task.isDirectory())
+            stream->blocks_tasks = true;
+    }
+
+    if (stream->blocks_tasks)
+        directory_pending_ = true;
+
+    const FileTransferTask& first_task = stream->bundle.front();
+
+    stream->task = std::make_unique<FileTransferTask>(
+        first_task.sourcePath(), first_task.targetPath(), false, bundle_size);
+
+    emit currentItemChanged(first_task.sourcePath(), first_task.targetPath());
+
+    sourceRequest(stream, FileRequest::bundleDownloadRequest(
+        this, bundle, kWindowSize, kSourceReplySlot));
+    return true;
+}
+
+void FileTransfer::resetStream(Stream* stream)
+{
+    in_flight_size_ -= stream->in_flight_size;
+
+    stream->task_percentage = 0;
+    stream->task_transfered_size = 0;
+
+    stream->window_size = 0;
+    stream->file_size = 0;
+    stream->modification_time = 0;
+    stream->requested_size = 0;
+    stream->in_flight_size = 0;
+    stream->requested_packets = 0;
+    stream->delta_block_size = 0;
+    stream->compression = proto::file_transfer::COMPRESSION_NONE;
+    stream->packets_allowed = false;
 }
 
-void FileTransfer::processTask(bool overwrite)
+void FileTransfer::processTask(Stream* stream, bool overwrite)
 {
-    task_percentage_ = 0;
-    task_transfered_size_ = 0;
+    resetStream(stream);
 
-    FileTransferTask& task = currentTask();
+    FileTransferTask& task = *stream->task;
 
     task.setOverwrite(overwrite);
 
     emit currentItemChanged(task.sourcePath(), task.targetPath());
 
     if (task.isDirectory())
-        targetRequest(FileRequest::createDirectoryRequest(this, task.targetPath(), kTargetReplySlot));
+    {
+        directory_pending_ = true;
+        stream->blocks_tasks = true;
+
+        targetRequest(stream, FileRequest::createDirectoryRequest(
+            this, task.targetPath(), kTargetReplySlot));
+    }
+    else if (overwrite && task.size() >= kMinDeltaFileSize)
+    {
+        // The target file exists and is going to be replaced. Its blocks can be reused.
+        targetRequest(stream, FileRequest::blockChecksumsRequest(
+            this, task.targetPath(), kTargetReplySlot));
+    }
     else
-        sourceRequest(FileRequest::downloadRequest(this, task.sourcePath(), kSourceReplySlot));
+    {
+        sourceRequest(stream, FileRequest::downloadRequest(
+            this, task.sourcePath(), kWindowSize, kSourceReplySlot));
+    }
 }
 
-void FileTransfer::processNextTask()
+void FileTransfer::finishTask(Stream* stream)
 {
-    if (!tasks_.isEmpty())
+    in_flight_size_ -= stream->in_flight_size;
+    stream->in_flight_size = 0;
+    stream->packets_allowed = false;
+
+    if (stream->blocks_tasks)
     {
-        // Delete the task only after confirmation of its successful execution.
-        tasks_.pop_front();
+        directory_pending_ = false;
+        stream->blocks_tasks = false;
     }
 
-    if (tasks_.isEmpty())
+    // Delete the task only after confirmation of its successful execution.
+    stream->task.reset();
+    stream->bundle.clear();
+
+    startTasks();
+}
+
+void FileTransfer::failBundle(Stream* stream)
+{
+    // The replies to the requests which were sent before the error belong to the bundle.
+    stream->source_discard = stream->source_pending;
+    stream->target_discard = stream->target_pending;
+
+    total_transfered_size_ -= stream->task_transfered_size;
+
+    // The files of the bundle are transferred separately in the same order, so that the
+    // directories are still created before their files.
+    for (int i = static_cast<int>(stream->bundle.size()) - 1; i >= 0; --i)
     {
-        emit finished();
-        return;
+        FileTransferTask& task = stream->bundle[i];
+
+        task.setBundleAllowed(false);
+        tasks_.prepend(std::move(task));
     }
 
-    processTask(false);
+    finishTask(stream);
 }
 
-void FileTransfer::processError(Error error_type, const QString& message)
+void FileTransfer::requeueBundleEntry(Stream* stream, int index)
 {
-    Action action = defaultAction(error_type);
-    if (action != Ask)
+    if (index < 0 || index >= static_cast<int>(stream->bundle.size()))
+        return;
+
+    FileTransferTask& task = stream->bundle[index];
+
+    total_transfered_size_ -= task.size();
+
+    task.setBundleAllowed(false);
+    tasks_.prepend(std::move(task));
+}
+
+void FileTransfer::requestPackets(Stream* stream)
+{
+    if (!stream->packets_allowed)
+        return;
+
+    // Peers which do not support the window do not report the size of the file either. The next
+    // packet of the default size is requested when the previous one is written, until the last
+    // packet is received.
+    if (!stream->window_size)
     {
-        applyAction(error_type, action);
+        if (!stream->source_pending && !stream->target_pending)
+        {
+            ++stream->requested_packets;
+
+            sourceRequest(stream, FileRequest::packetRequest(
+                this, 0, stream->compression, kSourceReplySlot));
+        }
+
         return;
     }
 
-    emit error(this, error_type, message);
+    qint64 max_packet_size = packet_size_;
+
+    if (stream->delta_block_size)
+    {
+        max_packet_size = qMax(max_packet_size,
+                               kMinDeltaBlocksPerPacket * stream->delta_block_size);
+    }
+
+    // An empty file is transferred with a single empty packet.
+    while (stream->requested_size < stream->file_size || !stream->requested_packets)
+    {
+        const qint64 packet_size =
+            qMin(max_packet_size, stream->file_size - stream->requested_size);
+
+        // At least one packet is always requested.
+        if (in_flight_size_ && in_flight_size_ + packet_size > stream->window_size)
+            break;
+
+        stream->requested_size += packet_size;
+        stream->in_flight_size += packet_size;
+        in_flight_size_ += packet_size;
+        ++stream->requested_packets;
+
+        sourceRequest(stream, FileRequest::packetRequest(
+            this, packet_size, stream->compression, kSourceReplySlot));
+    }
+}
+
+void FileTransfer::requestAllPackets()
+{
+    for (const auto& stream : streams_)
+        requestPackets(stream.get());
+}
+
+void FileTransfer::updatePacketSize(qint64 written_size)
+{
+    written_bytes_.add(written_size);
+
+    const qint64 throughput = written_bytes_.sumPerSecond();
+
+    // The packets must fit into the window several times, otherwise they are not pipelined.
+    const qint64 max_packet_size = qBound(kMinPacketSize,
+                                          static_cast<qint64>(kWindowSize / 4),
+                                          kMaxPacketSize);
+
+    qint64 packet_size = throughput * kPacketTime.count() / 1000;
+
+    // Change the size in powers of two to avoid reacting to small changes of the throughput.
+    qint64 rounded_size = kMinPacketSize;
+    while (rounded_size * 2 <= packet_size && rounded_size * 2 <= max_packet_size)
+        rounded_size *= 2;
+
+    packet_size_ = rounded_size;
 }
 
-void FileTransfer::sourceRequest(FileRequest* request)
+void FileTransfer::updateProgress(Stream* stream, qint64 transfered_size)
 {
+    const qint64 task_size = stream->task->size();
+
+    if (!task_size || !total_size_)
+        return;
+
+    stream->task_transfered_size += transfered_size;
+    total_transfered_size_ += transfered_size;
+
+    int task_percentage = stream->task_transfered_size * 100 / task_size;
+    int total_percentage = total_transfered_size_ * 100 / total_size_;
+
+    if (task_percentage != stream->task_percentage || total_percentage != total_percentage_)
+    {
+        stream->task_percentage = task_percentage;
+        total_percentage_ = total_percentage;
+
+        emit progressChanged(total_percentage_, stream->task_percentage);
+    }
+}
+
+void FileTransfer::processError(Stream* stream, Error error_type, const QString& message)
+{
+    // The replies to the requests which were sent before the error belong to the failed file.
+    stream->source_discard = stream->source_pending;
+    stream->target_discard = stream->target_pending;
+
+    // The window is released for the other streams while the stream waits for the action.
+    in_flight_size_ -= stream->in_flight_size;
+    stream->in_flight_size = 0;
+    stream->packets_allowed = false;
+
+    errors_.enqueue({ stream->id, error_type, message });
+    showNextError();
+}
+
+void FileTransfer::showNextError()
+{
+    while (!finished_ && !error_stream_ && !errors_.isEmpty())
+    {
+        StreamError stream_error = errors_.dequeue();
+        Stream* stream = streams_[stream_error.stream_id].get();
+
+        // The action could be chosen for all files while the error was in the queue.
+        Action action = defaultAction(stream_error.error_type);
+        if (action != Ask)
+        {
+            applyStreamAction(stream, stream_error.error_type, action);
+            continue;
+        }
+
+        error_stream_ = stream;
+        emit error(this, stream_error.error_type, stream_error.message);
+    }
+}
+
+void FileTransfer::applyStreamAction(Stream* stream, Error error_type, Action action)
+{
+    switch (action)
+    {
+        case Action::Abort:
+        {
+            finished_ = true;
+            errors_.clear();
+            emit finished();
+        }
+        break;
+
+        case Action::Replace:
+        case Action::ReplaceAll:
+        {
+            if (action == Action::ReplaceAll)
+                setDefaultAction(error_type, action);
+
+            processTask(stream, true);
+        }
+        break;
+
+        case Action::Skip:
+        case Action::SkipAll:
+        {
+            if (action == Action::SkipAll)
+                setDefaultAction(error_type, action);
+
+            finishTask(stream);
+        }
+        break;
+
+        default:
+            qFatal("Unexpected action");
+            break;
+    }
+}
+
+void FileTransfer::sourceRequest(Stream* stream, FileRequest* request)
+{
+    request->setStreamId(stream->id);
+    ++stream->source_pending;
+
     if (type_ == Downloader)
     {
         QMetaObject::invokeMethod(this, "remoteRequest", Q_ARG(FileRequest*, request));
@@ -312,8 +829,11 @@ void FileTransfer::sourceRequest(FileRequest* request)
     }
 }
 
-void FileTransfer::targetRequest(FileRequest* request)
+void FileTransfer::targetRequest(Stream* stream, FileRequest* request)
 {
+    request->setStreamId(stream->id);
+    ++stream->target_pending;
+
     if (type_ == Downloader)
     {
         QMetaObject::invokeMethod(this, "localRequest", Q_ARG(FileRequest*, request));
@@ -325,4 +845,37 @@ void FileTransfer::targetRequest(FileRequest* request)
     }
 }
 
+FileTransfer::Stream* FileTransfer::replyStream(const proto::file_transfer::Request& request,
+                                                bool source)
+{
+    if (request.stream_id() >= streams_.size())
+        return nullptr;
+
+    Stream* stream = streams_[request.stream_id()].get();
+
+    int& pending = source ? stream->source_pending : stream->target_pending;
+    int& discard = source ? stream->source_discard : stream->target_discard;
+
+    --pending;
+
+    if (discard)
+    {
+        --discard;
+        return nullptr;
+    }
+
+    if (finished_ || !stream->task)
+        return nullptr;
+
+    return stream;
+}
+
+int FileTransfer::streamCount() const
+{
+    if (!source_streams_ || !target_streams_)
+        return 1;
+
+    return qMin(kMaxStreamCount, qMin(source_streams_, target_streams_));
+}
+
 } // namespace aspia
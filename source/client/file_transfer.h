@@ -13,6 +13,10 @@
 #include <QPointer>
 #include <QMap>
 
+#include <memory>
+#include <vector>
+
+#include "base/sliding_window.h"
 #include "client/file_transfer_task.h"
 #include "host/file_request.h"
 #include "protocol/file_transfer_session.pb.h"
@@ -81,8 +85,6 @@ public:
     void setDefaultAction(Error error_type, Action action);
     void applyAction(Error error_type, Action action);
 
-    FileTransferTask& currentTask();
-
 signals:
     void started();
     void finished();
@@ -101,11 +103,90 @@ private slots:
     void taskQueueReady();
 
 private:
-    void processTask(bool overwrite);
-    void processNextTask();
-    void processError(Error error_type, const QString& message);
-    void sourceRequest(FileRequest* request);
-    void targetRequest(FileRequest* request);
+    // Several files are transferred at the same time, each in its own stream. The requests of
+    // a stream are tagged with its ID, so that the source and the target keep a separate file
+    // open for each stream. Small files are limited by the round trips of the requests rather
+    // than by the bandwidth, the streams allow to overlap them.
+    struct Stream
+    {
+        explicit Stream(quint32 id)
+            : id(id)
+        {
+            // Nothing
+        }
+
+        const quint32 id;
+
+        // The file which the stream transfers. If null, the stream is idle.
+        std::unique_ptr<FileTransferTask> task;
+
+        qint64 task_transfered_size = 0;
+        int task_percentage = 0;
+
+        // Packets of the file are requested from the source without waiting for the previous
+        // packets to be written to the target while the size of the requested, but not yet
+        // written data fits into the window. The window is negotiated with the source and the
+        // target in the download and upload requests and is shared by all streams.
+        qint64 window_size = 0;
+        qint64 file_size = 0;
+        qint64 requested_size = 0;
+        qint64 in_flight_size = 0;
+        int requested_packets = 0;
+
+        // The modification time of the source file (milliseconds since the epoch). The target
+        // resumes the interrupted transfer only for the same size and modification time.
+        qint64 modification_time = 0;
+
+        // If not zero, the target has a copy of the file which is going to be replaced and only
+        // the difference from it is transferred.
+        quint32 delta_block_size = 0;
+
+        // Compression of the packets which the target supports.
+        proto::file_transfer::Compression compression = proto::file_transfer::COMPRESSION_NONE;
+
+        // Set when the source and the target have opened the file and packets can be requested.
+        bool packets_allowed = false;
+
+        // Small files and directories which are sent in a single stream of packets. The task
+        // of the stream then describes the whole bundle.
+        std::vector<FileTransferTask> bundle;
+
+        // Set while the stream creates directories. Other tasks are not started until then.
+        bool blocks_tasks = false;
+
+        // The number of requests which are waiting for a reply. After an error the replies to
+        // the requests sent before it are discarded.
+        int source_pending = 0;
+        int target_pending = 0;
+        int source_discard = 0;
+        int target_discard = 0;
+    };
+
+    struct StreamError
+    {
+        quint32 stream_id;
+        Error error_type;
+        QString message;
+    };
+
+    void startTasks();
+    bool startBundle(Stream* stream);
+    void resetStream(Stream* stream);
+    void processTask(Stream* stream, bool overwrite);
+    void failBundle(Stream* stream);
+    void requeueBundleEntry(Stream* stream, int index);
+    void finishTask(Stream* stream);
+    void requestPackets(Stream* stream);
+    void requestAllPackets();
+    void updatePacketSize(qint64 written_size);
+    void updateProgress(Stream* stream, qint64 transfered_size);
+    void processError(Stream* stream, Error error_type, const QString& message);
+    void showNextError();
+    void applyStreamAction(Stream* stream, Error error_type, Action action);
+    void sourceRequest(Stream* stream, FileRequest* request);
+    void targetRequest(Stream* stream, FileRequest* request);
+    Stream* replyStream(const proto::file_transfer::Request& request, bool source);
+    int streamCount() const;
 
     // The map contains available actions for the error and the current action.
     QMap<Error, QPair<Actions, Action>> actions_;
@@ -113,12 +194,40 @@ private:
     QQueue<FileTransferTask> tasks_;
     const Type type_;
 
+    std::vector<std::unique_ptr<Stream>> streams_;
+
+    // The number of streams which the source and the target support. Zero until the first
+    // download or upload reply. Until both are known, files are transferred one at a time.
+    int source_streams_ = 0;
+    int target_streams_ = 0;
+
+    // Set when the source and the target support bundles.
+    bool source_bundles_ = false;
+    bool target_bundles_ = false;
+
+    // The files of a directory can be created only after the directory. While it is being
+    // created, other tasks are not started.
+    bool directory_pending_ = false;
+
+    // The errors of the streams are shown one at a time. The stream waits for the action
+    // while its error is in the queue.
+    QQueue<StreamError> errors_;
+    Stream* error_stream_ = nullptr;
+
+    bool finished_ = false;
+
     qint64 total_size_ = 0;
     qint64 total_transfered_size_ = 0;
-    qint64 task_transfered_size_ = 0;
-
     int total_percentage_ = 0;
-    int task_percentage_ = 0;
+
+    // The size of the requested, but not yet written data of all streams.
+    qint64 in_flight_size_ = 0;
+
+    // The size of the requested packets follows the measured throughput, so that each packet
+    // takes about the same time to transfer. Large packets reduce the per-packet overhead on fast
+    // links, small packets keep the progress and cancellation responsive on slow links.
+    qint64 packet_size_;
+    SlidingWindow written_bytes_;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(FileTransfer::Actions)
@@ -29,6 +29,24 @@ QString normalizePath(const QString& path)
     return normalized_path;
 }
 
+FileTransferTask createTask(const QString& source_dir,
+                            const QString& target_dir,
+                            const QString& item_name,
+                            bool is_directory,
+                            qint64 size)
+{
+    QString source_path = normalizePath(source_dir) + item_name;
+    QString target_path = normalizePath(target_dir) + item_name;
+
+    if (is_directory)
+    {
+        source_path = normalizePath(source_path);
+        target_path = normalizePath(target_path);
+    }
+
+    return FileTransferTask(source_path, target_path, is_directory, size);
+}
+
 } // namespace
 
 FileTransferQueueBuilder::FileTransferQueueBuilder(QObject* parent)
@@ -49,7 +67,10 @@ void FileTransferQueueBuilder::start(const QString& source_path,
     emit started();
 
     for (const auto& item : items)
-        addPendingTask(source_path, target_path, item.name, item.is_directory, item.size);
+    {
+        pending_tasks_.push_back(
+            createTask(source_path, target_path, item.name, item.is_directory, item.size));
+    }
 
     processNextPendingTask();
 }
@@ -72,19 +93,31 @@ void FileTransferQueueBuilder::reply(const proto::file_transfer::Request& reques
         return;
     }
 
-    // If we get a list of files, then the last task is a directory.
-    const FileTransferTask& last_task = tasks_.back();
-    Q_ASSERT(last_task.isDirectory());
+    const proto::file_transfer::FileList& file_list = reply.file_list();
 
-    for (int i = 0; i < reply.file_list().item_size(); ++i)
+    for (int i = 0; i < file_list.item_size(); ++i)
     {
-        const proto::file_transfer::FileList::Item& item = reply.file_list().item(i);
+        const proto::file_transfer::FileList::Item& item = file_list.item(i);
+
+        FileTransferTask task = createTask(listed_source_path_,
+                                           listed_target_path_,
+                                           QString::fromStdString(item.name()),
+                                           item.is_directory(),
+                                           item.size());
+
+        // The recursive listing contains the whole subtree and its directories are not listed
+        // again. Peers which do not support it return only the entries of the directory.
+        if (file_list.recursive())
+            tasks_.push_back(std::move(task));
+        else
+            pending_tasks_.push_back(std::move(task));
+    }
 
-        addPendingTask(last_task.sourcePath(),
-                       last_task.targetPath(),
-                       QString::fromStdString(item.name()),
-                       item.is_directory(),
-                       item.size());
+    if (file_list.continuation())
+    {
+        emit request(FileRequest::nextFileListRequest(
+            this, file_list.continuation(), kReplySlot));
+        return;
     }
 
     processNextPendingTask();
@@ -108,7 +141,10 @@ void FileTransferQueueBuilder::processNextPendingTask()
         return;
     }
 
-    emit request(FileRequest::fileListRequest(this, current.sourcePath(), kReplySlot));
+    listed_source_path_ = current.sourcePath();
+    listed_target_path_ = current.targetPath();
+
+    emit request(FileRequest::recursiveFileListRequest(this, current.sourcePath(), kReplySlot));
 }
 
 void FileTransferQueueBuilder::processError(const QString& message)
@@ -119,22 +155,4 @@ void FileTransferQueueBuilder::processError(const QString& message)
     emit finished();
 }
 
-void FileTransferQueueBuilder::addPendingTask(const QString& source_dir,
-                                              const QString& target_dir,
-                                              const QString& item_name,
-                                              bool is_directory,
-                                              qint64 size)
-{
-    QString source_path = normalizePath(source_dir) + item_name;
-    QString target_path = normalizePath(target_dir) + item_name;
-
-    if (is_directory)
-    {
-        source_path = normalizePath(source_path);
-        target_path = normalizePath(target_path);
-    }
-
-    pending_tasks_.push_back(FileTransferTask(source_path, target_path, is_directory, size));
-}
-
 } // namespace aspia
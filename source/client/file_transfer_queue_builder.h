@@ -48,17 +48,17 @@ public slots:
                const proto::file_transfer::Reply& reply);
 
 private:
-    void addPendingTask(const QString& source_dir,
-                        const QString& target_dir,
-                        const QString& item_name,
-                        bool is_directory,
-                        qint64 size);
     void processNextPendingTask();
     void processError(const QString& message);
 
     QQueue<FileTransferTask> pending_tasks_;
     QQueue<FileTransferTask> tasks_;
 
+    // The directory which is being listed. The pages of its listing can arrive after other tasks
+    // are added to the queue.
+    QString listed_source_path_;
+    QString listed_target_path_;
+
     Q_DISABLE_COPY(FileTransferQueueBuilder)
 };
 
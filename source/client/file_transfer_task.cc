@@ -25,6 +25,8 @@ FileTransferTask::FileTransferTask(FileTransferTask&& other) noexcept
     : source_path_(std::move(other.source_path_)),
       target_path_(std::move(other.target_path_)),
       is_directory_(other.is_directory_),
+      overwrite_(other.overwrite_),
+      bundle_allowed_(other.bundle_allowed_),
       size_(other.size_)
 {
     // Nothing
@@ -35,6 +37,8 @@ FileTransferTask& FileTransferTask::operator=(FileTransferTask&& other) noexcept
     source_path_ = std::move(other.source_path_);
     target_path_ = std::move(other.target_path_);
     is_directory_ = other.is_directory_;
+    overwrite_ = other.overwrite_;
+    bundle_allowed_ = other.bundle_allowed_;
     size_ = other.size_;
     return *this;
 }
@@ -37,11 +37,16 @@ public:
     bool overwrite() const { return overwrite_; }
     void setOverwrite(bool value) { overwrite_ = value; }
 
+    // Small files and directories are sent in bundles unless the bundle failed for them.
+    bool bundleAllowed() const { return bundle_allowed_; }
+    void setBundleAllowed(bool value) { bundle_allowed_ = value; }
+
 private:
     QString source_path_;
     QString target_path_;
     bool is_directory_;
     bool overwrite_ = false;
+    bool bundle_allowed_ = true;
     qint64 size_;
 };
 
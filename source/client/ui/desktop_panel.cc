@@ -19,6 +19,7 @@ DesktopPanel::DesktopPanel(proto::auth::SessionType session_type, QWidget* paren
     ui.setupUi(this);
 
     connect(ui.button_settings, &QPushButton::pressed, this, &DesktopPanel::settingsButton);
+    connect(ui.button_statistics, &QPushButton::clicked, this, &DesktopPanel::statisticsButton);
     connect(ui.button_autosize, &QPushButton::pressed, this, &DesktopPanel::onAutosizeButton);
     connect(ui.button_full_screen, &QPushButton::clicked, this, &DesktopPanel::onFullscreenButton);
 
@@ -28,6 +28,7 @@ signals:
     void switchToFullscreen(bool fullscreen);
     void switchToAutosize();
     void settingsButton();
+    void statisticsButton(bool checked);
 
 protected:
     // QFrame implementation.
@@ -17,6 +17,7 @@
 #endif // defined(Q_OS_WIN)
 
 #include "base/keycode_converter.h"
+#include "base/trace_event.h"
 #include "desktop_capture/desktop_frame_qimage.h"
 #include "protocol/desktop_session.pb.h"
 
@@ -196,10 +197,17 @@ void DesktopWidget::executeKeySequense(int key_sequence)
 
 void DesktopWidget::paintEvent(QPaintEvent* /* event */)
 {
+    TRACE_EVENT("DesktopWidget::paintEvent");
+
     if (frame_)
     {
+        const std::chrono::steady_clock::time_point begin_time = std::chrono::steady_clock::now();
+
         QPainter painter(this);
         painter.drawImage(rect(), frame_->constImage());
+
+        paint_time_.add(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin_time).count());
     }
 }
 
@@ -12,6 +12,7 @@
 #include <QWidget>
 #include <memory>
 
+#include "base/sliding_window.h"
 #include "desktop_capture/desktop_frame.h"
 
 namespace aspia {
@@ -29,6 +30,9 @@ public:
     void resizeDesktopFrame(const QSize& screen_size);
     DesktopFrame* desktopFrame();
 
+    // Average time of painting of the frame in microseconds.
+    qint64 paintTime() { return paint_time_.average(); }
+
     void doMouseEvent(QEvent::Type event_type,
                       const Qt::MouseButtons& buttons,
                       const QPoint& pos,
@@ -60,6 +64,8 @@ private:
     QPoint prev_pos_;
     quint32 prev_mask_ = 0;
 
+    SlidingWindow paint_time_;
+
     Q_DISABLE_COPY(DesktopWidget)
 };
 
@@ -10,6 +10,7 @@
 #include <QDebug>
 #include <QBrush>
 #include <QDesktopWidget>
+#include <QLabel>
 #include <QMessageBox>
 #include <QPalette>
 #include <QResizeEvent>
@@ -17,6 +18,7 @@
 #include <QScrollBar>
 
 #include "base/clipboard.h"
+#include "base/trace_event.h"
 #include "client/ui/desktop_config_dialog.h"
 #include "client/ui/desktop_panel.h"
 #include "client/ui/desktop_widget.h"
@@ -69,6 +71,7 @@ DesktopWindow::DesktopWindow(ConnectData* connect_data, QWidget* parent)
     connect(panel_, &DesktopPanel::keySequence, desktop_, &DesktopWidget::executeKeySequense);
     connect(panel_, &DesktopPanel::settingsButton, this, &DesktopWindow::changeSettings);
     connect(panel_, &DesktopPanel::switchToAutosize, this, &DesktopWindow::autosizeWindow);
+    connect(panel_, &DesktopPanel::statisticsButton, this, &DesktopWindow::switchStatistics);
 
     connect(panel_, &DesktopPanel::switchToFullscreen, this, [this](bool fullscreen)
     {
@@ -107,6 +110,8 @@ void DesktopWindow::drawDesktopFrame()
 {
     desktop_->update();
     panel_->update();
+
+    drawn_frames_.add(1);
 }
 
 DesktopFrame* DesktopWindow::desktopFrame()
@@ -181,6 +186,40 @@ bool DesktopWindow::requireConfigChange(proto::desktop::Config* config)
     return false;
 }
 
+void DesktopWindow::showStatistics(const proto::desktop::Statistics& host_statistics,
+                                   const NetworkChannel::Statistics& network_statistics,
+                                   qint64 round_trip_time,
+                                   qint64 decode_time)
+{
+    if (statistics_label_.isNull())
+        return;
+
+    QStringList lines;
+
+    lines << tr("Host: %1 fps captured, %2 fps sent, %3 Kpx/s changed")
+        .arg(host_statistics.capture_fps())
+        .arg(host_statistics.update_fps())
+        .arg(host_statistics.dirty_pixel_rate() / 1000);
+
+    lines << tr("Encode: %1 ms, %2 KB per frame")
+        .arg(host_statistics.encode_time() / 1000.0, 0, 'f', 1)
+        .arg(host_statistics.packet_size() / 1024.0, 0, 'f', 1);
+
+    lines << tr("Network: RTT %1 ms, %2 KB/s in, %3 KB/s out, %4 queued")
+        .arg(round_trip_time)
+        .arg(network_statistics.bytes_received / 1024)
+        .arg(network_statistics.bytes_sent / 1024)
+        .arg(network_statistics.write_queue_size);
+
+    lines << tr("Client: %1 fps drawn, decode %2 ms, paint %3 ms")
+        .arg(drawn_frames_.countPerSecond())
+        .arg(decode_time / 1000.0, 0, 'f', 1)
+        .arg(desktop_->paintTime() / 1000.0, 0, 'f', 1);
+
+    statistics_label_->setText(lines.join(QLatin1Char('\n')));
+    statistics_label_->adjustSize();
+}
+
 void DesktopWindow::onPointerEvent(const QPoint& pos, quint32 mask)
 {
     QPoint cursor = desktop_->mapTo(scroll_area_, pos);
@@ -261,8 +300,47 @@ void DesktopWindow::autosizeWindow()
     }
 }
 
+void DesktopWindow::switchStatistics(bool enable)
+{
+    if (enable)
+    {
+        if (statistics_label_.isNull())
+        {
+            statistics_label_ = new QLabel(this);
+            statistics_label_->setAttribute(Qt::WA_TransparentForMouseEvents);
+            statistics_label_->setStyleSheet(QStringLiteral(
+                "background-color: rgba(0, 0, 0, 160); color: white; padding: 6px;"));
+            statistics_label_->move(0, 0);
+        }
+
+        statistics_label_->show();
+        statistics_label_->raise();
+
+        if (!statistics_timer_id_)
+            statistics_timer_id_ = startTimer(std::chrono::seconds(1));
+
+        emit sendStatisticsRequest();
+    }
+    else
+    {
+        if (statistics_timer_id_)
+        {
+            killTimer(statistics_timer_id_);
+            statistics_timer_id_ = 0;
+        }
+
+        delete statistics_label_;
+    }
+}
+
 void DesktopWindow::timerEvent(QTimerEvent* event)
 {
+    if (event->timerId() == statistics_timer_id_)
+    {
+        emit sendStatisticsRequest();
+        return;
+    }
+
     if (event->timerId() == scroll_timer_id_)
     {
         if (scroll_delta_.x() != 0)
@@ -317,6 +395,17 @@ bool DesktopWindow::eventFilter(QObject* object, QEvent* event)
                 desktop_->doKeyEvent(key_event);
                 return true;
             }
+
+#if defined(ASPIA_ENABLE_TRACING)
+            // Ctrl+Alt+Shift+T writes the collected trace. The key is not sent to the host.
+            if (key_event && key_event->key() == Qt::Key_T &&
+                key_event->modifiers() == (Qt::ControlModifier | Qt::AltModifier | Qt::ShiftModifier))
+            {
+                if (event->type() == QEvent::KeyPress)
+                    TRACE_DUMP();
+                return true;
+            }
+#endif // defined(ASPIA_ENABLE_TRACING)
         }
 
         return false;
@@ -11,10 +11,13 @@
 #include <QPointer>
 #include <QWidget>
 
+#include "base/sliding_window.h"
 #include "client/connect_data.h"
+#include "network/network_channel.h"
 #include "protocol/desktop_session.pb.h"
 
 class QHBoxLayout;
+class QLabel;
 class QScrollArea;
 
 namespace aspia {
@@ -42,12 +45,20 @@ public:
     void setSupportedFeatures(quint32 features);
     bool requireConfigChange(proto::desktop::Config* config);
 
+    // Updates the statistics overlay. |round_trip_time| is in milliseconds, |decode_time| is in
+    // microseconds.
+    void showStatistics(const proto::desktop::Statistics& host_statistics,
+                        const NetworkChannel::Statistics& network_statistics,
+                        qint64 round_trip_time,
+                        qint64 decode_time);
+
 signals:
     void windowClose();
     void sendConfig(const proto::desktop::Config& config);
     void sendKeyEvent(quint32 usb_keycode, quint32 flags);
     void sendPointerEvent(const QPoint& pos, quint32 mask);
     void sendClipboardEvent(const proto::desktop::ClipboardEvent& event);
+    void sendStatisticsRequest();
 
 protected:
     // QWidget implementation.
@@ -61,6 +72,7 @@ private slots:
     void onPointerEvent(const QPoint& pos, quint32 mask);
     void changeSettings();
     void autosizeWindow();
+    void switchStatistics(bool enable);
 
 private:
     ConnectData* connect_data_;
@@ -77,6 +89,10 @@ private:
     int scroll_timer_id_ = 0;
     QPoint scroll_delta_;
 
+    QPointer<QLabel> statistics_label_;
+    int statistics_timer_id_ = 0;
+    SlidingWindow drawn_frames_;
+
     bool is_maximized_ = false;
 
     Q_DISABLE_COPY(DesktopWindow)
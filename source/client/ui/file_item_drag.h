@@ -14,7 +14,6 @@
 
 namespace aspia {
 
-class FileItem;
 class FileItemMimeData;
 
 class FileItemDrag : public QDrag
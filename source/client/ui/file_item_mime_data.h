@@ -14,8 +14,6 @@
 
 namespace aspia {
 
-class FileItem;
-
 class FileItemMimeData : public QMimeData
 {
 public:
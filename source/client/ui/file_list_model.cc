@@ -0,0 +1,619 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/file_list_model.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/ui/file_list_model.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+
+#include <algorithm>
+
+#include "host/file_platform_util.h"
+
+namespace aspia {
+
+namespace {
+
+QString sizeToString(qint64 size)
+{
+    static const qint64 kTB = 1024ULL * 1024ULL * 1024ULL * 1024ULL;
+    static const qint64 kGB = 1024ULL * 1024ULL * 1024ULL;
+    static const qint64 kMB = 1024ULL * 1024ULL;
+    static const qint64 kKB = 1024ULL;
+
+    QString units;
+    qint64 divider;
+
+    if (size >= kTB)
+    {
+        units = QCoreApplication::tr("TB");
+        divider = kTB;
+    }
+    else if (size >= kGB)
+    {
+        units = QCoreApplication::tr("GB");
+        divider = kGB;
+    }
+    else if (size >= kMB)
+    {
+        units = QCoreApplication::tr("MB");
+        divider = kMB;
+    }
+    else if (size >= kKB)
+    {
+        units = QCoreApplication::tr("kB");
+        divider = kKB;
+    }
+    else
+    {
+        units = QCoreApplication::tr("B");
+        divider = 1;
+    }
+
+    return QString("%1 %2")
+        .arg(static_cast<double>(size) / static_cast<double>(divider), 0, 'g', 4)
+        .arg(units);
+}
+
+template <typename T>
+int compareValues(T value1, T value2)
+{
+    if (value1 < value2)
+        return -1;
+
+    if (value2 < value1)
+        return 1;
+
+    return 0;
+}
+
+// Inserts the sorted |added| entries into the sorted |entries|. The positions are found with a
+// binary search, so the number of comparisons depends on the number of the added entries rather
+// than on the number of all entries. The comparison of the names is the most expensive part.
+template <typename Compare>
+void mergeSorted(std::vector<int>* entries, const std::vector<int>& added, Compare less_than)
+{
+    std::vector<int> merged;
+    merged.reserve(entries->size() + added.size());
+
+    auto pos = entries->cbegin();
+
+    for (int entry : added)
+    {
+        auto next = std::upper_bound(pos, entries->cend(), entry, less_than);
+
+        merged.insert(merged.end(), pos, next);
+        merged.push_back(entry);
+
+        pos = next;
+    }
+
+    merged.insert(merged.end(), pos, entries->cend());
+    entries->swap(merged);
+}
+
+} // namespace
+
+FileListModel::FileListModel(QObject* parent)
+    : QAbstractItemModel(parent),
+      directory_icon_(FilePlatformUtil::directoryIcon())
+{
+    // Nothing
+}
+
+void FileListModel::clear()
+{
+    beginResetModel();
+
+    names_.clear();
+    name_offset_.clear();
+    name_length_.clear();
+    size_.clear();
+    modification_time_.clear();
+    flags_.clear();
+    sorted_.clear();
+    rows_.clear();
+
+    has_new_folder_ = false;
+
+    endResetModel();
+}
+
+void FileListModel::addItems(const proto::file_transfer::FileList& list)
+{
+    const int first_entry = static_cast<int>(name_offset_.size());
+
+    for (int i = 0; i < list.item_size(); ++i)
+    {
+        const proto::file_transfer::FileList::Item& item = list.item(i);
+
+        appendEntry(QString::fromStdString(item.name()),
+                    item.size(),
+                    item.modification_time(),
+                    item.is_directory() ? FLAG_DIRECTORY : 0);
+    }
+
+    const int last_entry = static_cast<int>(name_offset_.size());
+    if (first_entry == last_entry)
+        return;
+
+    auto less_than = [this](int entry1, int entry2) { return lessThan(entry1, entry2); };
+
+    std::vector<int> added;
+    added.reserve(last_entry - first_entry);
+
+    for (int entry = first_entry; entry < last_entry; ++entry)
+        added.push_back(entry);
+
+    if (sort_column_ >= 0)
+    {
+        std::sort(added.begin(), added.end(), less_than);
+        mergeSorted(&sorted_, added, less_than);
+    }
+    else
+    {
+        sorted_.insert(sorted_.end(), added.begin(), added.end());
+    }
+
+    added.erase(std::remove_if(added.begin(), added.end(),
+                               [this](int entry) { return !isAccepted(entry); }),
+                added.end());
+
+    if (added.empty())
+        return;
+
+    // The rows are added to the end first, then moved to their sorted positions. Moving the rows
+    // keeps the selection and the current item.
+    const int first_row = rowCount();
+    const bool was_empty = rows_.empty();
+
+    beginInsertRows(QModelIndex(), first_row, first_row + static_cast<int>(added.size()) - 1);
+    rows_.insert(rows_.end(), added.begin(), added.end());
+    endInsertRows();
+
+    if (sort_column_ < 0 || was_empty)
+        return;
+
+    // Without the filter the rows are the same as the sorted entries.
+    std::vector<int> rows;
+
+    if (filter_.isEmpty())
+    {
+        rows = sorted_;
+    }
+    else
+    {
+        rows.assign(rows_.begin(), rows_.end() - added.size());
+        mergeSorted(&rows, added, less_than);
+    }
+
+    changeLayout(std::move(rows));
+}
+
+QModelIndex FileListModel::addNewFolder()
+{
+    if (!has_new_folder_)
+    {
+        beginInsertRows(QModelIndex(), 0, 0);
+        has_new_folder_ = true;
+        new_folder_name_.clear();
+        endInsertRows();
+    }
+
+    return index(0, COLUMN_NAME);
+}
+
+void FileListModel::removeNewFolder()
+{
+    if (!has_new_folder_)
+        return;
+
+    beginRemoveRows(QModelIndex(), 0, 0);
+    has_new_folder_ = false;
+    endRemoveRows();
+}
+
+void FileListModel::setFilter(const QString& filter)
+{
+    if (filter == filter_)
+        return;
+
+    // If the new filter contains the old one, it can only hide the visible rows. Otherwise the
+    // rows are selected from all entries again. The entries are already sorted in both cases.
+    const bool narrowed = filter.contains(filter_, Qt::CaseInsensitive);
+
+    filter_ = filter;
+
+    const std::vector<int>& source = narrowed ? rows_ : sorted_;
+
+    std::vector<int> rows;
+    rows.reserve(source.size());
+
+    for (int entry : source)
+    {
+        if (isAccepted(entry))
+            rows.push_back(entry);
+    }
+
+    beginResetModel();
+    rows_.swap(rows);
+    endResetModel();
+}
+
+QString FileListModel::name(const QModelIndex& index) const
+{
+    if (!index.isValid())
+        return QString();
+
+    const int entry = entryAt(index.row());
+    if (entry < 0)
+        return new_folder_name_;
+
+    return entryName(entry);
+}
+
+bool FileListModel::isDirectory(const QModelIndex& index) const
+{
+    if (!index.isValid())
+        return false;
+
+    const int entry = entryAt(index.row());
+    if (entry < 0)
+        return true;
+
+    return flags_[entry] & FLAG_DIRECTORY;
+}
+
+qint64 FileListModel::fileSize(const QModelIndex& index) const
+{
+    if (!index.isValid())
+        return 0;
+
+    const int entry = entryAt(index.row());
+    if (entry < 0)
+        return 0;
+
+    return size_[entry];
+}
+
+QModelIndex FileListModel::index(int row, int column, const QModelIndex& parent) const
+{
+    if (parent.isValid() || row < 0 || row >= rowCount() || column < 0 || column >= COLUMN_COUNT)
+        return QModelIndex();
+
+    return createIndex(row, column);
+}
+
+QModelIndex FileListModel::parent(const QModelIndex& /* child */) const
+{
+    return QModelIndex();
+}
+
+int FileListModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+
+    return static_cast<int>(rows_.size()) + firstEntryRow();
+}
+
+int FileListModel::columnCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+
+    return COLUMN_COUNT;
+}
+
+QVariant FileListModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid())
+        return QVariant();
+
+    const int entry = entryAt(index.row());
+    const int column = index.column();
+
+    if (entry < 0)
+    {
+        if (column != COLUMN_NAME)
+            return QVariant();
+
+        if (role == Qt::DisplayRole || role == Qt::EditRole)
+            return new_folder_name_;
+
+        if (role == Qt::DecorationRole)
+            return directory_icon_;
+
+        return QVariant();
+    }
+
+    const bool is_directory = flags_[entry] & FLAG_DIRECTORY;
+
+    if (role == Qt::DecorationRole)
+    {
+        if (column != COLUMN_NAME)
+            return QVariant();
+
+        return is_directory ? directory_icon_ : typeInfo(entry).icon;
+    }
+
+    if (role != Qt::DisplayRole && role != Qt::EditRole)
+        return QVariant();
+
+    switch (column)
+    {
+        case COLUMN_NAME:
+            return entryName(entry);
+
+        case COLUMN_SIZE:
+            if (is_directory)
+                return QVariant();
+            return sizeToString(size_[entry]);
+
+        case COLUMN_TYPE:
+            if (is_directory)
+                return QCoreApplication::tr("Folder");
+            return typeInfo(entry).description;
+
+        case COLUMN_MODIFIED:
+            return QDateTime::fromSecsSinceEpoch(
+                modification_time_[entry]).toString(Qt::DefaultLocaleShortDate);
+
+        default:
+            return QVariant();
+    }
+}
+
+bool FileListModel::setData(const QModelIndex& index, const QVariant& value, int role)
+{
+    if (!index.isValid() || index.column() != COLUMN_NAME || role != Qt::EditRole)
+        return false;
+
+    const QString name = value.toString();
+    const int entry = entryAt(index.row());
+
+    if (entry < 0)
+    {
+        new_folder_name_ = name;
+        emit dataChanged(index, index);
+        emit createFolderRequested(name);
+        return true;
+    }
+
+    const QString old_name = entryName(entry);
+    if (name == old_name)
+        return false;
+
+    // The new name is shown until the directory is listed again. The old name remains in the
+    // string of the names.
+    name_offset_[entry] = names_.size();
+    name_length_[entry] = name.size();
+    names_.append(name);
+
+    emit dataChanged(index, index);
+    emit renameRequested(old_name, name);
+    return true;
+}
+
+QVariant FileListModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+        return QVariant();
+
+    switch (section)
+    {
+        case COLUMN_NAME:
+            return tr("Name");
+
+        case COLUMN_SIZE:
+            return tr("Size");
+
+        case COLUMN_TYPE:
+            return tr("Type");
+
+        case COLUMN_MODIFIED:
+            return tr("Modified");
+
+        default:
+            return QVariant();
+    }
+}
+
+Qt::ItemFlags FileListModel::flags(const QModelIndex& index) const
+{
+    if (!index.isValid())
+        return Qt::NoItemFlags;
+
+    Qt::ItemFlags flags = Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsDragEnabled;
+
+    if (index.column() == COLUMN_NAME)
+        flags |= Qt::ItemIsEditable;
+
+    return flags;
+}
+
+void FileListModel::sort(int column, Qt::SortOrder order)
+{
+    if (column == sort_column_ && order == sort_order_)
+        return;
+
+    sort_column_ = column;
+    sort_order_ = order;
+
+    std::sort(sorted_.begin(), sorted_.end(),
+              [this](int entry1, int entry2) { return lessThan(entry1, entry2); });
+
+    std::vector<int> rows;
+    rows.reserve(rows_.size());
+
+    for (int entry : sorted_)
+    {
+        if (isAccepted(entry))
+            rows.push_back(entry);
+    }
+
+    changeLayout(std::move(rows));
+}
+
+int FileListModel::entryAt(int row) const
+{
+    if (has_new_folder_)
+    {
+        if (!row)
+            return -1;
+
+        --row;
+    }
+
+    return rows_[row];
+}
+
+void FileListModel::appendEntry(const QString& name, qint64 size, qint64 modification_time,
+                                quint8 flags)
+{
+    name_offset_.push_back(names_.size());
+    name_length_.push_back(name.size());
+    names_.append(name);
+
+    size_.push_back(size);
+    modification_time_.push_back(modification_time);
+    flags_.push_back(flags);
+}
+
+QString FileListModel::entryName(int entry) const
+{
+    return names_.mid(name_offset_[entry], name_length_[entry]);
+}
+
+QString FileListModel::entrySuffix(int entry) const
+{
+    const QStringRef name(&names_, name_offset_[entry], name_length_[entry]);
+
+    const int dot = name.lastIndexOf(QLatin1Char('.'));
+    if (dot == -1)
+        return QString();
+
+    return name.mid(dot + 1).toString().toLower();
+}
+
+const FileListModel::TypeInfo& FileListModel::typeInfo(int entry) const
+{
+    const QString suffix = entrySuffix(entry);
+
+    auto type_info = type_cache_.find(suffix);
+    if (type_info == type_cache_.end())
+    {
+        QPair<QIcon, QString> info = FilePlatformUtil::fileTypeInfo(entryName(entry));
+        type_info = type_cache_.insert(suffix, { info.first, info.second });
+    }
+
+    return type_info.value();
+}
+
+bool FileListModel::lessThan(int entry1, int entry2) const
+{
+    const bool is_directory1 = flags_[entry1] & FLAG_DIRECTORY;
+    const bool is_directory2 = flags_[entry2] & FLAG_DIRECTORY;
+
+    // Directories are always higher than files.
+    if (is_directory1 != is_directory2)
+        return is_directory1;
+
+    const QStringRef name1(&names_, name_offset_[entry1], name_length_[entry1]);
+    const QStringRef name2(&names_, name_offset_[entry2], name_length_[entry2]);
+
+    int result = 0;
+
+    switch (sort_column_)
+    {
+        case COLUMN_SIZE:
+            result = compareValues(size_[entry1], size_[entry2]);
+            break;
+
+        // The description of the type is known only after the type is resolved. The files with
+        // the same extension have the same type, so they are sorted by the extension.
+        case COLUMN_TYPE:
+        {
+            const int dot1 = name1.lastIndexOf(QLatin1Char('.'));
+            const int dot2 = name2.lastIndexOf(QLatin1Char('.'));
+
+            result = QStringRef::compare(dot1 == -1 ? QStringRef() : name1.mid(dot1 + 1),
+                                         dot2 == -1 ? QStringRef() : name2.mid(dot2 + 1),
+                                         Qt::CaseInsensitive);
+        }
+        break;
+
+        case COLUMN_MODIFIED:
+            result = compareValues(modification_time_[entry1], modification_time_[entry2]);
+            break;
+
+        default:
+            break;
+    }
+
+    if (!result)
+        result = QStringRef::compare(name1, name2, Qt::CaseInsensitive);
+
+    if (!result)
+        result = compareValues(entry1, entry2);
+
+    return sort_order_ == Qt::AscendingOrder ? result < 0 : result > 0;
+}
+
+bool FileListModel::isAccepted(int entry) const
+{
+    if (filter_.isEmpty())
+        return true;
+
+    const QStringRef name(&names_, name_offset_[entry], name_length_[entry]);
+    return name.contains(filter_, Qt::CaseInsensitive);
+}
+
+void FileListModel::changeLayout(std::vector<int>&& rows)
+{
+    emit layoutAboutToBeChanged(QList<QPersistentModelIndex>(),
+                                QAbstractItemModel::VerticalSortHint);
+
+    const QModelIndexList old_indexes = persistentIndexList();
+
+    if (old_indexes.isEmpty())
+    {
+        rows_.swap(rows);
+    }
+    else
+    {
+        std::vector<int> entries;
+        entries.reserve(old_indexes.size());
+
+        for (const QModelIndex& index : old_indexes)
+            entries.push_back(entryAt(index.row()));
+
+        rows_.swap(rows);
+
+        std::vector<int> entry_rows(name_offset_.size(), -1);
+
+        for (size_t i = 0; i < rows_.size(); ++i)
+            entry_rows[rows_[i]] = static_cast<int>(i) + firstEntryRow();
+
+        QModelIndexList new_indexes;
+        new_indexes.reserve(old_indexes.size());
+
+        for (int i = 0; i < old_indexes.size(); ++i)
+        {
+            // The row of the new folder does not move.
+            const int row = entries[i] < 0 ? old_indexes[i].row() : entry_rows[entries[i]];
+
+            new_indexes.append(row < 0 ? QModelIndex() : index(row, old_indexes[i].column()));
+        }
+
+        changePersistentIndexList(old_indexes, new_indexes);
+    }
+
+    emit layoutChanged(QList<QPersistentModelIndex>(), QAbstractItemModel::VerticalSortHint);
+}
+
+} // namespace aspia
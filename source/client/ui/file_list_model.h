@@ -0,0 +1,138 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/file_list_model.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__UI__FILE_LIST_MODEL_H
+#define _ASPIA_CLIENT__UI__FILE_LIST_MODEL_H
+
+#include <QAbstractItemModel>
+#include <QHash>
+#include <QIcon>
+
+#include <vector>
+
+#include "protocol/file_transfer_session.pb.h"
+
+namespace aspia {
+
+// The list of files of the directory shown in the file panel. A directory can contain hundreds
+// of thousands of entries, so the entries are kept in arrays instead of an object per entry: the
+// names are stored one after another in a single string and the other fields in separate
+// vectors. The view requests only the data of the visible rows, so the texts, the icons and the
+// types of the files are made when they are displayed.
+class FileListModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+    enum Column
+    {
+        COLUMN_NAME     = 0,
+        COLUMN_SIZE     = 1,
+        COLUMN_TYPE     = 2,
+        COLUMN_MODIFIED = 3,
+        COLUMN_COUNT    = 4
+    };
+
+    explicit FileListModel(QObject* parent = nullptr);
+    ~FileListModel() = default;
+
+    void clear();
+
+    // Adds the page of the listing. Only the added entries are sorted, then they are merged with
+    // the sorted entries.
+    void addItems(const proto::file_transfer::FileList& list);
+
+    // Adds the row for the folder which is not created yet and returns its index for editing.
+    // When the name is entered, |createFolderRequested| is emitted. The row is shown until the
+    // model is cleared or |removeNewFolder| is called.
+    QModelIndex addNewFolder();
+    void removeNewFolder();
+
+    // Shows only the entries which contain |filter| in their names (the case is ignored).
+    void setFilter(const QString& filter);
+    QString filter() const { return filter_; }
+
+    QString name(const QModelIndex& index) const;
+    bool isDirectory(const QModelIndex& index) const;
+    qint64 fileSize(const QModelIndex& index) const;
+
+    // QAbstractItemModel implementation.
+    QModelIndex index(int row, int column,
+                      const QModelIndex& parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex& child) const override;
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+signals:
+    void createFolderRequested(const QString& name);
+    void renameRequested(const QString& old_name, const QString& new_name);
+
+private:
+    enum Flags : quint8
+    {
+        FLAG_DIRECTORY = 1
+    };
+
+    struct TypeInfo
+    {
+        QIcon icon;
+        QString description;
+    };
+
+    // Returns the index of the entry shown in |row| or -1 for the row of the new folder.
+    int entryAt(int row) const;
+    int firstEntryRow() const { return has_new_folder_ ? 1 : 0; }
+
+    void appendEntry(const QString& name, qint64 size, qint64 modification_time, quint8 flags);
+    QString entryName(int entry) const;
+    QString entrySuffix(int entry) const;
+    const TypeInfo& typeInfo(int entry) const;
+
+    bool lessThan(int entry1, int entry2) const;
+    bool isAccepted(int entry) const;
+
+    // Replaces the visible rows. The persistent indexes (the selection and the current item) are
+    // moved to the new rows of their entries.
+    void changeLayout(std::vector<int>&& rows);
+
+    // The names of all entries one after another.
+    QString names_;
+
+    // The fields of the entries. The entries are not removed until the model is cleared.
+    std::vector<int> name_offset_;
+    std::vector<int> name_length_;
+    std::vector<qint64> size_;
+    std::vector<qint64> modification_time_;
+    std::vector<quint8> flags_;
+
+    // All entries in the current sort order and the entries accepted by the filter.
+    std::vector<int> sorted_;
+    std::vector<int> rows_;
+
+    int sort_column_ = -1;
+    Qt::SortOrder sort_order_ = Qt::AscendingOrder;
+    QString filter_;
+
+    bool has_new_folder_ = false;
+    QString new_folder_name_;
+
+    // The types are resolved by the extension, so the files with the same extension share them.
+    mutable QHash<QString, TypeInfo> type_cache_;
+    QIcon directory_icon_;
+
+    Q_DISABLE_COPY(FileListModel)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__UI__FILE_LIST_MODEL_H
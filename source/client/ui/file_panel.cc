@@ -9,11 +9,12 @@
 
 #include <QAction>
 #include <QDebug>
+#include <QInputDialog>
 #include <QKeyEvent>
 #include <QMenu>
 #include <QMessageBox>
 
-#include "client/ui/file_item.h"
+#include "client/ui/file_list_model.h"
 #include "client/file_remover.h"
 #include "client/file_status.h"
 #include "host/file_platform_util.h"
@@ -60,22 +61,28 @@ FilePanel::FilePanel(QWidget* parent)
     connect(ui.address_bar, QOverload<int>::of(&QComboBox::activated),
             this, &FilePanel::onAddressItemChanged);
 
-    connect(ui.tree, &FileTreeWidget::itemDoubleClicked,
+    connect(ui.tree, &FileTreeView::doubleClicked,
             this, &FilePanel::onFileDoubleClicked);
-    connect(ui.tree, &FileTreeWidget::itemSelectionChanged,
+    connect(ui.tree->selectionModel(), &QItemSelectionModel::selectionChanged,
             this, &FilePanel::onFileSelectionChanged);
-    connect(ui.tree, &FileTreeWidget::fileNameChanged,
-            this, &FilePanel::onFileNameChanged);
-    connect(ui.tree, &FileTreeWidget::customContextMenuRequested,
+    connect(ui.tree, &FileTreeView::customContextMenuRequested,
             this, &FilePanel::onFileContextMenu);
 
+    FileListModel* model = ui.tree->fileModel();
+
+    connect(model, &FileListModel::createFolderRequested,
+            this, &FilePanel::onCreateFolderRequested);
+    connect(model, &FileListModel::renameRequested,
+            this, &FilePanel::onRenameRequested);
+    connect(ui.edit_filter, &QLineEdit::textChanged, model, &FileListModel::setFilter);
+
     connect(ui.button_up, &QPushButton::pressed, this, &FilePanel::toParentFolder);
     connect(ui.button_refresh, &QPushButton::pressed, this, &FilePanel::refresh);
     connect(ui.button_add, &QPushButton::pressed, this, &FilePanel::addFolder);
     connect(ui.button_delete, &QPushButton::pressed, this, &FilePanel::removeSelected);
     connect(ui.button_send, &QPushButton::pressed, this, &FilePanel::sendSelected);
 
-    connect(ui.tree, &FileTreeWidget::fileListDroped, [this](const QList<FileTransfer::Item>& items)
+    connect(ui.tree, &FileTreeView::fileListDroped, [this](const QList<FileTransfer::Item>& items)
     {
         emit receiveItems(this, items);
     });
@@ -88,7 +95,13 @@ void FilePanel::setPanelName(const QString& name)
 
 void FilePanel::setCurrentPath(const QString& path)
 {
-    current_path_ = normalizePath(path);
+    const QString normalized_path = normalizePath(path);
+
+    // The filter is kept only while the same directory is shown.
+    if (normalized_path != current_path_)
+        ui.edit_filter->clear();
+
+    current_path_ = normalized_path;
 
     for (int i = 0; i < ui.address_bar->count(); ++i)
     {
@@ -100,11 +113,7 @@ void FilePanel::setCurrentPath(const QString& path)
         }
     }
 
-    for (int i = ui.tree->topLevelItemCount() - 1; i >= 0; --i)
-    {
-        QTreeWidgetItem* item = ui.tree->takeTopLevelItem(i);
-        delete item;
-    }
+    ui.tree->fileModel()->clear();
 
     int current_item = ui.address_bar->count();
 
@@ -133,8 +142,24 @@ void FilePanel::reply(const proto::file_transfer::Request& request,
     }
     else if (request.has_file_list_request())
     {
+        const proto::file_transfer::FileListRequest& list_request = request.file_list_request();
+
+        if (list_request.continuation())
+        {
+            if (list_request.continuation() != listing_continuation_)
+                return;
+        }
+        else if (normalizePath(QString::fromStdString(list_request.path())) != current_path_)
+        {
+            return;
+        }
+
+        listing_continuation_ = 0;
+
         if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
         {
+            list_cache_.remove(current_path_);
+
             QMessageBox::warning(this,
                                  tr("Warning"),
                                  tr("Failed to get list of files: %1")
@@ -143,7 +168,44 @@ void FilePanel::reply(const proto::file_transfer::Request& request,
             return;
         }
 
-        updateFiles(reply.file_list());
+        const proto::file_transfer::FileList& list = reply.file_list();
+
+        if (list_request.continuation())
+        {
+            updateFiles(list, false);
+        }
+        else if (list.not_modified())
+        {
+            // The cached listing is already shown.
+        }
+        else if (list.delta())
+        {
+            if (!list_cache_.update(current_path_, list))
+            {
+                emit this->request(
+                    FileRequest::pagedFileListRequest(this, current_path_, kReplySlot));
+                return;
+            }
+
+            updateFiles(*list_cache_.find(current_path_), true);
+        }
+        else
+        {
+            updateFiles(list, true);
+
+            // Only the listing which fits into one page has a version.
+            if (list.version())
+                list_cache_.insert(current_path_, list);
+            else
+                list_cache_.remove(current_path_);
+        }
+
+        listing_continuation_ = list.continuation();
+        if (listing_continuation_)
+        {
+            emit this->request(FileRequest::nextFileListRequest(
+                this, listing_continuation_, kReplySlot));
+        }
     }
     else if (request.has_create_directory_request())
     {
@@ -171,10 +233,19 @@ void FilePanel::reply(const proto::file_transfer::Request& request,
 
         refresh();
     }
+    else if (request.has_copy_request())
+    {
+        onCopyReply(reply, false);
+    }
+    else if (request.has_move_request())
+    {
+        onCopyReply(reply, true);
+    }
 }
 
 void FilePanel::refresh()
 {
+    bypass_cache_ = true;
     emit request(FileRequest::driveListRequest(this, kReplySlot));
 }
 
@@ -207,7 +278,12 @@ void FilePanel::keyPressEvent(QKeyEvent* event)
 
 void FilePanel::onAddressItemChanged(int index)
 {
-    current_path_ = normalizePath(addressItemPath(index));
+    const QString path = normalizePath(addressItemPath(index));
+
+    if (path != current_path_)
+        ui.edit_filter->clear();
+
+    current_path_ = path;
 
     // If the address is entered by the user, then the icon is missing.
     if (ui.address_bar->itemIcon(index).isNull())
@@ -237,16 +313,37 @@ void FilePanel::onAddressItemChanged(int index)
         }
     }
 
-    emit request(FileRequest::fileListRequest(this, current_path_, kReplySlot));
+    listing_continuation_ = 0;
+
+    const proto::file_transfer::FileList* cached_list =
+        bypass_cache_ ? nullptr : list_cache_.find(current_path_);
+
+    bypass_cache_ = false;
+
+    if (cached_list)
+    {
+        // The cached listing is shown at once. The peer returns only the changes of the
+        // directory.
+        updateFiles(*cached_list, true);
+
+        emit request(FileRequest::cachedFileListRequest(
+            this, current_path_, cached_list->version(), kReplySlot));
+    }
+    else
+    {
+        emit request(FileRequest::pagedFileListRequest(this, current_path_, kReplySlot));
+    }
 }
 
-void FilePanel::onFileDoubleClicked(QTreeWidgetItem* item, int column)
+void FilePanel::onFileDoubleClicked(const QModelIndex& index)
 {
-    FileItem* file_item = dynamic_cast<FileItem*>(item);
-    if (!file_item || !file_item->isDirectory())
+    FileListModel* model = ui.tree->fileModel();
+
+    const QString name = model->name(index);
+    if (name.isEmpty() || !model->isDirectory(index))
         return;
 
-    toChildFolder(file_item->text(0));
+    toChildFolder(name);
 }
 
 void FilePanel::onFileSelectionChanged()
@@ -267,37 +364,29 @@ void FilePanel::onFileSelectionChanged()
     }
 }
 
-void FilePanel::onFileNameChanged(FileItem* file_item)
+void FilePanel::onCreateFolderRequested(const QString& name)
 {
-    QString initial_name = file_item->initialName();
-    QString current_name = file_item->currentName();
-
-    if (initial_name.isEmpty()) // New item.
+    if (name.isEmpty())
     {
-        if (current_name.isEmpty())
-        {
-            QMessageBox::warning(this,
-                                 tr("Warning"),
-                                 tr("Folder name can not be empty."),
-                                 QMessageBox::Ok);
-            delete file_item;
-            return;
-        }
-
-        emit request(FileRequest::createDirectoryRequest(
-            this, currentPath() + current_name, kReplySlot));
+        QMessageBox::warning(this,
+                             tr("Warning"),
+                             tr("Folder name can not be empty."),
+                             QMessageBox::Ok);
+        ui.tree->fileModel()->removeNewFolder();
+        return;
     }
-    else // Rename item.
-    {
-        if (current_name == initial_name)
-            return;
 
-        emit request(FileRequest::renameRequest(
-            this,
-            currentPath() + initial_name,
-            currentPath() + current_name,
-            kReplySlot));
-    }
+    emit request(FileRequest::createDirectoryRequest(
+        this, currentPath() + name, kReplySlot));
+}
+
+void FilePanel::onRenameRequested(const QString& old_name, const QString& new_name)
+{
+    emit request(FileRequest::renameRequest(
+        this,
+        currentPath() + old_name,
+        currentPath() + new_name,
+        kReplySlot));
 }
 
 void FilePanel::onFileContextMenu(const QPoint& point)
@@ -305,16 +394,27 @@ void FilePanel::onFileContextMenu(const QPoint& point)
     QMenu menu;
 
     QScopedPointer<QAction> copy_action;
+    QScopedPointer<QAction> copy_to_action;
+    QScopedPointer<QAction> move_to_action;
     QScopedPointer<QAction> delete_action;
 
     if (selectedFilesCount() > 0)
     {
         copy_action.reset(new QAction(
             QIcon(QStringLiteral(":/icon/arrow-045.png")), tr("&Send\tF11")));
+        copy_to_action.reset(new QAction(tr("Cop&y To...")));
+        move_to_action.reset(new QAction(tr("&Move To...")));
         delete_action.reset(new QAction(
             QIcon(QStringLiteral(":/icon/cross-script.png")), tr("&Delete\tDelete")));
 
+        // Copying and moving are done by the peer itself, the data is not transferred.
+        const bool copy_enabled = copy_queue_.isEmpty() && copy_source_path_.isEmpty();
+        copy_to_action->setEnabled(copy_enabled);
+        move_to_action->setEnabled(copy_enabled);
+
         menu.addAction(copy_action.data());
+        menu.addAction(copy_to_action.data());
+        menu.addAction(move_to_action.data());
         menu.addAction(delete_action.data());
         menu.addSeparator();
     }
@@ -332,6 +432,10 @@ void FilePanel::onFileContextMenu(const QPoint& point)
         removeSelected();
     else if (selected_action == copy_action.data())
         sendSelected();
+    else if (selected_action == copy_to_action.data())
+        copySelected();
+    else if (selected_action == move_to_action.data())
+        moveSelected();
     else if (selected_action == add_folder_action.data())
         addFolder();
 }
@@ -353,26 +457,19 @@ void FilePanel::toParentFolder()
 
 void FilePanel::addFolder()
 {
-    FileItem* item = new FileItem(QString());
+    QModelIndex index = ui.tree->fileModel()->addNewFolder();
 
-    ui.tree->addTopLevelItem(item);
-    ui.tree->editItem(item);
+    ui.tree->scrollTo(index);
+    ui.tree->edit(index);
 }
 
 void FilePanel::removeSelected()
 {
+    FileListModel* model = ui.tree->fileModel();
     QList<FileRemover::Item> items;
 
-    for (int i = 0; i < ui.tree->topLevelItemCount(); ++i)
-    {
-        FileItem* file_item = dynamic_cast<FileItem*>(ui.tree->topLevelItem(i));
-
-        if (file_item && ui.tree->isItemSelected(file_item))
-        {
-            items.push_back(FileRemover::Item(file_item->currentName(),
-                                              file_item->isDirectory()));
-        }
-    }
+    for (const QModelIndex& index : ui.tree->selectedRows())
+        items.push_back(FileRemover::Item(model->name(index), model->isDirectory(index)));
 
     if (items.isEmpty())
         return;
@@ -390,18 +487,14 @@ void FilePanel::removeSelected()
 
 void FilePanel::sendSelected()
 {
+    FileListModel* model = ui.tree->fileModel();
     QList<FileTransfer::Item> items;
 
-    for (int i = 0; i < ui.tree->topLevelItemCount(); ++i)
+    for (const QModelIndex& index : ui.tree->selectedRows())
     {
-        FileItem* file_item = dynamic_cast<FileItem*>(ui.tree->topLevelItem(i));
-
-        if (file_item && ui.tree->isItemSelected(file_item))
-        {
-            items.push_back(FileTransfer::Item(file_item->currentName(),
-                                               file_item->fileSize(),
-                                               file_item->isDirectory()));
-        }
+        items.push_back(FileTransfer::Item(model->name(index),
+                                           model->fileSize(index),
+                                           model->isDirectory(index)));
     }
 
     if (items.isEmpty())
@@ -410,6 +503,122 @@ void FilePanel::sendSelected()
     emit sendItems(this, items);
 }
 
+void FilePanel::copySelected()
+{
+    startCopy(false);
+}
+
+void FilePanel::moveSelected()
+{
+    startCopy(true);
+}
+
+void FilePanel::startCopy(bool move)
+{
+    if (!copy_queue_.isEmpty() || !copy_source_path_.isEmpty())
+        return;
+
+    FileListModel* model = ui.tree->fileModel();
+    QQueue<QString> queue;
+
+    for (const QModelIndex& index : ui.tree->selectedRows())
+        queue.enqueue(model->name(index));
+
+    if (queue.isEmpty())
+        return;
+
+    bool ok;
+
+    QString target_path = QInputDialog::getText(this,
+                                                move ? tr("Move To") : tr("Copy To"),
+                                                tr("Destination folder:"),
+                                                QLineEdit::Normal,
+                                                current_path_,
+                                                &ok);
+    if (!ok || target_path.isEmpty())
+        return;
+
+    // The user can leave the directory while the items are copied.
+    copy_source_directory_ = current_path_;
+    copy_target_path_ = normalizePath(target_path);
+    copy_move_ = move;
+    copy_queue_ = std::move(queue);
+
+    copyNext();
+}
+
+void FilePanel::copyNext()
+{
+    if (copy_queue_.isEmpty())
+    {
+        copy_source_path_.clear();
+        onFileSelectionChanged();
+        refresh();
+        return;
+    }
+
+    const QString name = copy_queue_.dequeue();
+
+    copy_source_path_ = copy_source_directory_ + name;
+
+    const QString target_path = copy_target_path_ + name;
+
+    if (copy_move_)
+    {
+        emit request(FileRequest::moveRequest(
+            this, copy_source_path_, target_path, kReplySlot));
+    }
+    else
+    {
+        emit request(FileRequest::copyRequest(
+            this, copy_source_path_, target_path, kReplySlot));
+    }
+}
+
+void FilePanel::onCopyReply(const proto::file_transfer::Reply& reply, bool move)
+{
+    if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
+    {
+        const QString message = move ?
+            tr("Failed to move \"%1\": %2") : tr("Failed to copy \"%1\": %2");
+
+        QMessageBox::warning(this,
+                             tr("Warning"),
+                             message.arg(copy_source_path_)
+                                 .arg(fileStatusToString(reply.status())),
+                             QMessageBox::Ok);
+        copyNext();
+        return;
+    }
+
+    const proto::file_transfer::CopyProgress& progress = reply.copy_progress();
+
+    if (!progress.continuation())
+    {
+        copyNext();
+        return;
+    }
+
+    int percentage = 0;
+    if (progress.total_size())
+        percentage = static_cast<int>(progress.copied_size() * 100 / progress.total_size());
+
+    ui.label_status->setText(tr("%1% %2")
+                                 .arg(percentage)
+                                 .arg(QString::fromStdString(progress.current_path())));
+
+    if (move)
+    {
+        emit request(FileRequest::nextMoveRequest(
+            this, progress.continuation(), kReplySlot));
+    }
+    else
+    {
+        emit request(FileRequest::nextCopyRequest(
+            this, progress.continuation(), kReplySlot));
+    }
+}
+
 QString FilePanel::addressItemPath(int index) const
 {
     QString path = ui.address_bar->itemData(index).toString();
@@ -452,30 +661,19 @@ void FilePanel::updateDrives(const proto::file_transfer::DriveList& list)
         setCurrentPath(current_path_);
 }
 
-void FilePanel::updateFiles(const proto::file_transfer::FileList& list)
+void FilePanel::updateFiles(const proto::file_transfer::FileList& list, bool first_page)
 {
-    for (int i = ui.tree->topLevelItemCount() - 1; i >= 0; --i)
-    {
-        QTreeWidgetItem* item = ui.tree->takeTopLevelItem(i);
-        delete item;
-    }
+    FileListModel* model = ui.tree->fileModel();
 
-    for (int i = 0; i < list.item_size(); ++i)
-        ui.tree->addTopLevelItem(new FileItem(list.item(i)));
+    if (first_page)
+        model->clear();
+
+    model->addItems(list);
 }
 
 int FilePanel::selectedFilesCount()
 {
-    int selected_count = 0;
-
-    int total_count = ui.tree->topLevelItemCount();
-    for (int i = 0; i < total_count; ++i)
-    {
-        if (ui.tree->isItemSelected(ui.tree->topLevelItem(i)))
-            ++selected_count;
-    }
-
-    return selected_count;
+    return ui.tree->selectedRows().count();
 }
 
 } // namespace aspia
@@ -8,11 +8,14 @@
 #ifndef _ASPIA_CLIENT__UI__FILE_PANEL_H
 #define _ASPIA_CLIENT__UI__FILE_PANEL_H
 
+#include "client/file_list_cache.h"
 #include "client/file_remover.h"
 #include "client/file_transfer.h"
 #include "protocol/file_transfer_session.pb.h"
 #include "ui_file_panel.h"
 
+#include <QQueue>
+
 namespace aspia {
 
 class FilePanel : public QWidget
@@ -45,9 +48,10 @@ protected:
 
 private slots:
     void onAddressItemChanged(int index);
-    void onFileDoubleClicked(QTreeWidgetItem* item, int column);
+    void onFileDoubleClicked(const QModelIndex& index);
     void onFileSelectionChanged();
-    void onFileNameChanged(FileItem* file_item);
+    void onCreateFolderRequested(const QString& name);
+    void onRenameRequested(const QString& old_name, const QString& new_name);
     void onFileContextMenu(const QPoint& point);
 
     void toChildFolder(const QString& child_name);
@@ -55,16 +59,39 @@ private slots:
     void addFolder();
     void removeSelected();
     void sendSelected();
+    void copySelected();
+    void moveSelected();
 
 private:
+    void startCopy(bool move);
+    void copyNext();
+    void onCopyReply(const proto::file_transfer::Reply& reply, bool move);
+
     QString addressItemPath(int index) const;
     void updateDrives(const proto::file_transfer::DriveList& list);
-    void updateFiles(const proto::file_transfer::FileList& list);
+    void updateFiles(const proto::file_transfer::FileList& list, bool first_page);
     int selectedFilesCount();
 
     Ui::FilePanel ui;
     QString current_path_;
 
+    // The listing of the current directory is received in pages. The value is used to request
+    // the next page and to ignore the pages of the directories which are no longer shown.
+    quint64 listing_continuation_ = 0;
+
+    // The listings of the visited directories. The refresh lists the directory again even if
+    // its listing is cached: the changes of the files are not visible in the directory itself.
+    FileListCache list_cache_;
+    bool bypass_cache_ = false;
+
+    // The selected items are copied or moved on the peer one at a time. The peer replies with
+    // the progress and the continuation until the item is done.
+    QQueue<QString> copy_queue_;
+    QString copy_source_directory_;
+    QString copy_source_path_;
+    QString copy_target_path_;
+    bool copy_move_ = false;
+
     Q_DISABLE_COPY(FilePanel)
 };
 
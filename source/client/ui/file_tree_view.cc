@@ -0,0 +1,111 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/file_tree_view.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/ui/file_tree_view.h"
+
+#include <QApplication>
+#include <QMouseEvent>
+
+#include "client/ui/file_item_drag.h"
+#include "client/ui/file_item_mime_data.h"
+#include "client/ui/file_list_model.h"
+
+namespace aspia {
+
+FileTreeView::FileTreeView(QWidget* parent)
+    : QTreeView(parent),
+      model_(new FileListModel(this))
+{
+    setAcceptDrops(true);
+    setModel(model_);
+}
+
+QModelIndexList FileTreeView::selectedRows() const
+{
+    return selectionModel()->selectedRows(FileListModel::COLUMN_NAME);
+}
+
+void FileTreeView::mousePressEvent(QMouseEvent* event)
+{
+    if (event->button() == Qt::LeftButton)
+        start_pos_ = event->pos();
+
+    QTreeView::mousePressEvent(event);
+}
+
+void FileTreeView::mouseMoveEvent(QMouseEvent* event)
+{
+    if (event->buttons() & Qt::LeftButton)
+    {
+        int distance = (event->pos() - start_pos_).manhattanLength();
+
+        if (distance > QApplication::startDragDistance())
+        {
+            startDrag(Qt::CopyAction);
+            return;
+        }
+    }
+
+    QTreeView::mouseMoveEvent(event);
+}
+
+void FileTreeView::dragEnterEvent(QDragEnterEvent* event)
+{
+    if (event->mimeData()->hasFormat(FileItemMimeData::mimeType()))
+        event->acceptProposedAction();
+}
+
+void FileTreeView::dragMoveEvent(QDragMoveEvent* event)
+{
+    event->ignore();
+
+    if (event->source() != this)
+        event->acceptProposedAction();
+
+    QWidget::dragMoveEvent(event);
+}
+
+void FileTreeView::dropEvent(QDropEvent* event)
+{
+    const FileItemMimeData* mime_data =
+        dynamic_cast<const FileItemMimeData*>(event->mimeData());
+
+    if (!mime_data)
+        return;
+
+    emit fileListDroped(mime_data->fileList());
+}
+
+void FileTreeView::startDrag(Qt::DropActions supported_actions)
+{
+    QList<FileTransfer::Item> file_list;
+
+    for (const QModelIndex& index : selectedRows())
+    {
+        file_list.push_back(FileTransfer::Item(model_->name(index),
+                                               model_->fileSize(index),
+                                               model_->isDirectory(index)));
+    }
+
+    if (file_list.isEmpty())
+        return;
+
+    FileItemDrag* drag = new FileItemDrag(this);
+    drag->setFileList(file_list);
+    drag->exec(supported_actions);
+}
+
+void FileTreeView::closeEditor(QWidget* editor, QAbstractItemDelegate::EndEditHint hint)
+{
+    QTreeView::closeEditor(editor, hint);
+
+    // The name of the new folder is not entered.
+    if (hint == QAbstractItemDelegate::RevertModelCache)
+        model_->removeNewFolder();
+}
+
+} // namespace aspia
@@ -1,35 +1,39 @@
 //
 // PROJECT:         Aspia
-// FILE:            client/ui/file_tree_widget.h
+// FILE:            client/ui/file_tree_view.h
 // LICENSE:         GNU General Public License 3
 // PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
 //
 
-#ifndef _ASPIA_CLIENT__UI__FILE_TREE_WIDGET_H
-#define _ASPIA_CLIENT__UI__FILE_TREE_WIDGET_H
+#ifndef _ASPIA_CLIENT__UI__FILE_TREE_VIEW_H
+#define _ASPIA_CLIENT__UI__FILE_TREE_VIEW_H
 
-#include <QTreeWidget>
+#include <QTreeView>
 
 #include "client/file_transfer.h"
 
 namespace aspia {
 
-class FileItem;
+class FileListModel;
 
-class FileTreeWidget : public QTreeWidget
+class FileTreeView : public QTreeView
 {
     Q_OBJECT
 
 public:
-    FileTreeWidget(QWidget* parent = nullptr);
-    ~FileTreeWidget() = default;
+    FileTreeView(QWidget* parent = nullptr);
+    ~FileTreeView() = default;
+
+    FileListModel* fileModel() const { return model_; }
+
+    // Returns the rows of the selected items.
+    QModelIndexList selectedRows() const;
 
 signals:
     void fileListDroped(const QList<FileTransfer::Item>& file_list);
-    void fileNameChanged(FileItem* file_item) const;
 
 protected:
-    // QTreeWidget implementation.
+    // QTreeView implementation.
     void mousePressEvent(QMouseEvent* event) override;
     void mouseMoveEvent(QMouseEvent* event) override;
     void dragEnterEvent(QDragEnterEvent* event) override;
@@ -37,15 +41,16 @@ protected:
     void dropEvent(QDropEvent* event) override;
     void startDrag(Qt::DropActions supported_actions) override;
 
-private slots:
-    void onEditingFinished(const QModelIndex& index) const;
+protected slots:
+    void closeEditor(QWidget* editor, QAbstractItemDelegate::EndEditHint hint) override;
 
 private:
+    FileListModel* model_;
     QPoint start_pos_;
 
-    Q_DISABLE_COPY(FileTreeWidget)
+    Q_DISABLE_COPY(FileTreeView)
 };
 
 } // namespace aspia
 
-#endif // _ASPIA_CLIENT__UI__FILE_TREE_WIDGET_H
+#endif // _ASPIA_CLIENT__UI__FILE_TREE_VIEW_H
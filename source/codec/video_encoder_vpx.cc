@@ -12,6 +12,7 @@
 
 #include <libyuv/convert_from_argb.h>
 
+#include "base/trace_event.h"
 #include "codec/video_util.h"
 #include "desktop_capture/desktop_frame.h"
 
@@ -326,6 +327,8 @@ void VideoEncoderVPX::prepareImageAndActiveMap(const DesktopFrame* frame,
 
 std::unique_ptr<proto::desktop::VideoPacket> VideoEncoderVPX::encode(const DesktopFrame* frame)
 {
+    TRACE_EVENT("VideoEncoderVPX::encode");
+
     Q_ASSERT(encoding_ == proto::desktop::VIDEO_ENCODING_VP8 ||
              encoding_ == proto::desktop::VIDEO_ENCODING_VP9);
 
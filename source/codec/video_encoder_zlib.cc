@@ -9,6 +9,7 @@
 
 #include <QDebug>
 
+#include "base/trace_event.h"
 #include "codec/pixel_translator.h"
 #include "codec/video_util.h"
 #include "desktop_capture/desktop_frame.h"
@@ -99,6 +100,8 @@ void VideoEncoderZLIB::compressPacket(proto::desktop::VideoPacket* packet, size_
 
 std::unique_ptr<proto::desktop::VideoPacket> VideoEncoderZLIB::encode(const DesktopFrame* frame)
 {
+    TRACE_EVENT("VideoEncoderZLIB::encode");
+
     std::unique_ptr<proto::desktop::VideoPacket> packet =
         std::make_unique<proto::desktop::VideoPacket>();
 
@@ -10,7 +10,7 @@
 #include <QAbstractButton>
 #include <QMessageBox>
 
-#include "crypto/data_encryptor.h"
+#include "console/key_derivation_dialog.h"
 #include "crypto/random.h"
 
 namespace aspia {
@@ -25,7 +25,7 @@ constexpr int kMaxCommentLength = 2048;
 } // namespace
 
 AddressBookDialog::AddressBookDialog(QWidget* parent, proto::address_book::File* file,
-                                     proto::address_book::Data* data, QByteArray* key)
+                                     proto::address_book::Data* data, SecureBuffer* key)
     : QDialog(parent), file_(file), data_(data), key_(key)
 {
     ui.setupUi(this);
@@ -181,14 +181,26 @@ void AddressBookDialog::buttonBoxClicked(QAbstractButton* button)
                 // New salt is generated each time the password is changed.
                 QByteArray hashing_salt =
                     Random::generateBuffer(ui.spinbox_password_salt->value());
+                int hashing_rounds = ui.spinbox_hashing_rounds->value();
+
+                QByteArray password_utf8 = password.toUtf8();
+
+                // Now generate a key for encryption/decryption. The dialog remains open if the
+                // user cancels it.
+                SecureBuffer key;
+                bool key_created = KeyDerivationDialog::createKey(
+                    this, password_utf8, hashing_salt, hashing_rounds, &key);
+
+                secureMemZero(&password_utf8);
+
+                if (!key_created)
+                    return;
 
                 // Save the salt and the number of hashing iterations.
-                file_->set_hashing_rounds(ui.spinbox_hashing_rounds->value());
+                file_->set_hashing_rounds(hashing_rounds);
                 *file_->mutable_hashing_salt() = hashing_salt.toStdString();
 
-                // Now generate a key for encryption/decryption.
-                *key_ = DataEncryptor::createKey(password.toUtf8(), hashing_salt,
-                                                 file_->hashing_rounds());
+                *key_ = std::move(key);
             }
 
             int salt_before_size = ui.spinbox_salt_before->value();
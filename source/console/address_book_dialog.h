@@ -8,6 +8,7 @@
 #ifndef _ASPIA_CONSOLE__ADDRESS_BOOK_DIALOG_H
 #define _ASPIA_CONSOLE__ADDRESS_BOOK_DIALOG_H
 
+#include "crypto/secure_memory.h"
 #include "protocol/address_book.pb.h"
 #include "ui_address_book_dialog.h"
 
@@ -21,7 +22,7 @@ public:
     AddressBookDialog(QWidget* parent,
                       proto::address_book::File* file,
                       proto::address_book::Data* data,
-                      QByteArray* key);
+                      SecureBuffer* key);
     ~AddressBookDialog() = default;
 
 protected:
@@ -42,7 +43,7 @@ private:
 
     proto::address_book::File* file_;
     proto::address_book::Data* data_;
-    QByteArray* key_;
+    SecureBuffer* key_;
 
     bool password_changed_ = true;
     bool value_reverting_ = false;
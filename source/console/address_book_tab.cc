@@ -19,6 +19,7 @@
 #include "console/computer_group_dialog.h"
 #include "console/computer_item.h"
 #include "console/console_settings.h"
+#include "console/key_derivation_dialog.h"
 #include "console/open_address_book_dialog.h"
 #include "crypto/data_encryptor.h"
 #include "crypto/secure_memory.h"
@@ -84,7 +85,7 @@ void cleanupFile(proto::address_book::File* file)
 AddressBookTab::AddressBookTab(const QString& file_path,
                                proto::address_book::File&& file,
                                proto::address_book::Data&& data,
-                               QByteArray&& key,
+                               SecureBuffer&& key,
                                QWidget* parent)
     : ConsoleTab(ConsoleTab::AddressBook, parent),
       file_path_(file_path),
@@ -158,7 +159,6 @@ AddressBookTab::~AddressBookTab()
     cleanupFile(&file_);
 
     secureMemZero(&file_path_);
-    secureMemZero(&key_);
 }
 
 // static
@@ -166,7 +166,7 @@ AddressBookTab* AddressBookTab::createNew(QWidget* parent)
 {
     proto::address_book::File file;
     proto::address_book::Data data;
-    QByteArray key;
+    SecureBuffer key;
 
     AddressBookDialog dialog(parent, &file, &data, &key);
     if (dialog.exec() != QDialog::Accepted)
@@ -210,7 +210,7 @@ AddressBookTab* AddressBookTab::openFromFile(const QString& file_path, QWidget*
     secureMemZero(&buffer);
 
     proto::address_book::Data address_book_data;
-    QByteArray key;
+    SecureBuffer key;
 
     switch (address_book_file.encryption_type())
     {
@@ -230,10 +230,20 @@ AddressBookTab* AddressBookTab::openFromFile(const QString& file_path, QWidget*
             if (dialog.exec() != QDialog::Accepted)
                 return nullptr;
 
-            key = DataEncryptor::createKey(
-                dialog.password().toUtf8(),
+            QByteArray password = dialog.password().toUtf8();
+
+            bool key_created = KeyDerivationDialog::createKey(
+                parent,
+                password,
                 QByteArray::fromStdString(address_book_file.hashing_salt()),
-                address_book_file.hashing_rounds());
+                address_book_file.hashing_rounds(),
+                &key);
+
+            secureMemZero(&password);
+
+            // The user has canceled the derivation of the key.
+            if (!key_created)
+                return nullptr;
 
             QByteArray decrypted_data;
 
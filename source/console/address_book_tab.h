@@ -9,6 +9,7 @@
 #define _ASPIA_CONSOLE__ADDRESS_BOOK_TAB_H
 
 #include "console/console_tab.h"
+#include "crypto/secure_memory.h"
 #include "protocol/address_book.pb.h"
 #include "ui_address_book_tab.h"
 
@@ -72,7 +73,7 @@ private:
     AddressBookTab(const QString& file_path,
                    proto::address_book::File&& file,
                    proto::address_book::Data&& data,
-                   QByteArray&& key,
+                   SecureBuffer&& key,
                    QWidget* parent);
 
     void updateComputerList(ComputerGroupItem* computer_group);
@@ -84,7 +85,9 @@ private:
     Ui::AddressBookTab ui;
 
     QString file_path_;
-    QByteArray key_;
+
+    // The key is derived when the address book is opened and is kept until it is closed.
+    SecureBuffer key_;
 
     proto::address_book::File file_;
     proto::address_book::Data data_;
@@ -0,0 +1,137 @@
+//
+// PROJECT:         Aspia
+// FILE:            console/key_derivation_dialog.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "console/key_derivation_dialog.h"
+
+#include <QThread>
+#include <QTimer>
+
+#include <atomic>
+
+#include "crypto/data_encryptor.h"
+
+namespace aspia {
+
+namespace {
+
+// If the derivation completes in this time, the dialog is not shown.
+constexpr unsigned long kShowDelay = 100; // 100 ms
+
+constexpr int kProgressInterval = 50; // 50 ms
+
+} // namespace
+
+class KeyDerivationDialog::Thread : public QThread
+{
+public:
+    Thread(const QByteArray& password, const QByteArray& salt, int rounds)
+        : password_(password.constData(), password.size()),
+          salt_(salt),
+          rounds_(rounds)
+    {
+        // Nothing
+    }
+
+    ~Thread()
+    {
+        cancel();
+        wait();
+    }
+
+    void cancel() { canceled_ = true; }
+    int completedRounds() const { return completed_rounds_; }
+
+    SecureBuffer takeKey() { return std::move(key_); }
+
+protected:
+    // QThread implementation.
+    void run() override
+    {
+        QByteArray password = QByteArray::fromRawData(
+            reinterpret_cast<const char*>(password_.data()), static_cast<int>(password_.size()));
+
+        key_ = DataEncryptor::createKey(password, salt_, rounds_, [this](int completed_rounds)
+        {
+            completed_rounds_ = completed_rounds;
+            return !canceled_;
+        });
+
+        password_.clear();
+    }
+
+private:
+    SecureBuffer password_;
+    const QByteArray salt_;
+    const int rounds_;
+
+    std::atomic_int completed_rounds_{ 0 };
+    std::atomic_bool canceled_{ false };
+
+    SecureBuffer key_;
+
+    Q_DISABLE_COPY(Thread)
+};
+
+KeyDerivationDialog::KeyDerivationDialog(QWidget* parent,
+                                         std::unique_ptr<Thread> thread,
+                                         int rounds)
+    : QProgressDialog(parent),
+      thread_(std::move(thread))
+{
+    setWindowTitle(tr("Address Book"));
+    setLabelText(tr("Creating the encryption key..."));
+    setRange(0, rounds);
+    setAutoReset(false);
+    setAutoClose(false);
+
+    QTimer* timer = new QTimer(this);
+    connect(timer, &QTimer::timeout, this, &KeyDerivationDialog::onTimer);
+    timer->start(kProgressInterval);
+}
+
+KeyDerivationDialog::~KeyDerivationDialog() = default;
+
+// static
+bool KeyDerivationDialog::createKey(QWidget* parent,
+                                    const QByteArray& password,
+                                    const QByteArray& salt,
+                                    int rounds,
+                                    SecureBuffer* key)
+{
+    std::unique_ptr<Thread> thread = std::make_unique<Thread>(password, salt, rounds);
+    thread->start();
+
+    // The derivation with a small number of rounds completes without the dialog.
+    if (!thread->wait(kShowDelay))
+    {
+        KeyDerivationDialog dialog(parent, std::move(thread), rounds);
+
+        if (dialog.exec() != QDialog::Accepted || dialog.wasCanceled())
+            return false;
+
+        thread = std::move(dialog.thread_);
+        thread->wait();
+    }
+
+    *key = thread->takeKey();
+    return !key->isEmpty();
+}
+
+void KeyDerivationDialog::onTimer()
+{
+    // The thread can finish before the dialog is created, so its state is checked here instead
+    // of the connection to QThread::finished.
+    if (thread_->isFinished())
+    {
+        accept();
+        return;
+    }
+
+    setValue(thread_->completedRounds());
+}
+
+} // namespace aspia
@@ -0,0 +1,52 @@
+//
+// PROJECT:         Aspia
+// FILE:            console/key_derivation_dialog.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CONSOLE__KEY_DERIVATION_DIALOG_H
+#define _ASPIA_CONSOLE__KEY_DERIVATION_DIALOG_H
+
+#include <QProgressDialog>
+
+#include <memory>
+
+#include "crypto/secure_memory.h"
+
+namespace aspia {
+
+// Derives the key of the address book in a separate thread, so the console stays responsive.
+// The derivation with a large number of rounds takes seconds, so the progress is shown and the
+// user can cancel it.
+class KeyDerivationDialog : public QProgressDialog
+{
+    Q_OBJECT
+
+public:
+    ~KeyDerivationDialog();
+
+    // Creates the key from the password (see DataEncryptor::createKey). The dialog is shown only
+    // if the derivation takes noticeable time. Returns false if the user has canceled it.
+    static bool createKey(QWidget* parent,
+                          const QByteArray& password,
+                          const QByteArray& salt,
+                          int rounds,
+                          SecureBuffer* key);
+
+private slots:
+    void onTimer();
+
+private:
+    class Thread;
+
+    KeyDerivationDialog(QWidget* parent, std::unique_ptr<Thread> thread, int rounds);
+
+    std::unique_ptr<Thread> thread_;
+
+    Q_DISABLE_COPY(KeyDerivationDialog)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CONSOLE__KEY_DERIVATION_DIALOG_H
@@ -7,7 +7,7 @@
 
 #include "crypto/data_encryptor.h"
 
-#include <QCryptographicHash>
+#include <QIODevice>
 
 extern "C" {
 #define SODIUM_STATIC
@@ -21,96 +21,257 @@ namespace aspia {
 
 namespace {
 
-const size_t kChunkSize = 4096;
+constexpr size_t kHeaderSize = crypto_secretstream_xchacha20poly1305_HEADERBYTES;
+constexpr size_t kTagSize = crypto_secretstream_xchacha20poly1305_ABYTES;
+
+// Reads up to |size| bytes. Unlike QIODevice::read it does not return until |size| bytes are
+// read or the end of the data is reached. Returns -1 on error.
+qint64 readData(QIODevice* device, char* data, qint64 size)
+{
+    qint64 total = 0;
+
+    while (total < size)
+    {
+        const qint64 read = device->read(data + total, size - total);
+        if (read < 0)
+            return -1;
+
+        if (!read)
+            break;
+
+        total += read;
+    }
+
+    return total;
+}
 
 } // namespace
 
 // static
-QByteArray DataEncryptor::createKey(const QByteArray& password,
-                                    const QByteArray& salt,
-                                    int rounds)
+SecureBuffer DataEncryptor::createKey(const QByteArray& password,
+                                      const QByteArray& salt,
+                                      int rounds,
+                                      const ProgressCallback& progress)
 {
-    QByteArray data = password;
+    if (rounds < 1)
+        return SecureBuffer(password.constData(), password.size());
+
+    // The intermediate hashes are kept in the secure memory as well as the key.
+    SecureBuffer key(crypto_hash_sha256_BYTES);
+
+    crypto_hash_sha256_state state;
 
     for (int i = 0; i < rounds; ++i)
     {
-        QCryptographicHash key_hash(QCryptographicHash::Sha256);
+        crypto_hash_sha256_init(&state);
 
-        key_hash.addData(data);
-        key_hash.addData(salt);
+        if (!i)
+        {
+            crypto_hash_sha256_update(&state,
+                                      reinterpret_cast<const quint8*>(password.constData()),
+                                      password.size());
+        }
+        else
+        {
+            crypto_hash_sha256_update(&state, key.data(), key.size());
+        }
+
+        crypto_hash_sha256_update(&state,
+                                  reinterpret_cast<const quint8*>(salt.constData()),
+                                  salt.size());
+        crypto_hash_sha256_final(&state, key.data());
+
+        if (progress && !progress(i + 1))
+        {
+            key.clear();
+            break;
+        }
+    }
+
+    sodium_memzero(&state, sizeof(state));
+    return key;
+}
+
+// static
+qint64 DataEncryptor::encryptedSize(qint64 source_size, int chunk_size)
+{
+    Q_ASSERT(source_size >= 0 && chunk_size > 0);
+
+    // The last chunk is always shorter than |chunk_size|. If the size of the data is a multiple
+    // of the chunk size, the last chunk is empty.
+    const qint64 chunk_count = source_size / chunk_size + 1;
+    return static_cast<qint64>(kHeaderSize) + chunk_count * static_cast<qint64>(kTagSize) +
+           source_size;
+}
+
+// static
+qint64 DataEncryptor::decryptedSize(qint64 source_size, int chunk_size)
+{
+    Q_ASSERT(chunk_size > 0);
+
+    if (source_size < static_cast<qint64>(kHeaderSize + kTagSize))
+        return -1;
+
+    const qint64 encrypted_chunk_size = chunk_size + static_cast<qint64>(kTagSize);
+    const qint64 payload_size = source_size - static_cast<qint64>(kHeaderSize);
+
+    qint64 chunk_count = payload_size / encrypted_chunk_size;
+    const qint64 remainder = payload_size % encrypted_chunk_size;
+
+    if (remainder)
+    {
+        if (remainder < static_cast<qint64>(kTagSize))
+            return -1;
 
-        data = key_hash.result();
+        ++chunk_count;
     }
 
-    return data;
+    return payload_size - chunk_count * static_cast<qint64>(kTagSize);
 }
 
 // static
-QByteArray DataEncryptor::encrypt(const QByteArray& source_data, const QByteArray& key)
+QByteArray DataEncryptor::encrypt(const QByteArray& source_data,
+                                  const SecureBuffer& key,
+                                  int chunk_size)
 {
     Q_ASSERT(key.size() == crypto_secretstream_xchacha20poly1305_KEYBYTES);
+    Q_ASSERT(chunk_size > 0);
 
+    // The size is known in advance, so the chunks are encrypted directly into the result.
     QByteArray encrypted_data;
-    encrypted_data.resize(crypto_secretstream_xchacha20poly1305_HEADERBYTES);
+    encrypted_data.resize(encryptedSize(source_data.size(), chunk_size));
+
+    quint8* output_buffer = reinterpret_cast<quint8*>(encrypted_data.data());
 
     crypto_secretstream_xchacha20poly1305_state state;
+    crypto_secretstream_xchacha20poly1305_init_push(&state, output_buffer, key.data());
 
-    crypto_secretstream_xchacha20poly1305_init_push(
-        &state,
-        reinterpret_cast<quint8*>(encrypted_data.data()),
-        reinterpret_cast<const quint8*>(key.constData()));
+    output_buffer += kHeaderSize;
 
     const quint8* input_buffer = reinterpret_cast<const quint8*>(source_data.constData());
+    const size_t input_size = source_data.size();
     size_t input_pos = 0;
 
-    bool end_of_buffer = false;
+    for (;;)
+    {
+        const size_t consumed = std::min(input_size - input_pos, static_cast<size_t>(chunk_size));
+        const bool is_final = consumed < static_cast<size_t>(chunk_size);
+
+        quint64 output_length;
+
+        crypto_secretstream_xchacha20poly1305_push(
+            &state,
+            output_buffer, &output_length,
+            input_buffer + input_pos, consumed,
+            nullptr, 0,
+            is_final ? crypto_secretstream_xchacha20poly1305_TAG_FINAL : 0);
+
+        output_buffer += output_length;
+        input_pos += consumed;
+
+        if (is_final)
+            break;
+    }
+
+    Q_ASSERT(output_buffer ==
+             reinterpret_cast<quint8*>(encrypted_data.data()) + encrypted_data.size());
 
-    do
+    sodium_memzero(&state, sizeof(state));
+    return encrypted_data;
+}
+
+// static
+bool DataEncryptor::encrypt(QIODevice* source,
+                            QIODevice* target,
+                            const SecureBuffer& key,
+                            int chunk_size)
+{
+    if (!source || !target || chunk_size <= 0)
     {
-        size_t consumed = std::min(source_data.size() - input_pos, kChunkSize);
-        quint8 tag = 0;
+        qWarning("Invalid parameters");
+        return false;
+    }
 
-        if (consumed < kChunkSize)
+    if (key.size() != crypto_secretstream_xchacha20poly1305_KEYBYTES)
+    {
+        qWarning("Invalid key size");
+        return false;
+    }
+
+    // The source data may be secret, so it is kept in the secure memory.
+    SecureBuffer input_buffer(chunk_size);
+    QByteArray output_buffer;
+    output_buffer.resize(chunk_size + kTagSize);
+
+    quint8 header[kHeaderSize];
+
+    crypto_secretstream_xchacha20poly1305_state state;
+    crypto_secretstream_xchacha20poly1305_init_push(&state, header, key.data());
+
+    bool result = true;
+
+    if (target->write(reinterpret_cast<const char*>(header), kHeaderSize) !=
+        static_cast<qint64>(kHeaderSize))
+    {
+        qWarning("Unable to write header");
+        result = false;
+    }
+
+    while (result)
+    {
+        const qint64 consumed =
+            readData(source, reinterpret_cast<char*>(input_buffer.data()), chunk_size);
+        if (consumed < 0)
         {
-            tag = crypto_secretstream_xchacha20poly1305_TAG_FINAL;
-            end_of_buffer = true;
+            qWarning("Unable to read source data");
+            result = false;
+            break;
         }
 
-        quint8 output_buffer[kChunkSize + crypto_secretstream_xchacha20poly1305_ABYTES];
-        quint64 output_length;
-
-        crypto_secretstream_xchacha20poly1305_push(&state,
-                                                   output_buffer, &output_length,
-                                                   input_buffer + input_pos, consumed,
-                                                   nullptr, 0,
-                                                   tag);
+        const bool is_final = consumed < chunk_size;
 
-        size_t old_size = encrypted_data.size();
+        quint64 output_length;
 
-        encrypted_data.resize(old_size + static_cast<size_t>(output_length));
-        memcpy(encrypted_data.data() + old_size, output_buffer, static_cast<size_t>(output_length));
+        crypto_secretstream_xchacha20poly1305_push(
+            &state,
+            reinterpret_cast<quint8*>(output_buffer.data()), &output_length,
+            input_buffer.data(), consumed,
+            nullptr, 0,
+            is_final ? crypto_secretstream_xchacha20poly1305_TAG_FINAL : 0);
 
-        input_pos += consumed;
+        if (target->write(output_buffer.constData(), output_length) !=
+            static_cast<qint64>(output_length))
+        {
+            qWarning("Unable to write encrypted data");
+            result = false;
+            break;
+        }
 
-    } while (!end_of_buffer);
+        if (is_final)
+            break;
+    }
 
-    return encrypted_data;
+    sodium_memzero(&state, sizeof(state));
+    return result;
 }
 
 // static
 bool DataEncryptor::decrypt(const QByteArray& source_data,
-                            const QByteArray& key,
-                            QByteArray* decrypted_data)
+                            const SecureBuffer& key,
+                            QByteArray* decrypted_data,
+                            int chunk_size)
 {
-    return decrypt(source_data.constData(), source_data.size(), key, decrypted_data);
+    return decrypt(source_data.constData(), source_data.size(), key, decrypted_data, chunk_size);
 }
 
 // static
-bool DataEncryptor::decrypt(const char* source_data, int source_size, const QByteArray& key,
-                            QByteArray* decrypted_data)
+bool DataEncryptor::decrypt(const char* source_data,
+                            int source_size,
+                            const SecureBuffer& key,
+                            QByteArray* decrypted_data,
+                            int chunk_size)
 {
-    if (!source_data || source_size < crypto_secretstream_xchacha20poly1305_HEADERBYTES ||
-        !decrypted_data)
+    if (!source_data || !decrypted_data || chunk_size <= 0)
     {
         qWarning("Invalid parameters");
         return false;
@@ -124,29 +285,37 @@ bool DataEncryptor::decrypt(const char* source_data, int source_size, const QByt
 
     decrypted_data->clear();
 
+    const qint64 decrypted_size = decryptedSize(source_size, chunk_size);
+    if (decrypted_size < 0)
+    {
+        qWarning("Invalid size of encrypted data");
+        return false;
+    }
+
     crypto_secretstream_xchacha20poly1305_state state;
 
     if (crypto_secretstream_xchacha20poly1305_init_pull(
-            &state, reinterpret_cast<const quint8*>(source_data),
-            reinterpret_cast<const quint8*>(key.constData())) != 0)
+            &state, reinterpret_cast<const quint8*>(source_data), key.data()) != 0)
     {
         qWarning("crypto_secretstream_xchacha20poly1305_init_pull failed");
         return false;
     }
 
-    const quint8* input_buffer = reinterpret_cast<const quint8*>(source_data) +
-                                 crypto_secretstream_xchacha20poly1305_HEADERBYTES;
-    size_t input_size = source_size - crypto_secretstream_xchacha20poly1305_HEADERBYTES;
+    // The chunks are decrypted directly into the result.
+    decrypted_data->resize(decrypted_size);
+
+    const quint8* input_buffer = reinterpret_cast<const quint8*>(source_data) + kHeaderSize;
+    const size_t input_size = source_size - kHeaderSize;
     size_t input_pos = 0;
 
-    bool end_of_buffer = false;
+    quint8* output_buffer = reinterpret_cast<quint8*>(decrypted_data->data());
+
+    bool result = true;
 
-    do
+    for (;;)
     {
-        size_t consumed = std::min(input_size - input_pos,
-                                   kChunkSize + crypto_secretstream_xchacha20poly1305_ABYTES);
+        const size_t consumed = std::min(input_size - input_pos, chunk_size + kTagSize);
 
-        quint8 output_buffer[kChunkSize];
         quint64 output_length;
         quint8 tag;
 
@@ -155,31 +324,129 @@ bool DataEncryptor::decrypt(const char* source_data, int source_size, const QByt
                                                        0) != 0)
         {
             qWarning("crypto_secretstream_xchacha20poly1305_pull failed");
-            return false;
+            result = false;
+            break;
         }
 
+        output_buffer += output_length;
         input_pos += consumed;
 
-        if (tag == crypto_secretstream_xchacha20poly1305_TAG_FINAL)
+        const bool is_final = tag == crypto_secretstream_xchacha20poly1305_TAG_FINAL;
+
+        if (is_final != (input_pos == input_size))
         {
-            if (input_pos != input_size)
-            {
-                qWarning("Unexpected end of buffer");
-                return false;
-            }
+            qWarning("Unexpected end of buffer");
+            result = false;
+            break;
+        }
+
+        if (is_final)
+            break;
+    }
+
+    if (!result)
+    {
+        // The chunks decrypted before the error must not be used.
+        sodium_memzero(decrypted_data->data(), decrypted_data->size());
+        decrypted_data->clear();
+    }
+
+    sodium_memzero(&state, sizeof(state));
+    return result;
+}
+
+// static
+bool DataEncryptor::decrypt(QIODevice* source,
+                            QIODevice* target,
+                            const SecureBuffer& key,
+                            int chunk_size)
+{
+    if (!source || !target || chunk_size <= 0)
+    {
+        qWarning("Invalid parameters");
+        return false;
+    }
+
+    if (key.size() != crypto_secretstream_xchacha20poly1305_KEYBYTES)
+    {
+        qWarning("Invalid key size");
+        return false;
+    }
+
+    quint8 header[kHeaderSize];
+
+    if (readData(source, reinterpret_cast<char*>(header), kHeaderSize) !=
+        static_cast<qint64>(kHeaderSize))
+    {
+        qWarning("Unable to read header");
+        return false;
+    }
+
+    crypto_secretstream_xchacha20poly1305_state state;
 
-            end_of_buffer = true;
+    if (crypto_secretstream_xchacha20poly1305_init_pull(&state, header, key.data()) != 0)
+    {
+        qWarning("crypto_secretstream_xchacha20poly1305_init_pull failed");
+        return false;
+    }
+
+    QByteArray input_buffer;
+    input_buffer.resize(chunk_size + kTagSize);
+
+    // The decrypted data is kept in the secure memory.
+    SecureBuffer output_buffer(chunk_size);
+
+    bool result = true;
+
+    for (;;)
+    {
+        // A chunk shorter than the tag (including the end of the data before the final chunk)
+        // is rejected by crypto_secretstream_xchacha20poly1305_pull.
+        const qint64 consumed = readData(source, input_buffer.data(), input_buffer.size());
+        if (consumed < 0)
+        {
+            qWarning("Unable to read encrypted data");
+            result = false;
+            break;
         }
 
-        size_t old_size = decrypted_data->size();
+        quint64 output_length;
+        quint8 tag;
 
-        decrypted_data->resize(old_size + static_cast<size_t>(output_length));
-        memcpy(decrypted_data->data() + old_size, output_buffer,
-               static_cast<size_t>(output_length));
+        if (crypto_secretstream_xchacha20poly1305_pull(
+                &state, output_buffer.data(), &output_length, &tag,
+                reinterpret_cast<const quint8*>(input_buffer.constData()), consumed,
+                nullptr, 0) != 0)
+        {
+            qWarning("crypto_secretstream_xchacha20poly1305_pull failed");
+            result = false;
+            break;
+        }
+
+        if (target->write(reinterpret_cast<const char*>(output_buffer.data()), output_length) !=
+            static_cast<qint64>(output_length))
+        {
+            qWarning("Unable to write decrypted data");
+            result = false;
+            break;
+        }
 
-    } while (!end_of_buffer);
+        if (tag == crypto_secretstream_xchacha20poly1305_TAG_FINAL)
+        {
+            char extra_byte;
+
+            if (readData(source, &extra_byte, 1) != 0)
+            {
+                qWarning("Unexpected end of data");
+                result = false;
+            }
+
+            break;
+        }
+    }
 
-    return true;
+    sodium_memzero(&state, sizeof(state));
+    return result;
 }
 
 } // namespace aspia
@@ -10,26 +10,68 @@
 
 #include <QByteArray>
 
+#include <functional>
+
+class QIODevice;
+
+#include "crypto/secure_memory.h"
+
 namespace aspia {
 
 class DataEncryptor
 {
 public:
-    // Creates a key from the password. |password| must be in UTF-8 encoding.
-    static QByteArray createKey(const QByteArray& password,
-                                const QByteArray& salt,
-                                int rounds);
+    // Called after each round of the key derivation with the number of the completed rounds.
+    // If it returns false, the derivation is stopped.
+    using ProgressCallback = std::function<bool(int completed_rounds)>;
+
+    // Creates a key from the password. |password| must be in UTF-8 encoding. Returns an empty
+    // buffer if the derivation is stopped by |progress|.
+    static SecureBuffer createKey(const QByteArray& password,
+                                  const QByteArray& salt,
+                                  int rounds,
+                                  const ProgressCallback& progress = nullptr);
+
+    // The data is encrypted with chunks of |chunk_size| bytes, each of them is authenticated
+    // separately. The data can be decrypted only with the chunk size used for the encryption.
+    // The address book files use the default size.
+    static const int kDefaultChunkSize = 4096;
 
-    static QByteArray encrypt(const QByteArray& source_data, const QByteArray& key);
+    // Returns the size of the encrypted data for |source_size| bytes of the source data.
+    static qint64 encryptedSize(qint64 source_size, int chunk_size = kDefaultChunkSize);
+
+    // Returns the size of the decrypted data for |source_size| bytes of the encrypted data or -1
+    // if the encrypted data can not have such size.
+    static qint64 decryptedSize(qint64 source_size, int chunk_size = kDefaultChunkSize);
+
+    static QByteArray encrypt(const QByteArray& source_data,
+                              const SecureBuffer& key,
+                              int chunk_size = kDefaultChunkSize);
+
+    // Encrypts the data from |source| until its end and writes the result to |target|. Only one
+    // chunk of the data is kept in memory.
+    static bool encrypt(QIODevice* source,
+                        QIODevice* target,
+                        const SecureBuffer& key,
+                        int chunk_size = kDefaultChunkSize);
 
     static bool decrypt(const QByteArray& source_data,
-                        const QByteArray& key,
-                        QByteArray* decrypted_data);
+                        const SecureBuffer& key,
+                        QByteArray* decrypted_data,
+                        int chunk_size = kDefaultChunkSize);
 
     static bool decrypt(const char* source_data,
                         int source_size,
-                        const QByteArray& key,
-                        QByteArray* decrypted_data);
+                        const SecureBuffer& key,
+                        QByteArray* decrypted_data,
+                        int chunk_size = kDefaultChunkSize);
+
+    // Decrypts the data from |source| until its end and writes the result to |target|. If the
+    // function fails, the data already written to |target| must be discarded.
+    static bool decrypt(QIODevice* source,
+                        QIODevice* target,
+                        const SecureBuffer& key,
+                        int chunk_size = kDefaultChunkSize);
 
 private:
     Q_DISABLE_COPY(DataEncryptor)
@@ -8,6 +8,7 @@
 #include "crypto/encryptor.h"
 
 #include "base/message_serialization.h"
+#include "base/trace_event.h"
 #include "protocol/key_exchange.pb.h"
 
 extern "C" {
@@ -178,6 +179,8 @@ QByteArray Encryptor::helloMessage()
 
 QByteArray Encryptor::encrypt(const QByteArray& source_buffer)
 {
+    TRACE_EVENT("Encryptor::encrypt");
+
     Q_ASSERT(local_public_key_.empty());
     Q_ASSERT(local_secret_key_.empty());
     Q_ASSERT(encrypt_nonce_.size() == crypto_secretbox_NONCEBYTES);
@@ -204,6 +207,8 @@ QByteArray Encryptor::encrypt(const QByteArray& source_buffer)
 
 QByteArray Encryptor::decrypt(const QByteArray& source_buffer)
 {
+    TRACE_EVENT("Encryptor::decrypt");
+
     Q_ASSERT(local_public_key_.empty());
     Q_ASSERT(local_secret_key_.empty());
     Q_ASSERT(decrypt_nonce_.size() == crypto_secretbox_NONCEBYTES);
@@ -0,0 +1,47 @@
+//
+// PROJECT:         Aspia
+// FILE:            crypto/generic_hash.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "crypto/generic_hash.h"
+
+extern "C" {
+#define SODIUM_STATIC
+
+#pragma warning(push, 3)
+#include <sodium.h>
+#pragma warning(pop)
+} // extern "C"
+
+namespace aspia {
+
+struct GenericHash::State
+{
+    crypto_generichash_state state;
+};
+
+GenericHash::GenericHash()
+    : state_(std::make_unique<State>())
+{
+    crypto_generichash_init(&state_->state, nullptr, 0, crypto_generichash_BYTES);
+}
+
+GenericHash::~GenericHash() = default;
+
+void GenericHash::addData(const char* data, size_t size)
+{
+    crypto_generichash_update(&state_->state, reinterpret_cast<const quint8*>(data), size);
+}
+
+std::string GenericHash::result()
+{
+    std::string hash;
+    hash.resize(crypto_generichash_BYTES);
+
+    crypto_generichash_final(&state_->state, reinterpret_cast<quint8*>(&hash[0]), hash.size());
+    return hash;
+}
+
+} // namespace aspia
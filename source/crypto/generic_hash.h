@@ -0,0 +1,39 @@
+//
+// PROJECT:         Aspia
+// FILE:            crypto/generic_hash.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CRYPTO__GENERIC_HASH_H
+#define _ASPIA_CRYPTO__GENERIC_HASH_H
+
+#include <QtGlobal>
+
+#include <memory>
+#include <string>
+
+namespace aspia {
+
+// Computes BLAKE2b of the data which is added in parts.
+class GenericHash
+{
+public:
+    GenericHash();
+    ~GenericHash();
+
+    void addData(const char* data, size_t size);
+
+    // Returns the hash of the added data. The instance can not be used after that.
+    std::string result();
+
+private:
+    struct State;
+    std::unique_ptr<State> state_;
+
+    Q_DISABLE_COPY(GenericHash)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CRYPTO__GENERIC_HASH_H
@@ -47,4 +47,66 @@ void secureMemZero(QByteArray* bytes)
     secureMemZero(bytes->data(), bytes->size());
 }
 
+SecureBuffer::SecureBuffer(size_t size)
+{
+    if (!size)
+        return;
+
+    // The size of the memory pages is determined during the initialization.
+    if (sodium_init() == -1)
+        qFatal("sodium_init failed");
+
+    data_ = reinterpret_cast<quint8*>(sodium_malloc(size));
+    if (!data_)
+        qFatal("Unable to allocate secure memory");
+
+    size_ = size;
+}
+
+SecureBuffer::SecureBuffer(const void* data, size_t size)
+    : SecureBuffer(size)
+{
+    if (size)
+        memcpy(data_, data, size);
+}
+
+SecureBuffer::SecureBuffer(SecureBuffer&& other) noexcept
+    : data_(other.data_),
+      size_(other.size_)
+{
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+SecureBuffer& SecureBuffer::operator=(SecureBuffer&& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+
+        data_ = other.data_;
+        size_ = other.size_;
+
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    return *this;
+}
+
+SecureBuffer::~SecureBuffer()
+{
+    clear();
+}
+
+void SecureBuffer::clear()
+{
+    // sodium_free zeroes the memory before it is released.
+    if (data_)
+        sodium_free(data_);
+
+    data_ = nullptr;
+    size_ = 0;
+}
+
 } // namespace aspia
@@ -17,6 +17,34 @@ void secureMemZero(std::string* str);
 void secureMemZero(QString* str);
 void secureMemZero(QByteArray* bytes);
 
+// The buffer for keys and other secrets which are kept for a long time. The memory is locked
+// (it is not written to the swap file), is surrounded by guard pages and is zeroed when the
+// buffer is destroyed.
+class SecureBuffer
+{
+public:
+    SecureBuffer() = default;
+    explicit SecureBuffer(size_t size);
+    SecureBuffer(const void* data, size_t size);
+    SecureBuffer(SecureBuffer&& other) noexcept;
+    SecureBuffer& operator=(SecureBuffer&& other) noexcept;
+    ~SecureBuffer();
+
+    void clear();
+
+    bool isEmpty() const { return !size_; }
+    size_t size() const { return size_; }
+
+    quint8* data() { return data_; }
+    const quint8* data() const { return data_; }
+
+private:
+    quint8* data_ = nullptr;
+    size_t size_ = 0;
+
+    Q_DISABLE_COPY(SecureBuffer)
+};
+
 } // namespace aspia
 
 #endif // _ASPIA_CRYPTO__SECURE_MEMORY_H
@@ -18,7 +18,7 @@ class Capturer
 public:
     virtual ~Capturer() = default;
 
-    virtual const DesktopFrame* captureImage() = 0;
+    virtual DesktopFrame* captureImage() = 0;
     virtual std::unique_ptr<MouseCursor> captureCursor() = 0;
 };
 
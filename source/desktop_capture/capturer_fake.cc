@@ -0,0 +1,157 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/capturer_fake.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/capturer_fake.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kBlockSize = 256;
+constexpr int kBlockStep = 8;
+constexpr int kCursorSize = 32;
+
+// The cursor shape changes every |kCursorChangeInterval| captured frames.
+constexpr int kCursorChangeInterval = 30;
+
+} // namespace
+
+CapturerFake::CapturerFake(std::unique_ptr<DesktopFrameAligned> frame)
+    : frame_(std::move(frame)),
+      block_rect_(0, 0, kBlockSize, kBlockSize)
+{
+    drawBackground();
+}
+
+// static
+std::unique_ptr<CapturerFake> CapturerFake::create(const QSize& size)
+{
+    if (size.width() < kBlockSize || size.height() < kBlockSize)
+    {
+        qWarning("Too small size for fake capturer");
+        return nullptr;
+    }
+
+    std::unique_ptr<DesktopFrameAligned> frame =
+        DesktopFrameAligned::create(size, PixelFormat::ARGB());
+    if (!frame)
+        return nullptr;
+
+    return std::unique_ptr<CapturerFake>(new CapturerFake(std::move(frame)));
+}
+
+DesktopFrame* CapturerFake::captureImage()
+{
+    QRegion* updated_region = frame_->mutableUpdatedRegion();
+
+    if (!frame_count_)
+    {
+        // The first frame is sent completely.
+        *updated_region = QRect(QPoint(), frame_->size());
+    }
+    else
+    {
+        const QRect frame_rect(QPoint(), frame_->size());
+
+        *updated_region = block_rect_;
+
+        // Restore the background under the block and move it to the next position.
+        drawBackground();
+
+        block_rect_.translate(kBlockStep, 0);
+        if (!frame_rect.contains(block_rect_))
+        {
+            block_rect_.moveLeft(0);
+            block_rect_.translate(0, kBlockSize);
+
+            if (!frame_rect.contains(block_rect_))
+                block_rect_.moveTop(0);
+        }
+
+        *updated_region += block_rect_;
+    }
+
+    drawBlock(block_rect_);
+
+    ++frame_count_;
+    return frame_.get();
+}
+
+std::unique_ptr<MouseCursor> CapturerFake::captureCursor()
+{
+    if (frame_count_ < cursor_count_ * kCursorChangeInterval)
+        return nullptr;
+
+    const int shape = cursor_count_++ % 2;
+
+    const size_t size = kCursorSize * kCursorSize * sizeof(quint32);
+    std::unique_ptr<quint8[]> data = std::make_unique<quint8[]>(size);
+
+    quint32* pixel = reinterpret_cast<quint32*>(data.get());
+
+    for (int y = 0; y < kCursorSize; ++y)
+    {
+        for (int x = 0; x < kCursorSize; ++x)
+        {
+            // Arrow-like triangle or a square, white with a black border.
+            const bool inside = shape ? true : (x <= y);
+            const bool border = x == 0 || y == 0 || x == kCursorSize - 1 ||
+                                y == kCursorSize - 1 || (!shape && x == y);
+
+            if (!inside)
+                *pixel = 0x00000000;
+            else if (border)
+                *pixel = 0xFF000000;
+            else
+                *pixel = 0xFFFFFFFF;
+
+            ++pixel;
+        }
+    }
+
+    return MouseCursor::create(std::move(data), QSize(kCursorSize, kCursorSize), QPoint(0, 0));
+}
+
+void CapturerFake::drawBackground()
+{
+    const int width = frame_->size().width();
+    const int height = frame_->size().height();
+
+    // The whole background is redrawn only for the first frame. After that only the area
+    // under the block is restored.
+    const QRect rect = frame_count_ ? block_rect_ : QRect(0, 0, width, height);
+
+    for (int y = rect.top(); y <= rect.bottom(); ++y)
+    {
+        quint32* pixel = reinterpret_cast<quint32*>(frame_->frameDataAtPos(rect.left(), y));
+
+        for (int x = rect.left(); x <= rect.right(); ++x)
+        {
+            // A smooth gradient is close to what a real desktop wallpaper looks like.
+            *pixel++ = 0xFF000000 | ((x * 255 / width) << 16) | ((y * 255 / height) << 8) | 0x80;
+        }
+    }
+}
+
+void CapturerFake::drawBlock(const QRect& rect)
+{
+    const quint32 color = 0xFF000000 | ((frame_count_ * 7) & 0xFF) << 16 |
+                          ((frame_count_ * 13) & 0xFF) << 8 | ((frame_count_ * 3) & 0xFF);
+
+    for (int y = rect.top(); y <= rect.bottom(); ++y)
+    {
+        quint32* pixel = reinterpret_cast<quint32*>(frame_->frameDataAtPos(rect.left(), y));
+
+        for (int x = rect.left(); x <= rect.right(); ++x)
+        {
+            // Stripes make the block content compressible but not trivial.
+            *pixel++ = ((x + y + frame_count_) & 0x10) ? color : ~color | 0xFF000000;
+        }
+    }
+}
+
+} // namespace aspia
@@ -0,0 +1,46 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/capturer_fake.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__CAPTURER_FAKE_H
+#define _ASPIA_DESKTOP_CAPTURE__CAPTURER_FAKE_H
+
+#include "desktop_capture/capturer.h"
+#include "desktop_capture/desktop_frame_aligned.h"
+
+namespace aspia {
+
+// Platform independent capturer which generates a synthetic desktop: a static background with
+// a block moving across it and a periodically changing cursor. It is used to measure the
+// capture and encode pipeline on systems without GDI.
+class CapturerFake : public Capturer
+{
+public:
+    ~CapturerFake() = default;
+
+    static std::unique_ptr<CapturerFake> create(const QSize& size);
+
+    DesktopFrame* captureImage() override;
+    std::unique_ptr<MouseCursor> captureCursor() override;
+
+private:
+    explicit CapturerFake(std::unique_ptr<DesktopFrameAligned> frame);
+
+    void drawBackground();
+    void drawBlock(const QRect& rect);
+
+    std::unique_ptr<DesktopFrameAligned> frame_;
+
+    QRect block_rect_;
+    int frame_count_ = 0;
+    int cursor_count_ = 0;
+
+    Q_DISABLE_COPY(CapturerFake)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__CAPTURER_FAKE_H
@@ -10,6 +10,8 @@
 #include <QDebug>
 #include <dwmapi.h>
 
+#include "base/trace_event.h"
+
 namespace aspia {
 
 namespace {
@@ -343,8 +345,10 @@ bool CapturerGDI::prepareCaptureResources()
     return true;
 }
 
-const DesktopFrame* CapturerGDI::captureImage()
+DesktopFrame* CapturerGDI::captureImage()
 {
+    TRACE_EVENT("Capturer::captureImage");
+
     if (!prepareCaptureResources())
         return nullptr;
 
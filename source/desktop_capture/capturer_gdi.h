@@ -24,7 +24,7 @@ public:
 
     static std::unique_ptr<CapturerGDI> create();
 
-    const DesktopFrame* captureImage() override;
+    DesktopFrame* captureImage() override;
     std::unique_ptr<MouseCursor> captureCursor() override;
 
 private:
@@ -7,6 +7,8 @@
 
 #include "desktop_capture/desktop_frame.h"
 
+#include <cstring>
+
 namespace aspia {
 
 DesktopFrame::DesktopFrame(const QSize& size,
@@ -36,4 +38,22 @@ quint8* DesktopFrame::frameDataAtPos(int x, int y) const
     return frameDataAtPos(QPoint(x, y));
 }
 
+void DesktopFrame::copyPixelsFrom(const DesktopFrame& src, const QRect& rect)
+{
+    Q_ASSERT(format_.bytesPerPixel() == src.format().bytesPerPixel());
+
+    const quint8* src_ptr = src.frameDataAtPos(rect.topLeft());
+    quint8* dst_ptr = frameDataAtPos(rect.topLeft());
+
+    const size_t bytes_per_row = rect.width() * format_.bytesPerPixel();
+
+    for (int y = 0; y < rect.height(); ++y)
+    {
+        memcpy(dst_ptr, src_ptr, bytes_per_row);
+
+        src_ptr += src.stride();
+        dst_ptr += stride_;
+    }
+}
+
 } // namespace aspia
@@ -29,6 +29,9 @@ public:
     int stride() const { return stride_; }
     bool contains(int x, int y) const;
 
+    // Copies the pixels of |rect| from |src|. Both frames must have the same pixel format.
+    void copyPixelsFrom(const DesktopFrame& src, const QRect& rect);
+
     const QRegion& updatedRegion() const { return updated_region_; }
     QRegion* mutableUpdatedRegion() { return &updated_region_; }
 
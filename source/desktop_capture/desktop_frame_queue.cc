@@ -0,0 +1,132 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/desktop_frame_queue.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/desktop_frame_queue.h"
+
+namespace aspia {
+
+void DesktopFrameQueue::push(const DesktopFrame& frame)
+{
+    const QRegion& updated_region = frame.updatedRegion();
+    if (updated_region.isEmpty())
+        return;
+
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    if (stopped_)
+        return;
+
+    for (int i = 0; i < kPoolSize; ++i)
+        pool_[i].stale_region += updated_region;
+
+    Entry* entry = nullptr;
+
+    if (queue_.size() < kMaxQueueSize)
+    {
+        for (int i = 0; i < kPoolSize; ++i)
+        {
+            if (pool_[i].state == State::FREE)
+            {
+                entry = &pool_[i];
+                break;
+            }
+        }
+
+        Q_ASSERT(entry);
+
+        if (entry->frame)
+            *entry->frame->mutableUpdatedRegion() = QRegion();
+
+        if (!prepareEntry(entry, frame))
+            return;
+
+        *entry->frame->mutableUpdatedRegion() += updated_region;
+        entry->state = State::QUEUED;
+        queue_.push_back(entry);
+    }
+    else
+    {
+        // The consumer is too slow. The newest queued frame takes the changes of this one.
+        entry = queue_.back();
+
+        if (!prepareEntry(entry, frame))
+        {
+            queue_.pop_back();
+            entry->state = State::FREE;
+            return;
+        }
+
+        *entry->frame->mutableUpdatedRegion() += updated_region;
+    }
+
+    for (const auto& rect : entry->stale_region)
+        entry->frame->copyPixelsFrom(frame, rect);
+
+    entry->stale_region = QRegion();
+
+    condition_.notify_one();
+}
+
+DesktopFrame* DesktopFrameQueue::pop()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while (queue_.empty() && !stopped_)
+        condition_.wait(lock);
+
+    if (stopped_)
+        return nullptr;
+
+    Entry* entry = queue_.front();
+    queue_.pop_front();
+
+    entry->state = State::IN_USE;
+    return entry->frame.get();
+}
+
+void DesktopFrameQueue::release(DesktopFrame* frame)
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    for (int i = 0; i < kPoolSize; ++i)
+    {
+        if (pool_[i].frame.get() == frame)
+        {
+            Q_ASSERT(pool_[i].state == State::IN_USE);
+            pool_[i].state = State::FREE;
+            return;
+        }
+    }
+
+    Q_UNREACHABLE();
+}
+
+void DesktopFrameQueue::stop()
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+    stopped_ = true;
+    condition_.notify_all();
+}
+
+bool DesktopFrameQueue::prepareEntry(Entry* entry, const DesktopFrame& frame)
+{
+    if (entry->frame && entry->frame->size() == frame.size())
+        return true;
+
+    // The screen size has changed (or the frame has not been used yet).
+    entry->frame = DesktopFrameAligned::create(frame.size(), frame.format());
+    if (!entry->frame)
+        return false;
+
+    const QRect frame_rect(QPoint(), frame.size());
+
+    entry->stale_region = frame_rect;
+    *entry->frame->mutableUpdatedRegion() = frame_rect;
+    return true;
+}
+
+} // namespace aspia
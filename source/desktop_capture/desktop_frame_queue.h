@@ -0,0 +1,73 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/desktop_frame_queue.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__DESKTOP_FRAME_QUEUE_H
+#define _ASPIA_DESKTOP_CAPTURE__DESKTOP_FRAME_QUEUE_H
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "desktop_capture/desktop_frame_aligned.h"
+
+namespace aspia {
+
+// Bounded queue between the capture and encode stages. Captured frames are copied into a
+// fixed pool of frames, so the capturer can reuse its own buffers immediately. Only the areas
+// changed since a pooled frame was last filled are copied. When the queue is full, a new
+// capture is merged into the newest queued frame instead of waiting for the consumer.
+class DesktopFrameQueue
+{
+public:
+    static const int kMaxQueueSize = 2;
+
+    DesktopFrameQueue() = default;
+    ~DesktopFrameQueue() = default;
+
+    // Adds the changes of |frame| to the queue. Never blocks for the consumer.
+    void push(const DesktopFrame& frame);
+
+    // Waits for the next frame. Returns nullptr if the queue was stopped. The returned frame
+    // must be given back with release() before the next call.
+    DesktopFrame* pop();
+    void release(DesktopFrame* frame);
+
+    // Wakes up the consumer. All subsequent calls of pop() return nullptr.
+    void stop();
+
+private:
+    enum class State { FREE, QUEUED, IN_USE };
+
+    struct Entry
+    {
+        std::unique_ptr<DesktopFrameAligned> frame;
+
+        // Area in which the pixels of the frame differ from the last captured frame.
+        QRegion stale_region;
+
+        State state = State::FREE;
+    };
+
+    // One frame more than the queue size is held by the consumer.
+    static const int kPoolSize = kMaxQueueSize + 1;
+
+    bool prepareEntry(Entry* entry, const DesktopFrame& frame);
+
+    std::mutex lock_;
+    std::condition_variable condition_;
+
+    Entry pool_[kPoolSize];
+    std::deque<Entry*> queue_;
+    bool stopped_ = false;
+
+    Q_DISABLE_COPY(DesktopFrameQueue)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__DESKTOP_FRAME_QUEUE_H
@@ -7,6 +7,7 @@
 
 #include "desktop_capture/differ.h"
 
+#include "base/trace_event.h"
 #include "desktop_capture/diff_block_avx2.h"
 #include "desktop_capture/diff_block_sse2.h"
 #include "desktop_capture/diff_block_sse3.h"
@@ -300,6 +301,8 @@ void Differ::calcDirtyRegion(const quint8* prev_image,
                              const quint8* curr_image,
                              QRegion* dirty_region)
 {
+    TRACE_EVENT("Differ::calcDirtyRegion");
+
     *dirty_region = QRegion();
 
     // Identify all the blocks that contain changed pixels.
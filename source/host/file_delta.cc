@@ -0,0 +1,270 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_delta.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/file_delta.h"
+
+#include <QDebug>
+#include <QFile>
+
+extern "C" {
+#define SODIUM_STATIC
+
+#pragma warning(push, 3)
+#include <sodium.h>
+#pragma warning(pop)
+} // extern "C"
+
+namespace aspia {
+
+namespace {
+
+// The block size grows with the size of the file to keep the number of checksums (and the size
+// of the reply) limited. Blocks smaller than 2 kB make the checksums larger than the data saved.
+constexpr quint32 kMinBlockSize = 2 * 1024; // 2 kB
+constexpr quint32 kMaxBlockSize = 1024 * 1024; // 1 MB
+constexpr qint64 kPreferredBlockCount = 32 * 1024;
+
+// The reply with this number of checksums takes about 6 MB.
+constexpr qint64 kMaxBlockCount = 256 * 1024;
+
+// 128 bits of BLAKE2b. The weak checksum filters the candidates first, so the probability of
+// a false match is negligible.
+constexpr size_t kStrongHashSize = 16;
+
+constexpr int kFilterBits = 20;
+
+class RollingChecksum
+{
+public:
+    RollingChecksum() = default;
+
+    void reset(const quint8* data, quint32 size)
+    {
+        a_ = 0;
+        b_ = 0;
+        size_ = size;
+
+        for (quint32 i = 0; i < size; ++i)
+        {
+            a_ += data[i];
+            b_ += (size - i) * data[i];
+        }
+    }
+
+    // Moves the window one byte forward.
+    void roll(quint8 out, quint8 in)
+    {
+        a_ += in - out;
+        b_ += a_ - size_ * out;
+    }
+
+    quint32 value() const { return (a_ & 0xFFFF) | (b_ << 16); }
+
+private:
+    quint32 a_ = 0;
+    quint32 b_ = 0;
+    quint32 size_ = 0;
+};
+
+std::string strongHash(const char* data, quint32 size)
+{
+    std::string hash;
+    hash.resize(kStrongHashSize);
+
+    crypto_generichash(reinterpret_cast<quint8*>(&hash[0]), hash.size(),
+                       reinterpret_cast<const quint8*>(data), size,
+                       nullptr, 0);
+    return hash;
+}
+
+quint32 filterIndex(quint32 weak)
+{
+    return (weak * 2654435761U) >> (32 - kFilterBits);
+}
+
+quint32 blockSize(qint64 file_size)
+{
+    quint32 block_size = kMinBlockSize;
+
+    while (block_size < kMaxBlockSize && file_size / block_size > kPreferredBlockCount)
+        block_size *= 2;
+
+    return block_size;
+}
+
+} // namespace
+
+FileDeltaEncoder::FileDeltaEncoder(const proto::file_transfer::BlockChecksums& checksums)
+    : block_size_(checksums.block_size())
+{
+    if (!block_size_)
+        return;
+
+    blocks_.reserve(checksums.checksum_size());
+    strong_.reserve(checksums.checksum_size());
+    filter_.resize(1 << kFilterBits);
+
+    for (int i = 0; i < checksums.checksum_size(); ++i)
+    {
+        const proto::file_transfer::BlockChecksums::Checksum& checksum = checksums.checksum(i);
+
+        blocks_.emplace(checksum.weak(), static_cast<quint32>(i));
+        filter_[filterIndex(checksum.weak())] = true;
+        strong_.push_back(checksum.strong());
+    }
+}
+
+// static
+bool FileDeltaEncoder::computeBlockChecksums(const QString& file_path,
+                                             proto::file_transfer::BlockChecksums* checksums)
+{
+    QFile file(file_path);
+
+    if (!file.open(QFile::ReadOnly))
+        return false;
+
+    const qint64 file_size = file.size();
+    const quint32 block_size = blockSize(file_size);
+    const qint64 block_count = file_size / block_size;
+
+    if (block_count > kMaxBlockCount)
+    {
+        qWarning() << "Too many blocks in file: " << block_count;
+        return false;
+    }
+
+    checksums->set_block_size(block_size);
+
+    std::string buffer;
+    buffer.resize(block_size);
+
+    RollingChecksum weak;
+
+    for (qint64 i = 0; i < block_count; ++i)
+    {
+        if (file.read(&buffer[0], block_size) != block_size)
+        {
+            qDebug("Unable to read file");
+            return false;
+        }
+
+        weak.reset(reinterpret_cast<const quint8*>(buffer.data()), block_size);
+
+        proto::file_transfer::BlockChecksums::Checksum* checksum = checksums->add_checksum();
+        checksum->set_weak(weak.value());
+        checksum->set_strong(strongHash(buffer.data(), block_size));
+    }
+
+    return true;
+}
+
+void FileDeltaEncoder::encode(proto::file_transfer::Packet* packet)
+{
+    const std::string& data = packet->data();
+    const size_t size = data.size();
+
+    if (blocks_.empty() || size < block_size_)
+        return;
+
+    const quint8* input = reinterpret_cast<const quint8*>(data.data());
+
+    literal_buffer_.clear();
+
+    RollingChecksum weak;
+    weak.reset(input, block_size_);
+
+    size_t literal_begin = 0;
+    size_t pos = 0;
+
+    for (;;)
+    {
+        quint32 block_index;
+
+        if (findBlock(weak.value(), data.data() + pos, &block_index))
+        {
+            const quint32 literal_size = static_cast<quint32>(pos - literal_begin);
+            literal_buffer_.append(data, literal_begin, literal_size);
+
+            const int count = packet->operation_size();
+
+            proto::file_transfer::DeltaOperation* last =
+                count ? packet->mutable_operation(count - 1) : nullptr;
+
+            // Consecutive blocks are copied with a single operation.
+            if (last && !literal_size &&
+                last->block_index() + last->block_count() == block_index)
+            {
+                last->set_block_count(last->block_count() + 1);
+            }
+            else
+            {
+                proto::file_transfer::DeltaOperation* operation = packet->add_operation();
+                operation->set_literal_size(literal_size);
+                operation->set_block_index(block_index);
+                operation->set_block_count(1);
+            }
+
+            pos += block_size_;
+            literal_begin = pos;
+
+            if (pos + block_size_ > size)
+                break;
+
+            weak.reset(input + pos, block_size_);
+        }
+        else
+        {
+            if (pos + block_size_ >= size)
+                break;
+
+            weak.roll(input[pos], input[pos + block_size_]);
+            ++pos;
+        }
+    }
+
+    // The data does not contain any blocks of the target file.
+    if (!packet->operation_size())
+        return;
+
+    if (literal_begin < size)
+    {
+        literal_buffer_.append(data, literal_begin, size - literal_begin);
+
+        proto::file_transfer::DeltaOperation* operation = packet->add_operation();
+        operation->set_literal_size(static_cast<quint32>(size - literal_begin));
+    }
+
+    packet->set_delta_size(static_cast<quint32>(size));
+
+    // The buffer with the original data is kept for the next packet.
+    packet->mutable_data()->swap(literal_buffer_);
+}
+
+bool FileDeltaEncoder::findBlock(quint32 weak, const char* data, quint32* block_index) const
+{
+    if (!filter_[filterIndex(weak)])
+        return false;
+
+    auto range = blocks_.equal_range(weak);
+    if (range.first == range.second)
+        return false;
+
+    const std::string strong = strongHash(data, block_size_);
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (strong_[it->second] == strong)
+        {
+            *block_index = it->second;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace aspia
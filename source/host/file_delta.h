@@ -0,0 +1,56 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_delta.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__FILE_DELTA_H
+#define _ASPIA_HOST__FILE_DELTA_H
+
+#include <QString>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "protocol/file_transfer_session.pb.h"
+
+namespace aspia {
+
+// Implements the rsync algorithm. The target computes checksums of the blocks of its copy of the
+// file, the source finds the blocks in its copy with a rolling checksum and sends only the data
+// which is not present in the target copy plus references to the found blocks.
+class FileDeltaEncoder
+{
+public:
+    explicit FileDeltaEncoder(const proto::file_transfer::BlockChecksums& checksums);
+    ~FileDeltaEncoder() = default;
+
+    // Computes the checksums of the blocks of the file.
+    static bool computeBlockChecksums(const QString& file_path,
+                                      proto::file_transfer::BlockChecksums* checksums);
+
+    // Replaces the data of the packet with the literal data and the delta operations. If no
+    // blocks are found, the packet is left unchanged.
+    void encode(proto::file_transfer::Packet* packet);
+
+private:
+    bool findBlock(quint32 weak, const char* data, quint32* block_index) const;
+
+    const quint32 block_size_;
+
+    // Indexes of the blocks by their weak checksums. The lookup is done for each byte of the
+    // data, so the filter of the present checksums is checked first.
+    std::unordered_multimap<quint32, quint32> blocks_;
+    std::vector<bool> filter_;
+    std::vector<std::string> strong_;
+
+    std::string literal_buffer_;
+
+    Q_DISABLE_COPY(FileDeltaEncoder)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__FILE_DELTA_H
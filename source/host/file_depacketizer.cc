@@ -7,19 +7,112 @@
 
 #include "host/file_depacketizer.h"
 
+#include <QDateTime>
 #include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+
+#include "codec/decompressor_zlib.h"
+#include "host/file_platform_util.h"
+#include "host/file_transfer_journal.h"
+#include "host/file_write_behind.h"
 
 namespace aspia {
 
+namespace {
+
+// Protects from the packets which claim a huge size after decompression.
+constexpr quint32 kMaxUncompressedSize = 16 * 1024 * 1024; // 16 MB
+
+// The new contents of the file which is transferred with the delta packets are written next to
+// it under this suffix.
+const char kDeltaFileSuffix[] = ".aspia-delta";
+
+// Protects from the bundles with a broken header size.
+constexpr quint32 kMaxBundleHeaderSize = 64 * 1024; // 64 kB
+
+// The smaller files are not fragmented much and are not preallocated.
+constexpr qint64 kMinPreallocationSize = 1024 * 1024; // 1 MB
+
+// The packets are gathered until this size before they are written. The larger packets are
+// written without copying.
+constexpr size_t kWriteBufferSize = 1024 * 1024; // 1 MB
+
+// The journal is updated after this amount of the data is written.
+constexpr qint64 kJournalInterval = 8 * 1024 * 1024; // 8 MB
+
+} // namespace
+
 FileDepacketizer::FileDepacketizer(QPointer<QFile>& file)
 {
     file_.swap(file);
 }
 
+FileDepacketizer::~FileDepacketizer()
+{
+    // The transfer was interrupted. The received data is kept to resume it later.
+    if (!basis_ && !file_.isNull() && file_->isOpen())
+    {
+        // The queued data must be written before the file is closed.
+        if (!write_behind_)
+            flushWriteBuffer();
+        else
+            write_behind_->flush();
+
+        const qint64 written_offset = writtenOffset();
+        write_behind_.reset();
+
+        updateJournal(written_offset);
+
+        // The size of the file must not include the space which was reserved for the rest of
+        // the data.
+        if (resized_)
+            file_->resize(written_offset);
+    }
+
+    write_behind_.reset();
+
+    // The transfer of the delta was not completed. The existing file is left unchanged.
+    if (basis_ && !file_.isNull())
+    {
+        file_->close();
+        file_->remove();
+    }
+
+    // The bundle was interrupted in the middle of the file.
+    if (bundle_file_)
+    {
+        bundle_file_->close();
+        bundle_file_->remove();
+    }
+}
+
 // static
 std::unique_ptr<FileDepacketizer> FileDepacketizer::create(
-    const QString& file_path, bool overwrite)
+    const QString& file_path, bool overwrite, quint32 delta_block_size)
 {
+    if (delta_block_size)
+    {
+        std::unique_ptr<QFile> basis = std::make_unique<QFile>(file_path);
+
+        if (!basis->open(QFile::ReadOnly))
+            return nullptr;
+
+        QPointer<QFile> file = new QFile(file_path + QLatin1String(kDeltaFileSuffix));
+
+        if (!file->open(QFile::WriteOnly | QFile::Truncate))
+            return nullptr;
+
+        std::unique_ptr<FileDepacketizer> depacketizer(new FileDepacketizer(file));
+
+        depacketizer->block_size_ = delta_block_size;
+        depacketizer->block_count_ = basis->size() / delta_block_size;
+        depacketizer->basis_path_ = file_path;
+        depacketizer->basis_ = std::move(basis);
+
+        return depacketizer;
+    }
+
     QFile::OpenMode mode = QFile::WriteOnly;
 
     if (overwrite)
@@ -33,40 +126,600 @@ std::unique_ptr<FileDepacketizer> FileDepacketizer::create(
     return std::unique_ptr<FileDepacketizer>(new FileDepacketizer(file));
 }
 
+// static
+std::unique_ptr<FileDepacketizer> FileDepacketizer::createForResume(
+    const QString& file_path, qint64 offset)
+{
+    QPointer<QFile> file = new QFile(file_path);
+
+    if (!file->open(QFile::ReadWrite) || file->size() < offset || !file->resize(offset) ||
+        !file->seek(offset))
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<FileDepacketizer> depacketizer(new FileDepacketizer(file));
+    depacketizer->offset_ = offset;
+    return depacketizer;
+}
+
+// static
+std::unique_ptr<FileDepacketizer> FileDepacketizer::createBundle()
+{
+    std::unique_ptr<FileDepacketizer> depacketizer(new FileDepacketizer());
+    depacketizer->bundle_ = true;
+    return depacketizer;
+}
+
+void FileDepacketizer::enableWriteBehind(FileIoThread* io_thread)
+{
+    if (basis_ || bundle_ || file_.isNull())
+        return;
+
+    write_behind_ = std::make_unique<FileWriteBehind>(io_thread, file_.data());
+}
+
+bool FileDepacketizer::enableJournal(const QString& file_path,
+                                     qint64 file_size,
+                                     qint64 modification_time)
+{
+    if (basis_ || bundle_ || file_.isNull())
+        return false;
+
+    if (!FileTransferJournal::record(file_path, file_size, modification_time, offset_))
+        return false;
+
+    journal_path_ = file_path;
+    journal_file_size_ = file_size;
+    journal_modification_time_ = modification_time;
+    journal_offset_ = offset_;
+    return true;
+}
+
 bool FileDepacketizer::writeNextPacket(const proto::file_transfer::Packet& packet)
 {
-    Q_ASSERT(!file_.isNull() && file_->isOpen());
+    Q_ASSERT(bundle_ || (!file_.isNull() && file_->isOpen()));
 
     // The first packet must have the full file size.
     if (packet.flags() & proto::file_transfer::Packet::FLAG_FIRST_PACKET)
     {
         file_size_ = packet.file_size();
-        left_size_ = file_size_;
+
+        if (file_size_ < offset_)
+        {
+            qDebug("Invalid file size");
+            return false;
+        }
+
+        left_size_ = file_size_ - offset_;
+
+        if (!bundle_)
+            preallocate();
     }
 
-    const size_t packet_size = packet.data().size();
+    const char* packet_data = packet.data().data();
+    size_t packet_size = packet.data().size();
 
-    if (!file_->seek(file_size_ - left_size_))
+    switch (packet.compression())
     {
-        qDebug("seek failed");
-        return false;
+        case proto::file_transfer::COMPRESSION_NONE:
+            break;
+
+        case proto::file_transfer::COMPRESSION_ZLIB:
+        {
+            if (!decompressPacket(packet))
+            {
+                qDebug("Unable to decompress packet");
+                return false;
+            }
+
+            packet_data = decompress_buffer_.data();
+            packet_size = decompress_buffer_.size();
+        }
+        break;
+
+        default:
+        {
+            qDebug() << "Unsupported compression: " << packet.compression();
+            return false;
+        }
     }
 
-    if (file_->write(packet.data().data(), packet_size) != packet_size)
+    if (bundle_)
     {
-        qDebug("Unable to write file");
-        return false;
+        digest_.addData(packet_data, packet_size);
+
+        if (!writeBundle(packet_data, packet_size))
+            return false;
+
+        left_size_ -= packet_size;
+
+        if (packet.flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET)
+        {
+            // The bundle must end on the boundary of the entries.
+            if (bundle_state_ != BundleState::HEADER_SIZE || !bundle_buffer_.empty())
+            {
+                qDebug("Unexpected end of bundle");
+                return false;
+            }
+
+            return checkDigest(packet);
+        }
+
+        return true;
     }
 
-    left_size_ -= packet_size;
+    if (write_behind_)
+    {
+        digest_.addData(packet_data, packet_size);
+
+        if (packet.operation_size() ||
+            !write_behind_->write(file_size_ - left_size_, packet_data, packet_size))
+        {
+            return false;
+        }
+
+        left_size_ -= packet_size;
+    }
+    else if (packet.operation_size())
+    {
+        // The delta is written directly after the gathered data.
+        if (!flushWriteBuffer() || !writeDelta(packet, packet_data, packet_size))
+            return false;
+
+        left_size_ -= packet.delta_size();
+    }
+    else
+    {
+        digest_.addData(packet_data, packet_size);
+
+        // The packets come in order, so the position of the file is not changed between them.
+        if (!writeData(packet_data, packet_size))
+            return false;
+
+        left_size_ -= packet_size;
+    }
+
+    if (!journal_path_.isEmpty())
+    {
+        const qint64 written_offset = writtenOffset();
+
+        if (written_offset - journal_offset_ >= kJournalInterval)
+            updateJournal(written_offset);
+    }
 
     if (packet.flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET)
     {
         file_size_ = 0;
+
+        if (write_behind_)
+        {
+            const bool succeeded = write_behind_->flush();
+            write_behind_.reset();
+
+            if (!succeeded)
+                return false;
+        }
+        else if (!flushWriteBuffer())
+        {
+            return false;
+        }
+
+        if (!checkDigest(packet))
+        {
+            // The file is corrupted. It must not be taken as complete or resumed. The delta is
+            // removed with the destructor and the existing file is left unchanged.
+            if (!basis_)
+            {
+                file_->close();
+                file_->remove();
+            }
+
+            return false;
+        }
+
         file_->close();
+
+        if (basis_ && !replaceBasis())
+            return false;
     }
 
     return true;
 }
 
+void FileDepacketizer::preallocate()
+{
+    if (file_size_ - offset_ < kMinPreallocationSize)
+        return;
+
+    // The space for the whole file is reserved at once to keep it from being fragmented.
+    if (FilePlatformUtil::preallocateFile(file_.data(), file_size_))
+        return;
+
+    // The file system can not reserve the space. The file is extended instead. The file of the
+    // journaled transfer is not extended: if the process is terminated, the file would keep the
+    // size of the source with the data which was not received.
+    if (journal_path_.isEmpty())
+        resized_ = file_->resize(file_size_);
+}
+
+qint64 FileDepacketizer::writtenOffset()
+{
+    if (write_behind_)
+        return write_behind_->writtenOffset();
+
+    // The gathered packets are not in the file yet.
+    if (!file_->flush())
+        return journal_offset_;
+
+    return file_->pos();
+}
+
+void FileDepacketizer::updateJournal(qint64 written_offset)
+{
+    if (journal_path_.isEmpty() || written_offset <= journal_offset_)
+        return;
+
+    // If the journal can not be updated, the transfer is resumed from the previous offset.
+    if (FileTransferJournal::record(journal_path_, journal_file_size_,
+                                    journal_modification_time_, written_offset))
+    {
+        journal_offset_ = written_offset;
+    }
+}
+
+bool FileDepacketizer::writeData(const char* data, size_t size)
+{
+    if (write_buffer_.empty() && size >= kWriteBufferSize)
+    {
+        if (file_->write(data, size) != static_cast<qint64>(size))
+        {
+            qDebug("Unable to write file");
+            return false;
+        }
+
+        return true;
+    }
+
+    write_buffer_.append(data, size);
+
+    if (write_buffer_.size() < kWriteBufferSize)
+        return true;
+
+    return flushWriteBuffer();
+}
+
+bool FileDepacketizer::flushWriteBuffer()
+{
+    if (write_buffer_.empty())
+        return true;
+
+    const qint64 size = static_cast<qint64>(write_buffer_.size());
+    const bool succeeded = file_->write(write_buffer_.data(), size) == size;
+
+    // The capacity of the buffer is kept for the next packets.
+    write_buffer_.clear();
+
+    if (!succeeded)
+    {
+        qDebug("Unable to write file");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileDepacketizer::writeDelta(const proto::file_transfer::Packet& packet,
+                                  const char* literal_data, size_t literal_size)
+{
+    if (!basis_)
+    {
+        qDebug("Unexpected delta packet");
+        return false;
+    }
+
+    size_t literal_pos = 0;
+    qint64 written_size = 0;
+
+    for (int i = 0; i < packet.operation_size(); ++i)
+    {
+        const proto::file_transfer::DeltaOperation& operation = packet.operation(i);
+
+        if (operation.literal_size() > literal_size - literal_pos)
+        {
+            qDebug("Invalid literal size");
+            return false;
+        }
+
+        digest_.addData(literal_data + literal_pos, operation.literal_size());
+
+        if (file_->write(literal_data + literal_pos, operation.literal_size()) !=
+            operation.literal_size())
+        {
+            qDebug("Unable to write file");
+            return false;
+        }
+
+        literal_pos += operation.literal_size();
+        written_size += operation.literal_size();
+
+        if (!operation.block_count())
+            continue;
+
+        if (static_cast<qint64>(operation.block_index()) + operation.block_count() > block_count_)
+        {
+            qDebug("Invalid block index");
+            return false;
+        }
+
+        if (!basis_->seek(static_cast<qint64>(operation.block_index()) * block_size_))
+        {
+            qDebug("seek failed");
+            return false;
+        }
+
+        copy_buffer_.resize(block_size_);
+
+        for (quint32 block = 0; block < operation.block_count(); ++block)
+        {
+            if (basis_->read(&copy_buffer_[0], block_size_) != block_size_)
+            {
+                qDebug("Unable to read file");
+                return false;
+            }
+
+            digest_.addData(copy_buffer_.data(), block_size_);
+
+            if (file_->write(copy_buffer_.data(), block_size_) != block_size_)
+            {
+                qDebug("Unable to write file");
+                return false;
+            }
+        }
+
+        written_size += static_cast<qint64>(operation.block_count()) * block_size_;
+    }
+
+    if (literal_pos != literal_size || written_size != packet.delta_size())
+    {
+        qDebug("Invalid delta packet");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileDepacketizer::replaceBasis()
+{
+    basis_->close();
+
+    if (!QFile::remove(basis_path_))
+    {
+        qDebug("Unable to remove file");
+        return false;
+    }
+
+    // The existing file is removed. The new contents must be kept even if they can not be
+    // renamed.
+    basis_.reset();
+
+    if (!file_->rename(basis_path_))
+    {
+        qDebug("Unable to rename file");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileDepacketizer::writeBundle(const char* data, size_t size)
+{
+    while (size)
+    {
+        switch (bundle_state_)
+        {
+            case BundleState::HEADER_SIZE:
+            {
+                size_t part_size = qMin(size, 4 - bundle_buffer_.size());
+
+                bundle_buffer_.append(data, part_size);
+                data += part_size;
+                size -= part_size;
+
+                if (bundle_buffer_.size() < 4)
+                    break;
+
+                header_size_ = 0;
+
+                for (int i = 0; i < 4; ++i)
+                    header_size_ |= static_cast<quint32>(static_cast<quint8>(bundle_buffer_[i])) << (i * 8);
+
+                if (!header_size_ || header_size_ > kMaxBundleHeaderSize)
+                {
+                    qDebug("Invalid bundle header size");
+                    return false;
+                }
+
+                bundle_buffer_.clear();
+                bundle_state_ = BundleState::HEADER;
+            }
+            break;
+
+            case BundleState::HEADER:
+            {
+                size_t part_size = qMin(size, header_size_ - bundle_buffer_.size());
+
+                bundle_buffer_.append(data, part_size);
+                data += part_size;
+                size -= part_size;
+
+                if (bundle_buffer_.size() < header_size_)
+                    break;
+
+                if (!bundle_entry_.ParseFromString(bundle_buffer_))
+                {
+                    qDebug("Invalid bundle header");
+                    return false;
+                }
+
+                bundle_buffer_.clear();
+
+                openBundleEntry();
+
+                if (entry_left_size_)
+                {
+                    bundle_state_ = BundleState::DATA;
+                }
+                else
+                {
+                    closeBundleEntry();
+                    bundle_state_ = BundleState::HEADER_SIZE;
+                }
+            }
+            break;
+
+            case BundleState::DATA:
+            {
+                size_t part_size = static_cast<size_t>(qMin<quint64>(size, entry_left_size_));
+
+                if (bundle_file_ && bundle_file_->write(data, part_size) != part_size)
+                {
+                    bundle_file_->close();
+                    bundle_file_->remove();
+                    bundle_file_.reset();
+
+                    addBundleFailure(proto::file_transfer::STATUS_FILE_WRITE_ERROR);
+                }
+
+                data += part_size;
+                size -= part_size;
+                entry_left_size_ -= part_size;
+
+                if (!entry_left_size_)
+                {
+                    closeBundleEntry();
+                    bundle_state_ = BundleState::HEADER_SIZE;
+                }
+            }
+            break;
+        }
+    }
+
+    return true;
+}
+
+void FileDepacketizer::openBundleEntry()
+{
+    entry_left_size_ = bundle_entry_.size();
+
+    if (bundle_entry_.status() != proto::file_transfer::STATUS_SUCCESS)
+    {
+        addBundleFailure(bundle_entry_.status());
+        return;
+    }
+
+    const QString path = QString::fromStdString(bundle_entry_.target_path());
+
+    if (bundle_entry_.is_directory())
+    {
+        if (!QDir().mkpath(path))
+            addBundleFailure(proto::file_transfer::STATUS_ACCESS_DENIED);
+
+        return;
+    }
+
+    QFileInfo file_info(path);
+    if (file_info.exists())
+    {
+        addBundleFailure(proto::file_transfer::STATUS_PATH_ALREADY_EXISTS);
+        return;
+    }
+
+    // The directory of the file may be not created yet.
+    QDir().mkpath(file_info.absolutePath());
+
+    bundle_file_ = std::make_unique<QFile>(path);
+
+    if (!bundle_file_->open(QFile::WriteOnly))
+    {
+        bundle_file_.reset();
+        addBundleFailure(proto::file_transfer::STATUS_FILE_CREATE_ERROR);
+    }
+}
+
+void FileDepacketizer::closeBundleEntry()
+{
+    if (!bundle_file_)
+        return;
+
+    bundle_file_->setFileTime(QDateTime::fromSecsSinceEpoch(bundle_entry_.modification_time()),
+                              QFileDevice::FileModificationTime);
+    bundle_file_->close();
+    bundle_file_.reset();
+}
+
+void FileDepacketizer::addBundleFailure(proto::file_transfer::Status status)
+{
+    proto::file_transfer::BundleEntry* failure = bundle_failures_.add_entry();
+    failure->set_index(bundle_entry_.index());
+    failure->set_status(status);
+}
+
+bool FileDepacketizer::checkDigest(const proto::file_transfer::Packet& packet)
+{
+    // The sender does not compute the digest.
+    if (packet.digest().empty())
+        return true;
+
+    if (digest_.result() != packet.digest())
+    {
+        qWarning("The digest of the file does not match");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileDepacketizer::decompressPacket(const proto::file_transfer::Packet& packet)
+{
+    const quint32 uncompressed_size = packet.uncompressed_size();
+    if (!uncompressed_size || uncompressed_size > kMaxUncompressedSize)
+        return false;
+
+    if (!decompressor_)
+        decompressor_ = std::make_unique<DecompressorZLIB>();
+    else
+        decompressor_->reset();
+
+    decompress_buffer_.resize(uncompressed_size);
+
+    const std::string& data = packet.data();
+
+    const quint8* input = reinterpret_cast<const quint8*>(data.data());
+    quint8* output = reinterpret_cast<quint8*>(&decompress_buffer_[0]);
+
+    size_t input_pos = 0;
+    size_t output_pos = 0;
+
+    while (input_pos < data.size() && output_pos < decompress_buffer_.size())
+    {
+        size_t consumed = 0;
+        size_t written = 0;
+
+        bool decompress_again = decompressor_->process(input + input_pos,
+                                                       data.size() - input_pos,
+                                                       output + output_pos,
+                                                       decompress_buffer_.size() - output_pos,
+                                                       &consumed,
+                                                       &written);
+        input_pos += consumed;
+        output_pos += written;
+
+        if (!decompress_again || (!consumed && !written))
+            break;
+    }
+
+    return output_pos == uncompressed_size;
+}
+
 } // namespace aspia
@@ -12,27 +12,118 @@
 #include <QPointer>
 #include <memory>
 
+#include "crypto/generic_hash.h"
 #include "protocol/file_transfer_session.pb.h"
 
 namespace aspia {
 
+class DecompressorZLIB;
+class FileIoThread;
+class FileWriteBehind;
+
 class FileDepacketizer
 {
 public:
-    ~FileDepacketizer() = default;
+    ~FileDepacketizer();
+
+    // Creates an instance of the class. If |delta_block_size| is not zero, the packets may
+    // contain the delta against the existing file. The new contents are written to a temporary
+    // file which replaces the existing file after the last packet.
+    static std::unique_ptr<FileDepacketizer> create(const QString& file_path,
+                                                    bool overwrite,
+                                                    quint32 delta_block_size = 0);
+
+    // Creates an instance of the class which continues the interrupted transfer. The file is
+    // truncated to |offset| and the packets are written after it.
+    static std::unique_ptr<FileDepacketizer> createForResume(const QString& file_path,
+                                                             qint64 offset);
+
+    // Creates an instance of the class which unpacks the files of the bundle. The directories
+    // are created when needed. The existing files are not overwritten.
+    static std::unique_ptr<FileDepacketizer> createBundle();
+
+    // The entries of the bundle which could not be written.
+    const proto::file_transfer::Bundle& bundleFailures() const { return bundle_failures_; }
 
-    static std::unique_ptr<FileDepacketizer> create(const QString& file_path, bool overwrite);
+    // Enables writing of the packets on |io_thread|. A failed write is reported by one of the
+    // next packets, at the latest by the last one. Has no effect for the delta and the bundle.
+    void enableWriteBehind(FileIoThread* io_thread);
 
-    // Reads the packet and writes its contents to a file.
+    // Records the progress of the transfer in the journal of the incomplete transfers (see
+    // FileTransferJournal). The data is recorded as written only after it is flushed from the
+    // buffers of the process, so the transfer can be resumed after the process is terminated.
+    // Has no effect for the delta and the bundle.
+    bool enableJournal(const QString& file_path, qint64 file_size, qint64 modification_time);
+
+    // Reads the packet and writes its contents to a file. The last packet fails if its digest
+    // does not match the written data. The incomplete file is removed then.
     bool writeNextPacket(const proto::file_transfer::Packet& packet);
 
 private:
     FileDepacketizer(QPointer<QFile>& file_stream);
+    FileDepacketizer() = default;
+
+    void preallocate();
+    qint64 writtenOffset();
+    void updateJournal(qint64 written_offset);
+    bool writeData(const char* data, size_t size);
+    bool flushWriteBuffer();
+    bool checkDigest(const proto::file_transfer::Packet& packet);
+    bool decompressPacket(const proto::file_transfer::Packet& packet);
+    bool writeDelta(const proto::file_transfer::Packet& packet,
+                    const char* literal_data, size_t literal_size);
+    bool replaceBasis();
+    bool writeBundle(const char* data, size_t size);
+    void openBundleEntry();
+    void closeBundleEntry();
+    void addBundleFailure(proto::file_transfer::Status status);
 
     QPointer<QFile> file_;
 
     qint64 file_size_ = 0;
     qint64 left_size_ = 0;
+    qint64 offset_ = 0;
+
+    // The file was extended to its full size before the data was written.
+    bool resized_ = false;
+
+    // The journal of the file. Empty if the transfer is not recorded.
+    QString journal_path_;
+    qint64 journal_file_size_ = 0;
+    qint64 journal_modification_time_ = 0;
+    qint64 journal_offset_ = 0;
+
+    // The packets are written sequentially. The small packets are gathered into larger writes.
+    std::string write_buffer_;
+
+    // The data is hashed as it is written: the plain data, the data produced by the delta and
+    // the stream of the bundle.
+    GenericHash digest_;
+
+    std::unique_ptr<DecompressorZLIB> decompressor_;
+    std::string decompress_buffer_;
+
+    // The existing file for the delta packets. It is reset after the file is replaced.
+    std::unique_ptr<QFile> basis_;
+    QString basis_path_;
+    quint32 block_size_ = 0;
+    qint64 block_count_ = 0;
+    std::string copy_buffer_;
+
+    enum class BundleState { HEADER_SIZE, HEADER, DATA };
+
+    bool bundle_ = false;
+    BundleState bundle_state_ = BundleState::HEADER_SIZE;
+    std::string bundle_buffer_;
+    quint32 header_size_ = 0;
+    proto::file_transfer::BundleEntry bundle_entry_;
+    quint64 entry_left_size_ = 0;
+
+    // The file of the current entry. It is null if the entry is skipped.
+    std::unique_ptr<QFile> bundle_file_;
+    proto::file_transfer::Bundle bundle_failures_;
+
+    std::unique_ptr<FileWriteBehind> write_behind_;
 
     Q_DISABLE_COPY(FileDepacketizer)
 };
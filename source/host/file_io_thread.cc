@@ -0,0 +1,62 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_io_thread.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/file_io_thread.h"
+
+namespace aspia {
+
+FileIoThread::FileIoThread(QObject* parent)
+    : QThread(parent)
+{
+    start();
+}
+
+FileIoThread::~FileIoThread()
+{
+    {
+        std::scoped_lock<std::mutex> lock(task_queue_lock_);
+        terminate_ = true;
+        task_event_.notify_one();
+    }
+
+    wait();
+}
+
+void FileIoThread::postTask(std::function<void()> task)
+{
+    std::scoped_lock<std::mutex> lock(task_queue_lock_);
+    task_queue_.emplace(std::move(task));
+    task_event_.notify_one();
+}
+
+void FileIoThread::run()
+{
+    while (true)
+    {
+        std::queue<std::function<void()>> work_task_queue;
+
+        {
+            std::unique_lock<std::mutex> lock(task_queue_lock_);
+
+            while (task_queue_.empty() && !terminate_)
+                task_event_.wait(lock);
+
+            if (terminate_)
+                return;
+
+            work_task_queue.swap(task_queue_);
+        }
+
+        while (!work_task_queue.empty())
+        {
+            work_task_queue.front()();
+            work_task_queue.pop();
+        }
+    }
+}
+
+} // namespace aspia
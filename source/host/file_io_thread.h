@@ -0,0 +1,47 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_io_thread.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__FILE_IO_THREAD_H
+#define _ASPIA_HOST__FILE_IO_THREAD_H
+
+#include <QThread>
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+
+namespace aspia {
+
+// Executes the reads and writes of the transferred files, so that the disk works while the
+// packets are sent over the network. The tasks are executed in the order they were posted.
+class FileIoThread : public QThread
+{
+    Q_OBJECT
+
+public:
+    explicit FileIoThread(QObject* parent = nullptr);
+    ~FileIoThread();
+
+    void postTask(std::function<void()> task);
+
+protected:
+    // QThread implementation.
+    void run() override;
+
+private:
+    std::condition_variable task_event_;
+    std::mutex task_queue_lock_;
+    std::queue<std::function<void()>> task_queue_;
+    bool terminate_ = false;
+
+    Q_DISABLE_COPY(FileIoThread)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__FILE_IO_THREAD_H
@@ -7,6 +7,15 @@
 
 #include "host/file_packetizer.h"
 
+#include <QBuffer>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+
+#include "codec/compressor_zlib.h"
+#include "host/file_delta.h"
+#include "host/file_read_ahead.h"
+
 namespace aspia {
 
 namespace {
@@ -16,6 +25,52 @@ namespace {
 // This parameter specifies the size of the part.
 constexpr qint64 kPacketPartSize = 16 * 1024; // 16 kB
 
+// The maximum size of the part which can be requested by the client.
+constexpr qint64 kMaxPacketPartSize = 4 * 1024 * 1024; // 4 MB
+
+// The files of the bundle are read into memory. Larger files are transferred separately.
+constexpr qint64 kMaxBundleFileSize = 1024 * 1024; // 1 MB
+constexpr qint64 kMaxBundleSize = 16 * 1024 * 1024; // 16 MB
+
+// The fastest compression level. Transfer of the file should not be limited by the CPU.
+constexpr int kCompressionLevel = 1;
+
+// The packet is sent compressed only if the compressed data takes less than 90% of the original.
+constexpr int kMinCompressionRatio = 90;
+
+bool isCompressedFileType(const QString& file_path)
+{
+    static const char* kCompressedSuffixes[] =
+    {
+        "7z", "aac", "avi", "bz2", "cab", "docx", "flac", "gif", "gz", "jar", "jpeg", "jpg",
+        "lz4", "lzma", "m4a", "mkv", "mov", "mp3", "mp4", "msi", "odt", "ogg", "png", "pptx",
+        "rar", "tgz", "webm", "webp", "xlsx", "xz", "zip", "zst"
+    };
+
+    const QString suffix = QFileInfo(file_path).suffix().toLower();
+
+    for (const char* compressed_suffix : kCompressedSuffixes)
+    {
+        if (suffix == QLatin1String(compressed_suffix))
+            return true;
+    }
+
+    return false;
+}
+
+void appendBundleEntry(const proto::file_transfer::BundleEntry& entry, const QByteArray& data,
+                       QByteArray* bundle)
+{
+    const std::string header = entry.SerializeAsString();
+    const quint32 header_size = static_cast<quint32>(header.size());
+
+    for (int i = 0; i < 4; ++i)
+        bundle->append(static_cast<char>((header_size >> (i * 8)) & 0xFF));
+
+    bundle->append(header.data(), static_cast<int>(header.size()));
+    bundle->append(data);
+}
+
 char* GetOutputBuffer(proto::file_transfer::Packet* packet, size_t size)
 {
     packet->mutable_data()->resize(size);
@@ -24,26 +79,114 @@ char* GetOutputBuffer(proto::file_transfer::Packet* packet, size_t size)
 
 } // namespace
 
-FilePacketizer::FilePacketizer(QPointer<QFile>& file)
+FilePacketizer::FilePacketizer(std::unique_ptr<QIODevice> file, const QString& file_path)
+    : file_(std::move(file)),
+      file_path_(file_path)
 {
-    file_.swap(file);
     file_size_ = file_->size();
     left_size_ = file_size_;
 }
 
 std::unique_ptr<FilePacketizer> FilePacketizer::create(const QString& file_path)
 {
-    QPointer<QFile> file = new QFile(file_path);
+    std::unique_ptr<QFile> file = std::make_unique<QFile>(file_path);
 
     if (!file->open(QFile::ReadOnly))
         return nullptr;
 
-    return std::unique_ptr<FilePacketizer>(new FilePacketizer(file));
+    return std::unique_ptr<FilePacketizer>(new FilePacketizer(std::move(file), file_path));
+}
+
+// static
+std::unique_ptr<FilePacketizer> FilePacketizer::createBundle(
+    const proto::file_transfer::Bundle& bundle)
+{
+    QByteArray buffer;
+
+    for (int i = 0; i < bundle.entry_size(); ++i)
+    {
+        proto::file_transfer::BundleEntry entry;
+
+        entry.set_index(bundle.entry(i).index());
+        entry.set_target_path(bundle.entry(i).target_path());
+        entry.set_is_directory(bundle.entry(i).is_directory());
+        entry.set_status(proto::file_transfer::STATUS_SUCCESS);
+
+        QByteArray data;
+
+        if (!entry.is_directory())
+        {
+            QFile file(QString::fromStdString(bundle.entry(i).source_path()));
+
+            if (!file.open(QFile::ReadOnly))
+            {
+                entry.set_status(proto::file_transfer::STATUS_FILE_OPEN_ERROR);
+            }
+            else if (file.size() > kMaxBundleFileSize ||
+                     buffer.size() + file.size() > kMaxBundleSize)
+            {
+                // The file is transferred separately.
+                entry.set_status(proto::file_transfer::STATUS_INVALID_REQUEST);
+            }
+            else
+            {
+                data = file.readAll();
+
+                if (data.size() != file.size())
+                {
+                    data.clear();
+                    entry.set_status(proto::file_transfer::STATUS_FILE_READ_ERROR);
+                }
+                else
+                {
+                    entry.set_size(data.size());
+                    entry.set_modification_time(
+                        QFileInfo(file).lastModified().toSecsSinceEpoch());
+                }
+            }
+        }
+
+        appendBundleEntry(entry, data, &buffer);
+    }
+
+    std::unique_ptr<QBuffer> device = std::make_unique<QBuffer>();
+    device->setData(buffer);
+
+    if (!device->open(QBuffer::ReadOnly))
+        return nullptr;
+
+    return std::unique_ptr<FilePacketizer>(new FilePacketizer(std::move(device), QString()));
+}
+
+FilePacketizer::~FilePacketizer() = default;
+
+bool FilePacketizer::seek(qint64 offset)
+{
+    if (!first_packet_ || offset < 0 || offset > file_size_)
+        return false;
+
+    left_size_ = file_size_ - offset;
+    return true;
+}
+
+void FilePacketizer::enableDelta(const proto::file_transfer::BlockChecksums& checksums)
+{
+    delta_encoder_ = std::make_unique<FileDeltaEncoder>(checksums);
 }
 
-std::unique_ptr<proto::file_transfer::Packet> FilePacketizer::readNextPacket()
+void FilePacketizer::enableReadAhead(FileIoThread* io_thread)
 {
-    Q_ASSERT(!file_.isNull() && file_->isOpen());
+    // The bundle is already in memory.
+    if (file_path_.isEmpty())
+        return;
+
+    io_thread_ = io_thread;
+}
+
+std::unique_ptr<proto::file_transfer::Packet> FilePacketizer::readNextPacket(
+    qint64 max_size, proto::file_transfer::Compression compression)
+{
+    Q_ASSERT(read_ahead_ || (file_ && file_->isOpen()));
 
     // Create a new file packet.
     std::unique_ptr<proto::file_transfer::Packet> packet =
@@ -54,26 +197,63 @@ std::unique_ptr<proto::file_transfer::Packet> FilePacketizer::readNextPacket()
 
     qint64 packet_buffer_size = kPacketPartSize;
 
-    if (left_size_ < kPacketPartSize)
-        packet_buffer_size = static_cast<size_t>(left_size_);
+    if (max_size > 0)
+        packet_buffer_size = qMin(max_size, kMaxPacketPartSize);
 
-    char* packet_buffer = GetOutputBuffer(packet.get(), packet_buffer_size);
+    if (left_size_ < packet_buffer_size)
+        packet_buffer_size = left_size_;
 
     // Moving to a new position in file.
-    if (!file_->seek(file_size_ - left_size_))
+    if (!read_ahead_ && !file_->seek(file_size_ - left_size_))
     {
         qDebug("Unable to seek file");
         return nullptr;
     }
 
-    if (file_->read(packet_buffer, packet_buffer_size) != packet_buffer_size)
+    // The file is read sequentially from here on.
+    if (io_thread_ && !read_ahead_)
+        read_ahead_ = std::make_unique<FileReadAhead>(io_thread_, std::move(file_));
+
+    if (read_ahead_)
     {
-        qDebug("Unable to read file");
-        return nullptr;
+        if (!read_ahead_->read(packet_buffer_size, packet->mutable_data()))
+            return nullptr;
     }
+    else
+    {
+        char* packet_buffer = GetOutputBuffer(packet.get(), packet_buffer_size);
 
-    if (left_size_ == file_size_)
+        if (file_->read(packet_buffer, packet_buffer_size) != packet_buffer_size)
+        {
+            qDebug("Unable to read file");
+            return nullptr;
+        }
+    }
+
+    digest_.addData(packet->data().data(), packet->data().size());
+
+    if (delta_encoder_)
+        delta_encoder_->encode(packet.get());
+
+    if (compression == proto::file_transfer::COMPRESSION_ZLIB &&
+        !compression_disabled_ && !packet->data().empty())
     {
+        if (first_packet_ && isCompressedFileType(file_path_))
+        {
+            compression_disabled_ = true;
+        }
+        else if (!compressPacket(packet.get()) && first_packet_)
+        {
+            // The first packet is a probe. If it is not compressible, then the rest of the file
+            // most likely is not compressible too.
+            compression_disabled_ = true;
+        }
+    }
+
+    if (first_packet_)
+    {
+        first_packet_ = false;
+
         packet->set_flags(packet->flags() | proto::file_transfer::Packet::FLAG_FIRST_PACKET);
 
         // Set file path and size in first packet.
@@ -84,13 +264,66 @@ std::unique_ptr<proto::file_transfer::Packet> FilePacketizer::readNextPacket()
 
     if (!left_size_)
     {
-        file_size_ = 0;
-        file_->close();
+        if (read_ahead_)
+            read_ahead_.reset();
+        else
+            file_->close();
 
         packet->set_flags(packet->flags() | proto::file_transfer::Packet::FLAG_LAST_PACKET);
+        packet->set_digest(digest_.result());
     }
 
     return packet;
 }
 
+bool FilePacketizer::compressPacket(proto::file_transfer::Packet* packet)
+{
+    if (!compressor_)
+        compressor_ = std::make_unique<CompressorZLIB>(kCompressionLevel);
+    else
+        compressor_->reset();
+
+    const std::string& data = packet->data();
+
+    // If the compressed data does not fit into the buffer, then compression is not worth it.
+    compress_buffer_.resize(data.size() * kMinCompressionRatio / 100);
+    if (compress_buffer_.empty())
+        return false;
+
+    const quint8* input = reinterpret_cast<const quint8*>(data.data());
+    quint8* output = reinterpret_cast<quint8*>(&compress_buffer_[0]);
+
+    size_t input_pos = 0;
+    size_t output_pos = 0;
+    bool compress_again = true;
+
+    while (compress_again)
+    {
+        if (output_pos == compress_buffer_.size())
+            return false;
+
+        size_t consumed = 0;
+        size_t written = 0;
+
+        compress_again = compressor_->process(input + input_pos,
+                                              data.size() - input_pos,
+                                              output + output_pos,
+                                              compress_buffer_.size() - output_pos,
+                                              Compressor::CompressorFinish,
+                                              &consumed,
+                                              &written);
+        input_pos += consumed;
+        output_pos += written;
+    }
+
+    compress_buffer_.resize(output_pos);
+
+    packet->set_compression(proto::file_transfer::COMPRESSION_ZLIB);
+    packet->set_uncompressed_size(static_cast<quint32>(data.size()));
+
+    // The buffer with the original data is kept for the next packet.
+    packet->mutable_data()->swap(compress_buffer_);
+    return true;
+}
+
 } // namespace aspia
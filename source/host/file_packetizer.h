@@ -8,34 +8,83 @@
 #ifndef _ASPIA_HOST__FILE_PACKETIZER_H
 #define _ASPIA_HOST__FILE_PACKETIZER_H
 
-#include <QFile>
-#include <QPointer>
+#include <QIODevice>
+#include <QString>
 #include <memory>
 
+#include "crypto/generic_hash.h"
 #include "protocol/file_transfer_session.pb.h"
 
 namespace aspia {
 
+class CompressorZLIB;
+class FileDeltaEncoder;
+class FileIoThread;
+class FileReadAhead;
+
 class FilePacketizer
 {
 public:
-    ~FilePacketizer() = default;
+    ~FilePacketizer();
 
     // Creates an instance of the class.
     // Parameter |file_path| contains the full path to the file.
     // If the specified file can not be opened for reading, then returns nullptr.
     static std::unique_ptr<FilePacketizer> create(const QString& file_path);
 
-    // Creates a packet for transferring.
-    std::unique_ptr<proto::file_transfer::Packet> readNextPacket();
+    // Creates an instance of the class which transfers the files of the bundle as a single
+    // stream. The files are read at once, they are expected to be small.
+    static std::unique_ptr<FilePacketizer> createBundle(
+        const proto::file_transfer::Bundle& bundle);
+
+    // Returns the size of the file at the moment it was opened.
+    qint64 fileSize() const { return file_size_; }
+
+    // Starts the packets from |offset| instead of the beginning of the file.
+    bool seek(qint64 offset);
+
+    // Enables the delta packets against the file which has the given block checksums.
+    void enableDelta(const proto::file_transfer::BlockChecksums& checksums);
+
+    // Enables reading of the next packet on |io_thread| while the current one is sent.
+    void enableReadAhead(FileIoThread* io_thread);
+
+    // Creates a packet for transferring. The packet contains at most |max_size| bytes of the
+    // file. If |max_size| is zero, the default size is used. If the delta is enabled, the blocks
+    // found in the target file are replaced with references. If |compression| is not
+    // COMPRESSION_NONE, the packet is compressed when it is worth it. The last packet contains
+    // the digest of the sent data.
+    std::unique_ptr<proto::file_transfer::Packet> readNextPacket(
+        qint64 max_size = 0,
+        proto::file_transfer::Compression compression = proto::file_transfer::COMPRESSION_NONE);
 
 private:
-    FilePacketizer(QPointer<QFile>& file);
+    FilePacketizer(std::unique_ptr<QIODevice> file, const QString& file_path);
 
-    QPointer<QFile> file_;
+    bool compressPacket(proto::file_transfer::Packet* packet);
+
+    std::unique_ptr<QIODevice> file_;
+    const QString file_path_;
+
+    // The file is passed to the read-ahead with the first read.
+    FileIoThread* io_thread_ = nullptr;
+    std::unique_ptr<FileReadAhead> read_ahead_;
 
     qint64 file_size_ = 0;
     qint64 left_size_ = 0;
+    bool first_packet_ = true;
+
+    // The data is hashed right after it is read, while it is still in the cache.
+    GenericHash digest_;
+
+    std::unique_ptr<FileDeltaEncoder> delta_encoder_;
+
+    std::unique_ptr<CompressorZLIB> compressor_;
+    std::string compress_buffer_;
+
+    // Set if the file has a type which is already compressed or its first packet can not be
+    // compressed well. The rest of the file is sent without compression.
+    bool compression_disabled_ = false;
 
     Q_DISABLE_COPY(FilePacketizer)
 };
@@ -14,6 +14,8 @@
 
 #include "protocol/file_transfer_session.pb.h"
 
+class QFile;
+
 namespace aspia {
 
 class FilePlatformUtil
@@ -29,6 +31,16 @@ public:
     static QIcon driveIcon(proto::file_transfer::DriveList::Item::Type type);
     static proto::file_transfer::DriveList::Item::Type driveType(const QString& drive_path);
 
+    // Reserves the disk space for |size| bytes of the open file without changing its size.
+    // Returns false if the file system does not support it.
+    static bool preallocateFile(QFile* file, qint64 size);
+
+    // Copy |size| bytes from / read the pages of a file mapped into memory. If the pages can not
+    // be read (for example, a network share is disconnected or a removable media is pulled out),
+    // the functions return false instead of raising an exception.
+    static bool copyMappedMemory(void* target, const void* source, qint64 size);
+    static bool touchMappedMemory(const void* data, qint64 size);
+
 private:
     Q_DISABLE_COPY(FilePlatformUtil)
 };
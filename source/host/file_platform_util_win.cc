@@ -11,7 +11,9 @@
 #error This file is only for MS Windows
 #endif
 
+#include <QFile>
 #include <QtWin>
+#include <io.h>
 #include <shellapi.h>
 
 #include "base/win/scoped_user_object.h"
@@ -39,6 +41,18 @@ QIcon stockIcon(SHSTOCKICONID icon_id)
     return QIcon(QStringLiteral(":/icon/document.png"));
 }
 
+constexpr qint64 kPageSize = 4096;
+
+// The pages of a mapped file which can not be read raise EXCEPTION_IN_PAGE_ERROR when they are
+// accessed. Other exceptions are not handled.
+int mappedMemoryFilter(DWORD exception_code)
+{
+    if (exception_code == EXCEPTION_IN_PAGE_ERROR)
+        return EXCEPTION_EXECUTE_HANDLER;
+
+    return EXCEPTION_CONTINUE_SEARCH;
+}
+
 } // namespace
 
 // static
@@ -137,4 +151,56 @@ proto::file_transfer::DriveList::Item::Type FilePlatformUtil::driveType(const QS
     }
 }
 
+// static
+bool FilePlatformUtil::preallocateFile(QFile* file, qint64 size)
+{
+    HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(file->handle()));
+    if (handle == INVALID_HANDLE_VALUE)
+        return false;
+
+    // The clusters are allocated at once, but the end of the file is not moved. The data after
+    // it is not readable and the size of the interrupted file is still the size of its data.
+    FILE_ALLOCATION_INFO allocation_info;
+    allocation_info.AllocationSize.QuadPart = size;
+
+    return !!SetFileInformationByHandle(handle, FileAllocationInfo,
+                                        &allocation_info, sizeof(allocation_info));
+}
+
+// static
+bool FilePlatformUtil::copyMappedMemory(void* target, const void* source, qint64 size)
+{
+    __try
+    {
+        memcpy(target, source, static_cast<size_t>(size));
+    }
+    __except (mappedMemoryFilter(GetExceptionCode()))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+// static
+bool FilePlatformUtil::touchMappedMemory(const void* data, qint64 size)
+{
+    // Reading of one byte of each page makes the system read the page from the disk.
+    const volatile uchar* pages = reinterpret_cast<const volatile uchar*>(data);
+    uchar sum = 0;
+
+    __try
+    {
+        for (qint64 offset = 0; offset < size; offset += kPageSize)
+            sum += pages[offset];
+    }
+    __except (mappedMemoryFilter(GetExceptionCode()))
+    {
+        return false;
+    }
+
+    Q_UNUSED(sum);
+    return true;
+}
+
 } // namespace aspia
@@ -0,0 +1,266 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_read_ahead.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/file_read_ahead.h"
+
+#include <QDebug>
+
+#include "host/file_io_thread.h"
+#include "host/file_platform_util.h"
+
+namespace aspia {
+
+namespace {
+
+// The part of the file which is mapped at a time. Limits the address space which the transfers
+// of large files take.
+constexpr qint64 kMapWindowSize = 64 * 1024 * 1024; // 64 MB
+
+// The offset of the window is aligned to the allocation granularity of Windows.
+constexpr qint64 kMapAlignment = 64 * 1024; // 64 kB
+
+} // namespace
+
+FileReadAhead::FileReadAhead(FileIoThread* io_thread, std::unique_ptr<QIODevice> file)
+    : io_thread_(io_thread),
+      file_(std::move(file))
+{
+    Q_ASSERT(io_thread_);
+    Q_ASSERT(file_ && file_->isOpen());
+
+    mapped_file_ = qobject_cast<QFile*>(file_.get());
+    if (mapped_file_)
+    {
+        file_size_ = mapped_file_->size();
+        offset_ = mapped_file_->pos();
+        prefetched_offset_ = offset_;
+    }
+}
+
+FileReadAhead::~FileReadAhead()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    cancelled_ = true;
+
+    // The posted task refers to the instance.
+    while (reading_)
+        read_event_.wait(lock);
+
+    if (window_)
+        mapped_file_->unmap(window_);
+}
+
+bool FileReadAhead::read(qint64 size, std::string* output)
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    // The next packets most likely have the same size.
+    chunk_size_ = size;
+
+    if (mapped_file_)
+    {
+        if (readMapped(size, output, &lock))
+            return true;
+
+        if (!mapped_file_)
+        {
+            qDebug("Unable to read file");
+            return false;
+        }
+
+        // The file can not be mapped (for example, it is on a network share). It is read into
+        // the buffer from here on.
+        mapped_file_ = nullptr;
+
+        if (!file_->seek(offset_))
+        {
+            qDebug("Unable to seek file");
+            return false;
+        }
+    }
+
+    scheduleRead();
+
+    while (static_cast<qint64>(buffer_.size()) < size && reading_)
+        read_event_.wait(lock);
+
+    if (static_cast<qint64>(buffer_.size()) < size)
+    {
+        if (error_)
+            qDebug("Unable to read file");
+
+        return false;
+    }
+
+    output->assign(buffer_, 0, size);
+    buffer_.erase(0, size);
+
+    // The next packet is read while this one is sent.
+    scheduleRead();
+    return true;
+}
+
+bool FileReadAhead::readMapped(qint64 size, std::string* output,
+                               std::unique_lock<std::mutex>* lock)
+{
+    if (offset_ + size > file_size_)
+    {
+        // The file has been truncated. The read can not succeed in any mode.
+        stopMapping(lock);
+        return false;
+    }
+
+    if (!window_ || offset_ < window_offset_ || offset_ + size > window_offset_ + window_size_)
+    {
+        // The pages of the current window can be touched by the I/O thread.
+        while (reading_)
+            read_event_.wait(*lock);
+
+        if (window_)
+        {
+            mapped_file_->unmap(window_);
+            window_ = nullptr;
+        }
+
+        window_offset_ = offset_ - offset_ % kMapAlignment;
+        window_size_ = qMin(file_size_ - window_offset_,
+                            qMax(kMapWindowSize, offset_ + size - window_offset_));
+
+        if (window_size_)
+            window_ = mapped_file_->map(window_offset_, window_size_);
+
+        if (!window_)
+            return false;
+    }
+
+    output->resize(size);
+
+    if (!FilePlatformUtil::copyMappedMemory(&(*output)[0],
+                                            window_ + (offset_ - window_offset_), size))
+    {
+        // The pages can not be read from the disk. The buffered read would fail as well.
+        stopMapping(lock);
+        return false;
+    }
+
+    offset_ += size;
+
+    // The pages of the next packet are brought into memory while this one is sent.
+    scheduleRead();
+    return true;
+}
+
+void FileReadAhead::stopMapping(std::unique_lock<std::mutex>* lock)
+{
+    while (reading_)
+        read_event_.wait(*lock);
+
+    if (window_)
+        mapped_file_->unmap(window_);
+
+    window_ = nullptr;
+    mapped_file_ = nullptr;
+}
+
+void FileReadAhead::readChunk()
+{
+    qint64 chunk_size;
+    bool mapped;
+
+    const uchar* prefetch_data = nullptr;
+    qint64 prefetch_size = 0;
+
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        if (cancelled_)
+        {
+            reading_ = false;
+            read_event_.notify_all();
+            return;
+        }
+
+        mapped = mapped_file_ != nullptr;
+
+        if (mapped)
+        {
+            // The window is not changed until |reading_| is reset.
+            const qint64 begin = qMax(offset_, prefetched_offset_);
+            const qint64 end = qMin(offset_ + chunk_size_, window_offset_ + window_size_);
+
+            if (begin < end)
+            {
+                prefetch_data = window_ + (begin - window_offset_);
+                prefetch_size = end - begin;
+            }
+
+            prefetched_offset_ = offset_ + chunk_size_;
+        }
+
+        chunk_size = chunk_size_;
+    }
+
+    if (mapped)
+    {
+        // If the pages can not be read, the error is returned when they are copied.
+        FilePlatformUtil::touchMappedMemory(prefetch_data, prefetch_size);
+
+        std::scoped_lock<std::mutex> lock(lock_);
+        reading_ = false;
+        read_event_.notify_all();
+        return;
+    }
+
+    std::string chunk;
+    chunk.resize(chunk_size);
+
+    const qint64 read_size = file_->read(&chunk[0], chunk_size);
+
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    if (read_size < 0)
+    {
+        error_ = true;
+    }
+    else
+    {
+        buffer_.append(chunk, 0, read_size);
+
+        if (read_size < chunk_size)
+            end_of_file_ = true;
+    }
+
+    // The task is posted again to let the I/O thread serve the other files.
+    reading_ = false;
+    scheduleRead();
+
+    read_event_.notify_all();
+}
+
+void FileReadAhead::scheduleRead()
+{
+    if (reading_ || cancelled_ || error_ || end_of_file_ || !chunk_size_)
+        return;
+
+    if (mapped_file_)
+    {
+        // Only the pages of the mapped window are prefetched.
+        if (!window_ || prefetched_offset_ >= offset_ + chunk_size_)
+            return;
+    }
+    else if (static_cast<qint64>(buffer_.size()) >= chunk_size_)
+    {
+        // One packet is read ahead.
+        return;
+    }
+
+    reading_ = true;
+    io_thread_->postTask(std::bind(&FileReadAhead::readChunk, this));
+}
+
+} // namespace aspia
@@ -0,0 +1,82 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_read_ahead.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__FILE_READ_AHEAD_H
+#define _ASPIA_HOST__FILE_READ_AHEAD_H
+
+#include <QFile>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace aspia {
+
+class FileIoThread;
+
+// Reads the file sequentially. While a packet is sent, the data of the next packet of the same
+// size is read on the I/O thread.
+//
+// If possible, the file is mapped into memory by a window which slides across the file. The
+// data is copied from the page cache directly to the packet and the I/O thread only brings the
+// pages of the next packet into memory. Otherwise the data is read into an intermediate buffer.
+class FileReadAhead
+{
+public:
+    // The file is read from its current position.
+    FileReadAhead(FileIoThread* io_thread, std::unique_ptr<QIODevice> file);
+
+    // Waits for the read which is in progress.
+    ~FileReadAhead();
+
+    // Reads |size| bytes which follow the previous read to |output|. Waits until the data is
+    // read.
+    bool read(qint64 size, std::string* output);
+
+private:
+    bool readMapped(qint64 size, std::string* output, std::unique_lock<std::mutex>* lock);
+
+    // Unmaps the file. The reads fail after it.
+    void stopMapping(std::unique_lock<std::mutex>* lock);
+
+    void readChunk();
+    void scheduleRead();
+
+    FileIoThread* const io_thread_;
+    std::unique_ptr<QIODevice> file_;
+
+    std::mutex lock_;
+    std::condition_variable read_event_;
+
+    // The data which is read, but not yet returned.
+    std::string buffer_;
+
+    qint64 chunk_size_ = 0;
+    bool reading_ = false;
+    bool end_of_file_ = false;
+    bool error_ = false;
+    bool cancelled_ = false;
+
+    // Set while the file is read through the mapping.
+    QFile* mapped_file_ = nullptr;
+    qint64 file_size_ = 0;
+    qint64 offset_ = 0;
+
+    uchar* window_ = nullptr;
+    qint64 window_offset_ = 0;
+    qint64 window_size_ = 0;
+
+    // The end of the pages which are already brought into memory.
+    qint64 prefetched_offset_ = 0;
+
+    Q_DISABLE_COPY(FileReadAhead)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__FILE_READ_AHEAD_H
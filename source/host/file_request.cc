@@ -53,6 +53,51 @@ FileRequest* FileRequest::fileListRequest(QObject* sender,
     return new FileRequest(sender, std::move(request), reply_slot);
 }
 
+// static
+FileRequest* FileRequest::recursiveFileListRequest(QObject* sender,
+                                                   const QString& path,
+                                                   const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_file_list_request()->set_path(path.toStdString());
+    request.mutable_file_list_request()->set_recursive(true);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::pagedFileListRequest(QObject* sender,
+                                               const QString& path,
+                                               const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_file_list_request()->set_path(path.toStdString());
+    request.mutable_file_list_request()->set_paged(true);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::cachedFileListRequest(QObject* sender,
+                                                const QString& path,
+                                                quint64 cached_version,
+                                                const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_file_list_request()->set_path(path.toStdString());
+    request.mutable_file_list_request()->set_paged(true);
+    request.mutable_file_list_request()->set_cached_version(cached_version);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::nextFileListRequest(QObject* sender,
+                                              quint64 continuation,
+                                              const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_file_list_request()->set_continuation(continuation);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
 // static
 FileRequest* FileRequest::createDirectoryRequest(QObject* sender,
                                                  const QString& path,
@@ -85,13 +130,80 @@ FileRequest* FileRequest::removeRequest(QObject* sender,
     return new FileRequest(sender, std::move(request), reply_slot);
 }
 
+// static
+FileRequest* FileRequest::recursiveRemoveRequest(QObject* sender,
+                                                 const QString& path,
+                                                 const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_remove_request()->set_path(path.toStdString());
+    request.mutable_remove_request()->set_recursive(true);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::nextRemoveRequest(QObject* sender,
+                                            quint64 continuation,
+                                            const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_remove_request()->set_continuation(continuation);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::copyRequest(QObject* sender,
+                                      const QString& source_path,
+                                      const QString& target_path,
+                                      const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_copy_request()->set_source_path(source_path.toStdString());
+    request.mutable_copy_request()->set_target_path(target_path.toStdString());
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::nextCopyRequest(QObject* sender,
+                                          quint64 continuation,
+                                          const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_copy_request()->set_continuation(continuation);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::moveRequest(QObject* sender,
+                                      const QString& source_path,
+                                      const QString& target_path,
+                                      const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_move_request()->set_source_path(source_path.toStdString());
+    request.mutable_move_request()->set_target_path(target_path.toStdString());
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::nextMoveRequest(QObject* sender,
+                                          quint64 continuation,
+                                          const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_move_request()->set_continuation(continuation);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
 // static
 FileRequest* FileRequest::downloadRequest(QObject* sender,
                                           const QString& file_path,
+                                          quint32 window_size,
                                           const char* reply_slot)
 {
     proto::file_transfer::Request request;
     request.mutable_download_request()->set_path(file_path.toStdString());
+    request.mutable_download_request()->set_window_size(window_size);
     return new FileRequest(sender, std::move(request), reply_slot);
 }
 
@@ -99,19 +211,142 @@ FileRequest* FileRequest::downloadRequest(QObject* sender,
 FileRequest* FileRequest::uploadRequest(QObject* sender,
                                         const QString& file_path,
                                         bool overwrite,
+                                        quint32 window_size,
+                                        quint64 file_size,
+                                        quint64 modification_time,
                                         const char* reply_slot)
 {
     proto::file_transfer::Request request;
     request.mutable_upload_request()->set_path(file_path.toStdString());
     request.mutable_upload_request()->set_overwrite(overwrite);
+    request.mutable_upload_request()->set_window_size(window_size);
+    request.mutable_upload_request()->set_file_size(file_size);
+    request.mutable_upload_request()->set_modification_time(modification_time);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::blockChecksumsRequest(QObject* sender,
+                                                const QString& file_path,
+                                                const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_block_checksums_request()->set_path(file_path.toStdString());
     return new FileRequest(sender, std::move(request), reply_slot);
 }
 
 // static
-FileRequest* FileRequest::packetRequest(QObject* sender, const char* reply_slot)
+FileRequest* FileRequest::deltaDownloadRequest(
+    QObject* sender,
+    const QString& file_path,
+    quint32 window_size,
+    const proto::file_transfer::BlockChecksums& block_checksums,
+    const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_download_request()->set_path(file_path.toStdString());
+    request.mutable_download_request()->set_window_size(window_size);
+    request.mutable_download_request()->mutable_block_checksums()->CopyFrom(block_checksums);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::deltaUploadRequest(QObject* sender,
+                                             const QString& file_path,
+                                             quint32 window_size,
+                                             quint32 delta_block_size,
+                                             const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_upload_request()->set_path(file_path.toStdString());
+    request.mutable_upload_request()->set_overwrite(true);
+    request.mutable_upload_request()->set_window_size(window_size);
+    request.mutable_upload_request()->set_delta_block_size(delta_block_size);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::resumeRequest(QObject* sender,
+                                        const QString& file_path,
+                                        quint64 file_size,
+                                        quint64 modification_time,
+                                        const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_resume_request()->set_path(file_path.toStdString());
+    request.mutable_resume_request()->set_file_size(file_size);
+    request.mutable_resume_request()->set_modification_time(modification_time);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::resumeDownloadRequest(QObject* sender,
+                                                const QString& file_path,
+                                                quint32 window_size,
+                                                quint64 offset,
+                                                const std::string& tail_hash,
+                                                const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_download_request()->set_path(file_path.toStdString());
+    request.mutable_download_request()->set_window_size(window_size);
+    request.mutable_download_request()->set_offset(offset);
+    request.mutable_download_request()->set_tail_hash(tail_hash);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::resumeUploadRequest(QObject* sender,
+                                              const QString& file_path,
+                                              quint32 window_size,
+                                              quint64 offset,
+                                              quint64 file_size,
+                                              quint64 modification_time,
+                                              const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_upload_request()->set_path(file_path.toStdString());
+    request.mutable_upload_request()->set_overwrite(true);
+    request.mutable_upload_request()->set_window_size(window_size);
+    request.mutable_upload_request()->set_offset(offset);
+    request.mutable_upload_request()->set_file_size(file_size);
+    request.mutable_upload_request()->set_modification_time(modification_time);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::bundleDownloadRequest(QObject* sender,
+                                                const proto::file_transfer::Bundle& bundle,
+                                                quint32 window_size,
+                                                const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_download_request()->set_window_size(window_size);
+    *request.mutable_download_request()->mutable_bundle() = bundle;
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::bundleUploadRequest(QObject* sender,
+                                              quint32 window_size,
+                                              const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_upload_request()->set_window_size(window_size);
+    request.mutable_upload_request()->set_bundle(true);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::packetRequest(QObject* sender,
+                                        quint32 size,
+                                        proto::file_transfer::Compression compression,
+                                        const char* reply_slot)
 {
     proto::file_transfer::Request request;
     request.mutable_packet_request()->set_dummy(1);
+    request.mutable_packet_request()->set_size(size);
+    request.mutable_packet_request()->set_compression(compression);
     return new FileRequest(sender, std::move(request), reply_slot);
 }
 
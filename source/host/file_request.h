@@ -21,6 +21,7 @@ class FileRequest : public QObject
 
 public:
     const proto::file_transfer::Request& request() const { return request_; }
+    void setStreamId(quint32 stream_id) { request_.set_stream_id(stream_id); }
     bool sendReply(const proto::file_transfer::Reply& reply);
 
     static FileRequest* driveListRequest(QObject* sender, const char* reply_slot);
@@ -29,6 +30,23 @@ public:
                                         const QString& path,
                                         const char* reply_slot);
 
+    static FileRequest* recursiveFileListRequest(QObject* sender,
+                                                 const QString& path,
+                                                 const char* reply_slot);
+
+    static FileRequest* pagedFileListRequest(QObject* sender,
+                                             const QString& path,
+                                             const char* reply_slot);
+
+    static FileRequest* cachedFileListRequest(QObject* sender,
+                                              const QString& path,
+                                              quint64 cached_version,
+                                              const char* reply_slot);
+
+    static FileRequest* nextFileListRequest(QObject* sender,
+                                            quint64 continuation,
+                                            const char* reply_slot);
+
     static FileRequest* createDirectoryRequest(QObject* sender,
                                                const QString& path,
                                                const char* reply_slot);
@@ -42,16 +60,96 @@ public:
                                       const QString& path,
                                       const char* reply_slot);
 
+    static FileRequest* recursiveRemoveRequest(QObject* sender,
+                                               const QString& path,
+                                               const char* reply_slot);
+
+    static FileRequest* nextRemoveRequest(QObject* sender,
+                                          quint64 continuation,
+                                          const char* reply_slot);
+
+    static FileRequest* copyRequest(QObject* sender,
+                                    const QString& source_path,
+                                    const QString& target_path,
+                                    const char* reply_slot);
+
+    static FileRequest* nextCopyRequest(QObject* sender,
+                                        quint64 continuation,
+                                        const char* reply_slot);
+
+    static FileRequest* moveRequest(QObject* sender,
+                                    const QString& source_path,
+                                    const QString& target_path,
+                                    const char* reply_slot);
+
+    static FileRequest* nextMoveRequest(QObject* sender,
+                                        quint64 continuation,
+                                        const char* reply_slot);
+
     static FileRequest* downloadRequest(QObject* sender,
                                         const QString& file_path,
+                                        quint32 window_size,
                                         const char* reply_slot);
 
     static FileRequest* uploadRequest(QObject* sender,
                                       const QString& file_path,
                                       bool overwrite,
+                                      quint32 window_size,
+                                      quint64 file_size,
+                                      quint64 modification_time,
+                                      const char* reply_slot);
+
+    static FileRequest* blockChecksumsRequest(QObject* sender,
+                                              const QString& file_path,
+                                              const char* reply_slot);
+
+    static FileRequest* deltaDownloadRequest(
+        QObject* sender,
+        const QString& file_path,
+        quint32 window_size,
+        const proto::file_transfer::BlockChecksums& block_checksums,
+        const char* reply_slot);
+
+    static FileRequest* deltaUploadRequest(QObject* sender,
+                                           const QString& file_path,
+                                           quint32 window_size,
+                                           quint32 delta_block_size,
+                                           const char* reply_slot);
+
+    static FileRequest* resumeRequest(QObject* sender,
+                                      const QString& file_path,
+                                      quint64 file_size,
+                                      quint64 modification_time,
                                       const char* reply_slot);
 
-    static FileRequest* packetRequest(QObject* sender, const char* reply_slot);
+    static FileRequest* resumeDownloadRequest(QObject* sender,
+                                              const QString& file_path,
+                                              quint32 window_size,
+                                              quint64 offset,
+                                              const std::string& tail_hash,
+                                              const char* reply_slot);
+
+    static FileRequest* resumeUploadRequest(QObject* sender,
+                                            const QString& file_path,
+                                            quint32 window_size,
+                                            quint64 offset,
+                                            quint64 file_size,
+                                            quint64 modification_time,
+                                            const char* reply_slot);
+
+    static FileRequest* bundleDownloadRequest(QObject* sender,
+                                              const proto::file_transfer::Bundle& bundle,
+                                              quint32 window_size,
+                                              const char* reply_slot);
+
+    static FileRequest* bundleUploadRequest(QObject* sender,
+                                            quint32 window_size,
+                                            const char* reply_slot);
+
+    static FileRequest* packetRequest(QObject* sender,
+                                      quint32 size,
+                                      proto::file_transfer::Compression compression,
+                                      const char* reply_slot);
 
     static FileRequest* packet(QObject* sender,
                                const proto::file_transfer::Packet& packet,
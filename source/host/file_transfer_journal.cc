@@ -0,0 +1,132 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_transfer_journal.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/file_transfer_journal.h"
+
+#include <QFile>
+#include <QFileInfo>
+
+extern "C" {
+#define SODIUM_STATIC
+
+#pragma warning(push, 3)
+#include <sodium.h>
+#pragma warning(pop)
+} // extern "C"
+
+namespace aspia {
+
+namespace {
+
+const char kJournalSuffix[] = ".aspia-journal";
+
+constexpr qint64 kTailSize = 1024 * 1024; // 1 MB
+
+// The journal is a few numbers. A larger file with the suffix is not a journal.
+constexpr qint64 kMaxJournalSize = 64;
+
+} // namespace
+
+// static
+bool FileTransferJournal::record(const QString& file_path,
+                                 qint64 file_size,
+                                 qint64 modification_time,
+                                 qint64 offset)
+{
+    QFile journal(journalPath(file_path));
+
+    if (!journal.open(QFile::WriteOnly | QFile::Truncate))
+        return false;
+
+    QByteArray buffer = QByteArray::number(file_size) + ' ' +
+        QByteArray::number(modification_time) + ' ' + QByteArray::number(offset);
+
+    return journal.write(buffer) == buffer.size();
+}
+
+// static
+void FileTransferJournal::end(const QString& file_path)
+{
+    QFile::remove(journalPath(file_path));
+}
+
+// static
+qint64 FileTransferJournal::resumeOffset(const QString& file_path,
+                                         qint64 file_size,
+                                         qint64 modification_time)
+{
+    // The source which is not identified can be modified without changing its size.
+    if (!modification_time)
+        return 0;
+
+    QFile journal(journalPath(file_path));
+
+    if (!journal.open(QFile::ReadOnly) || journal.size() > kMaxJournalSize)
+        return 0;
+
+    // The journal which is interrupted while it is written does not have all fields.
+    const QList<QByteArray> fields = journal.readAll().split(' ');
+    if (fields.size() != 3)
+        return 0;
+
+    bool file_size_ok;
+    bool modification_time_ok;
+    bool offset_ok;
+
+    const qint64 recorded_file_size = fields[0].toLongLong(&file_size_ok);
+    const qint64 recorded_modification_time = fields[1].toLongLong(&modification_time_ok);
+    const qint64 offset = fields[2].toLongLong(&offset_ok);
+
+    if (!file_size_ok || !modification_time_ok || !offset_ok ||
+        recorded_file_size != file_size ||
+        recorded_modification_time != modification_time ||
+        offset < 0 || offset > file_size)
+    {
+        return 0;
+    }
+
+    // The file which is shorter was changed after the transfer was interrupted.
+    QFileInfo file_info(file_path);
+    if (!file_info.isFile() || file_info.size() < offset)
+        return 0;
+
+    return offset;
+}
+
+// static
+std::string FileTransferJournal::tailHash(const QString& file_path, qint64 offset)
+{
+    QFile file(file_path);
+
+    if (!file.open(QFile::ReadOnly) || file.size() < offset)
+        return std::string();
+
+    const qint64 tail_size = qMin(offset, kTailSize);
+
+    if (!file.seek(offset - tail_size))
+        return std::string();
+
+    QByteArray tail = file.read(tail_size);
+    if (tail.size() != tail_size)
+        return std::string();
+
+    std::string hash;
+    hash.resize(crypto_generichash_BYTES);
+
+    crypto_generichash(reinterpret_cast<quint8*>(&hash[0]), hash.size(),
+                       reinterpret_cast<const quint8*>(tail.constData()), tail.size(),
+                       nullptr, 0);
+    return hash;
+}
+
+// static
+QString FileTransferJournal::journalPath(const QString& file_path)
+{
+    return file_path + QLatin1String(kJournalSuffix);
+}
+
+} // namespace aspia
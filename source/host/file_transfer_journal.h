@@ -0,0 +1,57 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_transfer_journal.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__FILE_TRANSFER_JOURNAL_H
+#define _ASPIA_HOST__FILE_TRANSFER_JOURNAL_H
+
+#include <QString>
+
+#include <string>
+
+namespace aspia {
+
+// Records the files which are being received. The record is a small file next to the received
+// file. It is removed when the transfer is completed, so the files which still have the record
+// were interrupted and can be resumed.
+//
+// The record has the size and the modification time of the source and the size of the data
+// which is written to the file. The size of the file itself is not used: the space for the rest
+// of the data can be reserved in it, and the data which is not yet written can be lost.
+class FileTransferJournal
+{
+public:
+    // Records that |file_path| is being received from the source of |file_size| bytes which was
+    // modified at |modification_time| (milliseconds since the epoch), and that the data before
+    // |offset| is written to the file.
+    static bool record(const QString& file_path,
+                       qint64 file_size,
+                       qint64 modification_time,
+                       qint64 offset);
+
+    // Removes the record after the last packet is written.
+    static void end(const QString& file_path);
+
+    // If the transfer of the same source to |file_path| was interrupted, returns the size of the
+    // data which was written. Otherwise returns 0.
+    static qint64 resumeOffset(const QString& file_path,
+                               qint64 file_size,
+                               qint64 modification_time);
+
+    // Returns the hash of the data of the file before |offset|. Only the last megabyte is hashed,
+    // it is enough to make sure the source and the target have the same file. Returns an empty
+    // string if the file can not be read.
+    static std::string tailHash(const QString& file_path, qint64 offset);
+
+private:
+    static QString journalPath(const QString& file_path);
+
+    Q_DISABLE_COPY(FileTransferJournal)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__FILE_TRANSFER_JOURNAL_H
@@ -9,21 +9,116 @@
 
 #include <QDebug>
 #include <QDateTime>
+#include <QElapsedTimer>
 #include <QStandardPaths>
 #include <QStorageInfo>
 
+#include <algorithm>
+
+#include "host/file_delta.h"
 #include "host/file_platform_util.h"
+#include "host/file_transfer_journal.h"
 
 namespace aspia {
 
+namespace {
+
+// The maximum amount of packet data which the client can send or request without waiting for
+// the replies. Limits the memory which the queued messages can take.
+constexpr quint32 kMaxWindowSize = 16 * 1024 * 1024; // 16 MB
+
+// The maximum number of files which can be transferred at the same time.
+constexpr quint32 kMaxStreams = 16;
+
+// The size of one page of the listing. The entries of a deep tree are returned with several
+// replies instead of one huge message.
+constexpr int kMaxListingPageEntries = 8192;
+constexpr size_t kMaxListingPageSize = 2 * 1024 * 1024; // 2 MB
+
+// The listings which the client has not finished reading. When the limit is reached, a new one
+// is refused unless the client has not read the next page of one of them for the idle timeout.
+constexpr size_t kMaxListings = 4;
+constexpr qint64 kListingIdleTimeout = 60000; // 60 seconds
+
+// The copying replies after this time to report the progress. The files are copied in chunks of
+// this size.
+constexpr qint64 kCopyReplyInterval = 250; // 250 ms
+constexpr qint64 kCopyChunkSize = 4 * 1024 * 1024; // 4 MB
+
+// The copying and moving which the client has not finished. When the limit is reached, a new one
+// is refused unless the client has not continued one of them for the idle timeout.
+constexpr size_t kMaxCopies = 4;
+constexpr qint64 kCopyIdleTimeout = 60000; // 60 seconds
+
+// The snapshots of the listings which the client can have in its cache.
+constexpr size_t kMaxSnapshots = 64;
+
+constexpr QDir::Filters kListingFilter =
+    QDir::Files | QDir::AllDirs | QDir::NoDotAndDotDot | QDir::System | QDir::Hidden;
+
+bool isSameItem(const proto::file_transfer::FileList::Item& first,
+                const proto::file_transfer::FileList::Item& second)
+{
+    return first.size() == second.size() &&
+           first.modification_time() == second.modification_time() &&
+           first.is_directory() == second.is_directory();
+}
+
+// The links are not copied: the copy would contain the target of the link or, for a link to a
+// directory, an empty directory instead of the link. The shortcuts of Windows are ordinary files,
+// though QFileInfo reports them as links.
+bool isLink(const QFileInfo& info)
+{
+    return info.isSymLink() &&
+           info.suffix().compare(QLatin1String("lnk"), Qt::CaseInsensitive) != 0;
+}
+
+// The recursive removal replies after this time to report the progress. The failed entries are
+// reported in batches of limited size.
+constexpr qint64 kRemovalReplyInterval = 250; // 250 ms
+constexpr int kMaxRemovalFailures = 64;
+
+// The removals which the client has not finished. When the limit is reached, a new one is refused
+// unless the client has not continued one of them for the idle timeout.
+constexpr size_t kMaxRemovals = 4;
+constexpr qint64 kRemovalIdleTimeout = 60000; // 60 seconds
+
+proto::file_transfer::Status removePath(const QString& path, bool is_directory)
+{
+    if (is_directory)
+    {
+        if (!QDir().rmdir(path))
+            return proto::file_transfer::STATUS_ACCESS_DENIED;
+    }
+    else
+    {
+        QFile file(path);
+        file.setPermissions(QFile::ReadOther | QFile::WriteOther);
+        if (!file.remove(path))
+            return proto::file_transfer::STATUS_ACCESS_DENIED;
+    }
+
+    return proto::file_transfer::STATUS_SUCCESS;
+}
+
+} // namespace
+
 FileWorker::FileWorker(QObject* parent)
-    : QObject(parent)
+    : QObject(parent),
+      io_thread_(std::make_unique<FileIoThread>())
 {
     // Nothing
 }
 
 proto::file_transfer::Reply FileWorker::doRequest(const proto::file_transfer::Request& request)
 {
+    if (request.stream_id() >= kMaxStreams)
+    {
+        proto::file_transfer::Reply reply;
+        reply.set_status(proto::file_transfer::STATUS_INVALID_REQUEST);
+        return reply;
+    }
+
     if (request.has_drive_list_request())
     {
         return doDriveListRequest();
@@ -44,21 +139,37 @@ proto::file_transfer::Reply FileWorker::doRequest(const proto::file_transfer::Re
     {
         return doRemoveRequest(request.remove_request());
     }
+    else if (request.has_copy_request())
+    {
+        return doCopyRequest(request.copy_request());
+    }
+    else if (request.has_move_request())
+    {
+        return doMoveRequest(request.move_request());
+    }
     else if (request.has_download_request())
     {
-        return doDownloadRequest(request.download_request());
+        return doDownloadRequest(request.stream_id(), request.download_request());
     }
     else if (request.has_upload_request())
     {
-        return doUploadRequest(request.upload_request());
+        return doUploadRequest(request.stream_id(), request.upload_request());
     }
     else if (request.has_packet_request())
     {
-        return doPacketRequest();
+        return doPacketRequest(request.stream_id(), request.packet_request());
     }
     else if (request.has_packet())
     {
-        return doPacket(request.packet());
+        return doPacket(request.stream_id(), request.packet());
+    }
+    else if (request.has_block_checksums_request())
+    {
+        return doBlockChecksumsRequest(request.block_checksums_request());
+    }
+    else if (request.has_resume_request())
+    {
+        return doResumeRequest(request.resume_request());
     }
     else
     {
@@ -119,15 +230,102 @@ proto::file_transfer::Reply FileWorker::doFileListRequest(
 {
     proto::file_transfer::Reply reply;
 
-    QDir directory(QString::fromStdString(request.path()));
+    if (request.continuation())
+    {
+        auto listing = listings_.find(request.continuation());
+        if (listing == listings_.end())
+        {
+            reply.set_status(proto::file_transfer::STATUS_INVALID_REQUEST);
+            return reply;
+        }
+
+        reply.mutable_file_list()->set_recursive(listing->second.recursive);
+        readListingPage(listing->first, &listing->second, reply.mutable_file_list());
+
+        reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+        return reply;
+    }
+
+    const QString path = QString::fromStdString(request.path());
+
+    QDir directory(path);
     if (!directory.exists())
     {
         reply.set_status(proto::file_transfer::STATUS_PATH_NOT_FOUND);
         return reply;
     }
 
-    directory.setFilter(QDir::Files | QDir::AllDirs | QDir::NoDotAndDotDot |
-                        QDir::System | QDir::Hidden);
+    if (request.cached_version() && !request.recursive())
+    {
+        auto snapshot = snapshots_.find(request.cached_version());
+
+        if (snapshot != snapshots_.end() && snapshot->second.path == path &&
+            readListingChanges(snapshot, reply.mutable_file_list()))
+        {
+            reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+            return reply;
+        }
+    }
+
+    if (request.recursive() || request.paged())
+    {
+        // The time is taken before the listing. The changes made during the listing are found
+        // with the next validation.
+        const qint64 modification_time =
+            QFileInfo(path).lastModified().toMSecsSinceEpoch();
+
+        if (listings_.size() >= kMaxListings)
+        {
+            // The listings which the client reads are not interrupted.
+            auto abandoned = std::find_if(listings_.begin(), listings_.end(),
+                [](const std::pair<const quint64, Listing>& listing)
+            {
+                return listing.second.idle_timer.hasExpired(kListingIdleTimeout);
+            });
+
+            if (abandoned == listings_.end())
+            {
+                qWarning("Too many listings in progress");
+                reply.set_status(proto::file_transfer::STATUS_ACCESS_DENIED);
+                return reply;
+            }
+
+            listings_.erase(abandoned);
+        }
+
+        const quint64 id = ++last_listing_id_;
+
+        Listing& listing = listings_[id];
+        listing.root = directory;
+        listing.recursive = request.recursive();
+
+        // The symbolic links to directories are not followed to avoid loops.
+        listing.iterator = std::make_unique<QDirIterator>(
+            directory.path(),
+            kListingFilter,
+            listing.recursive ? QDirIterator::Subdirectories : QDirIterator::NoIteratorFlags);
+
+        proto::file_transfer::FileList* file_list = reply.mutable_file_list();
+
+        file_list->set_recursive(listing.recursive);
+        readListingPage(id, &listing, file_list);
+
+        // The directory which fits into one page can be cached by the client.
+        if (!request.recursive() && !file_list->continuation())
+        {
+            std::map<std::string, proto::file_transfer::FileList::Item> items;
+
+            for (int i = 0; i < file_list->item_size(); ++i)
+                items.emplace(file_list->item(i).name(), file_list->item(i));
+
+            file_list->set_version(addSnapshot(path, modification_time, std::move(items)));
+        }
+
+        reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+        return reply;
+    }
+
+    directory.setFilter(kListingFilter);
     directory.setSorting(QDir::Name | QDir::DirsFirst);
 
     QFileInfoList info_list = directory.entryInfoList();
@@ -146,6 +344,117 @@ proto::file_transfer::Reply FileWorker::doFileListRequest(
     return reply;
 }
 
+void FileWorker::readListingPage(quint64 id, Listing* listing,
+                                 proto::file_transfer::FileList* file_list)
+{
+    QDirIterator* iterator = listing->iterator.get();
+
+    listing->idle_timer.start();
+
+    int count = 0;
+    size_t page_size = 0;
+
+    while (count < kMaxListingPageEntries && page_size < kMaxListingPageSize)
+    {
+        if (!iterator->hasNext())
+        {
+            // The listing is complete.
+            listings_.erase(id);
+            return;
+        }
+
+        iterator->next();
+
+        const QFileInfo info = iterator->fileInfo();
+
+        proto::file_transfer::FileList::Item* item = file_list->add_item();
+
+        // QDirIterator returns a directory before the entries of the directory.
+        item->set_name(listing->root.relativeFilePath(info.filePath()).toStdString());
+        item->set_size(info.size());
+        item->set_modification_time(info.lastModified().toSecsSinceEpoch());
+        item->set_is_directory(info.isDir());
+
+        page_size += item->name().size();
+        ++count;
+    }
+
+    file_list->set_continuation(id);
+}
+
+bool FileWorker::readListingChanges(std::map<quint64, Snapshot>::iterator snapshot,
+                                    proto::file_transfer::FileList* file_list)
+{
+    const QString path = snapshot->second.path;
+    const qint64 modification_time = QFileInfo(path).lastModified().toMSecsSinceEpoch();
+
+    QDir directory(path);
+    directory.setFilter(kListingFilter);
+
+    // Adding, removing or renaming of an entry changes the modification time of the directory.
+    const uint entry_count = directory.count();
+
+    if (modification_time == snapshot->second.modification_time &&
+        entry_count == snapshot->second.items.size())
+    {
+        file_list->set_not_modified(true);
+        file_list->set_version(snapshot->first);
+        return true;
+    }
+
+    std::map<std::string, proto::file_transfer::FileList::Item> old_items;
+    old_items.swap(snapshot->second.items);
+    snapshots_.erase(snapshot);
+
+    // The large directory is listed in pages and is not cached.
+    if (entry_count > static_cast<uint>(kMaxListingPageEntries))
+        return false;
+
+    std::map<std::string, proto::file_transfer::FileList::Item> items;
+
+    for (const auto& info : directory.entryInfoList())
+    {
+        proto::file_transfer::FileList::Item item;
+
+        item.set_name(info.fileName().toStdString());
+        item.set_size(info.size());
+        item.set_modification_time(info.lastModified().toSecsSinceEpoch());
+        item.set_is_directory(info.isDir());
+
+        auto old_item = old_items.find(item.name());
+        if (old_item == old_items.end() || !isSameItem(old_item->second, item))
+            *file_list->add_item() = item;
+
+        items.emplace(item.name(), std::move(item));
+    }
+
+    for (const auto& old_item : old_items)
+    {
+        if (items.find(old_item.first) == items.end())
+            file_list->add_removed_item()->set_name(old_item.first);
+    }
+
+    file_list->set_delta(true);
+    file_list->set_version(addSnapshot(path, modification_time, std::move(items)));
+    return true;
+}
+
+quint64 FileWorker::addSnapshot(const QString& path, qint64 modification_time,
+                                std::map<std::string, proto::file_transfer::FileList::Item>&& items)
+{
+    if (snapshots_.size() >= kMaxSnapshots)
+        snapshots_.erase(snapshots_.begin());
+
+    const quint64 version = ++last_snapshot_version_;
+
+    Snapshot& snapshot = snapshots_[version];
+    snapshot.path = path;
+    snapshot.modification_time = modification_time;
+    snapshot.items = std::move(items);
+
+    return version;
+}
+
 proto::file_transfer::Reply FileWorker::doCreateDirectoryRequest(
     const proto::file_transfer::CreateDirectoryRequest& request)
 {
@@ -225,6 +534,21 @@ proto::file_transfer::Reply FileWorker::doRemoveRequest(
 {
     proto::file_transfer::Reply reply;
 
+    if (request.continuation())
+    {
+        auto removal = removals_.find(request.continuation());
+        if (removal == removals_.end())
+        {
+            reply.set_status(proto::file_transfer::STATUS_INVALID_REQUEST);
+            return reply;
+        }
+
+        processRemoval(removal->first, &removal->second, reply.mutable_remove_progress());
+
+        reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+        return reply;
+    }
+
     QString path = QString::fromStdString(request.path());
 
     QFileInfo file_info(path);
@@ -234,52 +558,481 @@ proto::file_transfer::Reply FileWorker::doRemoveRequest(
         return reply;
     }
 
-    if (file_info.isDir())
+    if (request.recursive())
     {
-        if (!QDir().rmdir(path))
+        if (removals_.size() >= kMaxRemovals)
         {
-            reply.set_status(proto::file_transfer::STATUS_ACCESS_DENIED);
+            // The removals which the client continues are not interrupted.
+            auto abandoned = std::find_if(removals_.begin(), removals_.end(),
+                [](const std::pair<const quint64, Removal>& removal)
+            {
+                return removal.second.idle_timer.hasExpired(kRemovalIdleTimeout);
+            });
+
+            if (abandoned == removals_.end())
+            {
+                qWarning("Too many removals in progress");
+                reply.set_status(proto::file_transfer::STATUS_ACCESS_DENIED);
+                return reply;
+            }
+
+            removals_.erase(abandoned);
+        }
+
+        const quint64 id = ++last_removal_id_;
+
+        Removal& removal = removals_[id];
+        removal.entries.push_back({ path, file_info.isDir() });
+
+        // The symbolic links to directories are removed without their contents.
+        if (file_info.isDir() && !file_info.isSymLink())
+        {
+            removal.iterator = std::make_unique<QDirIterator>(
+                path, kListingFilter, QDirIterator::Subdirectories);
+        }
+        else
+        {
+            removal.total = 1;
+        }
+
+        processRemoval(id, &removal, reply.mutable_remove_progress());
+
+        reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+        return reply;
+    }
+
+    reply.set_status(removePath(path, file_info.isDir()));
+    return reply;
+}
+
+void FileWorker::processRemoval(quint64 id, Removal* removal,
+                                proto::file_transfer::RemoveProgress* progress)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    removal->idle_timer.start();
+
+    while (removal->iterator && !timer.hasExpired(kRemovalReplyInterval))
+    {
+        if (!removal->iterator->hasNext())
+        {
+            removal->iterator.reset();
+            removal->total = static_cast<quint32>(removal->entries.size());
+            break;
+        }
+
+        removal->iterator->next();
+
+        const QFileInfo info = removal->iterator->fileInfo();
+
+        // QDirIterator returns a directory before the entries of the directory.
+        removal->entries.push_back({ info.filePath(), info.isDir() });
+        progress->set_current_path(info.filePath().toStdString());
+    }
+
+    if (!removal->iterator)
+    {
+        while (!removal->entries.empty() &&
+               !timer.hasExpired(kRemovalReplyInterval) &&
+               progress->failure_size() < kMaxRemovalFailures)
+        {
+            const Removal::Entry& entry = removal->entries.back();
+
+            proto::file_transfer::Status status = removePath(entry.path, entry.is_directory);
+            if (status != proto::file_transfer::STATUS_SUCCESS)
+            {
+                proto::file_transfer::RemoveProgress::Failure* failure = progress->add_failure();
+                failure->set_path(entry.path.toStdString());
+                failure->set_status(status);
+            }
+
+            progress->set_current_path(entry.path.toStdString());
+            removal->entries.pop_back();
+        }
+
+        progress->set_total(removal->total);
+        progress->set_processed(removal->total - static_cast<quint32>(removal->entries.size()));
+    }
+
+    if (removal->entries.empty())
+    {
+        // The removal is complete.
+        removals_.erase(id);
+        return;
+    }
+
+    progress->set_continuation(id);
+}
+
+proto::file_transfer::Reply FileWorker::doCopyRequest(
+    const proto::file_transfer::CopyRequest& request)
+{
+    if (request.continuation())
+        return continueCopy(request.continuation());
+
+    return startCopy(QString::fromStdString(request.source_path()),
+                     QString::fromStdString(request.target_path()),
+                     false);
+}
+
+proto::file_transfer::Reply FileWorker::doMoveRequest(
+    const proto::file_transfer::MoveRequest& request)
+{
+    if (request.continuation())
+        return continueCopy(request.continuation());
+
+    return startCopy(QString::fromStdString(request.source_path()),
+                     QString::fromStdString(request.target_path()),
+                     true);
+}
+
+proto::file_transfer::Reply FileWorker::startCopy(const QString& source_path,
+                                                  const QString& target_path,
+                                                  bool move)
+{
+    proto::file_transfer::Reply reply;
+
+    QFileInfo source_info(source_path);
+    if (!source_info.exists())
+    {
+        reply.set_status(proto::file_transfer::STATUS_PATH_NOT_FOUND);
+        return reply;
+    }
+
+    if (QFileInfo::exists(target_path))
+    {
+        reply.set_status(proto::file_transfer::STATUS_PATH_ALREADY_EXISTS);
+        return reply;
+    }
+
+    const bool is_directory = source_info.isDir() && !source_info.isSymLink();
+
+    // The directory can not be copied into itself.
+    if (is_directory)
+    {
+        const QString source_prefix = QDir::cleanPath(source_info.absoluteFilePath()) + '/';
+        const QString target = QDir::cleanPath(QFileInfo(target_path).absoluteFilePath());
+
+        if (target.startsWith(source_prefix, Qt::CaseInsensitive))
+        {
+            reply.set_status(proto::file_transfer::STATUS_INVALID_PATH_NAME);
             return reply;
         }
     }
-    else
+
+    // Within one volume the move is a rename. Otherwise the rename fails and the source is
+    // copied.
+    if (move)
     {
-        QFile file(path);
-        file.setPermissions(QFile::ReadOther | QFile::WriteOther);
-        if (!file.remove(path))
+        const bool renamed = source_info.isDir() ?
+            QDir().rename(source_path, target_path) : QFile::rename(source_path, target_path);
+
+        if (renamed)
+        {
+            reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+            reply.mutable_copy_progress()->set_current_path(source_path.toStdString());
+            return reply;
+        }
+    }
+
+    if (isLink(source_info))
+    {
+        qWarning() << "Unable to copy link" << source_path;
+        reply.set_status(proto::file_transfer::STATUS_INVALID_PATH_NAME);
+        return reply;
+    }
+
+    if (copies_.size() >= kMaxCopies)
+    {
+        // The copies which the client continues are not interrupted.
+        auto abandoned = std::find_if(copies_.begin(), copies_.end(),
+            [](const std::pair<const quint64, Copy>& copy)
         {
+            return copy.second.idle_timer.hasExpired(kCopyIdleTimeout);
+        });
+
+        if (abandoned == copies_.end())
+        {
+            qWarning("Too many copies in progress");
             reply.set_status(proto::file_transfer::STATUS_ACCESS_DENIED);
             return reply;
         }
+
+        copies_.erase(abandoned);
     }
 
-    reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+    const quint64 id = ++last_copy_id_;
+
+    Copy& copy = copies_[id];
+    copy.source_root = QDir(source_path);
+    copy.target_root = target_path;
+    copy.move = move;
+    copy.entries.push_back({ source_path, target_path, is_directory });
+
+    if (is_directory)
+    {
+        copy.iterator = std::make_unique<QDirIterator>(
+            source_path, kListingFilter, QDirIterator::Subdirectories);
+    }
+    else
+    {
+        copy.total_size = source_info.size();
+    }
+
+    reply.set_status(processCopy(id, &copy, reply.mutable_copy_progress()));
     return reply;
 }
 
+proto::file_transfer::Reply FileWorker::continueCopy(quint64 id)
+{
+    proto::file_transfer::Reply reply;
+
+    auto copy = copies_.find(id);
+    if (copy == copies_.end())
+    {
+        reply.set_status(proto::file_transfer::STATUS_INVALID_REQUEST);
+        return reply;
+    }
+
+    reply.set_status(processCopy(copy->first, &copy->second, reply.mutable_copy_progress()));
+    return reply;
+}
+
+proto::file_transfer::Status FileWorker::processCopy(quint64 id, Copy* copy,
+                                                     proto::file_transfer::CopyProgress* progress)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    copy->idle_timer.start();
+
+    proto::file_transfer::Status status = proto::file_transfer::STATUS_SUCCESS;
+
+    while (copy->iterator && !timer.hasExpired(kCopyReplyInterval))
+    {
+        if (!copy->iterator->hasNext())
+        {
+            copy->iterator.reset();
+            break;
+        }
+
+        copy->iterator->next();
+
+        const QFileInfo info = copy->iterator->fileInfo();
+
+        progress->set_current_path(info.filePath().toStdString());
+
+        // Nothing is copied until the listing is complete, so the copy fails without changes.
+        if (isLink(info))
+        {
+            qWarning() << "Unable to copy link" << info.filePath();
+            copy->iterator.reset();
+            status = proto::file_transfer::STATUS_INVALID_PATH_NAME;
+            break;
+        }
+
+        // QDirIterator returns a directory before the entries of the directory.
+        copy->entries.push_back(
+            { info.filePath(),
+              copy->target_root + '/' + copy->source_root.relativeFilePath(info.filePath()),
+              info.isDir() });
+
+        if (!info.isDir())
+            copy->total_size += info.size();
+    }
+
+    if (!copy->iterator && status == proto::file_transfer::STATUS_SUCCESS)
+    {
+        while (copy->copied_count < copy->entries.size() &&
+               !timer.hasExpired(kCopyReplyInterval))
+        {
+            progress->set_current_path(
+                copy->entries[copy->copied_count].source_path.toStdString());
+
+            status = copyNextPart(copy);
+            if (status != proto::file_transfer::STATUS_SUCCESS)
+                break;
+        }
+
+        // The source of the move is removed after all of it is copied.
+        while (status == proto::file_transfer::STATUS_SUCCESS &&
+               copy->move &&
+               copy->copied_count == copy->entries.size() &&
+               copy->removed_count < copy->entries.size() &&
+               !timer.hasExpired(kCopyReplyInterval))
+        {
+            const Copy::Entry& entry =
+                copy->entries[copy->entries.size() - copy->removed_count - 1];
+
+            progress->set_current_path(entry.source_path.toStdString());
+
+            status = removePath(entry.source_path, entry.is_directory);
+            ++copy->removed_count;
+        }
+
+        progress->set_total_size(copy->total_size);
+        progress->set_copied_size(qMin(copy->copied_size, copy->total_size));
+    }
+
+    const bool complete = copy->copied_count == copy->entries.size() &&
+                          (!copy->move || copy->removed_count == copy->entries.size());
+
+    if (status != proto::file_transfer::STATUS_SUCCESS || complete)
+    {
+        copies_.erase(id);
+        return status;
+    }
+
+    progress->set_continuation(id);
+    return status;
+}
+
+FileWorker::Copy::~Copy()
+{
+    // The partially copied file is not left in the target.
+    if (target_file)
+    {
+        target_file->close();
+        target_file->remove();
+    }
+}
+
+proto::file_transfer::Status FileWorker::copyNextPart(Copy* copy)
+{
+    const Copy::Entry& entry = copy->entries[copy->copied_count];
+
+    if (entry.is_directory)
+    {
+        if (QFileInfo::exists(entry.target_path))
+            return proto::file_transfer::STATUS_PATH_ALREADY_EXISTS;
+
+        if (!QDir().mkdir(entry.target_path))
+            return proto::file_transfer::STATUS_ACCESS_DENIED;
+
+        ++copy->copied_count;
+        return proto::file_transfer::STATUS_SUCCESS;
+    }
+
+    if (!copy->source_file)
+    {
+        if (QFileInfo::exists(entry.target_path))
+            return proto::file_transfer::STATUS_PATH_ALREADY_EXISTS;
+
+        copy->source_file = std::make_unique<QFile>(entry.source_path);
+        if (!copy->source_file->open(QFile::ReadOnly))
+            return proto::file_transfer::STATUS_FILE_OPEN_ERROR;
+
+        copy->target_file = std::make_unique<QFile>(entry.target_path);
+        if (!copy->target_file->open(QFile::WriteOnly))
+            return proto::file_transfer::STATUS_FILE_CREATE_ERROR;
+
+        // The copy is not fragmented. The result does not matter: the file is written anyway.
+        FilePlatformUtil::preallocateFile(copy->target_file.get(), copy->source_file->size());
+    }
+
+    copy_buffer_.resize(kCopyChunkSize);
+
+    const qint64 read_size = copy->source_file->read(&copy_buffer_[0], kCopyChunkSize);
+    if (read_size < 0)
+        return proto::file_transfer::STATUS_FILE_READ_ERROR;
+
+    if (read_size > 0)
+    {
+        if (copy->target_file->write(copy_buffer_.data(), read_size) != read_size)
+            return proto::file_transfer::STATUS_FILE_WRITE_ERROR;
+
+        copy->copied_size += read_size;
+        return proto::file_transfer::STATUS_SUCCESS;
+    }
+
+    // The end of the file.
+    copy->target_file->setFileTime(QFileInfo(entry.source_path).lastModified(),
+                                   QFileDevice::FileModificationTime);
+    copy->target_file->close();
+
+    copy->target_file.reset();
+    copy->source_file.reset();
+
+    ++copy->copied_count;
+    return proto::file_transfer::STATUS_SUCCESS;
+}
+
 proto::file_transfer::Reply FileWorker::doDownloadRequest(
-    const proto::file_transfer::DownloadRequest& request)
+    quint32 stream_id, const proto::file_transfer::DownloadRequest& request)
 {
     proto::file_transfer::Reply reply;
 
-    packetizer_ = FilePacketizer::create(QString::fromStdString(request.path()));
-    if (!packetizer_)
+    std::unique_ptr<FilePacketizer>& packetizer = streams_[stream_id].packetizer;
+
+    QString file_path = QString::fromStdString(request.path());
+
+    if (request.has_bundle())
+        packetizer = FilePacketizer::createBundle(request.bundle());
+    else
+        packetizer = FilePacketizer::create(file_path);
+
+    if (!packetizer)
+    {
         reply.set_status(proto::file_transfer::STATUS_FILE_OPEN_ERROR);
+    }
     else
+    {
+        if (request.has_block_checksums())
+            packetizer->enableDelta(request.block_checksums());
+
+        // If the data received by the target differs, the file is transferred from the beginning.
+        if (request.offset() && !request.tail_hash().empty() &&
+            FileTransferJournal::tailHash(file_path, request.offset()) == request.tail_hash() &&
+            packetizer->seek(request.offset()))
+        {
+            reply.set_offset(request.offset());
+        }
+
+        packetizer->enableReadAhead(io_thread_.get());
+
         reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+        reply.set_window_size(qMin(request.window_size(), kMaxWindowSize));
+        reply.set_file_size(packetizer->fileSize());
+        reply.set_max_streams(kMaxStreams);
+        reply.set_bundles(true);
+
+        // The target records the time in the journal, so the interrupted transfer is resumed
+        // only for the unchanged file.
+        if (!request.has_bundle())
+        {
+            reply.set_modification_time(
+                QFileInfo(file_path).lastModified().toMSecsSinceEpoch());
+        }
+    }
 
     return reply;
 }
 
 proto::file_transfer::Reply FileWorker::doUploadRequest(
-    const proto::file_transfer::UploadRequest& request)
+    quint32 stream_id, const proto::file_transfer::UploadRequest& request)
 {
     proto::file_transfer::Reply reply;
 
+    Stream& stream = streams_[stream_id];
+
     QString file_path = QString::fromStdString(request.path());
 
     do
     {
+        if (request.bundle())
+        {
+            stream.depacketizer = FileDepacketizer::createBundle();
+            stream.journal_path.clear();
+
+            reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+            reply.set_window_size(qMin(request.window_size(), kMaxWindowSize));
+            reply.set_compression(proto::file_transfer::COMPRESSION_ZLIB);
+            reply.set_max_streams(kMaxStreams);
+            reply.set_bundles(true);
+            break;
+        }
+
         if (!request.overwrite())
         {
             if (QFile(file_path).exists())
@@ -289,25 +1042,100 @@ proto::file_transfer::Reply FileWorker::doUploadRequest(
             }
         }
 
-        depacketizer_ = FileDepacketizer::create(file_path, request.overwrite());
-        if (!depacketizer_)
+        if (request.offset())
+        {
+            stream.depacketizer = FileDepacketizer::createForResume(file_path, request.offset());
+        }
+        else
+        {
+            stream.depacketizer = FileDepacketizer::create(
+                file_path, request.overwrite(), request.delta_block_size());
+        }
+
+        if (!stream.depacketizer)
         {
             reply.set_status(proto::file_transfer::STATUS_FILE_CREATE_ERROR);
             break;
         }
 
+        stream.depacketizer->enableWriteBehind(io_thread_.get());
+
+        // The file which replaces the existing file with the delta is complete only after
+        // the last packet. Such transfers are not resumed. The source without the modification
+        // time can be changed without changing its size, so its transfer is not resumed either.
+        if (request.file_size() && request.modification_time() &&
+            stream.depacketizer->enableJournal(
+                file_path, request.file_size(), request.modification_time()))
+        {
+            stream.journal_path = file_path;
+        }
+        else
+        {
+            stream.journal_path.clear();
+        }
+
         reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+        reply.set_window_size(qMin(request.window_size(), kMaxWindowSize));
+        reply.set_compression(proto::file_transfer::COMPRESSION_ZLIB);
+        reply.set_max_streams(kMaxStreams);
+        reply.set_bundles(true);
     }
     while (false);
 
     return reply;
 }
 
-proto::file_transfer::Reply FileWorker::doPacketRequest()
+proto::file_transfer::Reply FileWorker::doBlockChecksumsRequest(
+    const proto::file_transfer::BlockChecksumsRequest& request)
+{
+    proto::file_transfer::Reply reply;
+
+    if (!FileDeltaEncoder::computeBlockChecksums(QString::fromStdString(request.path()),
+                                                 reply.mutable_block_checksums()))
+    {
+        reply.clear_block_checksums();
+        reply.set_status(proto::file_transfer::STATUS_FILE_READ_ERROR);
+    }
+    else
+    {
+        reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+    }
+
+    return reply;
+}
+
+proto::file_transfer::Reply FileWorker::doResumeRequest(
+    const proto::file_transfer::ResumeRequest& request)
 {
     proto::file_transfer::Reply reply;
 
-    if (!packetizer_)
+    QString file_path = QString::fromStdString(request.path());
+
+    // Zero offset means that the file can not be resumed.
+    qint64 offset = FileTransferJournal::resumeOffset(
+        file_path, request.file_size(), request.modification_time());
+    if (offset)
+    {
+        std::string tail_hash = FileTransferJournal::tailHash(file_path, offset);
+        if (!tail_hash.empty())
+        {
+            reply.set_offset(offset);
+            reply.set_tail_hash(tail_hash);
+        }
+    }
+
+    reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+    return reply;
+}
+
+proto::file_transfer::Reply FileWorker::doPacketRequest(
+    quint32 stream_id, const proto::file_transfer::PacketRequest& request)
+{
+    proto::file_transfer::Reply reply;
+
+    std::unique_ptr<FilePacketizer>& packetizer = streams_[stream_id].packetizer;
+
+    if (!packetizer)
     {
         // Set the unknown status of the request. The connection will be closed.
         reply.set_status(proto::file_transfer::STATUS_UNKNOWN);
@@ -316,7 +1144,7 @@ proto::file_transfer::Reply FileWorker::doPacketRequest()
     else
     {
         std::unique_ptr<proto::file_transfer::Packet> packet =
-            packetizer_->readNextPacket();
+            packetizer->readNextPacket(request.size(), request.compression());
         if (!packet)
         {
             reply.set_status(proto::file_transfer::STATUS_FILE_READ_ERROR);
@@ -324,7 +1152,7 @@ proto::file_transfer::Reply FileWorker::doPacketRequest()
         else
         {
             if (packet->flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET)
-                packetizer_.reset();
+                packetizer.reset();
 
             reply.set_status(proto::file_transfer::STATUS_SUCCESS);
             reply.set_allocated_packet(packet.release());
@@ -334,11 +1162,14 @@ proto::file_transfer::Reply FileWorker::doPacketRequest()
     return reply;
 }
 
-proto::file_transfer::Reply FileWorker::doPacket(const proto::file_transfer::Packet& packet)
+proto::file_transfer::Reply FileWorker::doPacket(
+    quint32 stream_id, const proto::file_transfer::Packet& packet)
 {
     proto::file_transfer::Reply reply;
 
-    if (!depacketizer_)
+    Stream& stream = streams_[stream_id];
+
+    if (!stream.depacketizer)
     {
         // Set the unknown status of the request. The connection will be closed.
         reply.set_status(proto::file_transfer::STATUS_UNKNOWN);
@@ -346,13 +1177,27 @@ proto::file_transfer::Reply FileWorker::doPacket(const proto::file_transfer::Pac
     }
     else
     {
-        if (!depacketizer_->writeNextPacket(packet))
+        if (!stream.depacketizer->writeNextPacket(packet))
             reply.set_status(proto::file_transfer::STATUS_FILE_WRITE_ERROR);
         else
             reply.set_status(proto::file_transfer::STATUS_SUCCESS);
 
         if (packet.flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET)
-            depacketizer_.reset();
+        {
+            // The files of the bundle which were not written are transferred separately.
+            if (stream.depacketizer->bundleFailures().entry_size())
+                *reply.mutable_bundle_failures() = stream.depacketizer->bundleFailures();
+
+            stream.depacketizer.reset();
+
+            if (!stream.journal_path.isEmpty() &&
+                reply.status() == proto::file_transfer::STATUS_SUCCESS)
+            {
+                FileTransferJournal::end(stream.journal_path);
+            }
+
+            stream.journal_path.clear();
+        }
     }
 
     return reply;
@@ -9,10 +9,20 @@
 #define _ASPIA_HOST__FILE_WORKER_H
 
 #include "host/file_depacketizer.h"
+#include "host/file_io_thread.h"
 #include "host/file_packetizer.h"
 #include "host/file_request.h"
 #include "protocol/file_transfer_session.pb.h"
 
+#include <QDir>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFile>
+
+#include <map>
+#include <memory>
+#include <vector>
+
 namespace aspia {
 
 class FileWorker : public QObject
@@ -38,15 +48,155 @@ private:
         const proto::file_transfer::RenameRequest& request);
     proto::file_transfer::Reply doRemoveRequest(
         const proto::file_transfer::RemoveRequest& request);
+    proto::file_transfer::Reply doCopyRequest(
+        const proto::file_transfer::CopyRequest& request);
+    proto::file_transfer::Reply doMoveRequest(
+        const proto::file_transfer::MoveRequest& request);
     proto::file_transfer::Reply doDownloadRequest(
-        const proto::file_transfer::DownloadRequest& request);
+        quint32 stream_id, const proto::file_transfer::DownloadRequest& request);
     proto::file_transfer::Reply doUploadRequest(
-        const proto::file_transfer::UploadRequest& request);
-    proto::file_transfer::Reply doPacketRequest();
-    proto::file_transfer::Reply doPacket(const proto::file_transfer::Packet& packet);
+        quint32 stream_id, const proto::file_transfer::UploadRequest& request);
+    proto::file_transfer::Reply doBlockChecksumsRequest(
+        const proto::file_transfer::BlockChecksumsRequest& request);
+    proto::file_transfer::Reply doResumeRequest(
+        const proto::file_transfer::ResumeRequest& request);
+    proto::file_transfer::Reply doPacketRequest(
+        quint32 stream_id, const proto::file_transfer::PacketRequest& request);
+    proto::file_transfer::Reply doPacket(
+        quint32 stream_id, const proto::file_transfer::Packet& packet);
+
+    struct Listing;
+    void readListingPage(quint64 id, Listing* listing, proto::file_transfer::FileList* file_list);
+
+    struct Snapshot;
+    bool readListingChanges(std::map<quint64, Snapshot>::iterator snapshot,
+                            proto::file_transfer::FileList* file_list);
+    quint64 addSnapshot(const QString& path, qint64 modification_time,
+                        std::map<std::string, proto::file_transfer::FileList::Item>&& items);
+
+    struct Copy;
+    proto::file_transfer::Reply startCopy(const QString& source_path,
+                                          const QString& target_path,
+                                          bool move);
+    proto::file_transfer::Reply continueCopy(quint64 id);
+    proto::file_transfer::Status processCopy(quint64 id, Copy* copy,
+                                             proto::file_transfer::CopyProgress* progress);
+    proto::file_transfer::Status copyNextPart(Copy* copy);
+
+    struct Removal;
+    void processRemoval(quint64 id, Removal* removal,
+                        proto::file_transfer::RemoveProgress* progress);
+
+    struct Stream
+    {
+        std::unique_ptr<FileDepacketizer> depacketizer;
+        std::unique_ptr<FilePacketizer> packetizer;
+
+        // The file which is recorded in the journal of the incomplete transfers.
+        QString journal_path;
+    };
+
+    // Reads and writes the files of all streams. Destroyed after the streams which use it.
+    std::unique_ptr<FileIoThread> io_thread_;
+
+    std::map<quint32, Stream> streams_;
+
+    // The listings which are returned in pages. The enumeration continues from the same
+    // iterator when the next page is requested.
+    struct Listing
+    {
+        QDir root;
+        std::unique_ptr<QDirIterator> iterator;
+        bool recursive;
+
+        // Restarted by each request of the client.
+        QElapsedTimer idle_timer;
+    };
+
+    std::map<quint64, Listing> listings_;
+    quint64 last_listing_id_ = 0;
+
+    // The listings which were sent to the client and which it can cache. When the client lists
+    // the directory again, only the changes against the snapshot are returned.
+    struct Snapshot
+    {
+        QString path;
+
+        // The modification time of the directory before it was listed.
+        qint64 modification_time;
+
+        std::map<std::string, proto::file_transfer::FileList::Item> items;
+    };
+
+    std::map<quint64, Snapshot> snapshots_;
+    quint64 last_snapshot_version_ = 0;
+
+    // The recursive removals which are done in parts. The tree is listed first, then the entries
+    // are removed from the end of the list, so the contents of a directory are removed before it.
+    struct Removal
+    {
+        struct Entry
+        {
+            QString path;
+            bool is_directory;
+        };
+
+        std::vector<Entry> entries;
+
+        // It is reset when the listing is complete.
+        std::unique_ptr<QDirIterator> iterator;
+        quint32 total = 0;
+
+        // Restarted by each request of the client.
+        QElapsedTimer idle_timer;
+    };
+
+    std::map<quint64, Removal> removals_;
+    quint64 last_removal_id_ = 0;
+
+    // The copying and moving on the peer which are done in parts. The source is listed first
+    // (the directories before their contents), then the entries are copied in this order. The
+    // files are copied in chunks, so the current file is kept open between the requests. After
+    // the move the source entries are removed in the reverse order.
+    struct Copy
+    {
+        Copy() = default;
+
+        // Removes the file which is partially copied.
+        ~Copy();
+
+        struct Entry
+        {
+            QString source_path;
+            QString target_path;
+            bool is_directory;
+        };
+
+        QDir source_root;
+        QString target_root;
+        bool move;
+
+        std::vector<Entry> entries;
+
+        // It is reset when the listing is complete.
+        std::unique_ptr<QDirIterator> iterator;
+
+        size_t copied_count = 0;
+        size_t removed_count = 0;
+
+        quint64 total_size = 0;
+        quint64 copied_size = 0;
+
+        std::unique_ptr<QFile> source_file;
+        std::unique_ptr<QFile> target_file;
+
+        // Restarted by each request of the client.
+        QElapsedTimer idle_timer;
+    };
 
-    std::unique_ptr<FileDepacketizer> depacketizer_;
-    std::unique_ptr<FilePacketizer> packetizer_;
+    std::map<quint64, Copy> copies_;
+    quint64 last_copy_id_ = 0;
+    std::string copy_buffer_;
 
     Q_DISABLE_COPY(FileWorker)
 };
@@ -0,0 +1,133 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_write_behind.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/file_write_behind.h"
+
+#include <QDebug>
+
+#include "host/file_io_thread.h"
+
+namespace aspia {
+
+namespace {
+
+// The data of the packets which are acknowledged, but not yet written. A larger packet is
+// queued alone.
+constexpr size_t kMaxQueuedSize = 8 * 1024 * 1024; // 8 MB
+
+// The consecutive small blocks are written with a single call up to this size.
+constexpr size_t kMaxWriteSize = 1024 * 1024; // 1 MB
+
+} // namespace
+
+FileWriteBehind::FileWriteBehind(FileIoThread* io_thread, QFile* file)
+    : io_thread_(io_thread),
+      file_(file)
+{
+    Q_ASSERT(io_thread_);
+    Q_ASSERT(file_ && file_->isOpen());
+
+    written_offset_ = file_->pos();
+}
+
+FileWriteBehind::~FileWriteBehind()
+{
+    flush();
+}
+
+bool FileWriteBehind::write(qint64 offset, const char* data, size_t size)
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while (queued_size_ && queued_size_ + size > kMaxQueuedSize && !error_)
+        write_event_.wait(lock);
+
+    if (error_)
+        return false;
+
+    queue_.push({ offset, std::string(data, size) });
+    queued_size_ += size;
+
+    if (!writing_)
+    {
+        writing_ = true;
+        io_thread_->postTask(std::bind(&FileWriteBehind::writeNext, this));
+    }
+
+    return true;
+}
+
+bool FileWriteBehind::flush()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while (writing_)
+        write_event_.wait(lock);
+
+    return !error_;
+}
+
+qint64 FileWriteBehind::writtenOffset()
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+    return written_offset_;
+}
+
+void FileWriteBehind::writeNext()
+{
+    Block block;
+
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        block = std::move(queue_.front());
+        queue_.pop();
+
+        while (!queue_.empty() &&
+               queue_.front().offset == block.offset + static_cast<qint64>(block.data.size()) &&
+               block.data.size() + queue_.front().data.size() <= kMaxWriteSize)
+        {
+            block.data.append(queue_.front().data);
+            queue_.pop();
+        }
+    }
+
+    const qint64 size = static_cast<qint64>(block.data.size());
+
+    // The blocks are usually written in order and the file is already at the offset.
+    bool succeeded = (file_->pos() == block.offset || file_->seek(block.offset)) &&
+                     file_->write(block.data.data(), size) == size &&
+                     file_->flush();
+    if (!succeeded)
+        qDebug("Unable to write file");
+
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    queued_size_ -= block.data.size();
+
+    if (succeeded)
+    {
+        written_offset_ = block.offset + size;
+    }
+    else
+    {
+        error_ = true;
+
+        // The rest of the data is not written after the error.
+        queue_ = std::queue<Block>();
+        queued_size_ = 0;
+    }
+
+    // The task is posted again to let the I/O thread serve the other files.
+    if (!queue_.empty())
+        io_thread_->postTask(std::bind(&FileWriteBehind::writeNext, this));
+    else
+        writing_ = false;
+
+    write_event_.notify_all();
+}
+
+} // namespace aspia
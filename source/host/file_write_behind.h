@@ -0,0 +1,68 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_write_behind.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__FILE_WRITE_BEHIND_H
+#define _ASPIA_HOST__FILE_WRITE_BEHIND_H
+
+#include <QFile>
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <string>
+
+namespace aspia {
+
+class FileIoThread;
+
+// Writes the file on the I/O thread, so that the packet is acknowledged without waiting for the
+// disk. The amount of the queued data is limited. A failed write is reported by the next call.
+class FileWriteBehind
+{
+public:
+    // The file must not be used by the caller until the instance is destroyed.
+    FileWriteBehind(FileIoThread* io_thread, QFile* file);
+
+    // Waits until the queued data is written.
+    ~FileWriteBehind();
+
+    // Queues the data to be written at |offset|. Waits if too much data is queued.
+    bool write(qint64 offset, const char* data, size_t size);
+
+    // Waits until the queued data is written. Returns false if any write failed.
+    bool flush();
+
+    // Returns the end of the data which is written to the file and flushed from the buffers of
+    // the process. The blocks are written in the order they are queued.
+    qint64 writtenOffset();
+
+private:
+    void writeNext();
+
+    struct Block
+    {
+        qint64 offset;
+        std::string data;
+    };
+
+    FileIoThread* const io_thread_;
+    QFile* const file_;
+
+    std::mutex lock_;
+    std::condition_variable write_event_;
+    std::queue<Block> queue_;
+    size_t queued_size_ = 0;
+    qint64 written_offset_ = 0;
+    bool writing_ = false;
+    bool error_ = false;
+
+    Q_DISABLE_COPY(FileWriteBehind)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__FILE_WRITE_BEHIND_H
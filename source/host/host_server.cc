@@ -9,13 +9,18 @@
 
 #include <QCoreApplication>
 #include <QDebug>
+#include <QDir>
 #include <QUuid>
 
+#include <algorithm>
+
 #include "base/message_serialization.h"
+#include "base/metrics.h"
 #include "host/win/host.h"
 #include "host/host_user_authorizer.h"
 #include "ipc/ipc_server.h"
 #include "network/firewall_manager.h"
+#include "network/metrics_exporter.h"
 #include "network/network_channel.h"
 #include "protocol/notifier.pb.h"
 
@@ -25,6 +30,9 @@ namespace {
 
 const char kFirewallRuleName[] = "Aspia Host Service";
 const char kNotifierFileName[] = "aspia_host_notifier.exe";
+const char kMetricsFileName[] = "aspia_host_service.prom";
+const char kSessionMetricsFileName[] = "aspia_host_session_%1.prom";
+constexpr std::chrono::seconds kMetricsFileInterval(15);
 
 const char* sessionTypeToString(proto::auth::SessionType session_type)
 {
@@ -62,6 +70,12 @@ const char* statusToString(proto::auth::Status status)
     }
 }
 
+std::string sessionCpuTimeMetric(const Host& host)
+{
+    return "aspia_host_session_cpu_milliseconds{uuid=\"" + host.uuid().toStdString() +
+        "\",type=\"" + sessionTypeToString(host.sessionType()) + "\"}";
+}
+
 } // namespace
 
 HostServer::HostServer(QObject* parent)
@@ -129,6 +143,8 @@ void HostServer::stop()
         delete network_server_;
     }
 
+    delete metrics_exporter_;
+
     user_list_.clear();
 
     FirewallManager firewall(QCoreApplication::applicationFilePath());
@@ -138,6 +154,43 @@ void HostServer::stop()
     qInfo("Server is stopped");
 }
 
+void HostServer::startMetricsExport(int port, const QString& directory)
+{
+    if (!metrics_exporter_.isNull())
+    {
+        qWarning("An attempt was start an already running metrics export.");
+        return;
+    }
+
+    if (!port && directory.isEmpty())
+        return;
+
+    metrics_exporter_ = new MetricsExporter(this);
+
+    connect(metrics_exporter_, &MetricsExporter::aboutToExport,
+            this, &HostServer::updateMetrics);
+
+    // Errors are not fatal: the server works without the metrics.
+    if (port)
+        metrics_exporter_->startServer(port);
+
+    if (!directory.isEmpty())
+    {
+        metrics_exporter_->startFileExport(
+            directory + QLatin1Char('/') + kMetricsFileName, kMetricsFileInterval);
+
+        // The files of the sessions which were running when the service was stopped.
+        QDir metrics_directory(directory);
+        const QStringList session_files = metrics_directory.entryList(
+            QStringList() << QString(kSessionMetricsFileName).arg('*'), QDir::Files);
+
+        for (const auto& file_name : session_files)
+            metrics_directory.remove(file_name);
+
+        metrics_directory_ = directory;
+    }
+}
+
 void HostServer::setSessionChanged(quint32 event, quint32 session_id)
 {
     emit sessionChanged(event, session_id);
@@ -202,6 +255,9 @@ void HostServer::onNewConnection()
 
         qInfo() << "New connected client:" << channel->peerAddress();
 
+        MetricsRegistry::instance()->counter(
+            "aspia_host_connections_total", "Accepted incoming connections.")->increment();
+
         HostUserAuthorizer* authorizer = new HostUserAuthorizer(this);
 
         authorizer->setNetworkChannel(channel);
@@ -222,6 +278,11 @@ void HostServer::onAuthorizationFinished(HostUserAuthorizer* authorizer)
 
     QScopedPointer<HostUserAuthorizer> authorizer_deleter(authorizer);
 
+    MetricsRegistry::instance()->counter(
+        std::string("aspia_host_authorizations_total{status=\"") +
+            statusToString(authorizer->status()) + "\"}",
+        "Completed authorizations by status.")->increment();
+
     if (authorizer->status() != proto::auth::STATUS_SUCCESS)
         return;
 
@@ -232,6 +293,25 @@ void HostServer::onAuthorizationFinished(HostUserAuthorizer* authorizer)
     host->setUserName(authorizer->userName());
     host->setUuid(QUuid::createUuid().toString());
 
+    if (!metrics_directory_.isEmpty())
+    {
+        // The lowest index which is not used by the running sessions.
+        int metrics_index = 0;
+
+        while (std::any_of(session_list_.begin(), session_list_.end(),
+                           [metrics_index](const QPointer<Host>& session)
+        {
+            return !session.isNull() && session->metricsIndex() == metrics_index;
+        }))
+        {
+            ++metrics_index;
+        }
+
+        host->setMetricsFile(metrics_index,
+                             metrics_directory_ + QLatin1Char('/') +
+                                 QString(kSessionMetricsFileName).arg(metrics_index));
+    }
+
     connect(this, &HostServer::sessionChanged, host.data(), &Host::sessionChanged);
     connect(host.data(), &Host::finished, this, &HostServer::onHostFinished, Qt::QueuedConnection);
 
@@ -262,6 +342,7 @@ void HostServer::onHostFinished(Host* host)
         session_list_.erase(it);
 
         QScopedPointer<Host> host_deleter(host);
+        MetricsRegistry::instance()->remove(sessionCpuTimeMetric(*host));
         sessionCloseToNotifier(*host);
         break;
     }
@@ -380,6 +461,40 @@ void HostServer::onIpcMessageReceived(const QByteArray& buffer)
     ipc_channel_->readMessage();
 }
 
+void HostServer::updateMetrics()
+{
+    MetricsRegistry* metrics = MetricsRegistry::instance();
+
+    const proto::auth::SessionType session_types[] =
+    {
+        proto::auth::SESSION_TYPE_DESKTOP_MANAGE,
+        proto::auth::SESSION_TYPE_DESKTOP_VIEW,
+        proto::auth::SESSION_TYPE_FILE_TRANSFER
+    };
+
+    for (const auto session_type : session_types)
+    {
+        qint64 count = 0;
+
+        for (const auto& session : session_list_)
+        {
+            if (session->sessionType() == session_type)
+                ++count;
+        }
+
+        metrics->gauge(
+            std::string("aspia_host_sessions{type=\"") + sessionTypeToString(session_type) + "\"}",
+            "Active sessions by type.")->set(count);
+    }
+
+    for (const auto& session : session_list_)
+    {
+        metrics->gauge(sessionCpuTimeMetric(*session),
+                       "CPU time consumed by the session processes.")
+            ->set(session->cpuTime().count());
+    }
+}
+
 void HostServer::startNotifier()
 {
     if (notifier_state_ != NotifierState::Stopped)
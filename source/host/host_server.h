@@ -17,6 +17,7 @@ namespace aspia {
 
 class Host;
 class HostUserAuthorizer;
+class MetricsExporter;
 
 class HostServer : public QObject
 {
@@ -28,6 +29,10 @@ public:
 
     bool start(int port, const QList<User>& user_list);
     void stop();
+
+    // Starts the export of the metrics on 127.0.0.1:|port| (if not zero) and to a file in
+    // |directory| (if not empty).
+    void startMetricsExport(int port, const QString& directory);
     void setSessionChanged(quint32 event, quint32 session_id);
 
 signals:
@@ -46,6 +51,7 @@ private slots:
     void onIpcMessageReceived(const QByteArray& buffer);
     void onNotifierProcessError(HostProcess::ErrorCode error_code);
     void restartNotifier();
+    void updateMetrics();
 
 private:
     enum class NotifierState
@@ -80,6 +86,12 @@ private:
 
     int restart_timer_id_ = 0;
 
+    QPointer<MetricsExporter> metrics_exporter_;
+
+    // The directory for the metrics files of the session processes. Empty if the export to the
+    // files is disabled.
+    QString metrics_directory_;
+
     Q_DISABLE_COPY(HostServer)
 };
 
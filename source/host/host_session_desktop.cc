@@ -9,6 +9,7 @@
 
 #include "base/clipboard.h"
 #include "base/message_serialization.h"
+#include "base/trace_event.h"
 #include "host/input_injector.h"
 #include "host/screen_updater.h"
 
@@ -68,6 +69,8 @@ void HostSessionDesktop::stopSession()
     delete screen_updater_;
     delete clipboard_;
     input_injector_.reset();
+
+    TRACE_DUMP();
 }
 
 void HostSessionDesktop::customEvent(QEvent* event)
@@ -79,13 +82,9 @@ void HostSessionDesktop::customEvent(QEvent* event)
             ScreenUpdater::UpdateEvent* update_event =
                 reinterpret_cast<ScreenUpdater::UpdateEvent*>(event);
 
-            Q_ASSERT(update_event->video_packet || update_event->cursor_shape);
-
-            proto::desktop::HostToClient message;
-            message.set_allocated_video_packet(update_event->video_packet.release());
-            message.set_allocated_cursor_shape(update_event->cursor_shape.release());
+            Q_ASSERT(!update_event->buffer.isEmpty());
 
-            emit writeMessage(ScreenUpdateMessage, serializeMessage(message));
+            emit writeMessage(ScreenUpdateMessage, update_event->buffer);
         }
         break;
 
@@ -113,6 +112,8 @@ void HostSessionDesktop::messageReceived(const QByteArray& buffer)
         readClipboardEvent(message.clipboard_event());
     else if (message.has_config())
         readConfig(message.config());
+    else if (message.has_statistics_request())
+        readStatisticsRequest(message.statistics_request());
     else
     {
         qDebug("Unhandled message from client");
@@ -220,4 +221,17 @@ void HostSessionDesktop::readConfig(const proto::desktop::Config& config)
     screen_updater_ = new ScreenUpdater(config, this);
 }
 
+void HostSessionDesktop::readStatisticsRequest(const proto::desktop::StatisticsRequest& request)
+{
+    proto::desktop::HostToClient message;
+
+    proto::desktop::Statistics* statistics = message.mutable_statistics();
+    statistics->set_timestamp(request.timestamp());
+
+    if (!screen_updater_.isNull())
+        screen_updater_->statistics(statistics);
+
+    emit writeMessage(-1, serializeMessage(message));
+}
+
 } // namespace aspia
@@ -45,6 +45,7 @@ private:
     void readKeyEvent(const proto::desktop::KeyEvent& event);
     void readClipboardEvent(const proto::desktop::ClipboardEvent& event);
     void readConfig(const proto::desktop::Config& config);
+    void readStatisticsRequest(const proto::desktop::StatisticsRequest& request);
 
     const proto::auth::SessionType session_type_;
 
@@ -52,6 +52,16 @@ bool HostSettings::setTcpPort(int port)
     return true;
 }
 
+int HostSettings::metricsPort() const
+{
+    return settings_.value(QStringLiteral("MetricsPort"), 0).toInt();
+}
+
+QString HostSettings::metricsDirectory() const
+{
+    return settings_.value(QStringLiteral("MetricsDirectory")).toString();
+}
+
 QList<User> HostSettings::userList() const
 {
     QList<User> user_list;
@@ -29,6 +29,12 @@ public:
     int tcpPort() const;
     bool setTcpPort(int port);
 
+    // Port of the local metrics HTTP server. Zero disables the server.
+    int metricsPort() const;
+
+    // Directory to which the metrics files are periodically written. Empty disables the files.
+    QString metricsDirectory() const;
+
     QList<User> userList() const;
     bool setUserList(const QList<User>& user_list);
 
@@ -10,39 +10,122 @@
 #include <QCoreApplication>
 #include <QDebug>
 
+#include <chrono>
+#include <deque>
+#include <thread>
+
+#include "base/message_serialization.h"
+#include "base/metrics.h"
+#include "base/trace_event.h"
 #include "codec/cursor_encoder.h"
 #include "codec/video_encoder_vpx.h"
 #include "codec/video_encoder_zlib.h"
 #include "codec/video_util.h"
-#include "desktop_capture/capturer_gdi.h"
 #include "desktop_capture/capture_scheduler.h"
 
+#if defined(Q_OS_WIN)
+#include "desktop_capture/capturer_gdi.h"
+#else
+#include "desktop_capture/capturer_fake.h"
+#endif
+
 namespace aspia {
 
+namespace {
+
+#if !defined(Q_OS_WIN)
+constexpr QSize kFakeScreenSize(1920, 1080);
+#endif
+
+// Returns the time elapsed since |begin_time| in microseconds.
+qint64 elapsedTime(std::chrono::steady_clock::time_point begin_time)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin_time).count();
+}
+
+qint64 regionArea(const QRegion& region)
+{
+    qint64 area = 0;
+
+    for (const auto& rect : region)
+        area += rect.width() * rect.height();
+
+    return area;
+}
+
+} // namespace
+
 ScreenUpdater::ScreenUpdater(const proto::desktop::Config& config, QObject* parent)
     : QThread(parent),
       config_(config)
 {
+    MetricsRegistry* metrics = MetricsRegistry::instance();
+
+    captured_frames_metric_ = metrics->counter(
+        "aspia_screen_captured_frames_total", "Captured screen frames.");
+    dirty_pixels_metric_ = metrics->counter(
+        "aspia_screen_dirty_pixels_total", "Changed pixels in the captured frames.");
+    capture_time_metric_ = metrics->histogram(
+        "aspia_screen_capture_duration_microseconds", "Capture time of a frame and the cursor.",
+        { 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000 });
+    encode_time_metric_ = metrics->histogram(
+        "aspia_screen_encode_duration_microseconds", "Encoding time of a frame.",
+        { 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000 });
+    cursor_encode_time_metric_ = metrics->histogram(
+        "aspia_screen_cursor_encode_duration_microseconds", "Encoding time of a cursor shape.",
+        { 100, 250, 500, 1000, 2500, 5000, 10000, 25000 });
+    serialize_time_metric_ = metrics->histogram(
+        "aspia_screen_serialize_duration_microseconds", "Serialization time of a message.",
+        { 100, 250, 500, 1000, 2500, 5000, 10000, 25000 });
+    sent_packets_metric_ = metrics->counter(
+        "aspia_screen_sent_packets_total", "Video packets sent to the client.");
+    sent_bytes_metric_ = metrics->counter(
+        "aspia_screen_sent_bytes_total", "Encoded video data sent to the client.");
+
     start(QThread::HighPriority);
 }
 
 ScreenUpdater::~ScreenUpdater()
 {
-    terminate_ = true;
-    update();
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        terminate_ = true;
+
+        capture_condition_.notify_one();
+        encode_condition_.notify_one();
+        send_condition_.notify_one();
+    }
+
+    frame_queue_.stop();
     wait();
 }
 
 void ScreenUpdater::update()
 {
-    std::scoped_lock<std::mutex> lock(update_lock_);
-    update_required_ = true;
-    update_condition_.notify_one();
+    std::scoped_lock<std::mutex> lock(lock_);
+    send_in_progress_ = false;
+    send_condition_.notify_one();
+}
+
+void ScreenUpdater::statistics(proto::desktop::Statistics* statistics)
+{
+    std::scoped_lock<std::mutex> lock(statistics_lock_);
+
+    statistics->set_capture_fps(captured_frames_.countPerSecond());
+    statistics->set_update_fps(sent_packets_.countPerSecond());
+    statistics->set_dirty_pixel_rate(captured_frames_.sumPerSecond());
+    statistics->set_encode_time(encode_time_.average());
+    statistics->set_packet_size(sent_packets_.average());
 }
 
 void ScreenUpdater::run()
 {
+#if defined(Q_OS_WIN)
     std::unique_ptr<Capturer> capturer = CapturerGDI::create();
+#else
+    std::unique_ptr<Capturer> capturer = CapturerFake::create(kFakeScreenSize);
+#endif
     if (!capturer)
     {
         QCoreApplication::postEvent(parent(), new ErrorEvent());
@@ -83,56 +166,185 @@ void ScreenUpdater::run()
     if (config_.features() & proto::desktop::FEATURE_CURSOR_SHAPE)
         cursor_encoder = std::make_unique<CursorEncoder>();
 
+    std::thread encode_thread(&ScreenUpdater::encodeThread, this, video_encoder.get());
+    std::thread send_thread(&ScreenUpdater::sendThread, this, cursor_encoder.get());
+
     CaptureScheduler scheduler;
 
+    std::unique_lock<std::mutex> lock(lock_);
+
     while (!terminate_)
     {
+        lock.unlock();
+
         scheduler.beginCapture();
+        const auto capture_begin_time = std::chrono::steady_clock::now();
 
-        const DesktopFrame* screen_frame = capturer->captureImage();
+        DesktopFrame* screen_frame = capturer->captureImage();
         if (screen_frame)
         {
-            std::unique_ptr<proto::desktop::VideoPacket> video_packet;
-            std::unique_ptr<proto::desktop::CursorShape> cursor_shape;
+            frame_queue_.push(*screen_frame);
 
-            if (!screen_frame->updatedRegion().isEmpty())
-                video_packet = video_encoder->encode(screen_frame);
+            const qint64 dirty_pixels = regionArea(screen_frame->updatedRegion());
 
-            if (cursor_encoder)
-            {
-                std::unique_ptr<MouseCursor> mouse_cursor = capturer->captureCursor();
-                if (mouse_cursor)
-                    cursor_shape = cursor_encoder->encode(std::move(mouse_cursor));
-            }
+            captured_frames_metric_->increment();
+            dirty_pixels_metric_->increment(dirty_pixels);
 
-            if (video_packet || cursor_shape)
-            {
-                UpdateEvent* update_event = new UpdateEvent();
+            std::scoped_lock<std::mutex> statistics_lock(statistics_lock_);
+            captured_frames_.add(dirty_pixels);
+        }
 
-                update_event->video_packet = std::move(video_packet);
-                update_event->cursor_shape = std::move(cursor_shape);
+        std::unique_ptr<MouseCursor> mouse_cursor;
+        if (cursor_encoder)
+            mouse_cursor = capturer->captureCursor();
 
-                std::unique_lock<std::mutex> lock(update_lock_);
-                update_required_ = false;
+        capture_time_metric_->observe(elapsedTime(capture_begin_time));
 
-                QCoreApplication::postEvent(parent(), update_event);
+        lock.lock();
 
-                while (!update_required_ && !terminate_)
-                    update_condition_.wait(lock);
-            }
+        if (mouse_cursor)
+        {
+            // If the previous cursor has not been encoded yet, it is no longer needed.
+            mouse_cursor_ = std::move(mouse_cursor);
+            send_condition_.notify_one();
         }
 
-        std::unique_lock<std::mutex> lock(update_lock_);
-        update_required_ = false;
+        std::chrono::milliseconds delay =
+            scheduler.nextCaptureDelay(std::chrono::milliseconds(config_.update_interval()));
+
+        capture_condition_.wait_for(lock, delay, [this]() { return terminate_; });
+    }
+
+    lock.unlock();
+
+    frame_queue_.stop();
+
+    encode_thread.join();
+    send_thread.join();
+}
+
+void ScreenUpdater::encodeThread(VideoEncoder* video_encoder)
+{
+    quint32 last_frame_id = 0;
+
+    for (;;)
+    {
+        DesktopFrame* frame = frame_queue_.pop();
+        if (!frame)
+            return;
+
+        const quint32 frame_id = ++last_frame_id;
+        std::unique_ptr<proto::desktop::VideoPacket> video_packet;
 
-        while (!update_required_ && !terminate_)
         {
-            std::chrono::milliseconds delay =
-                scheduler.nextCaptureDelay(std::chrono::milliseconds(config_.update_interval()));
+            TRACE_EVENT_ID("ScreenUpdater::encode", frame_id);
+
+            const auto encode_begin_time = std::chrono::steady_clock::now();
+            video_packet = video_encoder->encode(frame);
+            const qint64 encode_time = elapsedTime(encode_begin_time);
+
+            encode_time_metric_->observe(encode_time);
 
-            if (update_condition_.wait_for(lock, delay) == std::cv_status::timeout)
-                break;
+            std::scoped_lock<std::mutex> statistics_lock(statistics_lock_);
+            encode_time_.add(encode_time);
         }
+
+        frame_queue_.release(frame);
+
+        if (!video_packet)
+            continue;
+
+        video_packet->set_frame_id(frame_id);
+
+        std::unique_lock<std::mutex> lock(lock_);
+
+        // While the previous packet is waiting for sending, the capturer merges new frames
+        // in the queue.
+        while (video_packet_ && !terminate_)
+            encode_condition_.wait(lock);
+
+        if (terminate_)
+            return;
+
+        video_packet_ = std::move(video_packet);
+        send_condition_.notify_one();
+    }
+}
+
+void ScreenUpdater::sendThread(CursorEncoder* cursor_encoder)
+{
+    // Encoded cursor shapes can not be dropped because the encoder caches them and the client
+    // must receive each of them.
+    std::deque<std::unique_ptr<proto::desktop::CursorShape>> cursor_shapes;
+
+    std::unique_lock<std::mutex> lock(lock_);
+
+    for (;;)
+    {
+        while (!terminate_ && !mouse_cursor_ &&
+               (send_in_progress_ || (!video_packet_ && cursor_shapes.empty())))
+        {
+            send_condition_.wait(lock);
+        }
+
+        if (terminate_)
+            return;
+
+        if (mouse_cursor_)
+        {
+            std::unique_ptr<MouseCursor> mouse_cursor = std::move(mouse_cursor_);
+            lock.unlock();
+
+            const auto encode_begin_time = std::chrono::steady_clock::now();
+
+            std::unique_ptr<proto::desktop::CursorShape> cursor_shape =
+                cursor_encoder->encode(std::move(mouse_cursor));
+            if (cursor_shape)
+                cursor_shapes.emplace_back(std::move(cursor_shape));
+
+            cursor_encode_time_metric_->observe(elapsedTime(encode_begin_time));
+
+            lock.lock();
+            continue;
+        }
+
+        proto::desktop::HostToClient message;
+
+        if (video_packet_)
+        {
+            sent_packets_metric_->increment();
+            sent_bytes_metric_->increment(video_packet_->data().size());
+
+            std::scoped_lock<std::mutex> statistics_lock(statistics_lock_);
+            sent_packets_.add(video_packet_->data().size());
+
+            message.set_allocated_video_packet(video_packet_.release());
+        }
+
+        if (!cursor_shapes.empty())
+        {
+            message.set_allocated_cursor_shape(cursor_shapes.front().release());
+            cursor_shapes.pop_front();
+        }
+
+        send_in_progress_ = true;
+        encode_condition_.notify_one();
+
+        lock.unlock();
+
+        UpdateEvent* update_event = new UpdateEvent();
+
+        {
+            TRACE_EVENT_ID("ScreenUpdater::serialize", message.video_packet().frame_id());
+
+            const auto serialize_begin_time = std::chrono::steady_clock::now();
+            update_event->buffer = serializeMessage(message);
+            serialize_time_metric_->observe(elapsedTime(serialize_begin_time));
+        }
+
+        QCoreApplication::postEvent(parent(), update_event);
+
+        lock.lock();
     }
 }
 
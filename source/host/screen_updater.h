@@ -8,6 +8,7 @@
 #ifndef _ASPIA_HOST__SCREEN_UPDATER_H
 #define _ASPIA_HOST__SCREEN_UPDATER_H
 
+#include <QByteArray>
 #include <QEvent>
 #include <QThread>
 
@@ -15,10 +16,27 @@
 #include <memory>
 #include <mutex>
 
+#include "base/sliding_window.h"
+#include "desktop_capture/desktop_frame_queue.h"
 #include "protocol/desktop_session.pb.h"
 
 namespace aspia {
 
+class CursorEncoder;
+class MetricsCounter;
+class MetricsHistogram;
+class MouseCursor;
+class VideoEncoder;
+
+// Screen updates are produced by three stages running in parallel:
+// 1. Capture (this thread) captures the screen and the cursor and puts the frames into a
+//    bounded queue of pooled frames.
+// 2. Encode takes the frames from the queue and encodes them. At most one encoded frame waits
+//    for sending.
+// 3. Send encodes the cursor shapes, serializes the updates and posts them to the session as
+//    soon as the previous update has been written.
+// Each stage periodically reports its timing to the log.
+
 class ScreenUpdater : public QThread
 {
     Q_OBJECT
@@ -27,8 +45,13 @@ public:
     ScreenUpdater(const proto::desktop::Config& config, QObject* parent);
     ~ScreenUpdater();
 
+    // Must be called when the previous update has been written to the channel.
     void update();
 
+    // Fills |statistics| with the values collected during the last seconds. The timestamp is not
+    // changed.
+    void statistics(proto::desktop::Statistics* statistics);
+
     class UpdateEvent : public QEvent
     {
     public:
@@ -40,8 +63,8 @@ public:
             // Nothing
         }
 
-        std::unique_ptr<aspia::proto::desktop::VideoPacket> video_packet;
-        std::unique_ptr<aspia::proto::desktop::CursorShape> cursor_shape;
+        // Serialized proto::desktop::HostToClient message.
+        QByteArray buffer;
 
     private:
         Q_DISABLE_COPY(UpdateEvent)
@@ -67,11 +90,39 @@ protected:
     void run() override;
 
 private:
-    std::condition_variable update_condition_;
-    std::mutex update_lock_;
-    bool update_required_ = false;
+    void encodeThread(VideoEncoder* video_encoder);
+    void sendThread(CursorEncoder* cursor_encoder);
+
+    DesktopFrameQueue frame_queue_;
+
+    std::mutex lock_;
+    std::condition_variable capture_condition_;
+    std::condition_variable encode_condition_;
+    std::condition_variable send_condition_;
+
+    // Encoded frame waiting for sending.
+    std::unique_ptr<proto::desktop::VideoPacket> video_packet_;
+
+    // The last captured cursor which is not encoded yet.
+    std::unique_ptr<MouseCursor> mouse_cursor_;
+
+    bool send_in_progress_ = false;
     bool terminate_ = false;
 
+    std::mutex statistics_lock_;
+    SlidingWindow captured_frames_; // Changed pixels of each captured frame.
+    SlidingWindow encode_time_; // Encoding time of each frame in microseconds.
+    SlidingWindow sent_packets_; // Size of each sent video packet.
+
+    MetricsCounter* captured_frames_metric_;
+    MetricsCounter* dirty_pixels_metric_;
+    MetricsHistogram* capture_time_metric_;
+    MetricsHistogram* encode_time_metric_;
+    MetricsHistogram* cursor_encode_time_metric_;
+    MetricsHistogram* serialize_time_metric_;
+    MetricsCounter* sent_packets_metric_;
+    MetricsCounter* sent_bytes_metric_;
+
     proto::desktop::Config config_;
 
     Q_DISABLE_COPY(ScreenUpdater)
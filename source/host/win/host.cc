@@ -11,7 +11,10 @@
 #include <windows.h>
 
 #include <QCoreApplication>
+#include <QFile>
 
+#include "base/metrics.h"
+#include "base/trace_event.h"
 #include "host/win/host_process.h"
 #include "host/host_session_fake.h"
 #include "ipc/ipc_channel.h"
@@ -88,11 +91,31 @@ void Host::setUuid(const QString& uuid)
     uuid_ = uuid;
 }
 
+void Host::setMetricsFile(int index, const QString& file_path)
+{
+    if (state_ != StoppedState)
+    {
+        qWarning("An attempt to set a metrics file in an already running host.");
+        return;
+    }
+
+    metrics_index_ = index;
+    metrics_file_ = file_path;
+}
+
 QString Host::remoteAddress() const
 {
     return network_channel_->peerAddress();
 }
 
+std::chrono::milliseconds Host::cpuTime() const
+{
+    if (session_process_.isNull())
+        return finished_cpu_time_;
+
+    return finished_cpu_time_ + session_process_->cpuTime();
+}
+
 bool Host::start()
 {
     if (network_channel_.isNull())
@@ -170,6 +193,8 @@ void Host::stop()
 
     state_ = StoppedState;
 
+    TRACE_DUMP();
+
     qInfo("Host is stopped");
     emit finished(this);
 }
@@ -227,6 +252,7 @@ void Host::ipcMessageWritten(int message_id)
 
 void Host::ipcMessageReceived(const QByteArray& buffer)
 {
+    TRACE_EVENT("Host::ipcMessageReceived");
     network_channel_->writeMessage(NetworkMessageId, buffer);
 }
 
@@ -268,6 +294,12 @@ void Host::ipcServerStarted(const QString& channel_id)
             break;
     }
 
+    if (!metrics_file_.isEmpty())
+    {
+        arguments << QStringLiteral("--metrics_file") << metrics_file_;
+        arguments << QStringLiteral("--metrics_index") << QString::number(metrics_index_);
+    }
+
     session_process_->setArguments(arguments);
 
     connect(session_process_, &HostProcess::errorOccurred, [this](HostProcess::ErrorCode error_code)
@@ -311,6 +343,10 @@ void Host::ipcNewConnection(IpcChannel* channel)
     connect(network_channel_, &NetworkChannel::messageReceived, this, &Host::networkMessageReceived);
 
     qInfo() << "Host process is attached for session" << session_id_;
+
+    MetricsRegistry::instance()->counter(
+        "aspia_host_session_attachments_total",
+        "Host processes attached to the user sessions.")->increment();
     state_ = AttachedState;
 
     ipc_channel_->readMessage();
@@ -352,10 +388,15 @@ void Host::dettachSession()
 
     if (!session_process_.isNull())
     {
+        finished_cpu_time_ += session_process_->cpuTime();
         session_process_->kill();
         delete session_process_;
     }
 
+    // The process is terminated and does not remove the file itself.
+    if (!metrics_file_.isEmpty())
+        QFile::remove(metrics_file_);
+
     qInfo("Host process is detached");
 
     if (state_ == StoppingState)
@@ -387,6 +428,10 @@ bool Host::startFakeSession()
         return false;
     }
 
+    MetricsRegistry::instance()->counter(
+        "aspia_host_fake_sessions_total",
+        "Fake sessions started while no user session is available.")->increment();
+
     connect(fake_session_, &HostSessionFake::writeMessage,
             network_channel_, &NetworkChannel::writeMessage);
 
@@ -10,6 +10,8 @@
 
 #include <QPointer>
 
+#include <chrono>
+
 #include "protocol/authorization.pb.h"
 
 namespace aspia {
@@ -52,6 +54,15 @@ public:
 
     QString remoteAddress() const;
 
+    // The session process writes its metrics to |file_path| with the label session="|index|".
+    // The index is reused by the next sessions, so the number of the files and the label values
+    // is limited by the number of simultaneous sessions.
+    int metricsIndex() const { return metrics_index_; }
+    void setMetricsFile(int index, const QString& file_path);
+
+    // Returns the CPU time consumed by the session process.
+    std::chrono::milliseconds cpuTime() const;
+
     bool start();
 
 public slots:
@@ -84,6 +95,9 @@ private:
     QString user_name_;
     QString uuid_;
 
+    int metrics_index_ = -1;
+    QString metrics_file_;
+
     quint32 session_id_ = kInvalidSessionId;
     int attach_timer_id_ = 0;
     State state_ = StoppedState;
@@ -93,6 +107,9 @@ private:
     QPointer<HostProcess> session_process_;
     QPointer<HostSessionFake> fake_session_;
 
+    // CPU time consumed by the session processes which have already been finished.
+    std::chrono::milliseconds finished_cpu_time_ { 0 };
+
     Q_DISABLE_COPY(Host)
 };
 
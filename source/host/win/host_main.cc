@@ -17,6 +17,7 @@
 
 #include "base/file_logger.h"
 #include "host/host_session.h"
+#include "network/metrics_exporter.h"
 #include "version.h"
 
 namespace aspia {
@@ -42,9 +43,19 @@ int hostMain(int argc, char *argv[])
                                            QString(),
                                            QStringLiteral("session_type"));
 
+    QCommandLineOption metrics_file_option(QStringLiteral("metrics_file"),
+                                           QString(),
+                                           QStringLiteral("metrics_file"));
+
+    QCommandLineOption metrics_index_option(QStringLiteral("metrics_index"),
+                                            QString(),
+                                            QStringLiteral("metrics_index"));
+
     QCommandLineParser parser;
     parser.addOption(channel_id_option);
     parser.addOption(session_type_option);
+    parser.addOption(metrics_file_option);
+    parser.addOption(metrics_index_option);
 
     if (!parser.parse(application.arguments()))
     {
@@ -61,6 +72,20 @@ int hostMain(int argc, char *argv[])
 
     session->start();
 
+    // The metrics of the session process (screen capture and encoding) are written to a separate
+    // file. The service does not proxy them. The file is named by the service, which removes it
+    // when the process is terminated.
+    QString metrics_file = parser.value(metrics_file_option);
+    std::unique_ptr<MetricsExporter> metrics_exporter;
+
+    if (!metrics_file.isEmpty())
+    {
+        metrics_exporter = std::make_unique<MetricsExporter>();
+        metrics_exporter->setExtraLabels(
+            "session=\"" + parser.value(metrics_index_option).toStdString() + "\"");
+        metrics_exporter->startFileExport(metrics_file, std::chrono::seconds(15));
+    }
+
     return application.exec();
 }
 
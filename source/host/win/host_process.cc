@@ -9,6 +9,7 @@
 
 #include <QDebug>
 
+#include "base/errno_logging.h"
 #include "host/win/host_process_impl.h"
 
 namespace aspia {
@@ -112,6 +113,32 @@ HostProcess::ProcessState HostProcess::state() const
     return impl_->state_;
 }
 
+std::chrono::milliseconds HostProcess::cpuTime() const
+{
+    if (!impl_->process_handle_.isValid())
+        return std::chrono::milliseconds::zero();
+
+    FILETIME creation_time;
+    FILETIME exit_time;
+    FILETIME kernel_time;
+    FILETIME user_time;
+
+    if (!GetProcessTimes(impl_->process_handle_.get(),
+                         &creation_time, &exit_time, &kernel_time, &user_time))
+    {
+        qWarningErrno("GetProcessTimes failed");
+        return std::chrono::milliseconds::zero();
+    }
+
+    auto to_int64 = [](const FILETIME& time)
+    {
+        return (static_cast<qint64>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    };
+
+    // FILETIME is in 100 nanosecond intervals.
+    return std::chrono::milliseconds((to_int64(kernel_time) + to_int64(user_time)) / 10000);
+}
+
 void HostProcess::start()
 {
     impl_->startProcess();
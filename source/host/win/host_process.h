@@ -11,6 +11,8 @@
 #include <QObject>
 #include <QScopedPointer>
 
+#include <chrono>
+
 namespace aspia {
 
 class HostProcessImpl;
@@ -65,6 +67,9 @@ public:
 
     ProcessState state() const;
 
+    // Returns the total CPU time (kernel and user) consumed by the process.
+    std::chrono::milliseconds cpuTime() const;
+
 public slots:
     void start();
     void kill();
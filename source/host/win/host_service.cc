@@ -92,6 +92,8 @@ void HostService::start()
         return;
     }
 
+    server_->startMetricsExport(settings.metricsPort(), settings.metricsDirectory());
+
     qInfo("Service is started");
 }
 
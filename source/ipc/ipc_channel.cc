@@ -9,6 +9,8 @@
 
 #include <QDebug>
 
+#include "base/trace_event.h"
+
 namespace aspia {
 
 namespace {
@@ -111,6 +113,8 @@ void IpcChannel::onBytesWritten(qint64 bytes)
     {
         int message_id = write_queue_.front().first;
 
+        TRACE_EVENT_COMPLETE("IpcChannel::write", write_begin_time_, 0);
+
         if (message_id != -1)
             emit messageWritten(message_id);
 
@@ -187,6 +191,8 @@ void IpcChannel::scheduleWrite()
         return;
     }
 
+    TRACE_EVENT_BEGIN(write_begin_time_);
+
     socket_->write(reinterpret_cast<const char*>(&write_size_), sizeof(MessageSizeType));
 }
 
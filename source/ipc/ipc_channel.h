@@ -76,6 +76,10 @@ private:
     MessageSizeType write_size_ = 0;
     qint64 written_ = 0;
 
+#if defined(ASPIA_ENABLE_TRACING)
+    qint64 write_begin_time_ = 0;
+#endif // defined(ASPIA_ENABLE_TRACING)
+
     bool read_required_ = false;
     bool read_size_received_ = false;
     QByteArray read_buffer_;
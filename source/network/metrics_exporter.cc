@@ -0,0 +1,167 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/metrics_exporter.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "network/metrics_exporter.h"
+
+#include <QDebug>
+#include <QFile>
+#include <QSaveFile>
+#include <QTcpSocket>
+#include <QTimerEvent>
+
+#include "base/metrics.h"
+
+namespace aspia {
+
+namespace {
+
+// Maximum size of the HTTP request headers.
+constexpr int kMaxRequestSize = 8192;
+
+QByteArray httpResponse(const char* status, const QByteArray& body)
+{
+    QByteArray response;
+
+    response.append("HTTP/1.0 ");
+    response.append(status);
+    response.append("\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: ");
+    response.append(QByteArray::number(body.size()));
+    response.append("\r\nConnection: close\r\n\r\n");
+    response.append(body);
+
+    return response;
+}
+
+} // namespace
+
+MetricsExporter::MetricsExporter(QObject* parent)
+    : QObject(parent)
+{
+    // Nothing
+}
+
+MetricsExporter::~MetricsExporter()
+{
+    if (!file_path_.isEmpty())
+        QFile::remove(file_path_);
+}
+
+void MetricsExporter::setExtraLabels(const std::string& extra_labels)
+{
+    extra_labels_ = extra_labels;
+}
+
+bool MetricsExporter::startServer(int port)
+{
+    if (!tcp_server_.isNull())
+    {
+        qWarning("Metrics server already started");
+        return false;
+    }
+
+    tcp_server_ = new QTcpServer(this);
+
+    connect(tcp_server_, &QTcpServer::newConnection, this, &MetricsExporter::onNewConnection);
+
+    // The metrics are not encrypted and not authorized, so they are available only locally.
+    if (!tcp_server_->listen(QHostAddress::LocalHost, port))
+    {
+        qWarning() << "Metrics server listen failed: " << tcp_server_->errorString();
+        delete tcp_server_;
+        return false;
+    }
+
+    qInfo() << "Metrics server is started on port" << port;
+    return true;
+}
+
+bool MetricsExporter::startFileExport(const QString& file_path,
+                                      const std::chrono::seconds& interval)
+{
+    if (file_timer_id_)
+    {
+        qWarning("Metrics file export already started");
+        return false;
+    }
+
+    file_timer_id_ = startTimer(interval);
+    if (!file_timer_id_)
+    {
+        qWarning("Could not start the timer");
+        return false;
+    }
+
+    file_path_ = file_path;
+    writeToFile();
+    return true;
+}
+
+void MetricsExporter::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() == file_timer_id_)
+    {
+        writeToFile();
+        return;
+    }
+
+    QObject::timerEvent(event);
+}
+
+void MetricsExporter::onNewConnection()
+{
+    while (tcp_server_->hasPendingConnections())
+    {
+        QTcpSocket* socket = tcp_server_->nextPendingConnection();
+        if (!socket)
+            continue;
+
+        connect(socket, &QTcpSocket::disconnected, socket, &QTcpSocket::deleteLater);
+        connect(socket, &QTcpSocket::readyRead, socket, [this, socket]()
+        {
+            // Wait for the end of the request headers.
+            if (!socket->canReadLine() || socket->peek(kMaxRequestSize).indexOf("\r\n\r\n") == -1)
+            {
+                if (socket->bytesAvailable() > kMaxRequestSize)
+                    socket->abort();
+                return;
+            }
+
+            QList<QByteArray> request_line = socket->readLine().trimmed().split(' ');
+            socket->readAll();
+
+            if (request_line.size() < 2 || request_line[0] != "GET")
+                socket->write(httpResponse("405 Method Not Allowed", QByteArray()));
+            else if (request_line[1] != "/metrics" && request_line[1] != "/")
+                socket->write(httpResponse("404 Not Found", QByteArray()));
+            else
+                socket->write(httpResponse("200 OK", exportMetrics()));
+
+            socket->disconnectFromHost();
+        });
+    }
+}
+
+QByteArray MetricsExporter::exportMetrics()
+{
+    emit aboutToExport();
+    return MetricsRegistry::instance()->format(extra_labels_);
+}
+
+void MetricsExporter::writeToFile()
+{
+    // The file is replaced atomically, so the collector never reads a partially written file.
+    QSaveFile file(file_path_);
+
+    if (!file.open(QSaveFile::WriteOnly) ||
+        file.write(exportMetrics()) == -1 ||
+        !file.commit())
+    {
+        qWarning() << "Unable to write metrics to" << file_path_ << ":" << file.errorString();
+    }
+}
+
+} // namespace aspia
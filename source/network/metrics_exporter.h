@@ -0,0 +1,67 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/metrics_exporter.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_NETWORK__METRICS_EXPORTER_H
+#define _ASPIA_NETWORK__METRICS_EXPORTER_H
+
+#include <QPointer>
+#include <QTcpServer>
+
+#include <chrono>
+#include <string>
+
+namespace aspia {
+
+// Exports the metrics of MetricsRegistry in the Prometheus text format. The metrics can be
+// served over HTTP on the loopback interface and/or periodically written to a file (suitable for
+// the textfile collector of node_exporter).
+class MetricsExporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit MetricsExporter(QObject* parent = nullptr);
+    ~MetricsExporter();
+
+    // Labels which are added to each exported sample (for example, pid="1234").
+    void setExtraLabels(const std::string& extra_labels);
+
+    // Starts the HTTP server on 127.0.0.1:|port|.
+    bool startServer(int port);
+
+    // Writes the metrics to |file_path| every |interval|. The file is removed on destruction.
+    bool startFileExport(const QString& file_path, const std::chrono::seconds& interval);
+
+signals:
+    // Emitted before the metrics are exported. Allows to update the gauges which are not
+    // updated on hot paths (CPU time, number of sessions).
+    void aboutToExport();
+
+protected:
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+
+private slots:
+    void onNewConnection();
+
+private:
+    QByteArray exportMetrics();
+    void writeToFile();
+
+    std::string extra_labels_;
+
+    QPointer<QTcpServer> tcp_server_;
+
+    QString file_path_;
+    int file_timer_id_ = 0;
+
+    Q_DISABLE_COPY(MetricsExporter)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_NETWORK__METRICS_EXPORTER_H
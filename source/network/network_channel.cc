@@ -11,6 +11,8 @@
 #include <QNetworkProxy>
 #include <QTimerEvent>
 
+#include "base/metrics.h"
+#include "base/trace_event.h"
 #include "crypto/encryptor.h"
 
 namespace aspia {
@@ -64,6 +66,17 @@ NetworkChannel::NetworkChannel(ChannelType channel_type, QTcpSocket* socket, QOb
 
     socket_->setParent(this);
 
+    MetricsRegistry* metrics = MetricsRegistry::instance();
+
+    sent_bytes_metric_ = metrics->counter(
+        "aspia_network_sent_bytes_total", "Bytes sent to the network (including encryption).");
+    sent_messages_metric_ = metrics->counter(
+        "aspia_network_sent_messages_total", "Messages sent to the network.");
+    received_bytes_metric_ = metrics->counter(
+        "aspia_network_received_bytes_total", "Bytes received from the network.");
+    received_messages_metric_ = metrics->counter(
+        "aspia_network_received_messages_total", "Messages received from the network.");
+
     if (channel_type_ == ClientChannel)
         connect(socket_, &QTcpSocket::connected, this, &NetworkChannel::onConnected);
 
@@ -109,6 +122,17 @@ QString NetworkChannel::peerAddress() const
     return address.toString();
 }
 
+NetworkChannel::Statistics NetworkChannel::statistics()
+{
+    Statistics statistics;
+
+    statistics.bytes_sent = sent_bytes_.sumPerSecond();
+    statistics.bytes_received = received_bytes_.sumPerSecond();
+    statistics.write_queue_size = static_cast<int>(write_queue_.size());
+
+    return statistics;
+}
+
 void NetworkChannel::readMessage()
 {
     Q_ASSERT(!read_required_);
@@ -208,6 +232,12 @@ void NetworkChannel::onBytesWritten(qint64 bytes)
     }
     else
     {
+        TRACE_EVENT_COMPLETE("NetworkChannel::write", write_begin_time_, 0);
+
+        sent_bytes_.add(write_buffer.size());
+        sent_bytes_metric_->increment(write_buffer.size());
+        sent_messages_metric_->increment();
+
         onMessageWritten(write_queue_.front().first);
 
         write_queue_.pop();
@@ -291,6 +321,10 @@ void NetworkChannel::onReadyRead()
             read_size_received_ = false;
             read_ = 0;
 
+            received_bytes_.add(read_buffer_.size());
+            received_bytes_metric_->increment(read_buffer_.size());
+            received_messages_metric_->increment();
+
             onMessageReceived(read_buffer_);
             break;
         }
@@ -404,6 +438,9 @@ void NetworkChannel::write(int message_id, const QByteArray& buffer)
 void NetworkChannel::scheduleWrite()
 {
     const QByteArray& write_buffer = write_queue_.front().second;
+
+    TRACE_EVENT_BEGIN(write_begin_time_);
+
     socket_->write(write_buffer.constData(), write_buffer.size());
 }
 
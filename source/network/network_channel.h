@@ -14,9 +14,12 @@
 #include <queue>
 #include <utility>
 
+#include "base/sliding_window.h"
+
 namespace aspia {
 
 class Encryptor;
+class MetricsCounter;
 class NetworkServer;
 
 class NetworkChannel : public QObject
@@ -48,6 +51,15 @@ public:
     ChannelState channelState() const { return channel_state_; }
     QString peerAddress() const;
 
+    struct Statistics
+    {
+        qint64 bytes_sent = 0; // Bytes per second.
+        qint64 bytes_received = 0; // Bytes per second.
+        int write_queue_size = 0; // Messages waiting to be sent.
+    };
+
+    Statistics statistics();
+
 signals:
     void connected();
     void disconnected();
@@ -98,6 +110,18 @@ private:
     std::queue<std::pair<int, QByteArray>> write_queue_;
     qint64 written_ = 0;
 
+    SlidingWindow sent_bytes_;
+    SlidingWindow received_bytes_;
+
+    MetricsCounter* sent_bytes_metric_;
+    MetricsCounter* sent_messages_metric_;
+    MetricsCounter* received_bytes_metric_;
+    MetricsCounter* received_messages_metric_;
+
+#if defined(ASPIA_ENABLE_TRACING)
+    qint64 write_begin_time_ = 0;
+#endif // defined(ASPIA_ENABLE_TRACING)
+
     bool read_required_ = false;
     bool read_size_received_ = false;
     QByteArray read_buffer_;
@@ -25,6 +25,8 @@ extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::pro
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_PointerEvent;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Rect;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Size;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Statistics;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_StatisticsRequest;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_Config;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<2> scc_info_VideoPacket;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<2> scc_info_VideoPacketFormat;
@@ -87,6 +89,16 @@ class ConfigDefaultTypeInternal {
   ::google::protobuf::internal::ExplicitlyConstructed<Config>
       _instance;
 } _Config_default_instance_;
+class StatisticsDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<Statistics>
+      _instance;
+} _Statistics_default_instance_;
+class StatisticsRequestDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<StatisticsRequest>
+      _instance;
+} _StatisticsRequest_default_instance_;
 class HostToClientDefaultTypeInternal {
  public:
   ::google::protobuf::internal::ExplicitlyConstructed<HostToClient>
@@ -260,6 +272,34 @@ static void InitDefaultsConfig() {
     {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsConfig}, {
       &protobuf_desktop_5fsession_2eproto::scc_info_PixelFormat.base,}};
 
+static void InitDefaultsStatistics() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::desktop::_Statistics_default_instance_;
+    new (ptr) ::aspia::proto::desktop::Statistics();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::desktop::Statistics::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<0> scc_info_Statistics =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsStatistics}, {}};
+
+static void InitDefaultsStatisticsRequest() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::desktop::_StatisticsRequest_default_instance_;
+    new (ptr) ::aspia::proto::desktop::StatisticsRequest();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::desktop::StatisticsRequest::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<0> scc_info_StatisticsRequest =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsStatisticsRequest}, {}};
+
 static void InitDefaultsHostToClient() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -271,12 +311,13 @@ static void InitDefaultsHostToClient() {
   ::aspia::proto::desktop::HostToClient::InitAsDefaultInstance();
 }
 
-::google::protobuf::internal::SCCInfo<4> scc_info_HostToClient =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 4, InitDefaultsHostToClient}, {
+::google::protobuf::internal::SCCInfo<5> scc_info_HostToClient =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 5, InitDefaultsHostToClient}, {
       &protobuf_desktop_5fsession_2eproto::scc_info_VideoPacket.base,
       &protobuf_desktop_5fsession_2eproto::scc_info_CursorShape.base,
       &protobuf_desktop_5fsession_2eproto::scc_info_ClipboardEvent.base,
-      &protobuf_desktop_5fsession_2eproto::scc_info_ConfigRequest.base,}};
+      &protobuf_desktop_5fsession_2eproto::scc_info_ConfigRequest.base,
+      &protobuf_desktop_5fsession_2eproto::scc_info_Statistics.base,}};
 
 static void InitDefaultsClientToHost() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -289,12 +330,13 @@ static void InitDefaultsClientToHost() {
   ::aspia::proto::desktop::ClientToHost::InitAsDefaultInstance();
 }
 
-::google::protobuf::internal::SCCInfo<4> scc_info_ClientToHost =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 4, InitDefaultsClientToHost}, {
+::google::protobuf::internal::SCCInfo<5> scc_info_ClientToHost =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 5, InitDefaultsClientToHost}, {
       &protobuf_desktop_5fsession_2eproto::scc_info_PointerEvent.base,
       &protobuf_desktop_5fsession_2eproto::scc_info_KeyEvent.base,
       &protobuf_desktop_5fsession_2eproto::scc_info_ClipboardEvent.base,
-      &protobuf_desktop_5fsession_2eproto::scc_info_Config.base,}};
+      &protobuf_desktop_5fsession_2eproto::scc_info_Config.base,
+      &protobuf_desktop_5fsession_2eproto::scc_info_StatisticsRequest.base,}};
 
 void InitDefaults() {
   ::google::protobuf::internal::InitSCC(&scc_info_KeyEvent.base);
@@ -308,6 +350,8 @@ void InitDefaults() {
   ::google::protobuf::internal::InitSCC(&scc_info_VideoPacket.base);
   ::google::protobuf::internal::InitSCC(&scc_info_ConfigRequest.base);
   ::google::protobuf::internal::InitSCC(&scc_info_Config.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_Statistics.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_StatisticsRequest.base);
   ::google::protobuf::internal::InitSCC(&scc_info_HostToClient.base);
   ::google::protobuf::internal::InitSCC(&scc_info_ClientToHost.base);
 }
@@ -2571,6 +2615,7 @@ const int VideoPacket::kEncodingFieldNumber;
 const int VideoPacket::kFormatFieldNumber;
 const int VideoPacket::kDirtyRectFieldNumber;
 const int VideoPacket::kDataFieldNumber;
+const int VideoPacket::kFrameIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 VideoPacket::VideoPacket()
@@ -2594,15 +2639,17 @@ VideoPacket::VideoPacket(const VideoPacket& from)
   } else {
     format_ = NULL;
   }
-  encoding_ = from.encoding_;
+  ::memcpy(&encoding_, &from.encoding_,
+    static_cast<size_t>(reinterpret_cast<char*>(&frame_id_) -
+    reinterpret_cast<char*>(&encoding_)) + sizeof(frame_id_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.VideoPacket)
 }
 
 void VideoPacket::SharedCtor() {
   data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&format_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&encoding_) -
-      reinterpret_cast<char*>(&format_)) + sizeof(encoding_));
+      reinterpret_cast<char*>(&frame_id_) -
+      reinterpret_cast<char*>(&format_)) + sizeof(frame_id_));
 }
 
 VideoPacket::~VideoPacket() {
@@ -2636,7 +2683,9 @@ void VideoPacket::Clear() {
     delete format_;
   }
   format_ = NULL;
-  encoding_ = 0;
+  ::memset(&encoding_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&frame_id_) -
+      reinterpret_cast<char*>(&encoding_)) + sizeof(frame_id_));
   _internal_metadata_.Clear();
 }
 
@@ -2707,6 +2756,20 @@ bool VideoPacket::MergePartialFromCodedStream(
         break;
       }
 
+      // uint32 frame_id = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &frame_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -2760,6 +2823,11 @@ void VideoPacket::SerializeWithCachedSizes(
       4, this->data(), output);
   }
 
+  // uint32 frame_id = 5;
+  if (this->frame_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->frame_id(), output);
+  }
+
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
   // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.VideoPacket)
@@ -2802,6 +2870,13 @@ size_t VideoPacket::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormatLite::EnumSize(this->encoding());
   }
 
+  // uint32 frame_id = 5;
+  if (this->frame_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->frame_id());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
@@ -2830,6 +2905,9 @@ void VideoPacket::MergeFrom(const VideoPacket& from) {
   if (from.encoding() != 0) {
     set_encoding(from.encoding());
   }
+  if (from.frame_id() != 0) {
+    set_frame_id(from.frame_id());
+  }
 }
 
 void VideoPacket::CopyFrom(const VideoPacket& from) {
@@ -2854,6 +2932,7 @@ void VideoPacket::InternalSwap(VideoPacket* other) {
     GetArenaNoVirtual());
   swap(format_, other->format_);
   swap(encoding_, other->encoding_);
+  swap(frame_id_, other->frame_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
@@ -3403,6 +3482,529 @@ void Config::InternalSwap(Config* other) {
 }
 
 
+// ===================================================================
+
+void Statistics::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Statistics::kTimestampFieldNumber;
+const int Statistics::kCaptureFpsFieldNumber;
+const int Statistics::kUpdateFpsFieldNumber;
+const int Statistics::kDirtyPixelRateFieldNumber;
+const int Statistics::kEncodeTimeFieldNumber;
+const int Statistics::kPacketSizeFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Statistics::Statistics()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_desktop_5fsession_2eproto::scc_info_Statistics.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.desktop.Statistics)
+}
+Statistics::Statistics(const Statistics& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&timestamp_, &from.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&packet_size_) -
+    reinterpret_cast<char*>(&timestamp_)) + sizeof(packet_size_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.Statistics)
+}
+
+void Statistics::SharedCtor() {
+  ::memset(&timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&packet_size_) -
+      reinterpret_cast<char*>(&timestamp_)) + sizeof(packet_size_));
+}
+
+Statistics::~Statistics() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.Statistics)
+  SharedDtor();
+}
+
+void Statistics::SharedDtor() {
+}
+
+void Statistics::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Statistics& Statistics::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_Statistics.base);
+  return *internal_default_instance();
+}
+
+
+void Statistics::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.Statistics)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&packet_size_) -
+      reinterpret_cast<char*>(&timestamp_)) + sizeof(packet_size_));
+  _internal_metadata_.Clear();
+}
+
+bool Statistics::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.Statistics)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint64 timestamp = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &timestamp_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 capture_fps = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &capture_fps_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 update_fps = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &update_fps_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 dirty_pixel_rate = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &dirty_pixel_rate_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 encode_time = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &encode_time_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 packet_size = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &packet_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.Statistics)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.Statistics)
+  return false;
+#undef DO_
+}
+
+void Statistics::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.Statistics)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 timestamp = 1;
+  if (this->timestamp() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->timestamp(), output);
+  }
+
+  // uint32 capture_fps = 2;
+  if (this->capture_fps() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->capture_fps(), output);
+  }
+
+  // uint32 update_fps = 3;
+  if (this->update_fps() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->update_fps(), output);
+  }
+
+  // uint64 dirty_pixel_rate = 4;
+  if (this->dirty_pixel_rate() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->dirty_pixel_rate(), output);
+  }
+
+  // uint32 encode_time = 5;
+  if (this->encode_time() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->encode_time(), output);
+  }
+
+  // uint32 packet_size = 6;
+  if (this->packet_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(6, this->packet_size(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.Statistics)
+}
+
+size_t Statistics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.Statistics)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // uint64 timestamp = 1;
+  if (this->timestamp() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->timestamp());
+  }
+
+  // uint32 capture_fps = 2;
+  if (this->capture_fps() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->capture_fps());
+  }
+
+  // uint32 update_fps = 3;
+  if (this->update_fps() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->update_fps());
+  }
+
+  // uint64 dirty_pixel_rate = 4;
+  if (this->dirty_pixel_rate() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->dirty_pixel_rate());
+  }
+
+  // uint32 encode_time = 5;
+  if (this->encode_time() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->encode_time());
+  }
+
+  // uint32 packet_size = 6;
+  if (this->packet_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->packet_size());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Statistics::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const Statistics*>(&from));
+}
+
+void Statistics::MergeFrom(const Statistics& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.Statistics)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.timestamp() != 0) {
+    set_timestamp(from.timestamp());
+  }
+  if (from.capture_fps() != 0) {
+    set_capture_fps(from.capture_fps());
+  }
+  if (from.update_fps() != 0) {
+    set_update_fps(from.update_fps());
+  }
+  if (from.dirty_pixel_rate() != 0) {
+    set_dirty_pixel_rate(from.dirty_pixel_rate());
+  }
+  if (from.encode_time() != 0) {
+    set_encode_time(from.encode_time());
+  }
+  if (from.packet_size() != 0) {
+    set_packet_size(from.packet_size());
+  }
+}
+
+void Statistics::CopyFrom(const Statistics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.Statistics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Statistics::IsInitialized() const {
+  return true;
+}
+
+void Statistics::Swap(Statistics* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Statistics::InternalSwap(Statistics* other) {
+  using std::swap;
+  swap(timestamp_, other->timestamp_);
+  swap(capture_fps_, other->capture_fps_);
+  swap(update_fps_, other->update_fps_);
+  swap(dirty_pixel_rate_, other->dirty_pixel_rate_);
+  swap(encode_time_, other->encode_time_);
+  swap(packet_size_, other->packet_size_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string Statistics::GetTypeName() const {
+  return "aspia.proto.desktop.Statistics";
+}
+
+
+// ===================================================================
+
+void StatisticsRequest::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int StatisticsRequest::kTimestampFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+StatisticsRequest::StatisticsRequest()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_desktop_5fsession_2eproto::scc_info_StatisticsRequest.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.desktop.StatisticsRequest)
+}
+StatisticsRequest::StatisticsRequest(const StatisticsRequest& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  timestamp_ = from.timestamp_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.StatisticsRequest)
+}
+
+void StatisticsRequest::SharedCtor() {
+  timestamp_ = GOOGLE_ULONGLONG(0);
+}
+
+StatisticsRequest::~StatisticsRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.StatisticsRequest)
+  SharedDtor();
+}
+
+void StatisticsRequest::SharedDtor() {
+}
+
+void StatisticsRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const StatisticsRequest& StatisticsRequest::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_StatisticsRequest.base);
+  return *internal_default_instance();
+}
+
+
+void StatisticsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.StatisticsRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  timestamp_ = GOOGLE_ULONGLONG(0);
+  _internal_metadata_.Clear();
+}
+
+bool StatisticsRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.StatisticsRequest)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint64 timestamp = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &timestamp_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.StatisticsRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.StatisticsRequest)
+  return false;
+#undef DO_
+}
+
+void StatisticsRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.StatisticsRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 timestamp = 1;
+  if (this->timestamp() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->timestamp(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.StatisticsRequest)
+}
+
+size_t StatisticsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.StatisticsRequest)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // uint64 timestamp = 1;
+  if (this->timestamp() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->timestamp());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void StatisticsRequest::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const StatisticsRequest*>(&from));
+}
+
+void StatisticsRequest::MergeFrom(const StatisticsRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.StatisticsRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.timestamp() != 0) {
+    set_timestamp(from.timestamp());
+  }
+}
+
+void StatisticsRequest::CopyFrom(const StatisticsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.StatisticsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatisticsRequest::IsInitialized() const {
+  return true;
+}
+
+void StatisticsRequest::Swap(StatisticsRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void StatisticsRequest::InternalSwap(StatisticsRequest* other) {
+  using std::swap;
+  swap(timestamp_, other->timestamp_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string StatisticsRequest::GetTypeName() const {
+  return "aspia.proto.desktop.StatisticsRequest";
+}
+
+
 // ===================================================================
 
 void HostToClient::InitAsDefaultInstance() {
@@ -3414,12 +4016,15 @@ void HostToClient::InitAsDefaultInstance() {
       ::aspia::proto::desktop::ClipboardEvent::internal_default_instance());
   ::aspia::proto::desktop::_HostToClient_default_instance_._instance.get_mutable()->config_request_ = const_cast< ::aspia::proto::desktop::ConfigRequest*>(
       ::aspia::proto::desktop::ConfigRequest::internal_default_instance());
+  ::aspia::proto::desktop::_HostToClient_default_instance_._instance.get_mutable()->statistics_ = const_cast< ::aspia::proto::desktop::Statistics*>(
+      ::aspia::proto::desktop::Statistics::internal_default_instance());
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int HostToClient::kVideoPacketFieldNumber;
 const int HostToClient::kCursorShapeFieldNumber;
 const int HostToClient::kClipboardEventFieldNumber;
 const int HostToClient::kConfigRequestFieldNumber;
+const int HostToClient::kStatisticsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 HostToClient::HostToClient()
@@ -3453,13 +4058,18 @@ HostToClient::HostToClient(const HostToClient& from)
   } else {
     config_request_ = NULL;
   }
+  if (from.has_statistics()) {
+    statistics_ = new ::aspia::proto::desktop::Statistics(*from.statistics_);
+  } else {
+    statistics_ = NULL;
+  }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.HostToClient)
 }
 
 void HostToClient::SharedCtor() {
   ::memset(&video_packet_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&config_request_) -
-      reinterpret_cast<char*>(&video_packet_)) + sizeof(config_request_));
+      reinterpret_cast<char*>(&statistics_) -
+      reinterpret_cast<char*>(&video_packet_)) + sizeof(statistics_));
 }
 
 HostToClient::~HostToClient() {
@@ -3472,6 +4082,7 @@ void HostToClient::SharedDtor() {
   if (this != internal_default_instance()) delete cursor_shape_;
   if (this != internal_default_instance()) delete clipboard_event_;
   if (this != internal_default_instance()) delete config_request_;
+  if (this != internal_default_instance()) delete statistics_;
 }
 
 void HostToClient::SetCachedSize(int size) const {
@@ -3505,6 +4116,10 @@ void HostToClient::Clear() {
     delete config_request_;
   }
   config_request_ = NULL;
+  if (GetArenaNoVirtual() == NULL && statistics_ != NULL) {
+    delete statistics_;
+  }
+  statistics_ = NULL;
   _internal_metadata_.Clear();
 }
 
@@ -3572,6 +4187,18 @@ bool HostToClient::MergePartialFromCodedStream(
         break;
       }
 
+      // .aspia.proto.desktop.Statistics statistics = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_statistics()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -3622,6 +4249,12 @@ void HostToClient::SerializeWithCachedSizes(
       4, this->_internal_config_request(), output);
   }
 
+  // .aspia.proto.desktop.Statistics statistics = 5;
+  if (this->has_statistics()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      5, this->_internal_statistics(), output);
+  }
+
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
   // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.HostToClient)
@@ -3661,6 +4294,13 @@ size_t HostToClient::ByteSizeLong() const {
         *config_request_);
   }
 
+  // .aspia.proto.desktop.Statistics statistics = 5;
+  if (this->has_statistics()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *statistics_);
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
@@ -3690,6 +4330,9 @@ void HostToClient::MergeFrom(const HostToClient& from) {
   if (from.has_config_request()) {
     mutable_config_request()->::aspia::proto::desktop::ConfigRequest::MergeFrom(from.config_request());
   }
+  if (from.has_statistics()) {
+    mutable_statistics()->::aspia::proto::desktop::Statistics::MergeFrom(from.statistics());
+  }
 }
 
 void HostToClient::CopyFrom(const HostToClient& from) {
@@ -3713,6 +4356,7 @@ void HostToClient::InternalSwap(HostToClient* other) {
   swap(cursor_shape_, other->cursor_shape_);
   swap(clipboard_event_, other->clipboard_event_);
   swap(config_request_, other->config_request_);
+  swap(statistics_, other->statistics_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
@@ -3732,12 +4376,15 @@ void ClientToHost::InitAsDefaultInstance() {
       ::aspia::proto::desktop::ClipboardEvent::internal_default_instance());
   ::aspia::proto::desktop::_ClientToHost_default_instance_._instance.get_mutable()->config_ = const_cast< ::aspia::proto::desktop::Config*>(
       ::aspia::proto::desktop::Config::internal_default_instance());
+  ::aspia::proto::desktop::_ClientToHost_default_instance_._instance.get_mutable()->statistics_request_ = const_cast< ::aspia::proto::desktop::StatisticsRequest*>(
+      ::aspia::proto::desktop::StatisticsRequest::internal_default_instance());
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int ClientToHost::kPointerEventFieldNumber;
 const int ClientToHost::kKeyEventFieldNumber;
 const int ClientToHost::kClipboardEventFieldNumber;
 const int ClientToHost::kConfigFieldNumber;
+const int ClientToHost::kStatisticsRequestFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 ClientToHost::ClientToHost()
@@ -3771,13 +4418,18 @@ ClientToHost::ClientToHost(const ClientToHost& from)
   } else {
     config_ = NULL;
   }
+  if (from.has_statistics_request()) {
+    statistics_request_ = new ::aspia::proto::desktop::StatisticsRequest(*from.statistics_request_);
+  } else {
+    statistics_request_ = NULL;
+  }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.ClientToHost)
 }
 
 void ClientToHost::SharedCtor() {
   ::memset(&pointer_event_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&config_) -
-      reinterpret_cast<char*>(&pointer_event_)) + sizeof(config_));
+      reinterpret_cast<char*>(&statistics_request_) -
+      reinterpret_cast<char*>(&pointer_event_)) + sizeof(statistics_request_));
 }
 
 ClientToHost::~ClientToHost() {
@@ -3790,6 +4442,7 @@ void ClientToHost::SharedDtor() {
   if (this != internal_default_instance()) delete key_event_;
   if (this != internal_default_instance()) delete clipboard_event_;
   if (this != internal_default_instance()) delete config_;
+  if (this != internal_default_instance()) delete statistics_request_;
 }
 
 void ClientToHost::SetCachedSize(int size) const {
@@ -3823,6 +4476,10 @@ void ClientToHost::Clear() {
     delete config_;
   }
   config_ = NULL;
+  if (GetArenaNoVirtual() == NULL && statistics_request_ != NULL) {
+    delete statistics_request_;
+  }
+  statistics_request_ = NULL;
   _internal_metadata_.Clear();
 }
 
@@ -3890,6 +4547,18 @@ bool ClientToHost::MergePartialFromCodedStream(
         break;
       }
 
+      // .aspia.proto.desktop.StatisticsRequest statistics_request = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_statistics_request()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -3940,6 +4609,12 @@ void ClientToHost::SerializeWithCachedSizes(
       4, this->_internal_config(), output);
   }
 
+  // .aspia.proto.desktop.StatisticsRequest statistics_request = 5;
+  if (this->has_statistics_request()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      5, this->_internal_statistics_request(), output);
+  }
+
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
   // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.ClientToHost)
@@ -3979,6 +4654,13 @@ size_t ClientToHost::ByteSizeLong() const {
         *config_);
   }
 
+  // .aspia.proto.desktop.StatisticsRequest statistics_request = 5;
+  if (this->has_statistics_request()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *statistics_request_);
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
@@ -4008,6 +4690,9 @@ void ClientToHost::MergeFrom(const ClientToHost& from) {
   if (from.has_config()) {
     mutable_config()->::aspia::proto::desktop::Config::MergeFrom(from.config());
   }
+  if (from.has_statistics_request()) {
+    mutable_statistics_request()->::aspia::proto::desktop::StatisticsRequest::MergeFrom(from.statistics_request());
+  }
 }
 
 void ClientToHost::CopyFrom(const ClientToHost& from) {
@@ -4031,6 +4716,7 @@ void ClientToHost::InternalSwap(ClientToHost* other) {
   swap(key_event_, other->key_event_);
   swap(clipboard_event_, other->clipboard_event_);
   swap(config_, other->config_);
+  swap(statistics_request_, other->statistics_request_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
@@ -4078,6 +4764,12 @@ template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::ConfigReq
 template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::Config* Arena::CreateMaybeMessage< ::aspia::proto::desktop::Config >(Arena* arena) {
   return Arena::CreateInternal< ::aspia::proto::desktop::Config >(arena);
 }
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::Statistics* Arena::CreateMaybeMessage< ::aspia::proto::desktop::Statistics >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::desktop::Statistics >(arena);
+}
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::StatisticsRequest* Arena::CreateMaybeMessage< ::aspia::proto::desktop::StatisticsRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::desktop::StatisticsRequest >(arena);
+}
 template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::HostToClient* Arena::CreateMaybeMessage< ::aspia::proto::desktop::HostToClient >(Arena* arena) {
   return Arena::CreateInternal< ::aspia::proto::desktop::HostToClient >(arena);
 }
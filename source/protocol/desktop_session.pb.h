@@ -38,7 +38,7 @@ namespace protobuf_desktop_5fsession_2eproto {
 struct TableStruct {
   static const ::google::protobuf::internal::ParseTableField entries[];
   static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[13];
+  static const ::google::protobuf::internal::ParseTable schema[15];
   static const ::google::protobuf::internal::FieldMetadata field_metadata[];
   static const ::google::protobuf::internal::SerializationTable serialization_table[];
   static const ::google::protobuf::uint32 offsets[];
@@ -80,6 +80,12 @@ extern RectDefaultTypeInternal _Rect_default_instance_;
 class Size;
 class SizeDefaultTypeInternal;
 extern SizeDefaultTypeInternal _Size_default_instance_;
+class Statistics;
+class StatisticsDefaultTypeInternal;
+extern StatisticsDefaultTypeInternal _Statistics_default_instance_;
+class StatisticsRequest;
+class StatisticsRequestDefaultTypeInternal;
+extern StatisticsRequestDefaultTypeInternal _StatisticsRequest_default_instance_;
 class VideoPacket;
 class VideoPacketDefaultTypeInternal;
 extern VideoPacketDefaultTypeInternal _VideoPacket_default_instance_;
@@ -102,6 +108,8 @@ template<> ::aspia::proto::desktop::PixelFormat* Arena::CreateMaybeMessage<::asp
 template<> ::aspia::proto::desktop::PointerEvent* Arena::CreateMaybeMessage<::aspia::proto::desktop::PointerEvent>(Arena*);
 template<> ::aspia::proto::desktop::Rect* Arena::CreateMaybeMessage<::aspia::proto::desktop::Rect>(Arena*);
 template<> ::aspia::proto::desktop::Size* Arena::CreateMaybeMessage<::aspia::proto::desktop::Size>(Arena*);
+template<> ::aspia::proto::desktop::Statistics* Arena::CreateMaybeMessage<::aspia::proto::desktop::Statistics>(Arena*);
+template<> ::aspia::proto::desktop::StatisticsRequest* Arena::CreateMaybeMessage<::aspia::proto::desktop::StatisticsRequest>(Arena*);
 template<> ::aspia::proto::desktop::VideoPacket* Arena::CreateMaybeMessage<::aspia::proto::desktop::VideoPacket>(Arena*);
 template<> ::aspia::proto::desktop::VideoPacketFormat* Arena::CreateMaybeMessage<::aspia::proto::desktop::VideoPacketFormat>(Arena*);
 }  // namespace protobuf
@@ -1349,6 +1357,12 @@ class VideoPacket : public ::google::protobuf::MessageLite /* @@protoc_insertion
   ::aspia::proto::desktop::VideoEncoding encoding() const;
   void set_encoding(::aspia::proto::desktop::VideoEncoding value);
 
+  // uint32 frame_id = 5;
+  void clear_frame_id();
+  static const int kFrameIdFieldNumber = 5;
+  ::google::protobuf::uint32 frame_id() const;
+  void set_frame_id(::google::protobuf::uint32 value);
+
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.VideoPacket)
  private:
 
@@ -1357,6 +1371,7 @@ class VideoPacket : public ::google::protobuf::MessageLite /* @@protoc_insertion
   ::google::protobuf::internal::ArenaStringPtr data_;
   ::aspia::proto::desktop::VideoPacketFormat* format_;
   int encoding_;
+  ::google::protobuf::uint32 frame_id_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
 };
@@ -1605,6 +1620,243 @@ class Config : public ::google::protobuf::MessageLite /* @@protoc_insertion_poin
 };
 // -------------------------------------------------------------------
 
+class Statistics : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.Statistics) */ {
+ public:
+  Statistics();
+  virtual ~Statistics();
+
+  Statistics(const Statistics& from);
+
+  inline Statistics& operator=(const Statistics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  Statistics(Statistics&& from) noexcept
+    : Statistics() {
+    *this = ::std::move(from);
+  }
+
+  inline Statistics& operator=(Statistics&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const Statistics& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Statistics* internal_default_instance() {
+    return reinterpret_cast<const Statistics*>(
+               &_Statistics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  void Swap(Statistics* other);
+  friend void swap(Statistics& a, Statistics& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Statistics* New() const final {
+    return CreateMaybeMessage<Statistics>(NULL);
+  }
+
+  Statistics* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<Statistics>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const Statistics& from);
+  void MergeFrom(const Statistics& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Statistics* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // uint64 timestamp = 1;
+  void clear_timestamp();
+  static const int kTimestampFieldNumber = 1;
+  ::google::protobuf::uint64 timestamp() const;
+  void set_timestamp(::google::protobuf::uint64 value);
+
+  // uint32 capture_fps = 2;
+  void clear_capture_fps();
+  static const int kCaptureFpsFieldNumber = 2;
+  ::google::protobuf::uint32 capture_fps() const;
+  void set_capture_fps(::google::protobuf::uint32 value);
+
+  // uint32 update_fps = 3;
+  void clear_update_fps();
+  static const int kUpdateFpsFieldNumber = 3;
+  ::google::protobuf::uint32 update_fps() const;
+  void set_update_fps(::google::protobuf::uint32 value);
+
+  // uint64 dirty_pixel_rate = 4;
+  void clear_dirty_pixel_rate();
+  static const int kDirtyPixelRateFieldNumber = 4;
+  ::google::protobuf::uint64 dirty_pixel_rate() const;
+  void set_dirty_pixel_rate(::google::protobuf::uint64 value);
+
+  // uint32 encode_time = 5;
+  void clear_encode_time();
+  static const int kEncodeTimeFieldNumber = 5;
+  ::google::protobuf::uint32 encode_time() const;
+  void set_encode_time(::google::protobuf::uint32 value);
+
+  // uint32 packet_size = 6;
+  void clear_packet_size();
+  static const int kPacketSizeFieldNumber = 6;
+  ::google::protobuf::uint32 packet_size() const;
+  void set_packet_size(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.Statistics)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::uint64 timestamp_;
+  ::google::protobuf::uint32 capture_fps_;
+  ::google::protobuf::uint32 update_fps_;
+  ::google::protobuf::uint64 dirty_pixel_rate_;
+  ::google::protobuf::uint32 encode_time_;
+  ::google::protobuf::uint32 packet_size_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class StatisticsRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.StatisticsRequest) */ {
+ public:
+  StatisticsRequest();
+  virtual ~StatisticsRequest();
+
+  StatisticsRequest(const StatisticsRequest& from);
+
+  inline StatisticsRequest& operator=(const StatisticsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  StatisticsRequest(StatisticsRequest&& from) noexcept
+    : StatisticsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StatisticsRequest& operator=(StatisticsRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const StatisticsRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const StatisticsRequest* internal_default_instance() {
+    return reinterpret_cast<const StatisticsRequest*>(
+               &_StatisticsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  void Swap(StatisticsRequest* other);
+  friend void swap(StatisticsRequest& a, StatisticsRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline StatisticsRequest* New() const final {
+    return CreateMaybeMessage<StatisticsRequest>(NULL);
+  }
+
+  StatisticsRequest* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<StatisticsRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const StatisticsRequest& from);
+  void MergeFrom(const StatisticsRequest& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(StatisticsRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // uint64 timestamp = 1;
+  void clear_timestamp();
+  static const int kTimestampFieldNumber = 1;
+  ::google::protobuf::uint64 timestamp() const;
+  void set_timestamp(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.StatisticsRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::uint64 timestamp_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
 class HostToClient : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.HostToClient) */ {
  public:
   HostToClient();
@@ -1639,7 +1891,7 @@ class HostToClient : public ::google::protobuf::MessageLite /* @@protoc_insertio
                &_HostToClient_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    13;
 
   void Swap(HostToClient* other);
   friend void swap(HostToClient& a, HostToClient& b) {
@@ -1738,6 +1990,18 @@ class HostToClient : public ::google::protobuf::MessageLite /* @@protoc_insertio
   ::aspia::proto::desktop::ConfigRequest* mutable_config_request();
   void set_allocated_config_request(::aspia::proto::desktop::ConfigRequest* config_request);
 
+  // .aspia.proto.desktop.Statistics statistics = 5;
+  bool has_statistics() const;
+  void clear_statistics();
+  static const int kStatisticsFieldNumber = 5;
+  private:
+  const ::aspia::proto::desktop::Statistics& _internal_statistics() const;
+  public:
+  const ::aspia::proto::desktop::Statistics& statistics() const;
+  ::aspia::proto::desktop::Statistics* release_statistics();
+  ::aspia::proto::desktop::Statistics* mutable_statistics();
+  void set_allocated_statistics(::aspia::proto::desktop::Statistics* statistics);
+
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.HostToClient)
  private:
 
@@ -1746,6 +2010,7 @@ class HostToClient : public ::google::protobuf::MessageLite /* @@protoc_insertio
   ::aspia::proto::desktop::CursorShape* cursor_shape_;
   ::aspia::proto::desktop::ClipboardEvent* clipboard_event_;
   ::aspia::proto::desktop::ConfigRequest* config_request_;
+  ::aspia::proto::desktop::Statistics* statistics_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
 };
@@ -1785,7 +2050,7 @@ class ClientToHost : public ::google::protobuf::MessageLite /* @@protoc_insertio
                &_ClientToHost_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    14;
 
   void Swap(ClientToHost* other);
   friend void swap(ClientToHost& a, ClientToHost& b) {
@@ -1884,6 +2149,18 @@ class ClientToHost : public ::google::protobuf::MessageLite /* @@protoc_insertio
   ::aspia::proto::desktop::Config* mutable_config();
   void set_allocated_config(::aspia::proto::desktop::Config* config);
 
+  // .aspia.proto.desktop.StatisticsRequest statistics_request = 5;
+  bool has_statistics_request() const;
+  void clear_statistics_request();
+  static const int kStatisticsRequestFieldNumber = 5;
+  private:
+  const ::aspia::proto::desktop::StatisticsRequest& _internal_statistics_request() const;
+  public:
+  const ::aspia::proto::desktop::StatisticsRequest& statistics_request() const;
+  ::aspia::proto::desktop::StatisticsRequest* release_statistics_request();
+  ::aspia::proto::desktop::StatisticsRequest* mutable_statistics_request();
+  void set_allocated_statistics_request(::aspia::proto::desktop::StatisticsRequest* statistics_request);
+
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.ClientToHost)
  private:
 
@@ -1892,6 +2169,7 @@ class ClientToHost : public ::google::protobuf::MessageLite /* @@protoc_insertio
   ::aspia::proto::desktop::KeyEvent* key_event_;
   ::aspia::proto::desktop::ClipboardEvent* clipboard_event_;
   ::aspia::proto::desktop::Config* config_;
+  ::aspia::proto::desktop::StatisticsRequest* statistics_request_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
 };
@@ -2678,6 +2956,20 @@ inline void VideoPacket::set_allocated_data(::std::string* data) {
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.VideoPacket.data)
 }
 
+// uint32 frame_id = 5;
+inline void VideoPacket::clear_frame_id() {
+  frame_id_ = 0u;
+}
+inline ::google::protobuf::uint32 VideoPacket::frame_id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.frame_id)
+  return frame_id_;
+}
+inline void VideoPacket::set_frame_id(::google::protobuf::uint32 value) {
+  
+  frame_id_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.frame_id)
+}
+
 // -------------------------------------------------------------------
 
 // ConfigRequest
@@ -2826,6 +3118,112 @@ inline void Config::set_compress_ratio(::google::protobuf::uint32 value) {
 
 // -------------------------------------------------------------------
 
+// Statistics
+
+// uint64 timestamp = 1;
+inline void Statistics::clear_timestamp() {
+  timestamp_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 Statistics::timestamp() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Statistics.timestamp)
+  return timestamp_;
+}
+inline void Statistics::set_timestamp(::google::protobuf::uint64 value) {
+  
+  timestamp_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Statistics.timestamp)
+}
+
+// uint32 capture_fps = 2;
+inline void Statistics::clear_capture_fps() {
+  capture_fps_ = 0u;
+}
+inline ::google::protobuf::uint32 Statistics::capture_fps() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Statistics.capture_fps)
+  return capture_fps_;
+}
+inline void Statistics::set_capture_fps(::google::protobuf::uint32 value) {
+  
+  capture_fps_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Statistics.capture_fps)
+}
+
+// uint32 update_fps = 3;
+inline void Statistics::clear_update_fps() {
+  update_fps_ = 0u;
+}
+inline ::google::protobuf::uint32 Statistics::update_fps() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Statistics.update_fps)
+  return update_fps_;
+}
+inline void Statistics::set_update_fps(::google::protobuf::uint32 value) {
+  
+  update_fps_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Statistics.update_fps)
+}
+
+// uint64 dirty_pixel_rate = 4;
+inline void Statistics::clear_dirty_pixel_rate() {
+  dirty_pixel_rate_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 Statistics::dirty_pixel_rate() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Statistics.dirty_pixel_rate)
+  return dirty_pixel_rate_;
+}
+inline void Statistics::set_dirty_pixel_rate(::google::protobuf::uint64 value) {
+  
+  dirty_pixel_rate_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Statistics.dirty_pixel_rate)
+}
+
+// uint32 encode_time = 5;
+inline void Statistics::clear_encode_time() {
+  encode_time_ = 0u;
+}
+inline ::google::protobuf::uint32 Statistics::encode_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Statistics.encode_time)
+  return encode_time_;
+}
+inline void Statistics::set_encode_time(::google::protobuf::uint32 value) {
+  
+  encode_time_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Statistics.encode_time)
+}
+
+// uint32 packet_size = 6;
+inline void Statistics::clear_packet_size() {
+  packet_size_ = 0u;
+}
+inline ::google::protobuf::uint32 Statistics::packet_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Statistics.packet_size)
+  return packet_size_;
+}
+inline void Statistics::set_packet_size(::google::protobuf::uint32 value) {
+  
+  packet_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Statistics.packet_size)
+}
+
+// -------------------------------------------------------------------
+
+// StatisticsRequest
+
+// uint64 timestamp = 1;
+inline void StatisticsRequest::clear_timestamp() {
+  timestamp_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 StatisticsRequest::timestamp() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.StatisticsRequest.timestamp)
+  return timestamp_;
+}
+inline void StatisticsRequest::set_timestamp(::google::protobuf::uint64 value) {
+  
+  timestamp_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.StatisticsRequest.timestamp)
+}
+
+// -------------------------------------------------------------------
+
 // HostToClient
 
 // .aspia.proto.desktop.VideoPacket video_packet = 1;
@@ -3044,6 +3442,60 @@ inline void HostToClient::set_allocated_config_request(::aspia::proto::desktop::
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.config_request)
 }
 
+// .aspia.proto.desktop.Statistics statistics = 5;
+inline bool HostToClient::has_statistics() const {
+  return this != internal_default_instance() && statistics_ != NULL;
+}
+inline void HostToClient::clear_statistics() {
+  if (GetArenaNoVirtual() == NULL && statistics_ != NULL) {
+    delete statistics_;
+  }
+  statistics_ = NULL;
+}
+inline const ::aspia::proto::desktop::Statistics& HostToClient::_internal_statistics() const {
+  return *statistics_;
+}
+inline const ::aspia::proto::desktop::Statistics& HostToClient::statistics() const {
+  const ::aspia::proto::desktop::Statistics* p = statistics_;
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.statistics)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::Statistics*>(
+      &::aspia::proto::desktop::_Statistics_default_instance_);
+}
+inline ::aspia::proto::desktop::Statistics* HostToClient::release_statistics() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.statistics)
+  
+  ::aspia::proto::desktop::Statistics* temp = statistics_;
+  statistics_ = NULL;
+  return temp;
+}
+inline ::aspia::proto::desktop::Statistics* HostToClient::mutable_statistics() {
+  
+  if (statistics_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Statistics>(GetArenaNoVirtual());
+    statistics_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.statistics)
+  return statistics_;
+}
+inline void HostToClient::set_allocated_statistics(::aspia::proto::desktop::Statistics* statistics) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete statistics_;
+  }
+  if (statistics) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      statistics = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, statistics, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  statistics_ = statistics;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.statistics)
+}
+
 // -------------------------------------------------------------------
 
 // ClientToHost
@@ -3264,6 +3716,60 @@ inline void ClientToHost::set_allocated_config(::aspia::proto::desktop::Config*
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.config)
 }
 
+// .aspia.proto.desktop.StatisticsRequest statistics_request = 5;
+inline bool ClientToHost::has_statistics_request() const {
+  return this != internal_default_instance() && statistics_request_ != NULL;
+}
+inline void ClientToHost::clear_statistics_request() {
+  if (GetArenaNoVirtual() == NULL && statistics_request_ != NULL) {
+    delete statistics_request_;
+  }
+  statistics_request_ = NULL;
+}
+inline const ::aspia::proto::desktop::StatisticsRequest& ClientToHost::_internal_statistics_request() const {
+  return *statistics_request_;
+}
+inline const ::aspia::proto::desktop::StatisticsRequest& ClientToHost::statistics_request() const {
+  const ::aspia::proto::desktop::StatisticsRequest* p = statistics_request_;
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.statistics_request)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::StatisticsRequest*>(
+      &::aspia::proto::desktop::_StatisticsRequest_default_instance_);
+}
+inline ::aspia::proto::desktop::StatisticsRequest* ClientToHost::release_statistics_request() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.statistics_request)
+  
+  ::aspia::proto::desktop::StatisticsRequest* temp = statistics_request_;
+  statistics_request_ = NULL;
+  return temp;
+}
+inline ::aspia::proto::desktop::StatisticsRequest* ClientToHost::mutable_statistics_request() {
+  
+  if (statistics_request_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::StatisticsRequest>(GetArenaNoVirtual());
+    statistics_request_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.statistics_request)
+  return statistics_request_;
+}
+inline void ClientToHost::set_allocated_statistics_request(::aspia::proto::desktop::StatisticsRequest* statistics_request) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete statistics_request_;
+  }
+  if (statistics_request) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      statistics_request = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, statistics_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  statistics_request_ = statistics_request;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.statistics_request)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -3291,6 +3797,10 @@ inline void ClientToHost::set_allocated_config(::aspia::proto::desktop::Config*
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -17,19 +17,31 @@
 // @@protoc_insertion_point(includes)
 
 namespace protobuf_file_5ftransfer_5fsession_2eproto {
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_BlockChecksumsRequest;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_BlockChecksums_Checksum;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_BundleEntry;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_CopyProgress;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_CopyRequest;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_CreateDirectoryRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_DownloadRequest;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_DeltaOperation;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_DriveListRequest;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_DriveList_Item;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_FileListRequest;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_FileList_Item;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Packet;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_MoveRequest;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_PacketRequest;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_RemoveProgress_Failure;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_RemoveRequest;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_RenameRequest;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_ResumeRequest;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_UploadRequest;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_BlockChecksums;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_Bundle;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_DriveList;
 extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_FileList;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_Packet;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_RemoveProgress;
+extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<2> scc_info_DownloadRequest;
 }  // namespace protobuf_file_5ftransfer_5fsession_2eproto
 namespace aspia {
 namespace proto {
@@ -64,11 +76,41 @@ class FileListRequestDefaultTypeInternal {
   ::google::protobuf::internal::ExplicitlyConstructed<FileListRequest>
       _instance;
 } _FileListRequest_default_instance_;
+class BlockChecksums_ChecksumDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<BlockChecksums_Checksum>
+      _instance;
+} _BlockChecksums_Checksum_default_instance_;
+class BlockChecksumsDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<BlockChecksums>
+      _instance;
+} _BlockChecksums_default_instance_;
+class BlockChecksumsRequestDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<BlockChecksumsRequest>
+      _instance;
+} _BlockChecksumsRequest_default_instance_;
+class BundleEntryDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<BundleEntry>
+      _instance;
+} _BundleEntry_default_instance_;
+class BundleDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<Bundle>
+      _instance;
+} _Bundle_default_instance_;
 class UploadRequestDefaultTypeInternal {
  public:
   ::google::protobuf::internal::ExplicitlyConstructed<UploadRequest>
       _instance;
 } _UploadRequest_default_instance_;
+class ResumeRequestDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<ResumeRequest>
+      _instance;
+} _ResumeRequest_default_instance_;
 class DownloadRequestDefaultTypeInternal {
  public:
   ::google::protobuf::internal::ExplicitlyConstructed<DownloadRequest>
@@ -79,6 +121,11 @@ class PacketRequestDefaultTypeInternal {
   ::google::protobuf::internal::ExplicitlyConstructed<PacketRequest>
       _instance;
 } _PacketRequest_default_instance_;
+class DeltaOperationDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<DeltaOperation>
+      _instance;
+} _DeltaOperation_default_instance_;
 class PacketDefaultTypeInternal {
  public:
   ::google::protobuf::internal::ExplicitlyConstructed<Packet>
@@ -99,6 +146,31 @@ class RemoveRequestDefaultTypeInternal {
   ::google::protobuf::internal::ExplicitlyConstructed<RemoveRequest>
       _instance;
 } _RemoveRequest_default_instance_;
+class RemoveProgress_FailureDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<RemoveProgress_Failure>
+      _instance;
+} _RemoveProgress_Failure_default_instance_;
+class RemoveProgressDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<RemoveProgress>
+      _instance;
+} _RemoveProgress_default_instance_;
+class CopyRequestDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<CopyRequest>
+      _instance;
+} _CopyRequest_default_instance_;
+class MoveRequestDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<MoveRequest>
+      _instance;
+} _MoveRequest_default_instance_;
+class CopyProgressDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<CopyProgress>
+      _instance;
+} _CopyProgress_default_instance_;
 class ReplyDefaultTypeInternal {
  public:
   ::google::protobuf::internal::ExplicitlyConstructed<Reply>
@@ -199,6 +271,78 @@ static void InitDefaultsFileListRequest() {
 ::google::protobuf::internal::SCCInfo<0> scc_info_FileListRequest =
     {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsFileListRequest}, {}};
 
+static void InitDefaultsBlockChecksums_Checksum() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_BlockChecksums_Checksum_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::BlockChecksums_Checksum();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::BlockChecksums_Checksum::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<0> scc_info_BlockChecksums_Checksum =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsBlockChecksums_Checksum}, {}};
+
+static void InitDefaultsBlockChecksums() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_BlockChecksums_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::BlockChecksums();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::BlockChecksums::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<1> scc_info_BlockChecksums =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsBlockChecksums}, {
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BlockChecksums_Checksum.base,}};
+
+static void InitDefaultsBlockChecksumsRequest() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_BlockChecksumsRequest_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::BlockChecksumsRequest();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::BlockChecksumsRequest::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<0> scc_info_BlockChecksumsRequest =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsBlockChecksumsRequest}, {}};
+
+static void InitDefaultsBundleEntry() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_BundleEntry_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::BundleEntry();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::BundleEntry::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<0> scc_info_BundleEntry =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsBundleEntry}, {}};
+
+static void InitDefaultsBundle() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_Bundle_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::Bundle();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::Bundle::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<1> scc_info_Bundle =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsBundle}, {
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BundleEntry.base,}};
+
 static void InitDefaultsUploadRequest() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -213,6 +357,20 @@ static void InitDefaultsUploadRequest() {
 ::google::protobuf::internal::SCCInfo<0> scc_info_UploadRequest =
     {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsUploadRequest}, {}};
 
+static void InitDefaultsResumeRequest() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_ResumeRequest_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::ResumeRequest();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::ResumeRequest::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<0> scc_info_ResumeRequest =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsResumeRequest}, {}};
+
 static void InitDefaultsDownloadRequest() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -224,8 +382,10 @@ static void InitDefaultsDownloadRequest() {
   ::aspia::proto::file_transfer::DownloadRequest::InitAsDefaultInstance();
 }
 
-::google::protobuf::internal::SCCInfo<0> scc_info_DownloadRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsDownloadRequest}, {}};
+::google::protobuf::internal::SCCInfo<2> scc_info_DownloadRequest =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsDownloadRequest}, {
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BlockChecksums.base,
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Bundle.base,}};
 
 static void InitDefaultsPacketRequest() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -241,6 +401,20 @@ static void InitDefaultsPacketRequest() {
 ::google::protobuf::internal::SCCInfo<0> scc_info_PacketRequest =
     {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPacketRequest}, {}};
 
+static void InitDefaultsDeltaOperation() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_DeltaOperation_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::DeltaOperation();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::DeltaOperation::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<0> scc_info_DeltaOperation =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsDeltaOperation}, {}};
+
 static void InitDefaultsPacket() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -252,8 +426,9 @@ static void InitDefaultsPacket() {
   ::aspia::proto::file_transfer::Packet::InitAsDefaultInstance();
 }
 
-::google::protobuf::internal::SCCInfo<0> scc_info_Packet =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPacket}, {}};
+::google::protobuf::internal::SCCInfo<1> scc_info_Packet =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsPacket}, {
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DeltaOperation.base,}};
 
 static void InitDefaultsCreateDirectoryRequest() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -297,6 +472,77 @@ static void InitDefaultsRemoveRequest() {
 ::google::protobuf::internal::SCCInfo<0> scc_info_RemoveRequest =
     {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsRemoveRequest}, {}};
 
+static void InitDefaultsRemoveProgress_Failure() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_RemoveProgress_Failure_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::RemoveProgress_Failure();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::RemoveProgress_Failure::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<0> scc_info_RemoveProgress_Failure =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsRemoveProgress_Failure}, {}};
+
+static void InitDefaultsRemoveProgress() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_RemoveProgress_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::RemoveProgress();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::RemoveProgress::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<1> scc_info_RemoveProgress =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsRemoveProgress}, {
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveProgress_Failure.base,}};
+
+static void InitDefaultsCopyRequest() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_CopyRequest_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::CopyRequest();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::CopyRequest::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<0> scc_info_CopyRequest =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsCopyRequest}, {}};
+
+static void InitDefaultsMoveRequest() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_MoveRequest_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::MoveRequest();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::MoveRequest::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<0> scc_info_MoveRequest =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsMoveRequest}, {}};
+
+static void InitDefaultsCopyProgress() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aspia::proto::file_transfer::_CopyProgress_default_instance_;
+    new (ptr) ::aspia::proto::file_transfer::CopyProgress();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aspia::proto::file_transfer::CopyProgress::InitAsDefaultInstance();
+}
+
+::google::protobuf::internal::SCCInfo<0> scc_info_CopyProgress =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsCopyProgress}, {}};
+
 static void InitDefaultsReply() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -308,11 +554,15 @@ static void InitDefaultsReply() {
   ::aspia::proto::file_transfer::Reply::InitAsDefaultInstance();
 }
 
-::google::protobuf::internal::SCCInfo<3> scc_info_Reply =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 3, InitDefaultsReply}, {
+::google::protobuf::internal::SCCInfo<7> scc_info_Reply =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 7, InitDefaultsReply}, {
       &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DriveList.base,
       &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_FileList.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base,}};
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base,
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BlockChecksums.base,
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Bundle.base,
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveProgress.base,
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CopyProgress.base,}};
 
 static void InitDefaultsRequest() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -325,8 +575,8 @@ static void InitDefaultsRequest() {
   ::aspia::proto::file_transfer::Request::InitAsDefaultInstance();
 }
 
-::google::protobuf::internal::SCCInfo<9> scc_info_Request =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 9, InitDefaultsRequest}, {
+::google::protobuf::internal::SCCInfo<13> scc_info_Request =
+    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 13, InitDefaultsRequest}, {
       &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DriveListRequest.base,
       &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_FileListRequest.base,
       &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CreateDirectoryRequest.base,
@@ -335,7 +585,11 @@ static void InitDefaultsRequest() {
       &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DownloadRequest.base,
       &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_UploadRequest.base,
       &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_PacketRequest.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base,}};
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base,
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BlockChecksumsRequest.base,
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_ResumeRequest.base,
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CopyRequest.base,
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_MoveRequest.base,}};
 
 void InitDefaults() {
   ::google::protobuf::internal::InitSCC(&scc_info_DriveList_Item.base);
@@ -344,13 +598,25 @@ void InitDefaults() {
   ::google::protobuf::internal::InitSCC(&scc_info_FileList_Item.base);
   ::google::protobuf::internal::InitSCC(&scc_info_FileList.base);
   ::google::protobuf::internal::InitSCC(&scc_info_FileListRequest.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_BlockChecksums_Checksum.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_BlockChecksums.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_BlockChecksumsRequest.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_BundleEntry.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_Bundle.base);
   ::google::protobuf::internal::InitSCC(&scc_info_UploadRequest.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_ResumeRequest.base);
   ::google::protobuf::internal::InitSCC(&scc_info_DownloadRequest.base);
   ::google::protobuf::internal::InitSCC(&scc_info_PacketRequest.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_DeltaOperation.base);
   ::google::protobuf::internal::InitSCC(&scc_info_Packet.base);
   ::google::protobuf::internal::InitSCC(&scc_info_CreateDirectoryRequest.base);
   ::google::protobuf::internal::InitSCC(&scc_info_RenameRequest.base);
   ::google::protobuf::internal::InitSCC(&scc_info_RemoveRequest.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_RemoveProgress_Failure.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_RemoveProgress.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_CopyRequest.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_MoveRequest.base);
+  ::google::protobuf::internal::InitSCC(&scc_info_CopyProgress.base);
   ::google::protobuf::internal::InitSCC(&scc_info_Reply.base);
   ::google::protobuf::internal::InitSCC(&scc_info_Request.base);
 }
@@ -431,6 +697,16 @@ bool Status_IsValid(int value) {
   }
 }
 
+bool Compression_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -1326,6 +1602,12 @@ void FileList::InitAsDefaultInstance() {
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int FileList::kItemFieldNumber;
+const int FileList::kRecursiveFieldNumber;
+const int FileList::kContinuationFieldNumber;
+const int FileList::kVersionFieldNumber;
+const int FileList::kNotModifiedFieldNumber;
+const int FileList::kDeltaFieldNumber;
+const int FileList::kRemovedItemFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 FileList::FileList()
@@ -1338,12 +1620,19 @@ FileList::FileList()
 FileList::FileList(const FileList& from)
   : ::google::protobuf::MessageLite(),
       _internal_metadata_(NULL),
-      item_(from.item_) {
+      item_(from.item_),
+      removed_item_(from.removed_item_) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&continuation_, &from.continuation_,
+    static_cast<size_t>(reinterpret_cast<char*>(&delta_) -
+    reinterpret_cast<char*>(&continuation_)) + sizeof(delta_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.FileList)
 }
 
 void FileList::SharedCtor() {
+  ::memset(&continuation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&delta_) -
+      reinterpret_cast<char*>(&continuation_)) + sizeof(delta_));
 }
 
 FileList::~FileList() {
@@ -1370,6 +1659,10 @@ void FileList::Clear() {
   (void) cached_has_bits;
 
   item_.Clear();
+  removed_item_.Clear();
+  ::memset(&continuation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&delta_) -
+      reinterpret_cast<char*>(&continuation_)) + sizeof(delta_));
   _internal_metadata_.Clear();
 }
 
@@ -1401,6 +1694,88 @@ bool FileList::MergePartialFromCodedStream(
         break;
       }
 
+      // bool recursive = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &recursive_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 continuation = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &continuation_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 version = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &version_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool not_modified = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &not_modified_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool delta = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &delta_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .aspia.proto.file_transfer.FileList.Item removed_item = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+                input, add_removed_item()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -1436,6 +1811,40 @@ void FileList::SerializeWithCachedSizes(
       output);
   }
 
+  // bool recursive = 2;
+  if (this->recursive() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->recursive(), output);
+  }
+
+  // uint64 continuation = 3;
+  if (this->continuation() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->continuation(), output);
+  }
+
+  // uint64 version = 4;
+  if (this->version() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->version(), output);
+  }
+
+  // bool not_modified = 5;
+  if (this->not_modified() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(5, this->not_modified(), output);
+  }
+
+  // bool delta = 6;
+  if (this->delta() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(6, this->delta(), output);
+  }
+
+  // repeated .aspia.proto.file_transfer.FileList.Item removed_item = 7;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->removed_item_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      7,
+      this->removed_item(static_cast<int>(i)),
+      output);
+  }
+
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
   // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.FileList)
@@ -1458,6 +1867,46 @@ size_t FileList::ByteSizeLong() const {
     }
   }
 
+  // repeated .aspia.proto.file_transfer.FileList.Item removed_item = 7;
+  {
+    unsigned int count = static_cast<unsigned int>(this->removed_item_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->removed_item(static_cast<int>(i)));
+    }
+  }
+
+  // uint64 continuation = 3;
+  if (this->continuation() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->continuation());
+  }
+
+  // uint64 version = 4;
+  if (this->version() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->version());
+  }
+
+  // bool recursive = 2;
+  if (this->recursive() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool not_modified = 5;
+  if (this->not_modified() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool delta = 6;
+  if (this->delta() != 0) {
+    total_size += 1 + 1;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
@@ -1476,6 +1925,22 @@ void FileList::MergeFrom(const FileList& from) {
   (void) cached_has_bits;
 
   item_.MergeFrom(from.item_);
+  removed_item_.MergeFrom(from.removed_item_);
+  if (from.continuation() != 0) {
+    set_continuation(from.continuation());
+  }
+  if (from.version() != 0) {
+    set_version(from.version());
+  }
+  if (from.recursive() != 0) {
+    set_recursive(from.recursive());
+  }
+  if (from.not_modified() != 0) {
+    set_not_modified(from.not_modified());
+  }
+  if (from.delta() != 0) {
+    set_delta(from.delta());
+  }
 }
 
 void FileList::CopyFrom(const FileList& from) {
@@ -1496,6 +1961,12 @@ void FileList::Swap(FileList* other) {
 void FileList::InternalSwap(FileList* other) {
   using std::swap;
   CastToBase(&item_)->InternalSwap(CastToBase(&other->item_));
+  CastToBase(&removed_item_)->InternalSwap(CastToBase(&other->removed_item_));
+  swap(continuation_, other->continuation_);
+  swap(version_, other->version_);
+  swap(recursive_, other->recursive_);
+  swap(not_modified_, other->not_modified_);
+  swap(delta_, other->delta_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
@@ -1510,6 +1981,10 @@ void FileListRequest::InitAsDefaultInstance() {
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int FileListRequest::kPathFieldNumber;
+const int FileListRequest::kRecursiveFieldNumber;
+const int FileListRequest::kContinuationFieldNumber;
+const int FileListRequest::kPagedFieldNumber;
+const int FileListRequest::kCachedVersionFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 FileListRequest::FileListRequest()
@@ -1527,11 +2002,17 @@ FileListRequest::FileListRequest(const FileListRequest& from)
   if (from.path().size() > 0) {
     path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
   }
+  ::memcpy(&continuation_, &from.continuation_,
+    static_cast<size_t>(reinterpret_cast<char*>(&paged_) -
+    reinterpret_cast<char*>(&continuation_)) + sizeof(paged_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.FileListRequest)
 }
 
 void FileListRequest::SharedCtor() {
   path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&continuation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&paged_) -
+      reinterpret_cast<char*>(&continuation_)) + sizeof(paged_));
 }
 
 FileListRequest::~FileListRequest() {
@@ -1559,6 +2040,9 @@ void FileListRequest::Clear() {
   (void) cached_has_bits;
 
   path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&continuation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&paged_) -
+      reinterpret_cast<char*>(&continuation_)) + sizeof(paged_));
   _internal_metadata_.Clear();
 }
 
@@ -1594,12 +2078,68 @@ bool FileListRequest::MergePartialFromCodedStream(
         break;
       }
 
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
+      // bool recursive = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &recursive_)));
+        } else {
+          goto handle_unusual;
         }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+        break;
+      }
+
+      // uint64 continuation = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &continuation_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool paged = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &paged_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 cached_version = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &cached_version_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
             input, tag, &unknown_fields_stream));
         break;
       }
@@ -1630,6 +2170,26 @@ void FileListRequest::SerializeWithCachedSizes(
       1, this->path(), output);
   }
 
+  // bool recursive = 2;
+  if (this->recursive() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->recursive(), output);
+  }
+
+  // uint64 continuation = 3;
+  if (this->continuation() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->continuation(), output);
+  }
+
+  // bool paged = 4;
+  if (this->paged() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->paged(), output);
+  }
+
+  // uint64 cached_version = 5;
+  if (this->cached_version() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->cached_version(), output);
+  }
+
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
   // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.FileListRequest)
@@ -1648,6 +2208,30 @@ size_t FileListRequest::ByteSizeLong() const {
         this->path());
   }
 
+  // uint64 continuation = 3;
+  if (this->continuation() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->continuation());
+  }
+
+  // uint64 cached_version = 5;
+  if (this->cached_version() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->cached_version());
+  }
+
+  // bool recursive = 2;
+  if (this->recursive() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool paged = 4;
+  if (this->paged() != 0) {
+    total_size += 1 + 1;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
@@ -1669,6 +2253,18 @@ void FileListRequest::MergeFrom(const FileListRequest& from) {
 
     path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
   }
+  if (from.continuation() != 0) {
+    set_continuation(from.continuation());
+  }
+  if (from.cached_version() != 0) {
+    set_cached_version(from.cached_version());
+  }
+  if (from.recursive() != 0) {
+    set_recursive(from.recursive());
+  }
+  if (from.paged() != 0) {
+    set_paged(from.paged());
+  }
 }
 
 void FileListRequest::CopyFrom(const FileListRequest& from) {
@@ -1690,6 +2286,10 @@ void FileListRequest::InternalSwap(FileListRequest* other) {
   using std::swap;
   path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
     GetArenaNoVirtual());
+  swap(continuation_, other->continuation_);
+  swap(cached_version_, other->cached_version_);
+  swap(recursive_, other->recursive_);
+  swap(paged_, other->paged_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
@@ -1700,67 +2300,67 @@ void FileListRequest::InternalSwap(FileListRequest* other) {
 
 // ===================================================================
 
-void UploadRequest::InitAsDefaultInstance() {
+void BlockChecksums_Checksum::InitAsDefaultInstance() {
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int UploadRequest::kPathFieldNumber;
-const int UploadRequest::kOverwriteFieldNumber;
+const int BlockChecksums_Checksum::kWeakFieldNumber;
+const int BlockChecksums_Checksum::kStrongFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-UploadRequest::UploadRequest()
+BlockChecksums_Checksum::BlockChecksums_Checksum()
   : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
   ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_UploadRequest.base);
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BlockChecksums_Checksum.base);
   SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.UploadRequest)
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.BlockChecksums.Checksum)
 }
-UploadRequest::UploadRequest(const UploadRequest& from)
+BlockChecksums_Checksum::BlockChecksums_Checksum(const BlockChecksums_Checksum& from)
   : ::google::protobuf::MessageLite(),
       _internal_metadata_(NULL) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  strong_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.strong().size() > 0) {
+    strong_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.strong_);
   }
-  overwrite_ = from.overwrite_;
-  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.UploadRequest)
+  weak_ = from.weak_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.BlockChecksums.Checksum)
 }
 
-void UploadRequest::SharedCtor() {
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  overwrite_ = false;
+void BlockChecksums_Checksum::SharedCtor() {
+  strong_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  weak_ = 0u;
 }
 
-UploadRequest::~UploadRequest() {
-  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.UploadRequest)
+BlockChecksums_Checksum::~BlockChecksums_Checksum() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.BlockChecksums.Checksum)
   SharedDtor();
 }
 
-void UploadRequest::SharedDtor() {
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void BlockChecksums_Checksum::SharedDtor() {
+  strong_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
-void UploadRequest::SetCachedSize(int size) const {
+void BlockChecksums_Checksum::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const UploadRequest& UploadRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_UploadRequest.base);
+const BlockChecksums_Checksum& BlockChecksums_Checksum::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BlockChecksums_Checksum.base);
   return *internal_default_instance();
 }
 
 
-void UploadRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.UploadRequest)
+void BlockChecksums_Checksum::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.BlockChecksums.Checksum)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  overwrite_ = false;
+  strong_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  weak_ = 0u;
   _internal_metadata_.Clear();
 }
 
-bool UploadRequest::MergePartialFromCodedStream(
+bool BlockChecksums_Checksum::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
@@ -1770,36 +2370,32 @@ bool UploadRequest::MergePartialFromCodedStream(
       unknown_fields_setter.buffer());
   ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
       &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.UploadRequest)
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.BlockChecksums.Checksum)
   for (;;) {
     ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string path = 1;
+      // uint32 weak = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), static_cast<int>(this->path().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.UploadRequest.path"));
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &weak_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // bool overwrite = 2;
+      // bytes strong = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &overwrite_)));
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_strong()));
         } else {
           goto handle_unusual;
         }
@@ -1818,56 +2414,54 @@ bool UploadRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.UploadRequest)
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.BlockChecksums.Checksum)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.UploadRequest)
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.BlockChecksums.Checksum)
   return false;
 #undef DO_
 }
 
-void UploadRequest::SerializeWithCachedSizes(
+void BlockChecksums_Checksum::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.UploadRequest)
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.BlockChecksums.Checksum)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string path = 1;
-  if (this->path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "aspia.proto.file_transfer.UploadRequest.path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->path(), output);
+  // uint32 weak = 1;
+  if (this->weak() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->weak(), output);
   }
 
-  // bool overwrite = 2;
-  if (this->overwrite() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->overwrite(), output);
+  // bytes strong = 2;
+  if (this->strong().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      2, this->strong(), output);
   }
 
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.UploadRequest)
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.BlockChecksums.Checksum)
 }
 
-size_t UploadRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.UploadRequest)
+size_t BlockChecksums_Checksum::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.BlockChecksums.Checksum)
   size_t total_size = 0;
 
   total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
 
-  // string path = 1;
-  if (this->path().size() > 0) {
+  // bytes strong = 2;
+  if (this->strong().size() > 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->path());
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->strong());
   }
 
-  // bool overwrite = 2;
-  if (this->overwrite() != 0) {
-    total_size += 1 + 1;
+  // uint32 weak = 1;
+  if (this->weak() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->weak());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -1875,114 +2469,113 @@ size_t UploadRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void UploadRequest::CheckTypeAndMergeFrom(
+void BlockChecksums_Checksum::CheckTypeAndMergeFrom(
     const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const UploadRequest*>(&from));
+  MergeFrom(*::google::protobuf::down_cast<const BlockChecksums_Checksum*>(&from));
 }
 
-void UploadRequest::MergeFrom(const UploadRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.UploadRequest)
+void BlockChecksums_Checksum::MergeFrom(const BlockChecksums_Checksum& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.BlockChecksums.Checksum)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.path().size() > 0) {
+  if (from.strong().size() > 0) {
 
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+    strong_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.strong_);
   }
-  if (from.overwrite() != 0) {
-    set_overwrite(from.overwrite());
+  if (from.weak() != 0) {
+    set_weak(from.weak());
   }
 }
 
-void UploadRequest::CopyFrom(const UploadRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.UploadRequest)
+void BlockChecksums_Checksum::CopyFrom(const BlockChecksums_Checksum& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.BlockChecksums.Checksum)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool UploadRequest::IsInitialized() const {
+bool BlockChecksums_Checksum::IsInitialized() const {
   return true;
 }
 
-void UploadRequest::Swap(UploadRequest* other) {
+void BlockChecksums_Checksum::Swap(BlockChecksums_Checksum* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void UploadRequest::InternalSwap(UploadRequest* other) {
+void BlockChecksums_Checksum::InternalSwap(BlockChecksums_Checksum* other) {
   using std::swap;
-  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  strong_.Swap(&other->strong_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
     GetArenaNoVirtual());
-  swap(overwrite_, other->overwrite_);
+  swap(weak_, other->weak_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
-::std::string UploadRequest::GetTypeName() const {
-  return "aspia.proto.file_transfer.UploadRequest";
+::std::string BlockChecksums_Checksum::GetTypeName() const {
+  return "aspia.proto.file_transfer.BlockChecksums.Checksum";
 }
 
 
 // ===================================================================
 
-void DownloadRequest::InitAsDefaultInstance() {
+void BlockChecksums::InitAsDefaultInstance() {
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DownloadRequest::kPathFieldNumber;
+const int BlockChecksums::kBlockSizeFieldNumber;
+const int BlockChecksums::kChecksumFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-DownloadRequest::DownloadRequest()
+BlockChecksums::BlockChecksums()
   : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
   ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DownloadRequest.base);
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BlockChecksums.base);
   SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.DownloadRequest)
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.BlockChecksums)
 }
-DownloadRequest::DownloadRequest(const DownloadRequest& from)
+BlockChecksums::BlockChecksums(const BlockChecksums& from)
   : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
+      _internal_metadata_(NULL),
+      checksum_(from.checksum_) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
-  }
-  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.DownloadRequest)
+  block_size_ = from.block_size_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.BlockChecksums)
 }
 
-void DownloadRequest::SharedCtor() {
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void BlockChecksums::SharedCtor() {
+  block_size_ = 0u;
 }
 
-DownloadRequest::~DownloadRequest() {
-  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.DownloadRequest)
+BlockChecksums::~BlockChecksums() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.BlockChecksums)
   SharedDtor();
 }
 
-void DownloadRequest::SharedDtor() {
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void BlockChecksums::SharedDtor() {
 }
 
-void DownloadRequest::SetCachedSize(int size) const {
+void BlockChecksums::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const DownloadRequest& DownloadRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DownloadRequest.base);
+const BlockChecksums& BlockChecksums::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BlockChecksums.base);
   return *internal_default_instance();
 }
 
 
-void DownloadRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.DownloadRequest)
+void BlockChecksums::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.BlockChecksums)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  checksum_.Clear();
+  block_size_ = 0u;
   _internal_metadata_.Clear();
 }
 
-bool DownloadRequest::MergePartialFromCodedStream(
+bool BlockChecksums::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
@@ -1992,22 +2585,32 @@ bool DownloadRequest::MergePartialFromCodedStream(
       unknown_fields_setter.buffer());
   ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
       &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.DownloadRequest)
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.BlockChecksums)
   for (;;) {
     ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string path = 1;
+      // uint32 block_size = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), static_cast<int>(this->path().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.DownloadRequest.path"));
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &block_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .aspia.proto.file_transfer.BlockChecksums.Checksum checksum = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+                input, add_checksum()));
         } else {
           goto handle_unusual;
         }
@@ -2026,46 +2629,61 @@ bool DownloadRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.DownloadRequest)
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.BlockChecksums)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.DownloadRequest)
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.BlockChecksums)
   return false;
 #undef DO_
 }
 
-void DownloadRequest::SerializeWithCachedSizes(
+void BlockChecksums::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.DownloadRequest)
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.BlockChecksums)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string path = 1;
-  if (this->path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "aspia.proto.file_transfer.DownloadRequest.path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->path(), output);
+  // uint32 block_size = 1;
+  if (this->block_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->block_size(), output);
+  }
+
+  // repeated .aspia.proto.file_transfer.BlockChecksums.Checksum checksum = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->checksum_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      2,
+      this->checksum(static_cast<int>(i)),
+      output);
   }
 
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.DownloadRequest)
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.BlockChecksums)
 }
 
-size_t DownloadRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.DownloadRequest)
+size_t BlockChecksums::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.BlockChecksums)
   size_t total_size = 0;
 
   total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
 
-  // string path = 1;
-  if (this->path().size() > 0) {
+  // repeated .aspia.proto.file_transfer.BlockChecksums.Checksum checksum = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->checksum_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->checksum(static_cast<int>(i)));
+    }
+  }
+
+  // uint32 block_size = 1;
+  if (this->block_size() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->path());
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->block_size());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -2073,106 +2691,3589 @@ size_t DownloadRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void DownloadRequest::CheckTypeAndMergeFrom(
+void BlockChecksums::CheckTypeAndMergeFrom(
     const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const DownloadRequest*>(&from));
+  MergeFrom(*::google::protobuf::down_cast<const BlockChecksums*>(&from));
 }
 
-void DownloadRequest::MergeFrom(const DownloadRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.DownloadRequest)
+void BlockChecksums::MergeFrom(const BlockChecksums& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.BlockChecksums)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.path().size() > 0) {
-
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  checksum_.MergeFrom(from.checksum_);
+  if (from.block_size() != 0) {
+    set_block_size(from.block_size());
   }
 }
 
-void DownloadRequest::CopyFrom(const DownloadRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.DownloadRequest)
+void BlockChecksums::CopyFrom(const BlockChecksums& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.BlockChecksums)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool DownloadRequest::IsInitialized() const {
+bool BlockChecksums::IsInitialized() const {
   return true;
 }
 
-void DownloadRequest::Swap(DownloadRequest* other) {
+void BlockChecksums::Swap(BlockChecksums* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void DownloadRequest::InternalSwap(DownloadRequest* other) {
+void BlockChecksums::InternalSwap(BlockChecksums* other) {
   using std::swap;
-  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  CastToBase(&checksum_)->InternalSwap(CastToBase(&other->checksum_));
+  swap(block_size_, other->block_size_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string BlockChecksums::GetTypeName() const {
+  return "aspia.proto.file_transfer.BlockChecksums";
+}
+
+
+// ===================================================================
+
+void BlockChecksumsRequest::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int BlockChecksumsRequest::kPathFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+BlockChecksumsRequest::BlockChecksumsRequest()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BlockChecksumsRequest.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.BlockChecksumsRequest)
+}
+BlockChecksumsRequest::BlockChecksumsRequest(const BlockChecksumsRequest& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.path().size() > 0) {
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.BlockChecksumsRequest)
+}
+
+void BlockChecksumsRequest::SharedCtor() {
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+BlockChecksumsRequest::~BlockChecksumsRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.BlockChecksumsRequest)
+  SharedDtor();
+}
+
+void BlockChecksumsRequest::SharedDtor() {
+  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void BlockChecksumsRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const BlockChecksumsRequest& BlockChecksumsRequest::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BlockChecksumsRequest.base);
+  return *internal_default_instance();
+}
+
+
+void BlockChecksumsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.BlockChecksumsRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _internal_metadata_.Clear();
+}
+
+bool BlockChecksumsRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.BlockChecksumsRequest)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string path = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->path().data(), static_cast<int>(this->path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.BlockChecksumsRequest.path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.BlockChecksumsRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.BlockChecksumsRequest)
+  return false;
+#undef DO_
+}
+
+void BlockChecksumsRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.BlockChecksumsRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->path().data(), static_cast<int>(this->path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.BlockChecksumsRequest.path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->path(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.BlockChecksumsRequest)
+}
+
+size_t BlockChecksumsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.BlockChecksumsRequest)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->path());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void BlockChecksumsRequest::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const BlockChecksumsRequest*>(&from));
+}
+
+void BlockChecksumsRequest::MergeFrom(const BlockChecksumsRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.BlockChecksumsRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.path().size() > 0) {
+
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+}
+
+void BlockChecksumsRequest::CopyFrom(const BlockChecksumsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.BlockChecksumsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlockChecksumsRequest::IsInitialized() const {
+  return true;
+}
+
+void BlockChecksumsRequest::Swap(BlockChecksumsRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void BlockChecksumsRequest::InternalSwap(BlockChecksumsRequest* other) {
+  using std::swap;
+  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string BlockChecksumsRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.BlockChecksumsRequest";
+}
+
+
+// ===================================================================
+
+void BundleEntry::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int BundleEntry::kIndexFieldNumber;
+const int BundleEntry::kSourcePathFieldNumber;
+const int BundleEntry::kTargetPathFieldNumber;
+const int BundleEntry::kSizeFieldNumber;
+const int BundleEntry::kModificationTimeFieldNumber;
+const int BundleEntry::kIsDirectoryFieldNumber;
+const int BundleEntry::kStatusFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+BundleEntry::BundleEntry()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BundleEntry.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.BundleEntry)
+}
+BundleEntry::BundleEntry(const BundleEntry& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  source_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.source_path().size() > 0) {
+    source_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.source_path_);
+  }
+  target_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.target_path().size() > 0) {
+    target_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.target_path_);
+  }
+  ::memcpy(&index_, &from.index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&status_) -
+    reinterpret_cast<char*>(&index_)) + sizeof(status_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.BundleEntry)
+}
+
+void BundleEntry::SharedCtor() {
+  source_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  target_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&status_) -
+      reinterpret_cast<char*>(&index_)) + sizeof(status_));
+}
+
+BundleEntry::~BundleEntry() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.BundleEntry)
+  SharedDtor();
+}
+
+void BundleEntry::SharedDtor() {
+  source_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  target_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void BundleEntry::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const BundleEntry& BundleEntry::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_BundleEntry.base);
+  return *internal_default_instance();
+}
+
+
+void BundleEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.BundleEntry)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  source_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  target_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&status_) -
+      reinterpret_cast<char*>(&index_)) + sizeof(status_));
+  _internal_metadata_.Clear();
+}
+
+bool BundleEntry::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.BundleEntry)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint32 index = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &index_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string source_path = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_source_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->source_path().data(), static_cast<int>(this->source_path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.BundleEntry.source_path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string target_path = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_target_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->target_path().data(), static_cast<int>(this->target_path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.BundleEntry.target_path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 size = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 modification_time = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &modification_time_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool is_directory = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &is_directory_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.Status status = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_status(static_cast< ::aspia::proto::file_transfer::Status >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.BundleEntry)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.BundleEntry)
+  return false;
+#undef DO_
+}
+
+void BundleEntry::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.BundleEntry)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 index = 1;
+  if (this->index() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->index(), output);
+  }
+
+  // string source_path = 2;
+  if (this->source_path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->source_path().data(), static_cast<int>(this->source_path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.BundleEntry.source_path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->source_path(), output);
+  }
+
+  // string target_path = 3;
+  if (this->target_path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->target_path().data(), static_cast<int>(this->target_path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.BundleEntry.target_path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->target_path(), output);
+  }
+
+  // uint64 size = 4;
+  if (this->size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->size(), output);
+  }
+
+  // int64 modification_time = 5;
+  if (this->modification_time() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(5, this->modification_time(), output);
+  }
+
+  // bool is_directory = 6;
+  if (this->is_directory() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(6, this->is_directory(), output);
+  }
+
+  // .aspia.proto.file_transfer.Status status = 7;
+  if (this->status() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      7, this->status(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.BundleEntry)
+}
+
+size_t BundleEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.BundleEntry)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // string source_path = 2;
+  if (this->source_path().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->source_path());
+  }
+
+  // string target_path = 3;
+  if (this->target_path().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->target_path());
+  }
+
+  // uint32 index = 1;
+  if (this->index() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->index());
+  }
+
+  // bool is_directory = 6;
+  if (this->is_directory() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 size = 4;
+  if (this->size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->size());
+  }
+
+  // int64 modification_time = 5;
+  if (this->modification_time() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->modification_time());
+  }
+
+  // .aspia.proto.file_transfer.Status status = 7;
+  if (this->status() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->status());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void BundleEntry::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const BundleEntry*>(&from));
+}
+
+void BundleEntry::MergeFrom(const BundleEntry& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.BundleEntry)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.source_path().size() > 0) {
+
+    source_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.source_path_);
+  }
+  if (from.target_path().size() > 0) {
+
+    target_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.target_path_);
+  }
+  if (from.index() != 0) {
+    set_index(from.index());
+  }
+  if (from.is_directory() != 0) {
+    set_is_directory(from.is_directory());
+  }
+  if (from.size() != 0) {
+    set_size(from.size());
+  }
+  if (from.modification_time() != 0) {
+    set_modification_time(from.modification_time());
+  }
+  if (from.status() != 0) {
+    set_status(from.status());
+  }
+}
+
+void BundleEntry::CopyFrom(const BundleEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.BundleEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BundleEntry::IsInitialized() const {
+  return true;
+}
+
+void BundleEntry::Swap(BundleEntry* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void BundleEntry::InternalSwap(BundleEntry* other) {
+  using std::swap;
+  source_path_.Swap(&other->source_path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  target_path_.Swap(&other->target_path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(index_, other->index_);
+  swap(is_directory_, other->is_directory_);
+  swap(size_, other->size_);
+  swap(modification_time_, other->modification_time_);
+  swap(status_, other->status_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string BundleEntry::GetTypeName() const {
+  return "aspia.proto.file_transfer.BundleEntry";
+}
+
+
+// ===================================================================
+
+void Bundle::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Bundle::kEntryFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Bundle::Bundle()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Bundle.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.Bundle)
+}
+Bundle::Bundle(const Bundle& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      entry_(from.entry_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.Bundle)
+}
+
+void Bundle::SharedCtor() {
+}
+
+Bundle::~Bundle() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.Bundle)
+  SharedDtor();
+}
+
+void Bundle::SharedDtor() {
+}
+
+void Bundle::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Bundle& Bundle::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Bundle.base);
+  return *internal_default_instance();
+}
+
+
+void Bundle::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.Bundle)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  entry_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool Bundle::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.Bundle)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .aspia.proto.file_transfer.BundleEntry entry = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+                input, add_entry()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.Bundle)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.Bundle)
+  return false;
+#undef DO_
+}
+
+void Bundle::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.Bundle)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .aspia.proto.file_transfer.BundleEntry entry = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->entry_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      1,
+      this->entry(static_cast<int>(i)),
+      output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.Bundle)
+}
+
+size_t Bundle::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.Bundle)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // repeated .aspia.proto.file_transfer.BundleEntry entry = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->entry_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->entry(static_cast<int>(i)));
+    }
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Bundle::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const Bundle*>(&from));
+}
+
+void Bundle::MergeFrom(const Bundle& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.Bundle)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  entry_.MergeFrom(from.entry_);
+}
+
+void Bundle::CopyFrom(const Bundle& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.Bundle)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Bundle::IsInitialized() const {
+  return true;
+}
+
+void Bundle::Swap(Bundle* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Bundle::InternalSwap(Bundle* other) {
+  using std::swap;
+  CastToBase(&entry_)->InternalSwap(CastToBase(&other->entry_));
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string Bundle::GetTypeName() const {
+  return "aspia.proto.file_transfer.Bundle";
+}
+
+
+// ===================================================================
+
+void UploadRequest::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int UploadRequest::kPathFieldNumber;
+const int UploadRequest::kOverwriteFieldNumber;
+const int UploadRequest::kWindowSizeFieldNumber;
+const int UploadRequest::kDeltaBlockSizeFieldNumber;
+const int UploadRequest::kOffsetFieldNumber;
+const int UploadRequest::kFileSizeFieldNumber;
+const int UploadRequest::kBundleFieldNumber;
+const int UploadRequest::kModificationTimeFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+UploadRequest::UploadRequest()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_UploadRequest.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.UploadRequest)
+}
+UploadRequest::UploadRequest(const UploadRequest& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.path().size() > 0) {
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  ::memcpy(&window_size_, &from.window_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&bundle_) -
+    reinterpret_cast<char*>(&window_size_)) + sizeof(bundle_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.UploadRequest)
+}
+
+void UploadRequest::SharedCtor() {
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&window_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&bundle_) -
+      reinterpret_cast<char*>(&window_size_)) + sizeof(bundle_));
+}
+
+UploadRequest::~UploadRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.UploadRequest)
+  SharedDtor();
+}
+
+void UploadRequest::SharedDtor() {
+  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void UploadRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const UploadRequest& UploadRequest::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_UploadRequest.base);
+  return *internal_default_instance();
+}
+
+
+void UploadRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.UploadRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&window_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&bundle_) -
+      reinterpret_cast<char*>(&window_size_)) + sizeof(bundle_));
+  _internal_metadata_.Clear();
+}
+
+bool UploadRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.UploadRequest)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string path = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->path().data(), static_cast<int>(this->path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.UploadRequest.path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool overwrite = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &overwrite_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 window_size = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &window_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 delta_block_size = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &delta_block_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 offset = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &offset_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 file_size = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &file_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool bundle = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &bundle_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 modification_time = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &modification_time_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.UploadRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.UploadRequest)
+  return false;
+#undef DO_
+}
+
+void UploadRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.UploadRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->path().data(), static_cast<int>(this->path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.UploadRequest.path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->path(), output);
+  }
+
+  // bool overwrite = 2;
+  if (this->overwrite() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->overwrite(), output);
+  }
+
+  // uint32 window_size = 3;
+  if (this->window_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->window_size(), output);
+  }
+
+  // uint32 delta_block_size = 4;
+  if (this->delta_block_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->delta_block_size(), output);
+  }
+
+  // uint64 offset = 5;
+  if (this->offset() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->offset(), output);
+  }
+
+  // uint64 file_size = 6;
+  if (this->file_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->file_size(), output);
+  }
+
+  // bool bundle = 7;
+  if (this->bundle() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(7, this->bundle(), output);
+  }
+
+  // uint64 modification_time = 8;
+  if (this->modification_time() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(8, this->modification_time(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.UploadRequest)
+}
+
+size_t UploadRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.UploadRequest)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->path());
+  }
+
+  // uint32 window_size = 3;
+  if (this->window_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->window_size());
+  }
+
+  // uint32 delta_block_size = 4;
+  if (this->delta_block_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->delta_block_size());
+  }
+
+  // uint64 offset = 5;
+  if (this->offset() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->offset());
+  }
+
+  // uint64 file_size = 6;
+  if (this->file_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->file_size());
+  }
+
+  // uint64 modification_time = 8;
+  if (this->modification_time() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->modification_time());
+  }
+
+  // bool overwrite = 2;
+  if (this->overwrite() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool bundle = 7;
+  if (this->bundle() != 0) {
+    total_size += 1 + 1;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void UploadRequest::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const UploadRequest*>(&from));
+}
+
+void UploadRequest::MergeFrom(const UploadRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.UploadRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.path().size() > 0) {
+
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  if (from.window_size() != 0) {
+    set_window_size(from.window_size());
+  }
+  if (from.delta_block_size() != 0) {
+    set_delta_block_size(from.delta_block_size());
+  }
+  if (from.offset() != 0) {
+    set_offset(from.offset());
+  }
+  if (from.file_size() != 0) {
+    set_file_size(from.file_size());
+  }
+  if (from.modification_time() != 0) {
+    set_modification_time(from.modification_time());
+  }
+  if (from.overwrite() != 0) {
+    set_overwrite(from.overwrite());
+  }
+  if (from.bundle() != 0) {
+    set_bundle(from.bundle());
+  }
+}
+
+void UploadRequest::CopyFrom(const UploadRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.UploadRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UploadRequest::IsInitialized() const {
+  return true;
+}
+
+void UploadRequest::Swap(UploadRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void UploadRequest::InternalSwap(UploadRequest* other) {
+  using std::swap;
+  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(window_size_, other->window_size_);
+  swap(delta_block_size_, other->delta_block_size_);
+  swap(offset_, other->offset_);
+  swap(file_size_, other->file_size_);
+  swap(modification_time_, other->modification_time_);
+  swap(overwrite_, other->overwrite_);
+  swap(bundle_, other->bundle_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string UploadRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.UploadRequest";
+}
+
+
+// ===================================================================
+
+void ResumeRequest::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ResumeRequest::kPathFieldNumber;
+const int ResumeRequest::kFileSizeFieldNumber;
+const int ResumeRequest::kModificationTimeFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ResumeRequest::ResumeRequest()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_ResumeRequest.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.ResumeRequest)
+}
+ResumeRequest::ResumeRequest(const ResumeRequest& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.path().size() > 0) {
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  ::memcpy(&file_size_, &from.file_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&modification_time_) -
+    reinterpret_cast<char*>(&file_size_)) + sizeof(modification_time_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.ResumeRequest)
+}
+
+void ResumeRequest::SharedCtor() {
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&file_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&modification_time_) -
+      reinterpret_cast<char*>(&file_size_)) + sizeof(modification_time_));
+}
+
+ResumeRequest::~ResumeRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.ResumeRequest)
+  SharedDtor();
+}
+
+void ResumeRequest::SharedDtor() {
+  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void ResumeRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const ResumeRequest& ResumeRequest::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_ResumeRequest.base);
+  return *internal_default_instance();
+}
+
+
+void ResumeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.ResumeRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&file_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&modification_time_) -
+      reinterpret_cast<char*>(&file_size_)) + sizeof(modification_time_));
+  _internal_metadata_.Clear();
+}
+
+bool ResumeRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.ResumeRequest)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string path = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->path().data(), static_cast<int>(this->path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.ResumeRequest.path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 file_size = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &file_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 modification_time = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &modification_time_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.ResumeRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.ResumeRequest)
+  return false;
+#undef DO_
+}
+
+void ResumeRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.ResumeRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->path().data(), static_cast<int>(this->path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.ResumeRequest.path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->path(), output);
+  }
+
+  // uint64 file_size = 2;
+  if (this->file_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->file_size(), output);
+  }
+
+  // uint64 modification_time = 3;
+  if (this->modification_time() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->modification_time(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.ResumeRequest)
+}
+
+size_t ResumeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.ResumeRequest)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->path());
+  }
+
+  // uint64 file_size = 2;
+  if (this->file_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->file_size());
+  }
+
+  // uint64 modification_time = 3;
+  if (this->modification_time() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->modification_time());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ResumeRequest::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const ResumeRequest*>(&from));
+}
+
+void ResumeRequest::MergeFrom(const ResumeRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.ResumeRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.path().size() > 0) {
+
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  if (from.file_size() != 0) {
+    set_file_size(from.file_size());
+  }
+  if (from.modification_time() != 0) {
+    set_modification_time(from.modification_time());
+  }
+}
+
+void ResumeRequest::CopyFrom(const ResumeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.ResumeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResumeRequest::IsInitialized() const {
+  return true;
+}
+
+void ResumeRequest::Swap(ResumeRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ResumeRequest::InternalSwap(ResumeRequest* other) {
+  using std::swap;
+  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(file_size_, other->file_size_);
+  swap(modification_time_, other->modification_time_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string ResumeRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.ResumeRequest";
+}
+
+
+// ===================================================================
+
+void DownloadRequest::InitAsDefaultInstance() {
+  ::aspia::proto::file_transfer::_DownloadRequest_default_instance_._instance.get_mutable()->block_checksums_ = const_cast< ::aspia::proto::file_transfer::BlockChecksums*>(
+      ::aspia::proto::file_transfer::BlockChecksums::internal_default_instance());
+  ::aspia::proto::file_transfer::_DownloadRequest_default_instance_._instance.get_mutable()->bundle_ = const_cast< ::aspia::proto::file_transfer::Bundle*>(
+      ::aspia::proto::file_transfer::Bundle::internal_default_instance());
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int DownloadRequest::kPathFieldNumber;
+const int DownloadRequest::kWindowSizeFieldNumber;
+const int DownloadRequest::kBlockChecksumsFieldNumber;
+const int DownloadRequest::kOffsetFieldNumber;
+const int DownloadRequest::kTailHashFieldNumber;
+const int DownloadRequest::kBundleFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+DownloadRequest::DownloadRequest()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DownloadRequest.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.DownloadRequest)
+}
+DownloadRequest::DownloadRequest(const DownloadRequest& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.path().size() > 0) {
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  tail_hash_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.tail_hash().size() > 0) {
+    tail_hash_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.tail_hash_);
+  }
+  if (from.has_block_checksums()) {
+    block_checksums_ = new ::aspia::proto::file_transfer::BlockChecksums(*from.block_checksums_);
+  } else {
+    block_checksums_ = NULL;
+  }
+  if (from.has_bundle()) {
+    bundle_ = new ::aspia::proto::file_transfer::Bundle(*from.bundle_);
+  } else {
+    bundle_ = NULL;
+  }
+  ::memcpy(&offset_, &from.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&window_size_) -
+    reinterpret_cast<char*>(&offset_)) + sizeof(window_size_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.DownloadRequest)
+}
+
+void DownloadRequest::SharedCtor() {
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  tail_hash_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&block_checksums_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&window_size_) -
+      reinterpret_cast<char*>(&block_checksums_)) + sizeof(window_size_));
+}
+
+DownloadRequest::~DownloadRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.DownloadRequest)
+  SharedDtor();
+}
+
+void DownloadRequest::SharedDtor() {
+  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  tail_hash_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete block_checksums_;
+  if (this != internal_default_instance()) delete bundle_;
+}
+
+void DownloadRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const DownloadRequest& DownloadRequest::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DownloadRequest.base);
+  return *internal_default_instance();
+}
+
+
+void DownloadRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.DownloadRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  tail_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == NULL && block_checksums_ != NULL) {
+    delete block_checksums_;
+  }
+  block_checksums_ = NULL;
+  if (GetArenaNoVirtual() == NULL && bundle_ != NULL) {
+    delete bundle_;
+  }
+  bundle_ = NULL;
+  ::memset(&offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&window_size_) -
+      reinterpret_cast<char*>(&offset_)) + sizeof(window_size_));
+  _internal_metadata_.Clear();
+}
+
+bool DownloadRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.DownloadRequest)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string path = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->path().data(), static_cast<int>(this->path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.DownloadRequest.path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 window_size = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &window_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.BlockChecksums block_checksums = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_block_checksums()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 offset = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &offset_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes tail_hash = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_tail_hash()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.Bundle bundle = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_bundle()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.DownloadRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.DownloadRequest)
+  return false;
+#undef DO_
+}
+
+void DownloadRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.DownloadRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->path().data(), static_cast<int>(this->path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.DownloadRequest.path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->path(), output);
+  }
+
+  // uint32 window_size = 2;
+  if (this->window_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->window_size(), output);
+  }
+
+  // .aspia.proto.file_transfer.BlockChecksums block_checksums = 3;
+  if (this->has_block_checksums()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      3, this->_internal_block_checksums(), output);
+  }
+
+  // uint64 offset = 4;
+  if (this->offset() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->offset(), output);
+  }
+
+  // bytes tail_hash = 5;
+  if (this->tail_hash().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      5, this->tail_hash(), output);
+  }
+
+  // .aspia.proto.file_transfer.Bundle bundle = 6;
+  if (this->has_bundle()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      6, this->_internal_bundle(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.DownloadRequest)
+}
+
+size_t DownloadRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.DownloadRequest)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->path());
+  }
+
+  // bytes tail_hash = 5;
+  if (this->tail_hash().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->tail_hash());
+  }
+
+  // .aspia.proto.file_transfer.BlockChecksums block_checksums = 3;
+  if (this->has_block_checksums()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *block_checksums_);
+  }
+
+  // .aspia.proto.file_transfer.Bundle bundle = 6;
+  if (this->has_bundle()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *bundle_);
+  }
+
+  // uint64 offset = 4;
+  if (this->offset() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->offset());
+  }
+
+  // uint32 window_size = 2;
+  if (this->window_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->window_size());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void DownloadRequest::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const DownloadRequest*>(&from));
+}
+
+void DownloadRequest::MergeFrom(const DownloadRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.DownloadRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.path().size() > 0) {
+
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  if (from.tail_hash().size() > 0) {
+
+    tail_hash_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.tail_hash_);
+  }
+  if (from.has_block_checksums()) {
+    mutable_block_checksums()->::aspia::proto::file_transfer::BlockChecksums::MergeFrom(from.block_checksums());
+  }
+  if (from.has_bundle()) {
+    mutable_bundle()->::aspia::proto::file_transfer::Bundle::MergeFrom(from.bundle());
+  }
+  if (from.offset() != 0) {
+    set_offset(from.offset());
+  }
+  if (from.window_size() != 0) {
+    set_window_size(from.window_size());
+  }
+}
+
+void DownloadRequest::CopyFrom(const DownloadRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.DownloadRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DownloadRequest::IsInitialized() const {
+  return true;
+}
+
+void DownloadRequest::Swap(DownloadRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void DownloadRequest::InternalSwap(DownloadRequest* other) {
+  using std::swap;
+  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  tail_hash_.Swap(&other->tail_hash_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(block_checksums_, other->block_checksums_);
+  swap(bundle_, other->bundle_);
+  swap(offset_, other->offset_);
+  swap(window_size_, other->window_size_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string DownloadRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.DownloadRequest";
+}
+
+
+// ===================================================================
+
+void PacketRequest::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int PacketRequest::kDummyFieldNumber;
+const int PacketRequest::kSizeFieldNumber;
+const int PacketRequest::kCompressionFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+PacketRequest::PacketRequest()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_PacketRequest.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.PacketRequest)
+}
+PacketRequest::PacketRequest(const PacketRequest& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&dummy_, &from.dummy_,
+    static_cast<size_t>(reinterpret_cast<char*>(&compression_) -
+    reinterpret_cast<char*>(&dummy_)) + sizeof(compression_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.PacketRequest)
+}
+
+void PacketRequest::SharedCtor() {
+  ::memset(&dummy_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&compression_) -
+      reinterpret_cast<char*>(&dummy_)) + sizeof(compression_));
+}
+
+PacketRequest::~PacketRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.PacketRequest)
+  SharedDtor();
+}
+
+void PacketRequest::SharedDtor() {
+}
+
+void PacketRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const PacketRequest& PacketRequest::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_PacketRequest.base);
+  return *internal_default_instance();
+}
+
+
+void PacketRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.PacketRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&dummy_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&compression_) -
+      reinterpret_cast<char*>(&dummy_)) + sizeof(compression_));
+  _internal_metadata_.Clear();
+}
+
+bool PacketRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.PacketRequest)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint32 dummy = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &dummy_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 size = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.Compression compression = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_compression(static_cast< ::aspia::proto::file_transfer::Compression >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.PacketRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.PacketRequest)
+  return false;
+#undef DO_
+}
+
+void PacketRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.PacketRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 dummy = 1;
+  if (this->dummy() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->dummy(), output);
+  }
+
+  // uint32 size = 2;
+  if (this->size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->size(), output);
+  }
+
+  // .aspia.proto.file_transfer.Compression compression = 3;
+  if (this->compression() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      3, this->compression(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.PacketRequest)
+}
+
+size_t PacketRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.PacketRequest)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // uint32 dummy = 1;
+  if (this->dummy() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->dummy());
+  }
+
+  // uint32 size = 2;
+  if (this->size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->size());
+  }
+
+  // .aspia.proto.file_transfer.Compression compression = 3;
+  if (this->compression() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->compression());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PacketRequest::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const PacketRequest*>(&from));
+}
+
+void PacketRequest::MergeFrom(const PacketRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.PacketRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.dummy() != 0) {
+    set_dummy(from.dummy());
+  }
+  if (from.size() != 0) {
+    set_size(from.size());
+  }
+  if (from.compression() != 0) {
+    set_compression(from.compression());
+  }
+}
+
+void PacketRequest::CopyFrom(const PacketRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.PacketRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PacketRequest::IsInitialized() const {
+  return true;
+}
+
+void PacketRequest::Swap(PacketRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void PacketRequest::InternalSwap(PacketRequest* other) {
+  using std::swap;
+  swap(dummy_, other->dummy_);
+  swap(size_, other->size_);
+  swap(compression_, other->compression_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string PacketRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.PacketRequest";
+}
+
+
+// ===================================================================
+
+void DeltaOperation::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int DeltaOperation::kLiteralSizeFieldNumber;
+const int DeltaOperation::kBlockIndexFieldNumber;
+const int DeltaOperation::kBlockCountFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+DeltaOperation::DeltaOperation()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DeltaOperation.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.DeltaOperation)
+}
+DeltaOperation::DeltaOperation(const DeltaOperation& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&literal_size_, &from.literal_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&block_count_) -
+    reinterpret_cast<char*>(&literal_size_)) + sizeof(block_count_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.DeltaOperation)
+}
+
+void DeltaOperation::SharedCtor() {
+  ::memset(&literal_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&block_count_) -
+      reinterpret_cast<char*>(&literal_size_)) + sizeof(block_count_));
+}
+
+DeltaOperation::~DeltaOperation() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.DeltaOperation)
+  SharedDtor();
+}
+
+void DeltaOperation::SharedDtor() {
+}
+
+void DeltaOperation::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const DeltaOperation& DeltaOperation::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DeltaOperation.base);
+  return *internal_default_instance();
+}
+
+
+void DeltaOperation::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.DeltaOperation)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&literal_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&block_count_) -
+      reinterpret_cast<char*>(&literal_size_)) + sizeof(block_count_));
+  _internal_metadata_.Clear();
+}
+
+bool DeltaOperation::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.DeltaOperation)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint32 literal_size = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &literal_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 block_index = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &block_index_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 block_count = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &block_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.DeltaOperation)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.DeltaOperation)
+  return false;
+#undef DO_
+}
+
+void DeltaOperation::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.DeltaOperation)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 literal_size = 1;
+  if (this->literal_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->literal_size(), output);
+  }
+
+  // uint32 block_index = 2;
+  if (this->block_index() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->block_index(), output);
+  }
+
+  // uint32 block_count = 3;
+  if (this->block_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->block_count(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.DeltaOperation)
+}
+
+size_t DeltaOperation::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.DeltaOperation)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // uint32 literal_size = 1;
+  if (this->literal_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->literal_size());
+  }
+
+  // uint32 block_index = 2;
+  if (this->block_index() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->block_index());
+  }
+
+  // uint32 block_count = 3;
+  if (this->block_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->block_count());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void DeltaOperation::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const DeltaOperation*>(&from));
+}
+
+void DeltaOperation::MergeFrom(const DeltaOperation& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.DeltaOperation)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.literal_size() != 0) {
+    set_literal_size(from.literal_size());
+  }
+  if (from.block_index() != 0) {
+    set_block_index(from.block_index());
+  }
+  if (from.block_count() != 0) {
+    set_block_count(from.block_count());
+  }
+}
+
+void DeltaOperation::CopyFrom(const DeltaOperation& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.DeltaOperation)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeltaOperation::IsInitialized() const {
+  return true;
+}
+
+void DeltaOperation::Swap(DeltaOperation* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void DeltaOperation::InternalSwap(DeltaOperation* other) {
+  using std::swap;
+  swap(literal_size_, other->literal_size_);
+  swap(block_index_, other->block_index_);
+  swap(block_count_, other->block_count_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string DeltaOperation::GetTypeName() const {
+  return "aspia.proto.file_transfer.DeltaOperation";
+}
+
+
+// ===================================================================
+
+void Packet::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Packet::kFlagsFieldNumber;
+const int Packet::kFileSizeFieldNumber;
+const int Packet::kDataFieldNumber;
+const int Packet::kCompressionFieldNumber;
+const int Packet::kUncompressedSizeFieldNumber;
+const int Packet::kOperationFieldNumber;
+const int Packet::kDeltaSizeFieldNumber;
+const int Packet::kDigestFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Packet::Packet()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.Packet)
+}
+Packet::Packet(const Packet& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      operation_(from.operation_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.data().size() > 0) {
+    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  }
+  digest_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.digest().size() > 0) {
+    digest_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.digest_);
+  }
+  ::memcpy(&file_size_, &from.file_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&delta_size_) -
+    reinterpret_cast<char*>(&file_size_)) + sizeof(delta_size_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.Packet)
+}
+
+void Packet::SharedCtor() {
+  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  digest_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&file_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&delta_size_) -
+      reinterpret_cast<char*>(&file_size_)) + sizeof(delta_size_));
+}
+
+Packet::~Packet() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.Packet)
+  SharedDtor();
+}
+
+void Packet::SharedDtor() {
+  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  digest_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void Packet::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Packet& Packet::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base);
+  return *internal_default_instance();
+}
+
+
+void Packet::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.Packet)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  operation_.Clear();
+  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  digest_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&file_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&delta_size_) -
+      reinterpret_cast<char*>(&file_size_)) + sizeof(delta_size_));
+  _internal_metadata_.Clear();
+}
+
+bool Packet::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.Packet)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint32 flags = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &flags_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 file_size = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &file_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes data = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.Compression compression = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_compression(static_cast< ::aspia::proto::file_transfer::Compression >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 uncompressed_size = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &uncompressed_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .aspia.proto.file_transfer.DeltaOperation operation = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+                input, add_operation()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 delta_size = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &delta_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes digest = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(66u /* 66 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_digest()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.Packet)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.Packet)
+  return false;
+#undef DO_
+}
+
+void Packet::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.Packet)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 flags = 1;
+  if (this->flags() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->flags(), output);
+  }
+
+  // uint64 file_size = 2;
+  if (this->file_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->file_size(), output);
+  }
+
+  // bytes data = 3;
+  if (this->data().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      3, this->data(), output);
+  }
+
+  // .aspia.proto.file_transfer.Compression compression = 4;
+  if (this->compression() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      4, this->compression(), output);
+  }
+
+  // uint32 uncompressed_size = 5;
+  if (this->uncompressed_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->uncompressed_size(), output);
+  }
+
+  // repeated .aspia.proto.file_transfer.DeltaOperation operation = 6;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->operation_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      6,
+      this->operation(static_cast<int>(i)),
+      output);
+  }
+
+  // uint32 delta_size = 7;
+  if (this->delta_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(7, this->delta_size(), output);
+  }
+
+  // bytes digest = 8;
+  if (this->digest().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      8, this->digest(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.Packet)
+}
+
+size_t Packet::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.Packet)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // repeated .aspia.proto.file_transfer.DeltaOperation operation = 6;
+  {
+    unsigned int count = static_cast<unsigned int>(this->operation_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->operation(static_cast<int>(i)));
+    }
+  }
+
+  // bytes data = 3;
+  if (this->data().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->data());
+  }
+
+  // bytes digest = 8;
+  if (this->digest().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->digest());
+  }
+
+  // uint64 file_size = 2;
+  if (this->file_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->file_size());
+  }
+
+  // uint32 flags = 1;
+  if (this->flags() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->flags());
+  }
+
+  // .aspia.proto.file_transfer.Compression compression = 4;
+  if (this->compression() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->compression());
+  }
+
+  // uint32 uncompressed_size = 5;
+  if (this->uncompressed_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->uncompressed_size());
+  }
+
+  // uint32 delta_size = 7;
+  if (this->delta_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->delta_size());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Packet::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const Packet*>(&from));
+}
+
+void Packet::MergeFrom(const Packet& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.Packet)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  operation_.MergeFrom(from.operation_);
+  if (from.data().size() > 0) {
+
+    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  }
+  if (from.digest().size() > 0) {
+
+    digest_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.digest_);
+  }
+  if (from.file_size() != 0) {
+    set_file_size(from.file_size());
+  }
+  if (from.flags() != 0) {
+    set_flags(from.flags());
+  }
+  if (from.compression() != 0) {
+    set_compression(from.compression());
+  }
+  if (from.uncompressed_size() != 0) {
+    set_uncompressed_size(from.uncompressed_size());
+  }
+  if (from.delta_size() != 0) {
+    set_delta_size(from.delta_size());
+  }
+}
+
+void Packet::CopyFrom(const Packet& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.Packet)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Packet::IsInitialized() const {
+  return true;
+}
+
+void Packet::Swap(Packet* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Packet::InternalSwap(Packet* other) {
+  using std::swap;
+  CastToBase(&operation_)->InternalSwap(CastToBase(&other->operation_));
+  data_.Swap(&other->data_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  digest_.Swap(&other->digest_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(file_size_, other->file_size_);
+  swap(flags_, other->flags_);
+  swap(compression_, other->compression_);
+  swap(uncompressed_size_, other->uncompressed_size_);
+  swap(delta_size_, other->delta_size_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string Packet::GetTypeName() const {
+  return "aspia.proto.file_transfer.Packet";
+}
+
+
+// ===================================================================
+
+void CreateDirectoryRequest::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int CreateDirectoryRequest::kPathFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+CreateDirectoryRequest::CreateDirectoryRequest()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CreateDirectoryRequest.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.CreateDirectoryRequest)
+}
+CreateDirectoryRequest::CreateDirectoryRequest(const CreateDirectoryRequest& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.path().size() > 0) {
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.CreateDirectoryRequest)
+}
+
+void CreateDirectoryRequest::SharedCtor() {
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+CreateDirectoryRequest::~CreateDirectoryRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.CreateDirectoryRequest)
+  SharedDtor();
+}
+
+void CreateDirectoryRequest::SharedDtor() {
+  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void CreateDirectoryRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const CreateDirectoryRequest& CreateDirectoryRequest::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CreateDirectoryRequest.base);
+  return *internal_default_instance();
+}
+
+
+void CreateDirectoryRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _internal_metadata_.Clear();
+}
+
+bool CreateDirectoryRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string path = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->path().data(), static_cast<int>(this->path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.CreateDirectoryRequest.path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.CreateDirectoryRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.CreateDirectoryRequest)
+  return false;
+#undef DO_
+}
+
+void CreateDirectoryRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->path().data(), static_cast<int>(this->path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.CreateDirectoryRequest.path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->path(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.CreateDirectoryRequest)
+}
+
+size_t CreateDirectoryRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->path());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void CreateDirectoryRequest::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const CreateDirectoryRequest*>(&from));
+}
+
+void CreateDirectoryRequest::MergeFrom(const CreateDirectoryRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.path().size() > 0) {
+
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+}
+
+void CreateDirectoryRequest::CopyFrom(const CreateDirectoryRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CreateDirectoryRequest::IsInitialized() const {
+  return true;
+}
+
+void CreateDirectoryRequest::Swap(CreateDirectoryRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void CreateDirectoryRequest::InternalSwap(CreateDirectoryRequest* other) {
+  using std::swap;
+  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string CreateDirectoryRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.CreateDirectoryRequest";
+}
+
+
+// ===================================================================
+
+void RenameRequest::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int RenameRequest::kOldNameFieldNumber;
+const int RenameRequest::kNewNameFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+RenameRequest::RenameRequest()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RenameRequest.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.RenameRequest)
+}
+RenameRequest::RenameRequest(const RenameRequest& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  old_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.old_name().size() > 0) {
+    old_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.old_name_);
+  }
+  new_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.new_name().size() > 0) {
+    new_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.new_name_);
+  }
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.RenameRequest)
+}
+
+void RenameRequest::SharedCtor() {
+  old_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  new_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+RenameRequest::~RenameRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.RenameRequest)
+  SharedDtor();
+}
+
+void RenameRequest::SharedDtor() {
+  old_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  new_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void RenameRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const RenameRequest& RenameRequest::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RenameRequest.base);
+  return *internal_default_instance();
+}
+
+
+void RenameRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.RenameRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  old_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  new_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _internal_metadata_.Clear();
+}
+
+bool RenameRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.RenameRequest)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string old_name = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_old_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->old_name().data(), static_cast<int>(this->old_name().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.RenameRequest.old_name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string new_name = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_new_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->new_name().data(), static_cast<int>(this->new_name().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.RenameRequest.new_name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.RenameRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.RenameRequest)
+  return false;
+#undef DO_
+}
+
+void RenameRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.RenameRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string old_name = 1;
+  if (this->old_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->old_name().data(), static_cast<int>(this->old_name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.RenameRequest.old_name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->old_name(), output);
+  }
+
+  // string new_name = 2;
+  if (this->new_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->new_name().data(), static_cast<int>(this->new_name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.RenameRequest.new_name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->new_name(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.RenameRequest)
+}
+
+size_t RenameRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.RenameRequest)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // string old_name = 1;
+  if (this->old_name().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->old_name());
+  }
+
+  // string new_name = 2;
+  if (this->new_name().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->new_name());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RenameRequest::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const RenameRequest*>(&from));
+}
+
+void RenameRequest::MergeFrom(const RenameRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.RenameRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.old_name().size() > 0) {
+
+    old_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.old_name_);
+  }
+  if (from.new_name().size() > 0) {
+
+    new_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.new_name_);
+  }
+}
+
+void RenameRequest::CopyFrom(const RenameRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.RenameRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RenameRequest::IsInitialized() const {
+  return true;
+}
+
+void RenameRequest::Swap(RenameRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void RenameRequest::InternalSwap(RenameRequest* other) {
+  using std::swap;
+  old_name_.Swap(&other->old_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  new_name_.Swap(&other->new_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+}
+
+::std::string RenameRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.RenameRequest";
+}
+
+
+// ===================================================================
+
+void RemoveRequest::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int RemoveRequest::kPathFieldNumber;
+const int RemoveRequest::kRecursiveFieldNumber;
+const int RemoveRequest::kContinuationFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+RemoveRequest::RemoveRequest()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  ::google::protobuf::internal::InitSCC(
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveRequest.base);
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.RemoveRequest)
+}
+RemoveRequest::RemoveRequest(const RemoveRequest& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.path().size() > 0) {
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  ::memcpy(&continuation_, &from.continuation_,
+    static_cast<size_t>(reinterpret_cast<char*>(&recursive_) -
+    reinterpret_cast<char*>(&continuation_)) + sizeof(recursive_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.RemoveRequest)
+}
+
+void RemoveRequest::SharedCtor() {
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&continuation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&recursive_) -
+      reinterpret_cast<char*>(&continuation_)) + sizeof(recursive_));
+}
+
+RemoveRequest::~RemoveRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.RemoveRequest)
+  SharedDtor();
+}
+
+void RemoveRequest::SharedDtor() {
+  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void RemoveRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const RemoveRequest& RemoveRequest::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveRequest.base);
+  return *internal_default_instance();
+}
+
+
+void RemoveRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.RemoveRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&continuation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&recursive_) -
+      reinterpret_cast<char*>(&continuation_)) + sizeof(recursive_));
+  _internal_metadata_.Clear();
+}
+
+bool RemoveRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
+      &_internal_metadata_);
+  ::google::protobuf::io::StringOutputStream unknown_fields_output(
+      unknown_fields_setter.buffer());
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_output, false);
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.RemoveRequest)
+  for (;;) {
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string path = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->path().data(), static_cast<int>(this->path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.RemoveRequest.path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool recursive = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &recursive_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 continuation = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &continuation_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.RemoveRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.RemoveRequest)
+  return false;
+#undef DO_
+}
+
+void RemoveRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.RemoveRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->path().data(), static_cast<int>(this->path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.RemoveRequest.path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->path(), output);
+  }
+
+  // bool recursive = 2;
+  if (this->recursive() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->recursive(), output);
+  }
+
+  // uint64 continuation = 3;
+  if (this->continuation() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->continuation(), output);
+  }
+
+  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
+                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.RemoveRequest)
+}
+
+size_t RemoveRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.RemoveRequest)
+  size_t total_size = 0;
+
+  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->path());
+  }
+
+  // uint64 continuation = 3;
+  if (this->continuation() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->continuation());
+  }
+
+  // bool recursive = 2;
+  if (this->recursive() != 0) {
+    total_size += 1 + 1;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RemoveRequest::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const RemoveRequest*>(&from));
+}
+
+void RemoveRequest::MergeFrom(const RemoveRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.RemoveRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.path().size() > 0) {
+
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  if (from.continuation() != 0) {
+    set_continuation(from.continuation());
+  }
+  if (from.recursive() != 0) {
+    set_recursive(from.recursive());
+  }
+}
+
+void RemoveRequest::CopyFrom(const RemoveRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.RemoveRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RemoveRequest::IsInitialized() const {
+  return true;
+}
+
+void RemoveRequest::Swap(RemoveRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void RemoveRequest::InternalSwap(RemoveRequest* other) {
+  using std::swap;
+  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
     GetArenaNoVirtual());
+  swap(continuation_, other->continuation_);
+  swap(recursive_, other->recursive_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
-::std::string DownloadRequest::GetTypeName() const {
-  return "aspia.proto.file_transfer.DownloadRequest";
+::std::string RemoveRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.RemoveRequest";
 }
 
 
 // ===================================================================
 
-void PacketRequest::InitAsDefaultInstance() {
+void RemoveProgress_Failure::InitAsDefaultInstance() {
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PacketRequest::kDummyFieldNumber;
+const int RemoveProgress_Failure::kPathFieldNumber;
+const int RemoveProgress_Failure::kStatusFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-PacketRequest::PacketRequest()
+RemoveProgress_Failure::RemoveProgress_Failure()
   : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
   ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_PacketRequest.base);
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveProgress_Failure.base);
   SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.PacketRequest)
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.RemoveProgress.Failure)
 }
-PacketRequest::PacketRequest(const PacketRequest& from)
+RemoveProgress_Failure::RemoveProgress_Failure(const RemoveProgress_Failure& from)
   : ::google::protobuf::MessageLite(),
       _internal_metadata_(NULL) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  dummy_ = from.dummy_;
-  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.PacketRequest)
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.path().size() > 0) {
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  status_ = from.status_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.RemoveProgress.Failure)
 }
 
-void PacketRequest::SharedCtor() {
-  dummy_ = 0u;
+void RemoveProgress_Failure::SharedCtor() {
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  status_ = 0;
 }
 
-PacketRequest::~PacketRequest() {
-  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.PacketRequest)
+RemoveProgress_Failure::~RemoveProgress_Failure() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.RemoveProgress.Failure)
   SharedDtor();
 }
 
-void PacketRequest::SharedDtor() {
+void RemoveProgress_Failure::SharedDtor() {
+  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
-void PacketRequest::SetCachedSize(int size) const {
+void RemoveProgress_Failure::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const PacketRequest& PacketRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_PacketRequest.base);
+const RemoveProgress_Failure& RemoveProgress_Failure::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveProgress_Failure.base);
   return *internal_default_instance();
 }
 
 
-void PacketRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.PacketRequest)
+void RemoveProgress_Failure::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.RemoveProgress.Failure)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  dummy_ = 0u;
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  status_ = 0;
   _internal_metadata_.Clear();
 }
 
-bool PacketRequest::MergePartialFromCodedStream(
+bool RemoveProgress_Failure::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
@@ -2182,20 +6283,37 @@ bool PacketRequest::MergePartialFromCodedStream(
       unknown_fields_setter.buffer());
   ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
       &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.PacketRequest)
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.RemoveProgress.Failure)
   for (;;) {
     ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint32 dummy = 1;
+      // string path = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->path().data(), static_cast<int>(this->path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.RemoveProgress.Failure.path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
 
+      // .aspia.proto.file_transfer.Status status = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          int value;
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &dummy_)));
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_status(static_cast< ::aspia::proto::file_transfer::Status >(value));
         } else {
           goto handle_unusual;
         }
@@ -2214,41 +6332,58 @@ bool PacketRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.PacketRequest)
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.RemoveProgress.Failure)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.PacketRequest)
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.RemoveProgress.Failure)
   return false;
 #undef DO_
 }
 
-void PacketRequest::SerializeWithCachedSizes(
+void RemoveProgress_Failure::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.PacketRequest)
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.RemoveProgress.Failure)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 dummy = 1;
-  if (this->dummy() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->dummy(), output);
+  // string path = 1;
+  if (this->path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->path().data(), static_cast<int>(this->path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.RemoveProgress.Failure.path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->path(), output);
+  }
+
+  // .aspia.proto.file_transfer.Status status = 2;
+  if (this->status() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->status(), output);
   }
 
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.PacketRequest)
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.RemoveProgress.Failure)
 }
 
-size_t PacketRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.PacketRequest)
+size_t RemoveProgress_Failure::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.RemoveProgress.Failure)
   size_t total_size = 0;
 
   total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
 
-  // uint32 dummy = 1;
-  if (this->dummy() != 0) {
+  // string path = 1;
+  if (this->path().size() > 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->dummy());
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->path());
+  }
+
+  // .aspia.proto.file_transfer.Status status = 2;
+  if (this->status() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->status());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -2256,119 +6391,129 @@ size_t PacketRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void PacketRequest::CheckTypeAndMergeFrom(
+void RemoveProgress_Failure::CheckTypeAndMergeFrom(
     const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const PacketRequest*>(&from));
+  MergeFrom(*::google::protobuf::down_cast<const RemoveProgress_Failure*>(&from));
 }
 
-void PacketRequest::MergeFrom(const PacketRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.PacketRequest)
+void RemoveProgress_Failure::MergeFrom(const RemoveProgress_Failure& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.RemoveProgress.Failure)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.dummy() != 0) {
-    set_dummy(from.dummy());
+  if (from.path().size() > 0) {
+
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  if (from.status() != 0) {
+    set_status(from.status());
   }
 }
 
-void PacketRequest::CopyFrom(const PacketRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.PacketRequest)
+void RemoveProgress_Failure::CopyFrom(const RemoveProgress_Failure& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.RemoveProgress.Failure)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PacketRequest::IsInitialized() const {
+bool RemoveProgress_Failure::IsInitialized() const {
   return true;
 }
 
-void PacketRequest::Swap(PacketRequest* other) {
+void RemoveProgress_Failure::Swap(RemoveProgress_Failure* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void PacketRequest::InternalSwap(PacketRequest* other) {
+void RemoveProgress_Failure::InternalSwap(RemoveProgress_Failure* other) {
   using std::swap;
-  swap(dummy_, other->dummy_);
+  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(status_, other->status_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
-::std::string PacketRequest::GetTypeName() const {
-  return "aspia.proto.file_transfer.PacketRequest";
+::std::string RemoveProgress_Failure::GetTypeName() const {
+  return "aspia.proto.file_transfer.RemoveProgress.Failure";
 }
 
 
 // ===================================================================
 
-void Packet::InitAsDefaultInstance() {
+void RemoveProgress::InitAsDefaultInstance() {
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Packet::kFlagsFieldNumber;
-const int Packet::kFileSizeFieldNumber;
-const int Packet::kDataFieldNumber;
+const int RemoveProgress::kTotalFieldNumber;
+const int RemoveProgress::kProcessedFieldNumber;
+const int RemoveProgress::kCurrentPathFieldNumber;
+const int RemoveProgress::kFailureFieldNumber;
+const int RemoveProgress::kContinuationFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-Packet::Packet()
+RemoveProgress::RemoveProgress()
   : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
   ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base);
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveProgress.base);
   SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.Packet)
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.RemoveProgress)
 }
-Packet::Packet(const Packet& from)
+RemoveProgress::RemoveProgress(const RemoveProgress& from)
   : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
+      _internal_metadata_(NULL),
+      failure_(from.failure_) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  current_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.current_path().size() > 0) {
+    current_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.current_path_);
   }
-  ::memcpy(&file_size_, &from.file_size_,
-    static_cast<size_t>(reinterpret_cast<char*>(&flags_) -
-    reinterpret_cast<char*>(&file_size_)) + sizeof(flags_));
-  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.Packet)
+  ::memcpy(&total_, &from.total_,
+    static_cast<size_t>(reinterpret_cast<char*>(&continuation_) -
+    reinterpret_cast<char*>(&total_)) + sizeof(continuation_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.RemoveProgress)
 }
 
-void Packet::SharedCtor() {
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&file_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&flags_) -
-      reinterpret_cast<char*>(&file_size_)) + sizeof(flags_));
+void RemoveProgress::SharedCtor() {
+  current_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&total_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&continuation_) -
+      reinterpret_cast<char*>(&total_)) + sizeof(continuation_));
 }
 
-Packet::~Packet() {
-  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.Packet)
+RemoveProgress::~RemoveProgress() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.RemoveProgress)
   SharedDtor();
 }
 
-void Packet::SharedDtor() {
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void RemoveProgress::SharedDtor() {
+  current_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
-void Packet::SetCachedSize(int size) const {
+void RemoveProgress::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const Packet& Packet::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base);
+const RemoveProgress& RemoveProgress::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveProgress.base);
   return *internal_default_instance();
 }
 
 
-void Packet::Clear() {
-// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.Packet)
+void RemoveProgress::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.RemoveProgress)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&file_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&flags_) -
-      reinterpret_cast<char*>(&file_size_)) + sizeof(flags_));
+  failure_.Clear();
+  current_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&total_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&continuation_) -
+      reinterpret_cast<char*>(&total_)) + sizeof(continuation_));
   _internal_metadata_.Clear();
 }
 
-bool Packet::MergePartialFromCodedStream(
+bool RemoveProgress::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
@@ -2378,46 +6523,76 @@ bool Packet::MergePartialFromCodedStream(
       unknown_fields_setter.buffer());
   ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
       &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.Packet)
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.RemoveProgress)
   for (;;) {
     ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint32 flags = 1;
+      // uint32 total = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &flags_)));
+                 input, &total_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint64 file_size = 2;
+      // uint32 processed = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &file_size_)));
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &processed_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // bytes data = 3;
+      // string current_path = 3;
       case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_current_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->current_path().data(), static_cast<int>(this->current_path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.RemoveProgress.current_path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .aspia.proto.file_transfer.RemoveProgress.Failure failure = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+                input, add_failure()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 continuation = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &continuation_)));
         } else {
           goto handle_unusual;
         }
@@ -2436,66 +6611,102 @@ bool Packet::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.Packet)
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.RemoveProgress)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.Packet)
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.RemoveProgress)
   return false;
 #undef DO_
 }
 
-void Packet::SerializeWithCachedSizes(
+void RemoveProgress::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.Packet)
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.RemoveProgress)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 flags = 1;
-  if (this->flags() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->flags(), output);
+  // uint32 total = 1;
+  if (this->total() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->total(), output);
   }
 
-  // uint64 file_size = 2;
-  if (this->file_size() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->file_size(), output);
+  // uint32 processed = 2;
+  if (this->processed() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->processed(), output);
   }
 
-  // bytes data = 3;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->data(), output);
+  // string current_path = 3;
+  if (this->current_path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->current_path().data(), static_cast<int>(this->current_path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.RemoveProgress.current_path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->current_path(), output);
+  }
+
+  // repeated .aspia.proto.file_transfer.RemoveProgress.Failure failure = 4;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->failure_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      4,
+      this->failure(static_cast<int>(i)),
+      output);
+  }
+
+  // uint64 continuation = 5;
+  if (this->continuation() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->continuation(), output);
   }
 
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.Packet)
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.RemoveProgress)
 }
 
-size_t Packet::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.Packet)
+size_t RemoveProgress::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.RemoveProgress)
   size_t total_size = 0;
 
   total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
 
-  // bytes data = 3;
-  if (this->data().size() > 0) {
+  // repeated .aspia.proto.file_transfer.RemoveProgress.Failure failure = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->failure_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->failure(static_cast<int>(i)));
+    }
+  }
+
+  // string current_path = 3;
+  if (this->current_path().size() > 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->current_path());
   }
 
-  // uint64 file_size = 2;
-  if (this->file_size() != 0) {
+  // uint32 total = 1;
+  if (this->total() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->file_size());
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->total());
   }
 
-  // uint32 flags = 1;
-  if (this->flags() != 0) {
+  // uint32 processed = 2;
+  if (this->processed() != 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->flags());
+        this->processed());
+  }
+
+  // uint64 continuation = 5;
+  if (this->continuation() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->continuation());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -2503,118 +6714,136 @@ size_t Packet::ByteSizeLong() const {
   return total_size;
 }
 
-void Packet::CheckTypeAndMergeFrom(
+void RemoveProgress::CheckTypeAndMergeFrom(
     const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Packet*>(&from));
+  MergeFrom(*::google::protobuf::down_cast<const RemoveProgress*>(&from));
 }
 
-void Packet::MergeFrom(const Packet& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.Packet)
+void RemoveProgress::MergeFrom(const RemoveProgress& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.RemoveProgress)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.data().size() > 0) {
+  failure_.MergeFrom(from.failure_);
+  if (from.current_path().size() > 0) {
 
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+    current_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.current_path_);
   }
-  if (from.file_size() != 0) {
-    set_file_size(from.file_size());
+  if (from.total() != 0) {
+    set_total(from.total());
   }
-  if (from.flags() != 0) {
-    set_flags(from.flags());
+  if (from.processed() != 0) {
+    set_processed(from.processed());
+  }
+  if (from.continuation() != 0) {
+    set_continuation(from.continuation());
   }
 }
 
-void Packet::CopyFrom(const Packet& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.Packet)
+void RemoveProgress::CopyFrom(const RemoveProgress& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.RemoveProgress)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Packet::IsInitialized() const {
+bool RemoveProgress::IsInitialized() const {
   return true;
 }
 
-void Packet::Swap(Packet* other) {
+void RemoveProgress::Swap(RemoveProgress* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void Packet::InternalSwap(Packet* other) {
+void RemoveProgress::InternalSwap(RemoveProgress* other) {
   using std::swap;
-  data_.Swap(&other->data_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  CastToBase(&failure_)->InternalSwap(CastToBase(&other->failure_));
+  current_path_.Swap(&other->current_path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
     GetArenaNoVirtual());
-  swap(file_size_, other->file_size_);
-  swap(flags_, other->flags_);
+  swap(total_, other->total_);
+  swap(processed_, other->processed_);
+  swap(continuation_, other->continuation_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
-::std::string Packet::GetTypeName() const {
-  return "aspia.proto.file_transfer.Packet";
+::std::string RemoveProgress::GetTypeName() const {
+  return "aspia.proto.file_transfer.RemoveProgress";
 }
 
 
 // ===================================================================
 
-void CreateDirectoryRequest::InitAsDefaultInstance() {
+void CopyRequest::InitAsDefaultInstance() {
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CreateDirectoryRequest::kPathFieldNumber;
+const int CopyRequest::kSourcePathFieldNumber;
+const int CopyRequest::kTargetPathFieldNumber;
+const int CopyRequest::kContinuationFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-CreateDirectoryRequest::CreateDirectoryRequest()
+CopyRequest::CopyRequest()
   : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
   ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CreateDirectoryRequest.base);
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CopyRequest.base);
   SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.CreateDirectoryRequest)
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.CopyRequest)
 }
-CreateDirectoryRequest::CreateDirectoryRequest(const CreateDirectoryRequest& from)
+CopyRequest::CopyRequest(const CopyRequest& from)
   : ::google::protobuf::MessageLite(),
       _internal_metadata_(NULL) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  source_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.source_path().size() > 0) {
+    source_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.source_path_);
   }
-  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.CreateDirectoryRequest)
+  target_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.target_path().size() > 0) {
+    target_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.target_path_);
+  }
+  continuation_ = from.continuation_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.CopyRequest)
 }
 
-void CreateDirectoryRequest::SharedCtor() {
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void CopyRequest::SharedCtor() {
+  source_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  target_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  continuation_ = GOOGLE_ULONGLONG(0);
 }
 
-CreateDirectoryRequest::~CreateDirectoryRequest() {
-  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.CreateDirectoryRequest)
+CopyRequest::~CopyRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.CopyRequest)
   SharedDtor();
 }
 
-void CreateDirectoryRequest::SharedDtor() {
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void CopyRequest::SharedDtor() {
+  source_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  target_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
-void CreateDirectoryRequest::SetCachedSize(int size) const {
+void CopyRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const CreateDirectoryRequest& CreateDirectoryRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CreateDirectoryRequest.base);
+const CopyRequest& CopyRequest::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CopyRequest.base);
   return *internal_default_instance();
 }
 
 
-void CreateDirectoryRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+void CopyRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.CopyRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  source_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  target_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  continuation_ = GOOGLE_ULONGLONG(0);
   _internal_metadata_.Clear();
 }
 
-bool CreateDirectoryRequest::MergePartialFromCodedStream(
+bool CopyRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
@@ -2624,22 +6853,52 @@ bool CreateDirectoryRequest::MergePartialFromCodedStream(
       unknown_fields_setter.buffer());
   ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
       &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.CopyRequest)
   for (;;) {
     ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string path = 1;
+      // string source_path = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
+                input, this->mutable_source_path()));
           DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), static_cast<int>(this->path().length()),
+            this->source_path().data(), static_cast<int>(this->source_path().length()),
             ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.CreateDirectoryRequest.path"));
+            "aspia.proto.file_transfer.CopyRequest.source_path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string target_path = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_target_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->target_path().data(), static_cast<int>(this->target_path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "aspia.proto.file_transfer.CopyRequest.target_path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 continuation = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &continuation_)));
         } else {
           goto handle_unusual;
         }
@@ -2658,46 +6917,75 @@ bool CreateDirectoryRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.CreateDirectoryRequest)
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.CopyRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.CreateDirectoryRequest)
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.CopyRequest)
   return false;
 #undef DO_
 }
 
-void CreateDirectoryRequest::SerializeWithCachedSizes(
+void CopyRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.CopyRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string path = 1;
-  if (this->path().size() > 0) {
+  // string source_path = 1;
+  if (this->source_path().size() > 0) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
+      this->source_path().data(), static_cast<int>(this->source_path().length()),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "aspia.proto.file_transfer.CreateDirectoryRequest.path");
+      "aspia.proto.file_transfer.CopyRequest.source_path");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->path(), output);
+      1, this->source_path(), output);
+  }
+
+  // string target_path = 2;
+  if (this->target_path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->target_path().data(), static_cast<int>(this->target_path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.CopyRequest.target_path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->target_path(), output);
+  }
+
+  // uint64 continuation = 3;
+  if (this->continuation() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->continuation(), output);
   }
 
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.CreateDirectoryRequest)
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.CopyRequest)
 }
 
-size_t CreateDirectoryRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+size_t CopyRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.CopyRequest)
   size_t total_size = 0;
 
   total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
 
-  // string path = 1;
-  if (this->path().size() > 0) {
+  // string source_path = 1;
+  if (this->source_path().size() > 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->path());
+        this->source_path());
+  }
+
+  // string target_path = 2;
+  if (this->target_path().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->target_path());
+  }
+
+  // uint64 continuation = 3;
+  if (this->continuation() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->continuation());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -2705,118 +6993,132 @@ size_t CreateDirectoryRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void CreateDirectoryRequest::CheckTypeAndMergeFrom(
+void CopyRequest::CheckTypeAndMergeFrom(
     const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const CreateDirectoryRequest*>(&from));
+  MergeFrom(*::google::protobuf::down_cast<const CopyRequest*>(&from));
 }
 
-void CreateDirectoryRequest::MergeFrom(const CreateDirectoryRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+void CopyRequest::MergeFrom(const CopyRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.CopyRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.path().size() > 0) {
+  if (from.source_path().size() > 0) {
 
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+    source_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.source_path_);
+  }
+  if (from.target_path().size() > 0) {
+
+    target_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.target_path_);
+  }
+  if (from.continuation() != 0) {
+    set_continuation(from.continuation());
   }
 }
 
-void CreateDirectoryRequest::CopyFrom(const CreateDirectoryRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+void CopyRequest::CopyFrom(const CopyRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.CopyRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CreateDirectoryRequest::IsInitialized() const {
+bool CopyRequest::IsInitialized() const {
   return true;
 }
 
-void CreateDirectoryRequest::Swap(CreateDirectoryRequest* other) {
+void CopyRequest::Swap(CopyRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void CreateDirectoryRequest::InternalSwap(CreateDirectoryRequest* other) {
+void CopyRequest::InternalSwap(CopyRequest* other) {
   using std::swap;
-  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  source_path_.Swap(&other->source_path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  target_path_.Swap(&other->target_path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
     GetArenaNoVirtual());
+  swap(continuation_, other->continuation_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
-::std::string CreateDirectoryRequest::GetTypeName() const {
-  return "aspia.proto.file_transfer.CreateDirectoryRequest";
+::std::string CopyRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.CopyRequest";
 }
 
 
 // ===================================================================
 
-void RenameRequest::InitAsDefaultInstance() {
+void MoveRequest::InitAsDefaultInstance() {
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RenameRequest::kOldNameFieldNumber;
-const int RenameRequest::kNewNameFieldNumber;
+const int MoveRequest::kSourcePathFieldNumber;
+const int MoveRequest::kTargetPathFieldNumber;
+const int MoveRequest::kContinuationFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-RenameRequest::RenameRequest()
+MoveRequest::MoveRequest()
   : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
   ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RenameRequest.base);
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_MoveRequest.base);
   SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.RenameRequest)
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.MoveRequest)
 }
-RenameRequest::RenameRequest(const RenameRequest& from)
+MoveRequest::MoveRequest(const MoveRequest& from)
   : ::google::protobuf::MessageLite(),
       _internal_metadata_(NULL) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  old_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.old_name().size() > 0) {
-    old_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.old_name_);
+  source_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.source_path().size() > 0) {
+    source_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.source_path_);
   }
-  new_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.new_name().size() > 0) {
-    new_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.new_name_);
+  target_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.target_path().size() > 0) {
+    target_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.target_path_);
   }
-  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.RenameRequest)
+  continuation_ = from.continuation_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.MoveRequest)
 }
 
-void RenameRequest::SharedCtor() {
-  old_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  new_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void MoveRequest::SharedCtor() {
+  source_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  target_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  continuation_ = GOOGLE_ULONGLONG(0);
 }
 
-RenameRequest::~RenameRequest() {
-  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.RenameRequest)
+MoveRequest::~MoveRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.MoveRequest)
   SharedDtor();
 }
 
-void RenameRequest::SharedDtor() {
-  old_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  new_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void MoveRequest::SharedDtor() {
+  source_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  target_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
-void RenameRequest::SetCachedSize(int size) const {
+void MoveRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const RenameRequest& RenameRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RenameRequest.base);
+const MoveRequest& MoveRequest::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_MoveRequest.base);
   return *internal_default_instance();
 }
 
 
-void RenameRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.RenameRequest)
+void MoveRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.MoveRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  old_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  new_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  source_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  target_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  continuation_ = GOOGLE_ULONGLONG(0);
   _internal_metadata_.Clear();
 }
 
-bool RenameRequest::MergePartialFromCodedStream(
+bool MoveRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
@@ -2826,38 +7128,52 @@ bool RenameRequest::MergePartialFromCodedStream(
       unknown_fields_setter.buffer());
   ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
       &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.RenameRequest)
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.MoveRequest)
   for (;;) {
     ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string old_name = 1;
+      // string source_path = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_old_name()));
+                input, this->mutable_source_path()));
           DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->old_name().data(), static_cast<int>(this->old_name().length()),
+            this->source_path().data(), static_cast<int>(this->source_path().length()),
             ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.RenameRequest.old_name"));
+            "aspia.proto.file_transfer.MoveRequest.source_path"));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // string new_name = 2;
+      // string target_path = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_new_name()));
+                input, this->mutable_target_path()));
           DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->new_name().data(), static_cast<int>(this->new_name().length()),
+            this->target_path().data(), static_cast<int>(this->target_path().length()),
             ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.RenameRequest.new_name"));
+            "aspia.proto.file_transfer.MoveRequest.target_path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 continuation = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &continuation_)));
         } else {
           goto handle_unusual;
         }
@@ -2876,63 +7192,75 @@ bool RenameRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.RenameRequest)
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.MoveRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.RenameRequest)
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.MoveRequest)
   return false;
 #undef DO_
 }
 
-void RenameRequest::SerializeWithCachedSizes(
+void MoveRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.RenameRequest)
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.MoveRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string old_name = 1;
-  if (this->old_name().size() > 0) {
+  // string source_path = 1;
+  if (this->source_path().size() > 0) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->old_name().data(), static_cast<int>(this->old_name().length()),
+      this->source_path().data(), static_cast<int>(this->source_path().length()),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "aspia.proto.file_transfer.RenameRequest.old_name");
+      "aspia.proto.file_transfer.MoveRequest.source_path");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->old_name(), output);
+      1, this->source_path(), output);
   }
 
-  // string new_name = 2;
-  if (this->new_name().size() > 0) {
+  // string target_path = 2;
+  if (this->target_path().size() > 0) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->new_name().data(), static_cast<int>(this->new_name().length()),
+      this->target_path().data(), static_cast<int>(this->target_path().length()),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "aspia.proto.file_transfer.RenameRequest.new_name");
+      "aspia.proto.file_transfer.MoveRequest.target_path");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->new_name(), output);
+      2, this->target_path(), output);
+  }
+
+  // uint64 continuation = 3;
+  if (this->continuation() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->continuation(), output);
   }
 
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.RenameRequest)
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.MoveRequest)
 }
 
-size_t RenameRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.RenameRequest)
+size_t MoveRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.MoveRequest)
   size_t total_size = 0;
 
   total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
 
-  // string old_name = 1;
-  if (this->old_name().size() > 0) {
+  // string source_path = 1;
+  if (this->source_path().size() > 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->old_name());
+        this->source_path());
   }
 
-  // string new_name = 2;
-  if (this->new_name().size() > 0) {
+  // string target_path = 2;
+  if (this->target_path().size() > 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->new_name());
+        this->target_path());
+  }
+
+  // uint64 continuation = 3;
+  if (this->continuation() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->continuation());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -2940,116 +7268,132 @@ size_t RenameRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void RenameRequest::CheckTypeAndMergeFrom(
+void MoveRequest::CheckTypeAndMergeFrom(
     const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const RenameRequest*>(&from));
+  MergeFrom(*::google::protobuf::down_cast<const MoveRequest*>(&from));
 }
 
-void RenameRequest::MergeFrom(const RenameRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.RenameRequest)
+void MoveRequest::MergeFrom(const MoveRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.MoveRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.old_name().size() > 0) {
+  if (from.source_path().size() > 0) {
 
-    old_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.old_name_);
+    source_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.source_path_);
   }
-  if (from.new_name().size() > 0) {
+  if (from.target_path().size() > 0) {
 
-    new_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.new_name_);
+    target_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.target_path_);
+  }
+  if (from.continuation() != 0) {
+    set_continuation(from.continuation());
   }
 }
 
-void RenameRequest::CopyFrom(const RenameRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.RenameRequest)
+void MoveRequest::CopyFrom(const MoveRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.MoveRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RenameRequest::IsInitialized() const {
+bool MoveRequest::IsInitialized() const {
   return true;
 }
 
-void RenameRequest::Swap(RenameRequest* other) {
+void MoveRequest::Swap(MoveRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void RenameRequest::InternalSwap(RenameRequest* other) {
+void MoveRequest::InternalSwap(MoveRequest* other) {
   using std::swap;
-  old_name_.Swap(&other->old_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  source_path_.Swap(&other->source_path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
     GetArenaNoVirtual());
-  new_name_.Swap(&other->new_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  target_path_.Swap(&other->target_path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
     GetArenaNoVirtual());
+  swap(continuation_, other->continuation_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
-::std::string RenameRequest::GetTypeName() const {
-  return "aspia.proto.file_transfer.RenameRequest";
+::std::string MoveRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.MoveRequest";
 }
 
 
 // ===================================================================
 
-void RemoveRequest::InitAsDefaultInstance() {
+void CopyProgress::InitAsDefaultInstance() {
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RemoveRequest::kPathFieldNumber;
+const int CopyProgress::kTotalSizeFieldNumber;
+const int CopyProgress::kCopiedSizeFieldNumber;
+const int CopyProgress::kCurrentPathFieldNumber;
+const int CopyProgress::kContinuationFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-RemoveRequest::RemoveRequest()
+CopyProgress::CopyProgress()
   : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
   ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveRequest.base);
+      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CopyProgress.base);
   SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.RemoveRequest)
+  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.CopyProgress)
 }
-RemoveRequest::RemoveRequest(const RemoveRequest& from)
+CopyProgress::CopyProgress(const CopyProgress& from)
   : ::google::protobuf::MessageLite(),
       _internal_metadata_(NULL) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  current_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.current_path().size() > 0) {
+    current_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.current_path_);
   }
-  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.RemoveRequest)
+  ::memcpy(&total_size_, &from.total_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&continuation_) -
+    reinterpret_cast<char*>(&total_size_)) + sizeof(continuation_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.CopyProgress)
 }
 
-void RemoveRequest::SharedCtor() {
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void CopyProgress::SharedCtor() {
+  current_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&total_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&continuation_) -
+      reinterpret_cast<char*>(&total_size_)) + sizeof(continuation_));
 }
 
-RemoveRequest::~RemoveRequest() {
-  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.RemoveRequest)
+CopyProgress::~CopyProgress() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.CopyProgress)
   SharedDtor();
 }
 
-void RemoveRequest::SharedDtor() {
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void CopyProgress::SharedDtor() {
+  current_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
-void RemoveRequest::SetCachedSize(int size) const {
+void CopyProgress::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const RemoveRequest& RemoveRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveRequest.base);
+const CopyProgress& CopyProgress::default_instance() {
+  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CopyProgress.base);
   return *internal_default_instance();
 }
 
 
-void RemoveRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.RemoveRequest)
+void CopyProgress::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.CopyProgress)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  current_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&total_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&continuation_) -
+      reinterpret_cast<char*>(&total_size_)) + sizeof(continuation_));
   _internal_metadata_.Clear();
 }
 
-bool RemoveRequest::MergePartialFromCodedStream(
+bool CopyProgress::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
@@ -3059,22 +7403,64 @@ bool RemoveRequest::MergePartialFromCodedStream(
       unknown_fields_setter.buffer());
   ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
       &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.RemoveRequest)
+  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.CopyProgress)
   for (;;) {
     ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string path = 1;
+      // uint64 total_size = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &total_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 copied_size = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &copied_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string current_path = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
+                input, this->mutable_current_path()));
           DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), static_cast<int>(this->path().length()),
+            this->current_path().data(), static_cast<int>(this->current_path().length()),
             ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.RemoveRequest.path"));
+            "aspia.proto.file_transfer.CopyProgress.current_path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 continuation = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &continuation_)));
         } else {
           goto handle_unusual;
         }
@@ -3093,46 +7479,82 @@ bool RemoveRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.RemoveRequest)
+  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.CopyProgress)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.RemoveRequest)
+  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.CopyProgress)
   return false;
 #undef DO_
 }
 
-void RemoveRequest::SerializeWithCachedSizes(
+void CopyProgress::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.RemoveRequest)
+  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.CopyProgress)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string path = 1;
-  if (this->path().size() > 0) {
+  // uint64 total_size = 1;
+  if (this->total_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->total_size(), output);
+  }
+
+  // uint64 copied_size = 2;
+  if (this->copied_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->copied_size(), output);
+  }
+
+  // string current_path = 3;
+  if (this->current_path().size() > 0) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
+      this->current_path().data(), static_cast<int>(this->current_path().length()),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "aspia.proto.file_transfer.RemoveRequest.path");
+      "aspia.proto.file_transfer.CopyProgress.current_path");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->path(), output);
+      3, this->current_path(), output);
+  }
+
+  // uint64 continuation = 4;
+  if (this->continuation() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->continuation(), output);
   }
 
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.RemoveRequest)
+  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.CopyProgress)
 }
 
-size_t RemoveRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.RemoveRequest)
+size_t CopyProgress::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.CopyProgress)
   size_t total_size = 0;
 
   total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
 
-  // string path = 1;
-  if (this->path().size() > 0) {
+  // string current_path = 3;
+  if (this->current_path().size() > 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->path());
+        this->current_path());
+  }
+
+  // uint64 total_size = 1;
+  if (this->total_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->total_size());
+  }
+
+  // uint64 copied_size = 2;
+  if (this->copied_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->copied_size());
+  }
+
+  // uint64 continuation = 4;
+  if (this->continuation() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->continuation());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -3140,48 +7562,60 @@ size_t RemoveRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void RemoveRequest::CheckTypeAndMergeFrom(
+void CopyProgress::CheckTypeAndMergeFrom(
     const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const RemoveRequest*>(&from));
+  MergeFrom(*::google::protobuf::down_cast<const CopyProgress*>(&from));
 }
 
-void RemoveRequest::MergeFrom(const RemoveRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.RemoveRequest)
+void CopyProgress::MergeFrom(const CopyProgress& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.CopyProgress)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.path().size() > 0) {
+  if (from.current_path().size() > 0) {
 
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+    current_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.current_path_);
+  }
+  if (from.total_size() != 0) {
+    set_total_size(from.total_size());
+  }
+  if (from.copied_size() != 0) {
+    set_copied_size(from.copied_size());
+  }
+  if (from.continuation() != 0) {
+    set_continuation(from.continuation());
   }
 }
 
-void RemoveRequest::CopyFrom(const RemoveRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.RemoveRequest)
+void CopyProgress::CopyFrom(const CopyProgress& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.CopyProgress)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RemoveRequest::IsInitialized() const {
+bool CopyProgress::IsInitialized() const {
   return true;
 }
 
-void RemoveRequest::Swap(RemoveRequest* other) {
+void CopyProgress::Swap(CopyProgress* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void RemoveRequest::InternalSwap(RemoveRequest* other) {
+void CopyProgress::InternalSwap(CopyProgress* other) {
   using std::swap;
-  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  current_path_.Swap(&other->current_path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
     GetArenaNoVirtual());
+  swap(total_size_, other->total_size_);
+  swap(copied_size_, other->copied_size_);
+  swap(continuation_, other->continuation_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
-::std::string RemoveRequest::GetTypeName() const {
-  return "aspia.proto.file_transfer.RemoveRequest";
+::std::string CopyProgress::GetTypeName() const {
+  return "aspia.proto.file_transfer.CopyProgress";
 }
 
 
@@ -3194,12 +7628,32 @@ void Reply::InitAsDefaultInstance() {
       ::aspia::proto::file_transfer::FileList::internal_default_instance());
   ::aspia::proto::file_transfer::_Reply_default_instance_._instance.get_mutable()->packet_ = const_cast< ::aspia::proto::file_transfer::Packet*>(
       ::aspia::proto::file_transfer::Packet::internal_default_instance());
+  ::aspia::proto::file_transfer::_Reply_default_instance_._instance.get_mutable()->block_checksums_ = const_cast< ::aspia::proto::file_transfer::BlockChecksums*>(
+      ::aspia::proto::file_transfer::BlockChecksums::internal_default_instance());
+  ::aspia::proto::file_transfer::_Reply_default_instance_._instance.get_mutable()->bundle_failures_ = const_cast< ::aspia::proto::file_transfer::Bundle*>(
+      ::aspia::proto::file_transfer::Bundle::internal_default_instance());
+  ::aspia::proto::file_transfer::_Reply_default_instance_._instance.get_mutable()->remove_progress_ = const_cast< ::aspia::proto::file_transfer::RemoveProgress*>(
+      ::aspia::proto::file_transfer::RemoveProgress::internal_default_instance());
+  ::aspia::proto::file_transfer::_Reply_default_instance_._instance.get_mutable()->copy_progress_ = const_cast< ::aspia::proto::file_transfer::CopyProgress*>(
+      ::aspia::proto::file_transfer::CopyProgress::internal_default_instance());
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int Reply::kStatusFieldNumber;
 const int Reply::kDriveListFieldNumber;
 const int Reply::kFileListFieldNumber;
 const int Reply::kPacketFieldNumber;
+const int Reply::kWindowSizeFieldNumber;
+const int Reply::kFileSizeFieldNumber;
+const int Reply::kCompressionFieldNumber;
+const int Reply::kBlockChecksumsFieldNumber;
+const int Reply::kOffsetFieldNumber;
+const int Reply::kTailHashFieldNumber;
+const int Reply::kMaxStreamsFieldNumber;
+const int Reply::kBundleFailuresFieldNumber;
+const int Reply::kBundlesFieldNumber;
+const int Reply::kRemoveProgressFieldNumber;
+const int Reply::kCopyProgressFieldNumber;
+const int Reply::kModificationTimeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Reply::Reply()
@@ -3213,6 +7667,10 @@ Reply::Reply(const Reply& from)
   : ::google::protobuf::MessageLite(),
       _internal_metadata_(NULL) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  tail_hash_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.tail_hash().size() > 0) {
+    tail_hash_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.tail_hash_);
+  }
   if (from.has_drive_list()) {
     drive_list_ = new ::aspia::proto::file_transfer::DriveList(*from.drive_list_);
   } else {
@@ -3228,14 +7686,37 @@ Reply::Reply(const Reply& from)
   } else {
     packet_ = NULL;
   }
-  status_ = from.status_;
+  if (from.has_block_checksums()) {
+    block_checksums_ = new ::aspia::proto::file_transfer::BlockChecksums(*from.block_checksums_);
+  } else {
+    block_checksums_ = NULL;
+  }
+  if (from.has_bundle_failures()) {
+    bundle_failures_ = new ::aspia::proto::file_transfer::Bundle(*from.bundle_failures_);
+  } else {
+    bundle_failures_ = NULL;
+  }
+  if (from.has_remove_progress()) {
+    remove_progress_ = new ::aspia::proto::file_transfer::RemoveProgress(*from.remove_progress_);
+  } else {
+    remove_progress_ = NULL;
+  }
+  if (from.has_copy_progress()) {
+    copy_progress_ = new ::aspia::proto::file_transfer::CopyProgress(*from.copy_progress_);
+  } else {
+    copy_progress_ = NULL;
+  }
+  ::memcpy(&status_, &from.status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&bundles_) -
+    reinterpret_cast<char*>(&status_)) + sizeof(bundles_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.Reply)
 }
 
 void Reply::SharedCtor() {
+  tail_hash_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&drive_list_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_) -
-      reinterpret_cast<char*>(&drive_list_)) + sizeof(status_));
+      reinterpret_cast<char*>(&bundles_) -
+      reinterpret_cast<char*>(&drive_list_)) + sizeof(bundles_));
 }
 
 Reply::~Reply() {
@@ -3244,9 +7725,14 @@ Reply::~Reply() {
 }
 
 void Reply::SharedDtor() {
+  tail_hash_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete drive_list_;
   if (this != internal_default_instance()) delete file_list_;
   if (this != internal_default_instance()) delete packet_;
+  if (this != internal_default_instance()) delete block_checksums_;
+  if (this != internal_default_instance()) delete bundle_failures_;
+  if (this != internal_default_instance()) delete remove_progress_;
+  if (this != internal_default_instance()) delete copy_progress_;
 }
 
 void Reply::SetCachedSize(int size) const {
@@ -3264,6 +7750,7 @@ void Reply::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  tail_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && drive_list_ != NULL) {
     delete drive_list_;
   }
@@ -3276,7 +7763,25 @@ void Reply::Clear() {
     delete packet_;
   }
   packet_ = NULL;
-  status_ = 0;
+  if (GetArenaNoVirtual() == NULL && block_checksums_ != NULL) {
+    delete block_checksums_;
+  }
+  block_checksums_ = NULL;
+  if (GetArenaNoVirtual() == NULL && bundle_failures_ != NULL) {
+    delete bundle_failures_;
+  }
+  bundle_failures_ = NULL;
+  if (GetArenaNoVirtual() == NULL && remove_progress_ != NULL) {
+    delete remove_progress_;
+  }
+  remove_progress_ = NULL;
+  if (GetArenaNoVirtual() == NULL && copy_progress_ != NULL) {
+    delete copy_progress_;
+  }
+  copy_progress_ = NULL;
+  ::memset(&status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&bundles_) -
+      reinterpret_cast<char*>(&status_)) + sizeof(bundles_));
   _internal_metadata_.Clear();
 }
 
@@ -3292,55 +7797,214 @@ bool Reply::MergePartialFromCodedStream(
       &unknown_fields_output, false);
   // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.Reply)
   for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
       // .aspia.proto.file_transfer.Status status = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_status(static_cast< ::aspia::proto::file_transfer::Status >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.DriveList drive_list = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_drive_list()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.FileList file_list = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_file_list()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.Packet packet = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_packet()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 window_size = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &window_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 file_size = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &file_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.Compression compression = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_compression(static_cast< ::aspia::proto::file_transfer::Compression >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.BlockChecksums block_checksums = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(66u /* 66 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_block_checksums()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 offset = 9;
+      case 9: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(72u /* 72 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &offset_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes tail_hash = 10;
+      case 10: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(82u /* 82 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_tail_hash()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 max_streams = 11;
+      case 11: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(88u /* 88 & 0xFF */)) {
+
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_status(static_cast< ::aspia::proto::file_transfer::Status >(value));
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &max_streams_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // .aspia.proto.file_transfer.DriveList drive_list = 2;
-      case 2: {
+      // .aspia.proto.file_transfer.Bundle bundle_failures = 12;
+      case 12: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+            static_cast< ::google::protobuf::uint8>(98u /* 98 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_drive_list()));
+               input, mutable_bundle_failures()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // .aspia.proto.file_transfer.FileList file_list = 3;
-      case 3: {
+      // bool bundles = 13;
+      case 13: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+            static_cast< ::google::protobuf::uint8>(104u /* 104 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &bundles_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.RemoveProgress remove_progress = 14;
+      case 14: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(114u /* 114 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_file_list()));
+               input, mutable_remove_progress()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // .aspia.proto.file_transfer.Packet packet = 4;
-      case 4: {
+      // .aspia.proto.file_transfer.CopyProgress copy_progress = 15;
+      case 15: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+            static_cast< ::google::protobuf::uint8>(122u /* 122 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_packet()));
+               input, mutable_copy_progress()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 modification_time = 16;
+      case 16: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(128u /* 128 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &modification_time_)));
         } else {
           goto handle_unusual;
         }
@@ -3397,6 +8061,72 @@ void Reply::SerializeWithCachedSizes(
       4, this->_internal_packet(), output);
   }
 
+  // uint32 window_size = 5;
+  if (this->window_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->window_size(), output);
+  }
+
+  // uint64 file_size = 6;
+  if (this->file_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->file_size(), output);
+  }
+
+  // .aspia.proto.file_transfer.Compression compression = 7;
+  if (this->compression() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      7, this->compression(), output);
+  }
+
+  // .aspia.proto.file_transfer.BlockChecksums block_checksums = 8;
+  if (this->has_block_checksums()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      8, this->_internal_block_checksums(), output);
+  }
+
+  // uint64 offset = 9;
+  if (this->offset() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(9, this->offset(), output);
+  }
+
+  // bytes tail_hash = 10;
+  if (this->tail_hash().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      10, this->tail_hash(), output);
+  }
+
+  // uint32 max_streams = 11;
+  if (this->max_streams() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(11, this->max_streams(), output);
+  }
+
+  // .aspia.proto.file_transfer.Bundle bundle_failures = 12;
+  if (this->has_bundle_failures()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      12, this->_internal_bundle_failures(), output);
+  }
+
+  // bool bundles = 13;
+  if (this->bundles() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(13, this->bundles(), output);
+  }
+
+  // .aspia.proto.file_transfer.RemoveProgress remove_progress = 14;
+  if (this->has_remove_progress()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      14, this->_internal_remove_progress(), output);
+  }
+
+  // .aspia.proto.file_transfer.CopyProgress copy_progress = 15;
+  if (this->has_copy_progress()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      15, this->_internal_copy_progress(), output);
+  }
+
+  // uint64 modification_time = 16;
+  if (this->modification_time() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(16, this->modification_time(), output);
+  }
+
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
   // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.Reply)
@@ -3408,6 +8138,13 @@ size_t Reply::ByteSizeLong() const {
 
   total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
 
+  // bytes tail_hash = 10;
+  if (this->tail_hash().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->tail_hash());
+  }
+
   // .aspia.proto.file_transfer.DriveList drive_list = 2;
   if (this->has_drive_list()) {
     total_size += 1 +
@@ -3429,12 +8166,86 @@ size_t Reply::ByteSizeLong() const {
         *packet_);
   }
 
+  // .aspia.proto.file_transfer.BlockChecksums block_checksums = 8;
+  if (this->has_block_checksums()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *block_checksums_);
+  }
+
+  // .aspia.proto.file_transfer.Bundle bundle_failures = 12;
+  if (this->has_bundle_failures()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *bundle_failures_);
+  }
+
+  // .aspia.proto.file_transfer.RemoveProgress remove_progress = 14;
+  if (this->has_remove_progress()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *remove_progress_);
+  }
+
+  // .aspia.proto.file_transfer.CopyProgress copy_progress = 15;
+  if (this->has_copy_progress()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *copy_progress_);
+  }
+
   // .aspia.proto.file_transfer.Status status = 1;
   if (this->status() != 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::EnumSize(this->status());
   }
 
+  // uint32 window_size = 5;
+  if (this->window_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->window_size());
+  }
+
+  // uint64 file_size = 6;
+  if (this->file_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->file_size());
+  }
+
+  // uint64 offset = 9;
+  if (this->offset() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->offset());
+  }
+
+  // .aspia.proto.file_transfer.Compression compression = 7;
+  if (this->compression() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->compression());
+  }
+
+  // uint32 max_streams = 11;
+  if (this->max_streams() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->max_streams());
+  }
+
+  // uint64 modification_time = 16;
+  if (this->modification_time() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->modification_time());
+  }
+
+  // bool bundles = 13;
+  if (this->bundles() != 0) {
+    total_size += 1 + 1;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
@@ -3452,6 +8263,10 @@ void Reply::MergeFrom(const Reply& from) {
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.tail_hash().size() > 0) {
+
+    tail_hash_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.tail_hash_);
+  }
   if (from.has_drive_list()) {
     mutable_drive_list()->::aspia::proto::file_transfer::DriveList::MergeFrom(from.drive_list());
   }
@@ -3461,9 +8276,42 @@ void Reply::MergeFrom(const Reply& from) {
   if (from.has_packet()) {
     mutable_packet()->::aspia::proto::file_transfer::Packet::MergeFrom(from.packet());
   }
+  if (from.has_block_checksums()) {
+    mutable_block_checksums()->::aspia::proto::file_transfer::BlockChecksums::MergeFrom(from.block_checksums());
+  }
+  if (from.has_bundle_failures()) {
+    mutable_bundle_failures()->::aspia::proto::file_transfer::Bundle::MergeFrom(from.bundle_failures());
+  }
+  if (from.has_remove_progress()) {
+    mutable_remove_progress()->::aspia::proto::file_transfer::RemoveProgress::MergeFrom(from.remove_progress());
+  }
+  if (from.has_copy_progress()) {
+    mutable_copy_progress()->::aspia::proto::file_transfer::CopyProgress::MergeFrom(from.copy_progress());
+  }
   if (from.status() != 0) {
     set_status(from.status());
   }
+  if (from.window_size() != 0) {
+    set_window_size(from.window_size());
+  }
+  if (from.file_size() != 0) {
+    set_file_size(from.file_size());
+  }
+  if (from.offset() != 0) {
+    set_offset(from.offset());
+  }
+  if (from.compression() != 0) {
+    set_compression(from.compression());
+  }
+  if (from.max_streams() != 0) {
+    set_max_streams(from.max_streams());
+  }
+  if (from.modification_time() != 0) {
+    set_modification_time(from.modification_time());
+  }
+  if (from.bundles() != 0) {
+    set_bundles(from.bundles());
+  }
 }
 
 void Reply::CopyFrom(const Reply& from) {
@@ -3483,10 +8331,23 @@ void Reply::Swap(Reply* other) {
 }
 void Reply::InternalSwap(Reply* other) {
   using std::swap;
+  tail_hash_.Swap(&other->tail_hash_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
   swap(drive_list_, other->drive_list_);
   swap(file_list_, other->file_list_);
   swap(packet_, other->packet_);
+  swap(block_checksums_, other->block_checksums_);
+  swap(bundle_failures_, other->bundle_failures_);
+  swap(remove_progress_, other->remove_progress_);
+  swap(copy_progress_, other->copy_progress_);
   swap(status_, other->status_);
+  swap(window_size_, other->window_size_);
+  swap(file_size_, other->file_size_);
+  swap(offset_, other->offset_);
+  swap(compression_, other->compression_);
+  swap(max_streams_, other->max_streams_);
+  swap(modification_time_, other->modification_time_);
+  swap(bundles_, other->bundles_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
@@ -3516,6 +8377,14 @@ void Request::InitAsDefaultInstance() {
       ::aspia::proto::file_transfer::PacketRequest::internal_default_instance());
   ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->packet_ = const_cast< ::aspia::proto::file_transfer::Packet*>(
       ::aspia::proto::file_transfer::Packet::internal_default_instance());
+  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->block_checksums_request_ = const_cast< ::aspia::proto::file_transfer::BlockChecksumsRequest*>(
+      ::aspia::proto::file_transfer::BlockChecksumsRequest::internal_default_instance());
+  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->resume_request_ = const_cast< ::aspia::proto::file_transfer::ResumeRequest*>(
+      ::aspia::proto::file_transfer::ResumeRequest::internal_default_instance());
+  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->copy_request_ = const_cast< ::aspia::proto::file_transfer::CopyRequest*>(
+      ::aspia::proto::file_transfer::CopyRequest::internal_default_instance());
+  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->move_request_ = const_cast< ::aspia::proto::file_transfer::MoveRequest*>(
+      ::aspia::proto::file_transfer::MoveRequest::internal_default_instance());
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int Request::kDriveListRequestFieldNumber;
@@ -3527,6 +8396,11 @@ const int Request::kDownloadRequestFieldNumber;
 const int Request::kUploadRequestFieldNumber;
 const int Request::kPacketRequestFieldNumber;
 const int Request::kPacketFieldNumber;
+const int Request::kBlockChecksumsRequestFieldNumber;
+const int Request::kResumeRequestFieldNumber;
+const int Request::kStreamIdFieldNumber;
+const int Request::kCopyRequestFieldNumber;
+const int Request::kMoveRequestFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Request::Request()
@@ -3585,13 +8459,34 @@ Request::Request(const Request& from)
   } else {
     packet_ = NULL;
   }
+  if (from.has_block_checksums_request()) {
+    block_checksums_request_ = new ::aspia::proto::file_transfer::BlockChecksumsRequest(*from.block_checksums_request_);
+  } else {
+    block_checksums_request_ = NULL;
+  }
+  if (from.has_resume_request()) {
+    resume_request_ = new ::aspia::proto::file_transfer::ResumeRequest(*from.resume_request_);
+  } else {
+    resume_request_ = NULL;
+  }
+  if (from.has_copy_request()) {
+    copy_request_ = new ::aspia::proto::file_transfer::CopyRequest(*from.copy_request_);
+  } else {
+    copy_request_ = NULL;
+  }
+  if (from.has_move_request()) {
+    move_request_ = new ::aspia::proto::file_transfer::MoveRequest(*from.move_request_);
+  } else {
+    move_request_ = NULL;
+  }
+  stream_id_ = from.stream_id_;
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.Request)
 }
 
 void Request::SharedCtor() {
   ::memset(&drive_list_request_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&packet_) -
-      reinterpret_cast<char*>(&drive_list_request_)) + sizeof(packet_));
+      reinterpret_cast<char*>(&stream_id_) -
+      reinterpret_cast<char*>(&drive_list_request_)) + sizeof(stream_id_));
 }
 
 Request::~Request() {
@@ -3609,6 +8504,10 @@ void Request::SharedDtor() {
   if (this != internal_default_instance()) delete upload_request_;
   if (this != internal_default_instance()) delete packet_request_;
   if (this != internal_default_instance()) delete packet_;
+  if (this != internal_default_instance()) delete block_checksums_request_;
+  if (this != internal_default_instance()) delete resume_request_;
+  if (this != internal_default_instance()) delete copy_request_;
+  if (this != internal_default_instance()) delete move_request_;
 }
 
 void Request::SetCachedSize(int size) const {
@@ -3662,6 +8561,23 @@ void Request::Clear() {
     delete packet_;
   }
   packet_ = NULL;
+  if (GetArenaNoVirtual() == NULL && block_checksums_request_ != NULL) {
+    delete block_checksums_request_;
+  }
+  block_checksums_request_ = NULL;
+  if (GetArenaNoVirtual() == NULL && resume_request_ != NULL) {
+    delete resume_request_;
+  }
+  resume_request_ = NULL;
+  if (GetArenaNoVirtual() == NULL && copy_request_ != NULL) {
+    delete copy_request_;
+  }
+  copy_request_ = NULL;
+  if (GetArenaNoVirtual() == NULL && move_request_ != NULL) {
+    delete move_request_;
+  }
+  move_request_ = NULL;
+  stream_id_ = 0u;
   _internal_metadata_.Clear();
 }
 
@@ -3789,6 +8705,68 @@ bool Request::MergePartialFromCodedStream(
         break;
       }
 
+      // .aspia.proto.file_transfer.BlockChecksumsRequest block_checksums_request = 10;
+      case 10: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(82u /* 82 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_block_checksums_request()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.ResumeRequest resume_request = 11;
+      case 11: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(90u /* 90 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_resume_request()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 stream_id = 12;
+      case 12: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(96u /* 96 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &stream_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.CopyRequest copy_request = 13;
+      case 13: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(106u /* 106 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_copy_request()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .aspia.proto.file_transfer.MoveRequest move_request = 14;
+      case 14: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(114u /* 114 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_move_request()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -3869,6 +8847,35 @@ void Request::SerializeWithCachedSizes(
       9, this->_internal_packet(), output);
   }
 
+  // .aspia.proto.file_transfer.BlockChecksumsRequest block_checksums_request = 10;
+  if (this->has_block_checksums_request()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      10, this->_internal_block_checksums_request(), output);
+  }
+
+  // .aspia.proto.file_transfer.ResumeRequest resume_request = 11;
+  if (this->has_resume_request()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      11, this->_internal_resume_request(), output);
+  }
+
+  // uint32 stream_id = 12;
+  if (this->stream_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(12, this->stream_id(), output);
+  }
+
+  // .aspia.proto.file_transfer.CopyRequest copy_request = 13;
+  if (this->has_copy_request()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      13, this->_internal_copy_request(), output);
+  }
+
+  // .aspia.proto.file_transfer.MoveRequest move_request = 14;
+  if (this->has_move_request()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      14, this->_internal_move_request(), output);
+  }
+
   output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
                    static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
   // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.Request)
@@ -3943,6 +8950,41 @@ size_t Request::ByteSizeLong() const {
         *packet_);
   }
 
+  // .aspia.proto.file_transfer.BlockChecksumsRequest block_checksums_request = 10;
+  if (this->has_block_checksums_request()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *block_checksums_request_);
+  }
+
+  // .aspia.proto.file_transfer.ResumeRequest resume_request = 11;
+  if (this->has_resume_request()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *resume_request_);
+  }
+
+  // .aspia.proto.file_transfer.CopyRequest copy_request = 13;
+  if (this->has_copy_request()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *copy_request_);
+  }
+
+  // .aspia.proto.file_transfer.MoveRequest move_request = 14;
+  if (this->has_move_request()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *move_request_);
+  }
+
+  // uint32 stream_id = 12;
+  if (this->stream_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->stream_id());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
@@ -3987,6 +9029,21 @@ void Request::MergeFrom(const Request& from) {
   if (from.has_packet()) {
     mutable_packet()->::aspia::proto::file_transfer::Packet::MergeFrom(from.packet());
   }
+  if (from.has_block_checksums_request()) {
+    mutable_block_checksums_request()->::aspia::proto::file_transfer::BlockChecksumsRequest::MergeFrom(from.block_checksums_request());
+  }
+  if (from.has_resume_request()) {
+    mutable_resume_request()->::aspia::proto::file_transfer::ResumeRequest::MergeFrom(from.resume_request());
+  }
+  if (from.has_copy_request()) {
+    mutable_copy_request()->::aspia::proto::file_transfer::CopyRequest::MergeFrom(from.copy_request());
+  }
+  if (from.has_move_request()) {
+    mutable_move_request()->::aspia::proto::file_transfer::MoveRequest::MergeFrom(from.move_request());
+  }
+  if (from.stream_id() != 0) {
+    set_stream_id(from.stream_id());
+  }
 }
 
 void Request::CopyFrom(const Request& from) {
@@ -4015,6 +9072,11 @@ void Request::InternalSwap(Request* other) {
   swap(upload_request_, other->upload_request_);
   swap(packet_request_, other->packet_request_);
   swap(packet_, other->packet_);
+  swap(block_checksums_request_, other->block_checksums_request_);
+  swap(resume_request_, other->resume_request_);
+  swap(copy_request_, other->copy_request_);
+  swap(move_request_, other->move_request_);
+  swap(stream_id_, other->stream_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
 }
 
@@ -4047,15 +9109,36 @@ template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::Fil
 template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::FileListRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::FileListRequest >(Arena* arena) {
   return Arena::CreateInternal< ::aspia::proto::file_transfer::FileListRequest >(arena);
 }
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::BlockChecksums_Checksum* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::BlockChecksums_Checksum >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::BlockChecksums_Checksum >(arena);
+}
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::BlockChecksums* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::BlockChecksums >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::BlockChecksums >(arena);
+}
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::BlockChecksumsRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::BlockChecksumsRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::BlockChecksumsRequest >(arena);
+}
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::BundleEntry* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::BundleEntry >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::BundleEntry >(arena);
+}
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::Bundle* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::Bundle >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::Bundle >(arena);
+}
 template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::UploadRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::UploadRequest >(Arena* arena) {
   return Arena::CreateInternal< ::aspia::proto::file_transfer::UploadRequest >(arena);
 }
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::ResumeRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::ResumeRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::ResumeRequest >(arena);
+}
 template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::DownloadRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::DownloadRequest >(Arena* arena) {
   return Arena::CreateInternal< ::aspia::proto::file_transfer::DownloadRequest >(arena);
 }
 template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::PacketRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::PacketRequest >(Arena* arena) {
   return Arena::CreateInternal< ::aspia::proto::file_transfer::PacketRequest >(arena);
 }
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::DeltaOperation* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::DeltaOperation >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::DeltaOperation >(arena);
+}
 template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::Packet* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::Packet >(Arena* arena) {
   return Arena::CreateInternal< ::aspia::proto::file_transfer::Packet >(arena);
 }
@@ -4068,6 +9151,21 @@ template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::Ren
 template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::RemoveRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::RemoveRequest >(Arena* arena) {
   return Arena::CreateInternal< ::aspia::proto::file_transfer::RemoveRequest >(arena);
 }
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::RemoveProgress_Failure* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::RemoveProgress_Failure >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::RemoveProgress_Failure >(arena);
+}
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::RemoveProgress* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::RemoveProgress >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::RemoveProgress >(arena);
+}
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::CopyRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::CopyRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::CopyRequest >(arena);
+}
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::MoveRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::MoveRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::MoveRequest >(arena);
+}
+template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::CopyProgress* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::CopyProgress >(Arena* arena) {
+  return Arena::CreateInternal< ::aspia::proto::file_transfer::CopyProgress >(arena);
+}
 template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::Reply* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::Reply >(Arena* arena) {
   return Arena::CreateInternal< ::aspia::proto::file_transfer::Reply >(arena);
 }
@@ -38,7 +38,7 @@ namespace protobuf_file_5ftransfer_5fsession_2eproto {
 struct TableStruct {
   static const ::google::protobuf::internal::ParseTableField entries[];
   static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[15];
+  static const ::google::protobuf::internal::ParseTable schema[27];
   static const ::google::protobuf::internal::FieldMetadata field_metadata[];
   static const ::google::protobuf::internal::SerializationTable serialization_table[];
   static const ::google::protobuf::uint32 offsets[];
@@ -47,9 +47,33 @@ struct TableStruct {
 namespace aspia {
 namespace proto {
 namespace file_transfer {
+class BlockChecksums;
+class BlockChecksumsDefaultTypeInternal;
+extern BlockChecksumsDefaultTypeInternal _BlockChecksums_default_instance_;
+class BlockChecksumsRequest;
+class BlockChecksumsRequestDefaultTypeInternal;
+extern BlockChecksumsRequestDefaultTypeInternal _BlockChecksumsRequest_default_instance_;
+class BlockChecksums_Checksum;
+class BlockChecksums_ChecksumDefaultTypeInternal;
+extern BlockChecksums_ChecksumDefaultTypeInternal _BlockChecksums_Checksum_default_instance_;
+class Bundle;
+class BundleDefaultTypeInternal;
+extern BundleDefaultTypeInternal _Bundle_default_instance_;
+class BundleEntry;
+class BundleEntryDefaultTypeInternal;
+extern BundleEntryDefaultTypeInternal _BundleEntry_default_instance_;
+class CopyProgress;
+class CopyProgressDefaultTypeInternal;
+extern CopyProgressDefaultTypeInternal _CopyProgress_default_instance_;
+class CopyRequest;
+class CopyRequestDefaultTypeInternal;
+extern CopyRequestDefaultTypeInternal _CopyRequest_default_instance_;
 class CreateDirectoryRequest;
 class CreateDirectoryRequestDefaultTypeInternal;
 extern CreateDirectoryRequestDefaultTypeInternal _CreateDirectoryRequest_default_instance_;
+class DeltaOperation;
+class DeltaOperationDefaultTypeInternal;
+extern DeltaOperationDefaultTypeInternal _DeltaOperation_default_instance_;
 class DownloadRequest;
 class DownloadRequestDefaultTypeInternal;
 extern DownloadRequestDefaultTypeInternal _DownloadRequest_default_instance_;
@@ -71,12 +95,21 @@ extern FileListRequestDefaultTypeInternal _FileListRequest_default_instance_;
 class FileList_Item;
 class FileList_ItemDefaultTypeInternal;
 extern FileList_ItemDefaultTypeInternal _FileList_Item_default_instance_;
+class MoveRequest;
+class MoveRequestDefaultTypeInternal;
+extern MoveRequestDefaultTypeInternal _MoveRequest_default_instance_;
 class Packet;
 class PacketDefaultTypeInternal;
 extern PacketDefaultTypeInternal _Packet_default_instance_;
 class PacketRequest;
 class PacketRequestDefaultTypeInternal;
 extern PacketRequestDefaultTypeInternal _PacketRequest_default_instance_;
+class RemoveProgress;
+class RemoveProgressDefaultTypeInternal;
+extern RemoveProgressDefaultTypeInternal _RemoveProgress_default_instance_;
+class RemoveProgress_Failure;
+class RemoveProgress_FailureDefaultTypeInternal;
+extern RemoveProgress_FailureDefaultTypeInternal _RemoveProgress_Failure_default_instance_;
 class RemoveRequest;
 class RemoveRequestDefaultTypeInternal;
 extern RemoveRequestDefaultTypeInternal _RemoveRequest_default_instance_;
@@ -89,6 +122,9 @@ extern ReplyDefaultTypeInternal _Reply_default_instance_;
 class Request;
 class RequestDefaultTypeInternal;
 extern RequestDefaultTypeInternal _Request_default_instance_;
+class ResumeRequest;
+class ResumeRequestDefaultTypeInternal;
+extern ResumeRequestDefaultTypeInternal _ResumeRequest_default_instance_;
 class UploadRequest;
 class UploadRequestDefaultTypeInternal;
 extern UploadRequestDefaultTypeInternal _UploadRequest_default_instance_;
@@ -97,7 +133,15 @@ extern UploadRequestDefaultTypeInternal _UploadRequest_default_instance_;
 }  // namespace aspia
 namespace google {
 namespace protobuf {
+template<> ::aspia::proto::file_transfer::BlockChecksums* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::BlockChecksums>(Arena*);
+template<> ::aspia::proto::file_transfer::BlockChecksumsRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::BlockChecksumsRequest>(Arena*);
+template<> ::aspia::proto::file_transfer::BlockChecksums_Checksum* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::BlockChecksums_Checksum>(Arena*);
+template<> ::aspia::proto::file_transfer::Bundle* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::Bundle>(Arena*);
+template<> ::aspia::proto::file_transfer::BundleEntry* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::BundleEntry>(Arena*);
+template<> ::aspia::proto::file_transfer::CopyProgress* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::CopyProgress>(Arena*);
+template<> ::aspia::proto::file_transfer::CopyRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::CopyRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::CreateDirectoryRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::CreateDirectoryRequest>(Arena*);
+template<> ::aspia::proto::file_transfer::DeltaOperation* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::DeltaOperation>(Arena*);
 template<> ::aspia::proto::file_transfer::DownloadRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::DownloadRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::DriveList* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::DriveList>(Arena*);
 template<> ::aspia::proto::file_transfer::DriveListRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::DriveListRequest>(Arena*);
@@ -105,12 +149,16 @@ template<> ::aspia::proto::file_transfer::DriveList_Item* Arena::CreateMaybeMess
 template<> ::aspia::proto::file_transfer::FileList* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::FileList>(Arena*);
 template<> ::aspia::proto::file_transfer::FileListRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::FileListRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::FileList_Item* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::FileList_Item>(Arena*);
+template<> ::aspia::proto::file_transfer::MoveRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::MoveRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::Packet* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::Packet>(Arena*);
 template<> ::aspia::proto::file_transfer::PacketRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::PacketRequest>(Arena*);
+template<> ::aspia::proto::file_transfer::RemoveProgress* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::RemoveProgress>(Arena*);
+template<> ::aspia::proto::file_transfer::RemoveProgress_Failure* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::RemoveProgress_Failure>(Arena*);
 template<> ::aspia::proto::file_transfer::RemoveRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::RemoveRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::RenameRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::RenameRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::Reply* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::Reply>(Arena*);
 template<> ::aspia::proto::file_transfer::Request* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::Request>(Arena*);
+template<> ::aspia::proto::file_transfer::ResumeRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::ResumeRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::UploadRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::UploadRequest>(Arena*);
 }  // namespace protobuf
 }  // namespace google
@@ -171,6 +219,17 @@ const Status Status_MIN = STATUS_UNKNOWN;
 const Status Status_MAX = STATUS_FILE_READ_ERROR;
 const int Status_ARRAYSIZE = Status_MAX + 1;
 
+enum Compression {
+  COMPRESSION_NONE = 0,
+  COMPRESSION_ZLIB = 1,
+  Compression_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
+  Compression_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+};
+bool Compression_IsValid(int value);
+const Compression Compression_MIN = COMPRESSION_NONE;
+const Compression Compression_MAX = COMPRESSION_ZLIB;
+const int Compression_ARRAYSIZE = Compression_MAX + 1;
+
 // ===================================================================
 
 class DriveList_Item : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DriveList.Item) */ {
@@ -755,11 +814,59 @@ class FileList : public ::google::protobuf::MessageLite /* @@protoc_insertion_po
   const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >&
       item() const;
 
+  // repeated .aspia.proto.file_transfer.FileList.Item removed_item = 7;
+  int removed_item_size() const;
+  void clear_removed_item();
+  static const int kRemovedItemFieldNumber = 7;
+  ::aspia::proto::file_transfer::FileList_Item* mutable_removed_item(int index);
+  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >*
+      mutable_removed_item();
+  const ::aspia::proto::file_transfer::FileList_Item& removed_item(int index) const;
+  ::aspia::proto::file_transfer::FileList_Item* add_removed_item();
+  const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >&
+      removed_item() const;
+
+  // uint64 continuation = 3;
+  void clear_continuation();
+  static const int kContinuationFieldNumber = 3;
+  ::google::protobuf::uint64 continuation() const;
+  void set_continuation(::google::protobuf::uint64 value);
+
+  // uint64 version = 4;
+  void clear_version();
+  static const int kVersionFieldNumber = 4;
+  ::google::protobuf::uint64 version() const;
+  void set_version(::google::protobuf::uint64 value);
+
+  // bool recursive = 2;
+  void clear_recursive();
+  static const int kRecursiveFieldNumber = 2;
+  bool recursive() const;
+  void set_recursive(bool value);
+
+  // bool not_modified = 5;
+  void clear_not_modified();
+  static const int kNotModifiedFieldNumber = 5;
+  bool not_modified() const;
+  void set_not_modified(bool value);
+
+  // bool delta = 6;
+  void clear_delta();
+  static const int kDeltaFieldNumber = 6;
+  bool delta() const;
+  void set_delta(bool value);
+
   // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.FileList)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
   ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item > item_;
+  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item > removed_item_;
+  ::google::protobuf::uint64 continuation_;
+  ::google::protobuf::uint64 version_;
+  bool recursive_;
+  bool not_modified_;
+  bool delta_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
 };
@@ -864,34 +971,62 @@ class FileListRequest : public ::google::protobuf::MessageLite /* @@protoc_inser
   ::std::string* release_path();
   void set_allocated_path(::std::string* path);
 
+  // uint64 continuation = 3;
+  void clear_continuation();
+  static const int kContinuationFieldNumber = 3;
+  ::google::protobuf::uint64 continuation() const;
+  void set_continuation(::google::protobuf::uint64 value);
+
+  // uint64 cached_version = 5;
+  void clear_cached_version();
+  static const int kCachedVersionFieldNumber = 5;
+  ::google::protobuf::uint64 cached_version() const;
+  void set_cached_version(::google::protobuf::uint64 value);
+
+  // bool recursive = 2;
+  void clear_recursive();
+  static const int kRecursiveFieldNumber = 2;
+  bool recursive() const;
+  void set_recursive(bool value);
+
+  // bool paged = 4;
+  void clear_paged();
+  static const int kPagedFieldNumber = 4;
+  bool paged() const;
+  void set_paged(bool value);
+
   // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.FileListRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
   ::google::protobuf::internal::ArenaStringPtr path_;
+  ::google::protobuf::uint64 continuation_;
+  ::google::protobuf::uint64 cached_version_;
+  bool recursive_;
+  bool paged_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class UploadRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.UploadRequest) */ {
+class BlockChecksums_Checksum : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.BlockChecksums.Checksum) */ {
  public:
-  UploadRequest();
-  virtual ~UploadRequest();
+  BlockChecksums_Checksum();
+  virtual ~BlockChecksums_Checksum();
 
-  UploadRequest(const UploadRequest& from);
+  BlockChecksums_Checksum(const BlockChecksums_Checksum& from);
 
-  inline UploadRequest& operator=(const UploadRequest& from) {
+  inline BlockChecksums_Checksum& operator=(const BlockChecksums_Checksum& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  UploadRequest(UploadRequest&& from) noexcept
-    : UploadRequest() {
+  BlockChecksums_Checksum(BlockChecksums_Checksum&& from) noexcept
+    : BlockChecksums_Checksum() {
     *this = ::std::move(from);
   }
 
-  inline UploadRequest& operator=(UploadRequest&& from) noexcept {
+  inline BlockChecksums_Checksum& operator=(BlockChecksums_Checksum&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -900,34 +1035,34 @@ class UploadRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
     return *this;
   }
   #endif
-  static const UploadRequest& default_instance();
+  static const BlockChecksums_Checksum& default_instance();
 
   static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const UploadRequest* internal_default_instance() {
-    return reinterpret_cast<const UploadRequest*>(
-               &_UploadRequest_default_instance_);
+  static inline const BlockChecksums_Checksum* internal_default_instance() {
+    return reinterpret_cast<const BlockChecksums_Checksum*>(
+               &_BlockChecksums_Checksum_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  void Swap(UploadRequest* other);
-  friend void swap(UploadRequest& a, UploadRequest& b) {
+  void Swap(BlockChecksums_Checksum* other);
+  friend void swap(BlockChecksums_Checksum& a, BlockChecksums_Checksum& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UploadRequest* New() const final {
-    return CreateMaybeMessage<UploadRequest>(NULL);
+  inline BlockChecksums_Checksum* New() const final {
+    return CreateMaybeMessage<BlockChecksums_Checksum>(NULL);
   }
 
-  UploadRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<UploadRequest>(arena);
+  BlockChecksums_Checksum* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<BlockChecksums_Checksum>(arena);
   }
   void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
     final;
-  void CopyFrom(const UploadRequest& from);
-  void MergeFrom(const UploadRequest& from);
+  void CopyFrom(const BlockChecksums_Checksum& from);
+  void MergeFrom(const BlockChecksums_Checksum& from);
   void Clear() final;
   bool IsInitialized() const final;
 
@@ -943,7 +1078,7 @@ class UploadRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(UploadRequest* other);
+  void InternalSwap(BlockChecksums_Checksum* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -959,55 +1094,55 @@ class UploadRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
 
   // accessors -------------------------------------------------------
 
-  // string path = 1;
-  void clear_path();
-  static const int kPathFieldNumber = 1;
-  const ::std::string& path() const;
-  void set_path(const ::std::string& value);
+  // bytes strong = 2;
+  void clear_strong();
+  static const int kStrongFieldNumber = 2;
+  const ::std::string& strong() const;
+  void set_strong(const ::std::string& value);
   #if LANG_CXX11
-  void set_path(::std::string&& value);
+  void set_strong(::std::string&& value);
   #endif
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  ::std::string* mutable_path();
-  ::std::string* release_path();
-  void set_allocated_path(::std::string* path);
-
-  // bool overwrite = 2;
-  void clear_overwrite();
-  static const int kOverwriteFieldNumber = 2;
-  bool overwrite() const;
-  void set_overwrite(bool value);
-
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.UploadRequest)
+  void set_strong(const char* value);
+  void set_strong(const void* value, size_t size);
+  ::std::string* mutable_strong();
+  ::std::string* release_strong();
+  void set_allocated_strong(::std::string* strong);
+
+  // uint32 weak = 1;
+  void clear_weak();
+  static const int kWeakFieldNumber = 1;
+  ::google::protobuf::uint32 weak() const;
+  void set_weak(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.BlockChecksums.Checksum)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr path_;
-  bool overwrite_;
+  ::google::protobuf::internal::ArenaStringPtr strong_;
+  ::google::protobuf::uint32 weak_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DownloadRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DownloadRequest) */ {
+class BlockChecksums : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.BlockChecksums) */ {
  public:
-  DownloadRequest();
-  virtual ~DownloadRequest();
+  BlockChecksums();
+  virtual ~BlockChecksums();
 
-  DownloadRequest(const DownloadRequest& from);
+  BlockChecksums(const BlockChecksums& from);
 
-  inline DownloadRequest& operator=(const DownloadRequest& from) {
+  inline BlockChecksums& operator=(const BlockChecksums& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  DownloadRequest(DownloadRequest&& from) noexcept
-    : DownloadRequest() {
+  BlockChecksums(BlockChecksums&& from) noexcept
+    : BlockChecksums() {
     *this = ::std::move(from);
   }
 
-  inline DownloadRequest& operator=(DownloadRequest&& from) noexcept {
+  inline BlockChecksums& operator=(BlockChecksums&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -1016,34 +1151,34 @@ class DownloadRequest : public ::google::protobuf::MessageLite /* @@protoc_inser
     return *this;
   }
   #endif
-  static const DownloadRequest& default_instance();
+  static const BlockChecksums& default_instance();
 
   static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const DownloadRequest* internal_default_instance() {
-    return reinterpret_cast<const DownloadRequest*>(
-               &_DownloadRequest_default_instance_);
+  static inline const BlockChecksums* internal_default_instance() {
+    return reinterpret_cast<const BlockChecksums*>(
+               &_BlockChecksums_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  void Swap(DownloadRequest* other);
-  friend void swap(DownloadRequest& a, DownloadRequest& b) {
+  void Swap(BlockChecksums* other);
+  friend void swap(BlockChecksums& a, BlockChecksums& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DownloadRequest* New() const final {
-    return CreateMaybeMessage<DownloadRequest>(NULL);
+  inline BlockChecksums* New() const final {
+    return CreateMaybeMessage<BlockChecksums>(NULL);
   }
 
-  DownloadRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<DownloadRequest>(arena);
+  BlockChecksums* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<BlockChecksums>(arena);
   }
   void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
     final;
-  void CopyFrom(const DownloadRequest& from);
-  void MergeFrom(const DownloadRequest& from);
+  void CopyFrom(const BlockChecksums& from);
+  void MergeFrom(const BlockChecksums& from);
   void Clear() final;
   bool IsInitialized() const final;
 
@@ -1059,7 +1194,7 @@ class DownloadRequest : public ::google::protobuf::MessageLite /* @@protoc_inser
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(DownloadRequest* other);
+  void InternalSwap(BlockChecksums* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -1073,50 +1208,57 @@ class DownloadRequest : public ::google::protobuf::MessageLite /* @@protoc_inser
 
   // nested types ----------------------------------------------------
 
-  // accessors -------------------------------------------------------
+  typedef BlockChecksums_Checksum Checksum;
 
-  // string path = 1;
-  void clear_path();
-  static const int kPathFieldNumber = 1;
-  const ::std::string& path() const;
-  void set_path(const ::std::string& value);
-  #if LANG_CXX11
-  void set_path(::std::string&& value);
-  #endif
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  ::std::string* mutable_path();
-  ::std::string* release_path();
-  void set_allocated_path(::std::string* path);
+  // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.DownloadRequest)
+  // repeated .aspia.proto.file_transfer.BlockChecksums.Checksum checksum = 2;
+  int checksum_size() const;
+  void clear_checksum();
+  static const int kChecksumFieldNumber = 2;
+  ::aspia::proto::file_transfer::BlockChecksums_Checksum* mutable_checksum(int index);
+  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::BlockChecksums_Checksum >*
+      mutable_checksum();
+  const ::aspia::proto::file_transfer::BlockChecksums_Checksum& checksum(int index) const;
+  ::aspia::proto::file_transfer::BlockChecksums_Checksum* add_checksum();
+  const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::BlockChecksums_Checksum >&
+      checksum() const;
+
+  // uint32 block_size = 1;
+  void clear_block_size();
+  static const int kBlockSizeFieldNumber = 1;
+  ::google::protobuf::uint32 block_size() const;
+  void set_block_size(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.BlockChecksums)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr path_;
+  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::BlockChecksums_Checksum > checksum_;
+  ::google::protobuf::uint32 block_size_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class PacketRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.PacketRequest) */ {
+class BlockChecksumsRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.BlockChecksumsRequest) */ {
  public:
-  PacketRequest();
-  virtual ~PacketRequest();
+  BlockChecksumsRequest();
+  virtual ~BlockChecksumsRequest();
 
-  PacketRequest(const PacketRequest& from);
+  BlockChecksumsRequest(const BlockChecksumsRequest& from);
 
-  inline PacketRequest& operator=(const PacketRequest& from) {
+  inline BlockChecksumsRequest& operator=(const BlockChecksumsRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  PacketRequest(PacketRequest&& from) noexcept
-    : PacketRequest() {
+  BlockChecksumsRequest(BlockChecksumsRequest&& from) noexcept
+    : BlockChecksumsRequest() {
     *this = ::std::move(from);
   }
 
-  inline PacketRequest& operator=(PacketRequest&& from) noexcept {
+  inline BlockChecksumsRequest& operator=(BlockChecksumsRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -1125,34 +1267,34 @@ class PacketRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
     return *this;
   }
   #endif
-  static const PacketRequest& default_instance();
+  static const BlockChecksumsRequest& default_instance();
 
   static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const PacketRequest* internal_default_instance() {
-    return reinterpret_cast<const PacketRequest*>(
-               &_PacketRequest_default_instance_);
+  static inline const BlockChecksumsRequest* internal_default_instance() {
+    return reinterpret_cast<const BlockChecksumsRequest*>(
+               &_BlockChecksumsRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  void Swap(PacketRequest* other);
-  friend void swap(PacketRequest& a, PacketRequest& b) {
+  void Swap(BlockChecksumsRequest* other);
+  friend void swap(BlockChecksumsRequest& a, BlockChecksumsRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PacketRequest* New() const final {
-    return CreateMaybeMessage<PacketRequest>(NULL);
+  inline BlockChecksumsRequest* New() const final {
+    return CreateMaybeMessage<BlockChecksumsRequest>(NULL);
   }
 
-  PacketRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<PacketRequest>(arena);
+  BlockChecksumsRequest* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<BlockChecksumsRequest>(arena);
   }
   void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
     final;
-  void CopyFrom(const PacketRequest& from);
-  void MergeFrom(const PacketRequest& from);
+  void CopyFrom(const BlockChecksumsRequest& from);
+  void MergeFrom(const BlockChecksumsRequest& from);
   void Clear() final;
   bool IsInitialized() const final;
 
@@ -1168,7 +1310,7 @@ class PacketRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(PacketRequest* other);
+  void InternalSwap(BlockChecksumsRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -1184,40 +1326,48 @@ class PacketRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
 
   // accessors -------------------------------------------------------
 
-  // uint32 dummy = 1;
-  void clear_dummy();
-  static const int kDummyFieldNumber = 1;
-  ::google::protobuf::uint32 dummy() const;
-  void set_dummy(::google::protobuf::uint32 value);
+  // string path = 1;
+  void clear_path();
+  static const int kPathFieldNumber = 1;
+  const ::std::string& path() const;
+  void set_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_path(::std::string&& value);
+  #endif
+  void set_path(const char* value);
+  void set_path(const char* value, size_t size);
+  ::std::string* mutable_path();
+  ::std::string* release_path();
+  void set_allocated_path(::std::string* path);
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.PacketRequest)
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.BlockChecksumsRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::uint32 dummy_;
+  ::google::protobuf::internal::ArenaStringPtr path_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class Packet : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Packet) */ {
+class BundleEntry : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.BundleEntry) */ {
  public:
-  Packet();
-  virtual ~Packet();
+  BundleEntry();
+  virtual ~BundleEntry();
 
-  Packet(const Packet& from);
+  BundleEntry(const BundleEntry& from);
 
-  inline Packet& operator=(const Packet& from) {
+  inline BundleEntry& operator=(const BundleEntry& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  Packet(Packet&& from) noexcept
-    : Packet() {
+  BundleEntry(BundleEntry&& from) noexcept
+    : BundleEntry() {
     *this = ::std::move(from);
   }
 
-  inline Packet& operator=(Packet&& from) noexcept {
+  inline BundleEntry& operator=(BundleEntry&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -1226,34 +1376,34 @@ class Packet : public ::google::protobuf::MessageLite /* @@protoc_insertion_poin
     return *this;
   }
   #endif
-  static const Packet& default_instance();
+  static const BundleEntry& default_instance();
 
   static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Packet* internal_default_instance() {
-    return reinterpret_cast<const Packet*>(
-               &_Packet_default_instance_);
+  static inline const BundleEntry* internal_default_instance() {
+    return reinterpret_cast<const BundleEntry*>(
+               &_BundleEntry_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     9;
 
-  void Swap(Packet* other);
-  friend void swap(Packet& a, Packet& b) {
+  void Swap(BundleEntry* other);
+  friend void swap(BundleEntry& a, BundleEntry& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Packet* New() const final {
-    return CreateMaybeMessage<Packet>(NULL);
+  inline BundleEntry* New() const final {
+    return CreateMaybeMessage<BundleEntry>(NULL);
   }
 
-  Packet* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<Packet>(arena);
+  BundleEntry* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<BundleEntry>(arena);
   }
   void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
     final;
-  void CopyFrom(const Packet& from);
-  void MergeFrom(const Packet& from);
+  void CopyFrom(const BundleEntry& from);
+  void MergeFrom(const BundleEntry& from);
   void Clear() final;
   bool IsInitialized() const final;
 
@@ -1269,7 +1419,7 @@ class Packet : public ::google::protobuf::MessageLite /* @@protoc_insertion_poin
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(Packet* other);
+  void InternalSwap(BundleEntry* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -1283,83 +1433,100 @@ class Packet : public ::google::protobuf::MessageLite /* @@protoc_insertion_poin
 
   // nested types ----------------------------------------------------
 
-  typedef Packet_Flags Flags;
-  static const Flags FLAG_ERROR =
-    Packet_Flags_FLAG_ERROR;
-  static const Flags FLAG_PACKET =
-    Packet_Flags_FLAG_PACKET;
-  static const Flags FLAG_FIRST_PACKET =
-    Packet_Flags_FLAG_FIRST_PACKET;
-  static const Flags FLAG_LAST_PACKET =
-    Packet_Flags_FLAG_LAST_PACKET;
-  static inline bool Flags_IsValid(int value) {
-    return Packet_Flags_IsValid(value);
-  }
-  static const Flags Flags_MIN =
-    Packet_Flags_Flags_MIN;
-  static const Flags Flags_MAX =
-    Packet_Flags_Flags_MAX;
-  static const int Flags_ARRAYSIZE =
-    Packet_Flags_Flags_ARRAYSIZE;
-
   // accessors -------------------------------------------------------
 
-  // bytes data = 3;
-  void clear_data();
-  static const int kDataFieldNumber = 3;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
+  // string source_path = 2;
+  void clear_source_path();
+  static const int kSourcePathFieldNumber = 2;
+  const ::std::string& source_path() const;
+  void set_source_path(const ::std::string& value);
   #if LANG_CXX11
-  void set_data(::std::string&& value);
+  void set_source_path(::std::string&& value);
   #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  void set_source_path(const char* value);
+  void set_source_path(const char* value, size_t size);
+  ::std::string* mutable_source_path();
+  ::std::string* release_source_path();
+  void set_allocated_source_path(::std::string* source_path);
+
+  // string target_path = 3;
+  void clear_target_path();
+  static const int kTargetPathFieldNumber = 3;
+  const ::std::string& target_path() const;
+  void set_target_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_target_path(::std::string&& value);
+  #endif
+  void set_target_path(const char* value);
+  void set_target_path(const char* value, size_t size);
+  ::std::string* mutable_target_path();
+  ::std::string* release_target_path();
+  void set_allocated_target_path(::std::string* target_path);
+
+  // uint32 index = 1;
+  void clear_index();
+  static const int kIndexFieldNumber = 1;
+  ::google::protobuf::uint32 index() const;
+  void set_index(::google::protobuf::uint32 value);
+
+  // bool is_directory = 6;
+  void clear_is_directory();
+  static const int kIsDirectoryFieldNumber = 6;
+  bool is_directory() const;
+  void set_is_directory(bool value);
 
-  // uint64 file_size = 2;
-  void clear_file_size();
-  static const int kFileSizeFieldNumber = 2;
-  ::google::protobuf::uint64 file_size() const;
-  void set_file_size(::google::protobuf::uint64 value);
+  // uint64 size = 4;
+  void clear_size();
+  static const int kSizeFieldNumber = 4;
+  ::google::protobuf::uint64 size() const;
+  void set_size(::google::protobuf::uint64 value);
 
-  // uint32 flags = 1;
-  void clear_flags();
-  static const int kFlagsFieldNumber = 1;
-  ::google::protobuf::uint32 flags() const;
-  void set_flags(::google::protobuf::uint32 value);
+  // int64 modification_time = 5;
+  void clear_modification_time();
+  static const int kModificationTimeFieldNumber = 5;
+  ::google::protobuf::int64 modification_time() const;
+  void set_modification_time(::google::protobuf::int64 value);
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Packet)
+  // .aspia.proto.file_transfer.Status status = 7;
+  void clear_status();
+  static const int kStatusFieldNumber = 7;
+  ::aspia::proto::file_transfer::Status status() const;
+  void set_status(::aspia::proto::file_transfer::Status value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.BundleEntry)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  ::google::protobuf::uint64 file_size_;
-  ::google::protobuf::uint32 flags_;
+  ::google::protobuf::internal::ArenaStringPtr source_path_;
+  ::google::protobuf::internal::ArenaStringPtr target_path_;
+  ::google::protobuf::uint32 index_;
+  bool is_directory_;
+  ::google::protobuf::uint64 size_;
+  ::google::protobuf::int64 modification_time_;
+  int status_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class CreateDirectoryRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.CreateDirectoryRequest) */ {
+class Bundle : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Bundle) */ {
  public:
-  CreateDirectoryRequest();
-  virtual ~CreateDirectoryRequest();
+  Bundle();
+  virtual ~Bundle();
 
-  CreateDirectoryRequest(const CreateDirectoryRequest& from);
+  Bundle(const Bundle& from);
 
-  inline CreateDirectoryRequest& operator=(const CreateDirectoryRequest& from) {
+  inline Bundle& operator=(const Bundle& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  CreateDirectoryRequest(CreateDirectoryRequest&& from) noexcept
-    : CreateDirectoryRequest() {
+  Bundle(Bundle&& from) noexcept
+    : Bundle() {
     *this = ::std::move(from);
   }
 
-  inline CreateDirectoryRequest& operator=(CreateDirectoryRequest&& from) noexcept {
+  inline Bundle& operator=(Bundle&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -1368,34 +1535,34 @@ class CreateDirectoryRequest : public ::google::protobuf::MessageLite /* @@proto
     return *this;
   }
   #endif
-  static const CreateDirectoryRequest& default_instance();
+  static const Bundle& default_instance();
 
   static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const CreateDirectoryRequest* internal_default_instance() {
-    return reinterpret_cast<const CreateDirectoryRequest*>(
-               &_CreateDirectoryRequest_default_instance_);
+  static inline const Bundle* internal_default_instance() {
+    return reinterpret_cast<const Bundle*>(
+               &_Bundle_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  void Swap(CreateDirectoryRequest* other);
-  friend void swap(CreateDirectoryRequest& a, CreateDirectoryRequest& b) {
+  void Swap(Bundle* other);
+  friend void swap(Bundle& a, Bundle& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CreateDirectoryRequest* New() const final {
-    return CreateMaybeMessage<CreateDirectoryRequest>(NULL);
+  inline Bundle* New() const final {
+    return CreateMaybeMessage<Bundle>(NULL);
   }
 
-  CreateDirectoryRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<CreateDirectoryRequest>(arena);
+  Bundle* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<Bundle>(arena);
   }
   void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
     final;
-  void CopyFrom(const CreateDirectoryRequest& from);
-  void MergeFrom(const CreateDirectoryRequest& from);
+  void CopyFrom(const Bundle& from);
+  void MergeFrom(const Bundle& from);
   void Clear() final;
   bool IsInitialized() const final;
 
@@ -1411,7 +1578,7 @@ class CreateDirectoryRequest : public ::google::protobuf::MessageLite /* @@proto
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(CreateDirectoryRequest* other);
+  void InternalSwap(Bundle* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -1427,48 +1594,46 @@ class CreateDirectoryRequest : public ::google::protobuf::MessageLite /* @@proto
 
   // accessors -------------------------------------------------------
 
-  // string path = 1;
-  void clear_path();
-  static const int kPathFieldNumber = 1;
-  const ::std::string& path() const;
-  void set_path(const ::std::string& value);
-  #if LANG_CXX11
-  void set_path(::std::string&& value);
-  #endif
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  ::std::string* mutable_path();
-  ::std::string* release_path();
-  void set_allocated_path(::std::string* path);
-
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.CreateDirectoryRequest)
+  // repeated .aspia.proto.file_transfer.BundleEntry entry = 1;
+  int entry_size() const;
+  void clear_entry();
+  static const int kEntryFieldNumber = 1;
+  ::aspia::proto::file_transfer::BundleEntry* mutable_entry(int index);
+  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::BundleEntry >*
+      mutable_entry();
+  const ::aspia::proto::file_transfer::BundleEntry& entry(int index) const;
+  ::aspia::proto::file_transfer::BundleEntry* add_entry();
+  const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::BundleEntry >&
+      entry() const;
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Bundle)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr path_;
+  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::BundleEntry > entry_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class RenameRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.RenameRequest) */ {
+class UploadRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.UploadRequest) */ {
  public:
-  RenameRequest();
-  virtual ~RenameRequest();
+  UploadRequest();
+  virtual ~UploadRequest();
 
-  RenameRequest(const RenameRequest& from);
+  UploadRequest(const UploadRequest& from);
 
-  inline RenameRequest& operator=(const RenameRequest& from) {
+  inline UploadRequest& operator=(const UploadRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  RenameRequest(RenameRequest&& from) noexcept
-    : RenameRequest() {
+  UploadRequest(UploadRequest&& from) noexcept
+    : UploadRequest() {
     *this = ::std::move(from);
   }
 
-  inline RenameRequest& operator=(RenameRequest&& from) noexcept {
+  inline UploadRequest& operator=(UploadRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -1477,34 +1642,34 @@ class RenameRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
     return *this;
   }
   #endif
-  static const RenameRequest& default_instance();
+  static const UploadRequest& default_instance();
 
   static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RenameRequest* internal_default_instance() {
-    return reinterpret_cast<const RenameRequest*>(
-               &_RenameRequest_default_instance_);
+  static inline const UploadRequest* internal_default_instance() {
+    return reinterpret_cast<const UploadRequest*>(
+               &_UploadRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  void Swap(RenameRequest* other);
-  friend void swap(RenameRequest& a, RenameRequest& b) {
+  void Swap(UploadRequest* other);
+  friend void swap(UploadRequest& a, UploadRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RenameRequest* New() const final {
-    return CreateMaybeMessage<RenameRequest>(NULL);
+  inline UploadRequest* New() const final {
+    return CreateMaybeMessage<UploadRequest>(NULL);
   }
 
-  RenameRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<RenameRequest>(arena);
+  UploadRequest* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<UploadRequest>(arena);
   }
   void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
     final;
-  void CopyFrom(const RenameRequest& from);
-  void MergeFrom(const RenameRequest& from);
+  void CopyFrom(const UploadRequest& from);
+  void MergeFrom(const UploadRequest& from);
   void Clear() final;
   bool IsInitialized() const final;
 
@@ -1520,7 +1685,7 @@ class RenameRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(RenameRequest* other);
+  void InternalSwap(UploadRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -1536,63 +1701,97 @@ class RenameRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
 
   // accessors -------------------------------------------------------
 
-  // string old_name = 1;
-  void clear_old_name();
-  static const int kOldNameFieldNumber = 1;
-  const ::std::string& old_name() const;
-  void set_old_name(const ::std::string& value);
+  // string path = 1;
+  void clear_path();
+  static const int kPathFieldNumber = 1;
+  const ::std::string& path() const;
+  void set_path(const ::std::string& value);
   #if LANG_CXX11
-  void set_old_name(::std::string&& value);
+  void set_path(::std::string&& value);
   #endif
-  void set_old_name(const char* value);
-  void set_old_name(const char* value, size_t size);
-  ::std::string* mutable_old_name();
-  ::std::string* release_old_name();
-  void set_allocated_old_name(::std::string* old_name);
+  void set_path(const char* value);
+  void set_path(const char* value, size_t size);
+  ::std::string* mutable_path();
+  ::std::string* release_path();
+  void set_allocated_path(::std::string* path);
 
-  // string new_name = 2;
-  void clear_new_name();
-  static const int kNewNameFieldNumber = 2;
-  const ::std::string& new_name() const;
-  void set_new_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_new_name(::std::string&& value);
-  #endif
-  void set_new_name(const char* value);
-  void set_new_name(const char* value, size_t size);
-  ::std::string* mutable_new_name();
-  ::std::string* release_new_name();
-  void set_allocated_new_name(::std::string* new_name);
+  // uint32 window_size = 3;
+  void clear_window_size();
+  static const int kWindowSizeFieldNumber = 3;
+  ::google::protobuf::uint32 window_size() const;
+  void set_window_size(::google::protobuf::uint32 value);
+
+  // uint32 delta_block_size = 4;
+  void clear_delta_block_size();
+  static const int kDeltaBlockSizeFieldNumber = 4;
+  ::google::protobuf::uint32 delta_block_size() const;
+  void set_delta_block_size(::google::protobuf::uint32 value);
+
+  // uint64 offset = 5;
+  void clear_offset();
+  static const int kOffsetFieldNumber = 5;
+  ::google::protobuf::uint64 offset() const;
+  void set_offset(::google::protobuf::uint64 value);
+
+  // uint64 file_size = 6;
+  void clear_file_size();
+  static const int kFileSizeFieldNumber = 6;
+  ::google::protobuf::uint64 file_size() const;
+  void set_file_size(::google::protobuf::uint64 value);
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.RenameRequest)
+  // uint64 modification_time = 8;
+  void clear_modification_time();
+  static const int kModificationTimeFieldNumber = 8;
+  ::google::protobuf::uint64 modification_time() const;
+  void set_modification_time(::google::protobuf::uint64 value);
+
+  // bool overwrite = 2;
+  void clear_overwrite();
+  static const int kOverwriteFieldNumber = 2;
+  bool overwrite() const;
+  void set_overwrite(bool value);
+
+  // bool bundle = 7;
+  void clear_bundle();
+  static const int kBundleFieldNumber = 7;
+  bool bundle() const;
+  void set_bundle(bool value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.UploadRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr old_name_;
-  ::google::protobuf::internal::ArenaStringPtr new_name_;
+  ::google::protobuf::internal::ArenaStringPtr path_;
+  ::google::protobuf::uint32 window_size_;
+  ::google::protobuf::uint32 delta_block_size_;
+  ::google::protobuf::uint64 offset_;
+  ::google::protobuf::uint64 file_size_;
+  ::google::protobuf::uint64 modification_time_;
+  bool overwrite_;
+  bool bundle_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class RemoveRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.RemoveRequest) */ {
+class ResumeRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.ResumeRequest) */ {
  public:
-  RemoveRequest();
-  virtual ~RemoveRequest();
+  ResumeRequest();
+  virtual ~ResumeRequest();
 
-  RemoveRequest(const RemoveRequest& from);
+  ResumeRequest(const ResumeRequest& from);
 
-  inline RemoveRequest& operator=(const RemoveRequest& from) {
+  inline ResumeRequest& operator=(const ResumeRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  RemoveRequest(RemoveRequest&& from) noexcept
-    : RemoveRequest() {
+  ResumeRequest(ResumeRequest&& from) noexcept
+    : ResumeRequest() {
     *this = ::std::move(from);
   }
 
-  inline RemoveRequest& operator=(RemoveRequest&& from) noexcept {
+  inline ResumeRequest& operator=(ResumeRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -1601,34 +1800,34 @@ class RemoveRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
     return *this;
   }
   #endif
-  static const RemoveRequest& default_instance();
+  static const ResumeRequest& default_instance();
 
   static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RemoveRequest* internal_default_instance() {
-    return reinterpret_cast<const RemoveRequest*>(
-               &_RemoveRequest_default_instance_);
+  static inline const ResumeRequest* internal_default_instance() {
+    return reinterpret_cast<const ResumeRequest*>(
+               &_ResumeRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     12;
 
-  void Swap(RemoveRequest* other);
-  friend void swap(RemoveRequest& a, RemoveRequest& b) {
+  void Swap(ResumeRequest* other);
+  friend void swap(ResumeRequest& a, ResumeRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RemoveRequest* New() const final {
-    return CreateMaybeMessage<RemoveRequest>(NULL);
+  inline ResumeRequest* New() const final {
+    return CreateMaybeMessage<ResumeRequest>(NULL);
   }
 
-  RemoveRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<RemoveRequest>(arena);
+  ResumeRequest* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<ResumeRequest>(arena);
   }
   void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
     final;
-  void CopyFrom(const RemoveRequest& from);
-  void MergeFrom(const RemoveRequest& from);
+  void CopyFrom(const ResumeRequest& from);
+  void MergeFrom(const ResumeRequest& from);
   void Clear() final;
   bool IsInitialized() const final;
 
@@ -1644,7 +1843,7 @@ class RemoveRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(RemoveRequest* other);
+  void InternalSwap(ResumeRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -1674,34 +1873,48 @@ class RemoveRequest : public ::google::protobuf::MessageLite /* @@protoc_inserti
   ::std::string* release_path();
   void set_allocated_path(::std::string* path);
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.RemoveRequest)
+  // uint64 file_size = 2;
+  void clear_file_size();
+  static const int kFileSizeFieldNumber = 2;
+  ::google::protobuf::uint64 file_size() const;
+  void set_file_size(::google::protobuf::uint64 value);
+
+  // uint64 modification_time = 3;
+  void clear_modification_time();
+  static const int kModificationTimeFieldNumber = 3;
+  ::google::protobuf::uint64 modification_time() const;
+  void set_modification_time(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.ResumeRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
   ::google::protobuf::internal::ArenaStringPtr path_;
+  ::google::protobuf::uint64 file_size_;
+  ::google::protobuf::uint64 modification_time_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class Reply : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Reply) */ {
+class DownloadRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DownloadRequest) */ {
  public:
-  Reply();
-  virtual ~Reply();
+  DownloadRequest();
+  virtual ~DownloadRequest();
 
-  Reply(const Reply& from);
+  DownloadRequest(const DownloadRequest& from);
 
-  inline Reply& operator=(const Reply& from) {
+  inline DownloadRequest& operator=(const DownloadRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  Reply(Reply&& from) noexcept
-    : Reply() {
+  DownloadRequest(DownloadRequest&& from) noexcept
+    : DownloadRequest() {
     *this = ::std::move(from);
   }
 
-  inline Reply& operator=(Reply&& from) noexcept {
+  inline DownloadRequest& operator=(DownloadRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -1710,34 +1923,34 @@ class Reply : public ::google::protobuf::MessageLite /* @@protoc_insertion_point
     return *this;
   }
   #endif
-  static const Reply& default_instance();
+  static const DownloadRequest& default_instance();
 
   static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Reply* internal_default_instance() {
-    return reinterpret_cast<const Reply*>(
-               &_Reply_default_instance_);
+  static inline const DownloadRequest* internal_default_instance() {
+    return reinterpret_cast<const DownloadRequest*>(
+               &_DownloadRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     13;
 
-  void Swap(Reply* other);
-  friend void swap(Reply& a, Reply& b) {
+  void Swap(DownloadRequest* other);
+  friend void swap(DownloadRequest& a, DownloadRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Reply* New() const final {
-    return CreateMaybeMessage<Reply>(NULL);
+  inline DownloadRequest* New() const final {
+    return CreateMaybeMessage<DownloadRequest>(NULL);
   }
 
-  Reply* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<Reply>(arena);
+  DownloadRequest* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<DownloadRequest>(arena);
   }
   void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
     final;
-  void CopyFrom(const Reply& from);
-  void MergeFrom(const Reply& from);
+  void CopyFrom(const DownloadRequest& from);
+  void MergeFrom(const DownloadRequest& from);
   void Clear() final;
   bool IsInitialized() const final;
 
@@ -1753,7 +1966,7 @@ class Reply : public ::google::protobuf::MessageLite /* @@protoc_insertion_point
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(Reply* other);
+  void InternalSwap(DownloadRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -1769,79 +1982,103 @@ class Reply : public ::google::protobuf::MessageLite /* @@protoc_insertion_point
 
   // accessors -------------------------------------------------------
 
-  // .aspia.proto.file_transfer.DriveList drive_list = 2;
-  bool has_drive_list() const;
-  void clear_drive_list();
-  static const int kDriveListFieldNumber = 2;
-  private:
-  const ::aspia::proto::file_transfer::DriveList& _internal_drive_list() const;
-  public:
-  const ::aspia::proto::file_transfer::DriveList& drive_list() const;
-  ::aspia::proto::file_transfer::DriveList* release_drive_list();
-  ::aspia::proto::file_transfer::DriveList* mutable_drive_list();
-  void set_allocated_drive_list(::aspia::proto::file_transfer::DriveList* drive_list);
+  // string path = 1;
+  void clear_path();
+  static const int kPathFieldNumber = 1;
+  const ::std::string& path() const;
+  void set_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_path(::std::string&& value);
+  #endif
+  void set_path(const char* value);
+  void set_path(const char* value, size_t size);
+  ::std::string* mutable_path();
+  ::std::string* release_path();
+  void set_allocated_path(::std::string* path);
 
-  // .aspia.proto.file_transfer.FileList file_list = 3;
-  bool has_file_list() const;
-  void clear_file_list();
-  static const int kFileListFieldNumber = 3;
+  // bytes tail_hash = 5;
+  void clear_tail_hash();
+  static const int kTailHashFieldNumber = 5;
+  const ::std::string& tail_hash() const;
+  void set_tail_hash(const ::std::string& value);
+  #if LANG_CXX11
+  void set_tail_hash(::std::string&& value);
+  #endif
+  void set_tail_hash(const char* value);
+  void set_tail_hash(const void* value, size_t size);
+  ::std::string* mutable_tail_hash();
+  ::std::string* release_tail_hash();
+  void set_allocated_tail_hash(::std::string* tail_hash);
+
+  // .aspia.proto.file_transfer.BlockChecksums block_checksums = 3;
+  bool has_block_checksums() const;
+  void clear_block_checksums();
+  static const int kBlockChecksumsFieldNumber = 3;
   private:
-  const ::aspia::proto::file_transfer::FileList& _internal_file_list() const;
+  const ::aspia::proto::file_transfer::BlockChecksums& _internal_block_checksums() const;
   public:
-  const ::aspia::proto::file_transfer::FileList& file_list() const;
-  ::aspia::proto::file_transfer::FileList* release_file_list();
-  ::aspia::proto::file_transfer::FileList* mutable_file_list();
-  void set_allocated_file_list(::aspia::proto::file_transfer::FileList* file_list);
-
-  // .aspia.proto.file_transfer.Packet packet = 4;
-  bool has_packet() const;
-  void clear_packet();
-  static const int kPacketFieldNumber = 4;
+  const ::aspia::proto::file_transfer::BlockChecksums& block_checksums() const;
+  ::aspia::proto::file_transfer::BlockChecksums* release_block_checksums();
+  ::aspia::proto::file_transfer::BlockChecksums* mutable_block_checksums();
+  void set_allocated_block_checksums(::aspia::proto::file_transfer::BlockChecksums* block_checksums);
+
+  // .aspia.proto.file_transfer.Bundle bundle = 6;
+  bool has_bundle() const;
+  void clear_bundle();
+  static const int kBundleFieldNumber = 6;
   private:
-  const ::aspia::proto::file_transfer::Packet& _internal_packet() const;
+  const ::aspia::proto::file_transfer::Bundle& _internal_bundle() const;
   public:
-  const ::aspia::proto::file_transfer::Packet& packet() const;
-  ::aspia::proto::file_transfer::Packet* release_packet();
-  ::aspia::proto::file_transfer::Packet* mutable_packet();
-  void set_allocated_packet(::aspia::proto::file_transfer::Packet* packet);
+  const ::aspia::proto::file_transfer::Bundle& bundle() const;
+  ::aspia::proto::file_transfer::Bundle* release_bundle();
+  ::aspia::proto::file_transfer::Bundle* mutable_bundle();
+  void set_allocated_bundle(::aspia::proto::file_transfer::Bundle* bundle);
+
+  // uint64 offset = 4;
+  void clear_offset();
+  static const int kOffsetFieldNumber = 4;
+  ::google::protobuf::uint64 offset() const;
+  void set_offset(::google::protobuf::uint64 value);
+
+  // uint32 window_size = 2;
+  void clear_window_size();
+  static const int kWindowSizeFieldNumber = 2;
+  ::google::protobuf::uint32 window_size() const;
+  void set_window_size(::google::protobuf::uint32 value);
 
-  // .aspia.proto.file_transfer.Status status = 1;
-  void clear_status();
-  static const int kStatusFieldNumber = 1;
-  ::aspia::proto::file_transfer::Status status() const;
-  void set_status(::aspia::proto::file_transfer::Status value);
-
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Reply)
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.DownloadRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::file_transfer::DriveList* drive_list_;
-  ::aspia::proto::file_transfer::FileList* file_list_;
-  ::aspia::proto::file_transfer::Packet* packet_;
-  int status_;
+  ::google::protobuf::internal::ArenaStringPtr path_;
+  ::google::protobuf::internal::ArenaStringPtr tail_hash_;
+  ::aspia::proto::file_transfer::BlockChecksums* block_checksums_;
+  ::aspia::proto::file_transfer::Bundle* bundle_;
+  ::google::protobuf::uint64 offset_;
+  ::google::protobuf::uint32 window_size_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class Request : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Request) */ {
+class PacketRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.PacketRequest) */ {
  public:
-  Request();
-  virtual ~Request();
+  PacketRequest();
+  virtual ~PacketRequest();
 
-  Request(const Request& from);
+  PacketRequest(const PacketRequest& from);
 
-  inline Request& operator=(const Request& from) {
+  inline PacketRequest& operator=(const PacketRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  Request(Request&& from) noexcept
-    : Request() {
+  PacketRequest(PacketRequest&& from) noexcept
+    : PacketRequest() {
     *this = ::std::move(from);
   }
 
-  inline Request& operator=(Request&& from) noexcept {
+  inline PacketRequest& operator=(PacketRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -1850,34 +2087,34 @@ class Request : public ::google::protobuf::MessageLite /* @@protoc_insertion_poi
     return *this;
   }
   #endif
-  static const Request& default_instance();
+  static const PacketRequest& default_instance();
 
   static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Request* internal_default_instance() {
-    return reinterpret_cast<const Request*>(
-               &_Request_default_instance_);
+  static inline const PacketRequest* internal_default_instance() {
+    return reinterpret_cast<const PacketRequest*>(
+               &_PacketRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  void Swap(Request* other);
-  friend void swap(Request& a, Request& b) {
+  void Swap(PacketRequest* other);
+  friend void swap(PacketRequest& a, PacketRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Request* New() const final {
-    return CreateMaybeMessage<Request>(NULL);
+  inline PacketRequest* New() const final {
+    return CreateMaybeMessage<PacketRequest>(NULL);
   }
 
-  Request* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<Request>(arena);
-  }
+  PacketRequest* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<PacketRequest>(arena);
+  }
   void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
     final;
-  void CopyFrom(const Request& from);
-  void MergeFrom(const Request& from);
+  void CopyFrom(const PacketRequest& from);
+  void MergeFrom(const PacketRequest& from);
   void Clear() final;
   bool IsInitialized() const final;
 
@@ -1893,7 +2130,7 @@ class Request : public ::google::protobuf::MessageLite /* @@protoc_insertion_poi
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(Request* other);
+  void InternalSwap(PacketRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -1909,1083 +2146,4873 @@ class Request : public ::google::protobuf::MessageLite /* @@protoc_insertion_poi
 
   // accessors -------------------------------------------------------
 
-  // .aspia.proto.file_transfer.DriveListRequest drive_list_request = 1;
-  bool has_drive_list_request() const;
-  void clear_drive_list_request();
-  static const int kDriveListRequestFieldNumber = 1;
-  private:
-  const ::aspia::proto::file_transfer::DriveListRequest& _internal_drive_list_request() const;
-  public:
-  const ::aspia::proto::file_transfer::DriveListRequest& drive_list_request() const;
-  ::aspia::proto::file_transfer::DriveListRequest* release_drive_list_request();
-  ::aspia::proto::file_transfer::DriveListRequest* mutable_drive_list_request();
-  void set_allocated_drive_list_request(::aspia::proto::file_transfer::DriveListRequest* drive_list_request);
+  // uint32 dummy = 1;
+  void clear_dummy();
+  static const int kDummyFieldNumber = 1;
+  ::google::protobuf::uint32 dummy() const;
+  void set_dummy(::google::protobuf::uint32 value);
 
-  // .aspia.proto.file_transfer.FileListRequest file_list_request = 2;
-  bool has_file_list_request() const;
-  void clear_file_list_request();
-  static const int kFileListRequestFieldNumber = 2;
-  private:
-  const ::aspia::proto::file_transfer::FileListRequest& _internal_file_list_request() const;
-  public:
-  const ::aspia::proto::file_transfer::FileListRequest& file_list_request() const;
-  ::aspia::proto::file_transfer::FileListRequest* release_file_list_request();
-  ::aspia::proto::file_transfer::FileListRequest* mutable_file_list_request();
-  void set_allocated_file_list_request(::aspia::proto::file_transfer::FileListRequest* file_list_request);
+  // uint32 size = 2;
+  void clear_size();
+  static const int kSizeFieldNumber = 2;
+  ::google::protobuf::uint32 size() const;
+  void set_size(::google::protobuf::uint32 value);
 
-  // .aspia.proto.file_transfer.CreateDirectoryRequest create_directory_request = 3;
-  bool has_create_directory_request() const;
-  void clear_create_directory_request();
-  static const int kCreateDirectoryRequestFieldNumber = 3;
-  private:
-  const ::aspia::proto::file_transfer::CreateDirectoryRequest& _internal_create_directory_request() const;
-  public:
-  const ::aspia::proto::file_transfer::CreateDirectoryRequest& create_directory_request() const;
-  ::aspia::proto::file_transfer::CreateDirectoryRequest* release_create_directory_request();
-  ::aspia::proto::file_transfer::CreateDirectoryRequest* mutable_create_directory_request();
-  void set_allocated_create_directory_request(::aspia::proto::file_transfer::CreateDirectoryRequest* create_directory_request);
+  // .aspia.proto.file_transfer.Compression compression = 3;
+  void clear_compression();
+  static const int kCompressionFieldNumber = 3;
+  ::aspia::proto::file_transfer::Compression compression() const;
+  void set_compression(::aspia::proto::file_transfer::Compression value);
 
-  // .aspia.proto.file_transfer.RenameRequest rename_request = 4;
-  bool has_rename_request() const;
-  void clear_rename_request();
-  static const int kRenameRequestFieldNumber = 4;
-  private:
-  const ::aspia::proto::file_transfer::RenameRequest& _internal_rename_request() const;
-  public:
-  const ::aspia::proto::file_transfer::RenameRequest& rename_request() const;
-  ::aspia::proto::file_transfer::RenameRequest* release_rename_request();
-  ::aspia::proto::file_transfer::RenameRequest* mutable_rename_request();
-  void set_allocated_rename_request(::aspia::proto::file_transfer::RenameRequest* rename_request);
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.PacketRequest)
+ private:
 
-  // .aspia.proto.file_transfer.RemoveRequest remove_request = 5;
-  bool has_remove_request() const;
-  void clear_remove_request();
-  static const int kRemoveRequestFieldNumber = 5;
-  private:
-  const ::aspia::proto::file_transfer::RemoveRequest& _internal_remove_request() const;
-  public:
-  const ::aspia::proto::file_transfer::RemoveRequest& remove_request() const;
-  ::aspia::proto::file_transfer::RemoveRequest* release_remove_request();
-  ::aspia::proto::file_transfer::RemoveRequest* mutable_remove_request();
-  void set_allocated_remove_request(::aspia::proto::file_transfer::RemoveRequest* remove_request);
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::uint32 dummy_;
+  ::google::protobuf::uint32 size_;
+  int compression_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
 
-  // .aspia.proto.file_transfer.DownloadRequest download_request = 6;
-  bool has_download_request() const;
-  void clear_download_request();
-  static const int kDownloadRequestFieldNumber = 6;
-  private:
-  const ::aspia::proto::file_transfer::DownloadRequest& _internal_download_request() const;
-  public:
-  const ::aspia::proto::file_transfer::DownloadRequest& download_request() const;
-  ::aspia::proto::file_transfer::DownloadRequest* release_download_request();
-  ::aspia::proto::file_transfer::DownloadRequest* mutable_download_request();
-  void set_allocated_download_request(::aspia::proto::file_transfer::DownloadRequest* download_request);
+class DeltaOperation : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DeltaOperation) */ {
+ public:
+  DeltaOperation();
+  virtual ~DeltaOperation();
 
-  // .aspia.proto.file_transfer.UploadRequest upload_request = 7;
-  bool has_upload_request() const;
-  void clear_upload_request();
-  static const int kUploadRequestFieldNumber = 7;
-  private:
-  const ::aspia::proto::file_transfer::UploadRequest& _internal_upload_request() const;
-  public:
-  const ::aspia::proto::file_transfer::UploadRequest& upload_request() const;
-  ::aspia::proto::file_transfer::UploadRequest* release_upload_request();
-  ::aspia::proto::file_transfer::UploadRequest* mutable_upload_request();
-  void set_allocated_upload_request(::aspia::proto::file_transfer::UploadRequest* upload_request);
+  DeltaOperation(const DeltaOperation& from);
 
-  // .aspia.proto.file_transfer.PacketRequest packet_request = 8;
-  bool has_packet_request() const;
-  void clear_packet_request();
-  static const int kPacketRequestFieldNumber = 8;
-  private:
-  const ::aspia::proto::file_transfer::PacketRequest& _internal_packet_request() const;
-  public:
-  const ::aspia::proto::file_transfer::PacketRequest& packet_request() const;
-  ::aspia::proto::file_transfer::PacketRequest* release_packet_request();
-  ::aspia::proto::file_transfer::PacketRequest* mutable_packet_request();
-  void set_allocated_packet_request(::aspia::proto::file_transfer::PacketRequest* packet_request);
+  inline DeltaOperation& operator=(const DeltaOperation& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  DeltaOperation(DeltaOperation&& from) noexcept
+    : DeltaOperation() {
+    *this = ::std::move(from);
+  }
+
+  inline DeltaOperation& operator=(DeltaOperation&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const DeltaOperation& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const DeltaOperation* internal_default_instance() {
+    return reinterpret_cast<const DeltaOperation*>(
+               &_DeltaOperation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  void Swap(DeltaOperation* other);
+  friend void swap(DeltaOperation& a, DeltaOperation& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DeltaOperation* New() const final {
+    return CreateMaybeMessage<DeltaOperation>(NULL);
+  }
+
+  DeltaOperation* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<DeltaOperation>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const DeltaOperation& from);
+  void MergeFrom(const DeltaOperation& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
 
-  // .aspia.proto.file_transfer.Packet packet = 9;
-  bool has_packet() const;
-  void clear_packet();
-  static const int kPacketFieldNumber = 9;
   private:
-  const ::aspia::proto::file_transfer::Packet& _internal_packet() const;
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(DeltaOperation* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
   public:
-  const ::aspia::proto::file_transfer::Packet& packet() const;
-  ::aspia::proto::file_transfer::Packet* release_packet();
-  ::aspia::proto::file_transfer::Packet* mutable_packet();
-  void set_allocated_packet(::aspia::proto::file_transfer::Packet* packet);
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Request)
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // uint32 literal_size = 1;
+  void clear_literal_size();
+  static const int kLiteralSizeFieldNumber = 1;
+  ::google::protobuf::uint32 literal_size() const;
+  void set_literal_size(::google::protobuf::uint32 value);
+
+  // uint32 block_index = 2;
+  void clear_block_index();
+  static const int kBlockIndexFieldNumber = 2;
+  ::google::protobuf::uint32 block_index() const;
+  void set_block_index(::google::protobuf::uint32 value);
+
+  // uint32 block_count = 3;
+  void clear_block_count();
+  static const int kBlockCountFieldNumber = 3;
+  ::google::protobuf::uint32 block_count() const;
+  void set_block_count(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.DeltaOperation)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::file_transfer::DriveListRequest* drive_list_request_;
-  ::aspia::proto::file_transfer::FileListRequest* file_list_request_;
-  ::aspia::proto::file_transfer::CreateDirectoryRequest* create_directory_request_;
-  ::aspia::proto::file_transfer::RenameRequest* rename_request_;
-  ::aspia::proto::file_transfer::RemoveRequest* remove_request_;
-  ::aspia::proto::file_transfer::DownloadRequest* download_request_;
-  ::aspia::proto::file_transfer::UploadRequest* upload_request_;
-  ::aspia::proto::file_transfer::PacketRequest* packet_request_;
-  ::aspia::proto::file_transfer::Packet* packet_;
+  ::google::protobuf::uint32 literal_size_;
+  ::google::protobuf::uint32 block_index_;
+  ::google::protobuf::uint32 block_count_;
   mutable ::google::protobuf::internal::CachedSize _cached_size_;
   friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
 };
-// ===================================================================
+// -------------------------------------------------------------------
+
+class Packet : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Packet) */ {
+ public:
+  Packet();
+  virtual ~Packet();
 
+  Packet(const Packet& from);
 
-// ===================================================================
+  inline Packet& operator=(const Packet& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  Packet(Packet&& from) noexcept
+    : Packet() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// DriveList_Item
+  inline Packet& operator=(Packet&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const Packet& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Packet* internal_default_instance() {
+    return reinterpret_cast<const Packet*>(
+               &_Packet_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  void Swap(Packet* other);
+  friend void swap(Packet& a, Packet& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Packet* New() const final {
+    return CreateMaybeMessage<Packet>(NULL);
+  }
+
+  Packet* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<Packet>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const Packet& from);
+  void MergeFrom(const Packet& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Packet* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Packet_Flags Flags;
+  static const Flags FLAG_ERROR =
+    Packet_Flags_FLAG_ERROR;
+  static const Flags FLAG_PACKET =
+    Packet_Flags_FLAG_PACKET;
+  static const Flags FLAG_FIRST_PACKET =
+    Packet_Flags_FLAG_FIRST_PACKET;
+  static const Flags FLAG_LAST_PACKET =
+    Packet_Flags_FLAG_LAST_PACKET;
+  static inline bool Flags_IsValid(int value) {
+    return Packet_Flags_IsValid(value);
+  }
+  static const Flags Flags_MIN =
+    Packet_Flags_Flags_MIN;
+  static const Flags Flags_MAX =
+    Packet_Flags_Flags_MAX;
+  static const int Flags_ARRAYSIZE =
+    Packet_Flags_Flags_ARRAYSIZE;
+
+  // accessors -------------------------------------------------------
+
+  // repeated .aspia.proto.file_transfer.DeltaOperation operation = 6;
+  int operation_size() const;
+  void clear_operation();
+  static const int kOperationFieldNumber = 6;
+  ::aspia::proto::file_transfer::DeltaOperation* mutable_operation(int index);
+  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DeltaOperation >*
+      mutable_operation();
+  const ::aspia::proto::file_transfer::DeltaOperation& operation(int index) const;
+  ::aspia::proto::file_transfer::DeltaOperation* add_operation();
+  const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DeltaOperation >&
+      operation() const;
+
+  // bytes data = 3;
+  void clear_data();
+  static const int kDataFieldNumber = 3;
+  const ::std::string& data() const;
+  void set_data(const ::std::string& value);
+  #if LANG_CXX11
+  void set_data(::std::string&& value);
+  #endif
+  void set_data(const char* value);
+  void set_data(const void* value, size_t size);
+  ::std::string* mutable_data();
+  ::std::string* release_data();
+  void set_allocated_data(::std::string* data);
+
+  // bytes digest = 8;
+  void clear_digest();
+  static const int kDigestFieldNumber = 8;
+  const ::std::string& digest() const;
+  void set_digest(const ::std::string& value);
+  #if LANG_CXX11
+  void set_digest(::std::string&& value);
+  #endif
+  void set_digest(const char* value);
+  void set_digest(const void* value, size_t size);
+  ::std::string* mutable_digest();
+  ::std::string* release_digest();
+  void set_allocated_digest(::std::string* digest);
+
+  // uint64 file_size = 2;
+  void clear_file_size();
+  static const int kFileSizeFieldNumber = 2;
+  ::google::protobuf::uint64 file_size() const;
+  void set_file_size(::google::protobuf::uint64 value);
+
+  // uint32 flags = 1;
+  void clear_flags();
+  static const int kFlagsFieldNumber = 1;
+  ::google::protobuf::uint32 flags() const;
+  void set_flags(::google::protobuf::uint32 value);
+
+  // .aspia.proto.file_transfer.Compression compression = 4;
+  void clear_compression();
+  static const int kCompressionFieldNumber = 4;
+  ::aspia::proto::file_transfer::Compression compression() const;
+  void set_compression(::aspia::proto::file_transfer::Compression value);
+
+  // uint32 uncompressed_size = 5;
+  void clear_uncompressed_size();
+  static const int kUncompressedSizeFieldNumber = 5;
+  ::google::protobuf::uint32 uncompressed_size() const;
+  void set_uncompressed_size(::google::protobuf::uint32 value);
+
+  // uint32 delta_size = 7;
+  void clear_delta_size();
+  static const int kDeltaSizeFieldNumber = 7;
+  ::google::protobuf::uint32 delta_size() const;
+  void set_delta_size(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Packet)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DeltaOperation > operation_;
+  ::google::protobuf::internal::ArenaStringPtr data_;
+  ::google::protobuf::internal::ArenaStringPtr digest_;
+  ::google::protobuf::uint64 file_size_;
+  ::google::protobuf::uint32 flags_;
+  int compression_;
+  ::google::protobuf::uint32 uncompressed_size_;
+  ::google::protobuf::uint32 delta_size_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class CreateDirectoryRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.CreateDirectoryRequest) */ {
+ public:
+  CreateDirectoryRequest();
+  virtual ~CreateDirectoryRequest();
+
+  CreateDirectoryRequest(const CreateDirectoryRequest& from);
+
+  inline CreateDirectoryRequest& operator=(const CreateDirectoryRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  CreateDirectoryRequest(CreateDirectoryRequest&& from) noexcept
+    : CreateDirectoryRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CreateDirectoryRequest& operator=(CreateDirectoryRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const CreateDirectoryRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const CreateDirectoryRequest* internal_default_instance() {
+    return reinterpret_cast<const CreateDirectoryRequest*>(
+               &_CreateDirectoryRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  void Swap(CreateDirectoryRequest* other);
+  friend void swap(CreateDirectoryRequest& a, CreateDirectoryRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CreateDirectoryRequest* New() const final {
+    return CreateMaybeMessage<CreateDirectoryRequest>(NULL);
+  }
+
+  CreateDirectoryRequest* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<CreateDirectoryRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const CreateDirectoryRequest& from);
+  void MergeFrom(const CreateDirectoryRequest& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(CreateDirectoryRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string path = 1;
+  void clear_path();
+  static const int kPathFieldNumber = 1;
+  const ::std::string& path() const;
+  void set_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_path(::std::string&& value);
+  #endif
+  void set_path(const char* value);
+  void set_path(const char* value, size_t size);
+  ::std::string* mutable_path();
+  ::std::string* release_path();
+  void set_allocated_path(::std::string* path);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.CreateDirectoryRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr path_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class RenameRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.RenameRequest) */ {
+ public:
+  RenameRequest();
+  virtual ~RenameRequest();
+
+  RenameRequest(const RenameRequest& from);
+
+  inline RenameRequest& operator=(const RenameRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  RenameRequest(RenameRequest&& from) noexcept
+    : RenameRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RenameRequest& operator=(RenameRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const RenameRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const RenameRequest* internal_default_instance() {
+    return reinterpret_cast<const RenameRequest*>(
+               &_RenameRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  void Swap(RenameRequest* other);
+  friend void swap(RenameRequest& a, RenameRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline RenameRequest* New() const final {
+    return CreateMaybeMessage<RenameRequest>(NULL);
+  }
+
+  RenameRequest* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<RenameRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const RenameRequest& from);
+  void MergeFrom(const RenameRequest& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(RenameRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string old_name = 1;
+  void clear_old_name();
+  static const int kOldNameFieldNumber = 1;
+  const ::std::string& old_name() const;
+  void set_old_name(const ::std::string& value);
+  #if LANG_CXX11
+  void set_old_name(::std::string&& value);
+  #endif
+  void set_old_name(const char* value);
+  void set_old_name(const char* value, size_t size);
+  ::std::string* mutable_old_name();
+  ::std::string* release_old_name();
+  void set_allocated_old_name(::std::string* old_name);
+
+  // string new_name = 2;
+  void clear_new_name();
+  static const int kNewNameFieldNumber = 2;
+  const ::std::string& new_name() const;
+  void set_new_name(const ::std::string& value);
+  #if LANG_CXX11
+  void set_new_name(::std::string&& value);
+  #endif
+  void set_new_name(const char* value);
+  void set_new_name(const char* value, size_t size);
+  ::std::string* mutable_new_name();
+  ::std::string* release_new_name();
+  void set_allocated_new_name(::std::string* new_name);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.RenameRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr old_name_;
+  ::google::protobuf::internal::ArenaStringPtr new_name_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class RemoveRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.RemoveRequest) */ {
+ public:
+  RemoveRequest();
+  virtual ~RemoveRequest();
+
+  RemoveRequest(const RemoveRequest& from);
+
+  inline RemoveRequest& operator=(const RemoveRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  RemoveRequest(RemoveRequest&& from) noexcept
+    : RemoveRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RemoveRequest& operator=(RemoveRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const RemoveRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const RemoveRequest* internal_default_instance() {
+    return reinterpret_cast<const RemoveRequest*>(
+               &_RemoveRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  void Swap(RemoveRequest* other);
+  friend void swap(RemoveRequest& a, RemoveRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline RemoveRequest* New() const final {
+    return CreateMaybeMessage<RemoveRequest>(NULL);
+  }
+
+  RemoveRequest* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<RemoveRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const RemoveRequest& from);
+  void MergeFrom(const RemoveRequest& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(RemoveRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string path = 1;
+  void clear_path();
+  static const int kPathFieldNumber = 1;
+  const ::std::string& path() const;
+  void set_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_path(::std::string&& value);
+  #endif
+  void set_path(const char* value);
+  void set_path(const char* value, size_t size);
+  ::std::string* mutable_path();
+  ::std::string* release_path();
+  void set_allocated_path(::std::string* path);
+
+  // uint64 continuation = 3;
+  void clear_continuation();
+  static const int kContinuationFieldNumber = 3;
+  ::google::protobuf::uint64 continuation() const;
+  void set_continuation(::google::protobuf::uint64 value);
+
+  // bool recursive = 2;
+  void clear_recursive();
+  static const int kRecursiveFieldNumber = 2;
+  bool recursive() const;
+  void set_recursive(bool value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.RemoveRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr path_;
+  ::google::protobuf::uint64 continuation_;
+  bool recursive_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class RemoveProgress_Failure : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.RemoveProgress.Failure) */ {
+ public:
+  RemoveProgress_Failure();
+  virtual ~RemoveProgress_Failure();
+
+  RemoveProgress_Failure(const RemoveProgress_Failure& from);
+
+  inline RemoveProgress_Failure& operator=(const RemoveProgress_Failure& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  RemoveProgress_Failure(RemoveProgress_Failure&& from) noexcept
+    : RemoveProgress_Failure() {
+    *this = ::std::move(from);
+  }
+
+  inline RemoveProgress_Failure& operator=(RemoveProgress_Failure&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const RemoveProgress_Failure& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const RemoveProgress_Failure* internal_default_instance() {
+    return reinterpret_cast<const RemoveProgress_Failure*>(
+               &_RemoveProgress_Failure_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  void Swap(RemoveProgress_Failure* other);
+  friend void swap(RemoveProgress_Failure& a, RemoveProgress_Failure& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline RemoveProgress_Failure* New() const final {
+    return CreateMaybeMessage<RemoveProgress_Failure>(NULL);
+  }
+
+  RemoveProgress_Failure* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<RemoveProgress_Failure>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const RemoveProgress_Failure& from);
+  void MergeFrom(const RemoveProgress_Failure& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(RemoveProgress_Failure* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string path = 1;
+  void clear_path();
+  static const int kPathFieldNumber = 1;
+  const ::std::string& path() const;
+  void set_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_path(::std::string&& value);
+  #endif
+  void set_path(const char* value);
+  void set_path(const char* value, size_t size);
+  ::std::string* mutable_path();
+  ::std::string* release_path();
+  void set_allocated_path(::std::string* path);
+
+  // .aspia.proto.file_transfer.Status status = 2;
+  void clear_status();
+  static const int kStatusFieldNumber = 2;
+  ::aspia::proto::file_transfer::Status status() const;
+  void set_status(::aspia::proto::file_transfer::Status value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.RemoveProgress.Failure)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr path_;
+  int status_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class RemoveProgress : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.RemoveProgress) */ {
+ public:
+  RemoveProgress();
+  virtual ~RemoveProgress();
+
+  RemoveProgress(const RemoveProgress& from);
+
+  inline RemoveProgress& operator=(const RemoveProgress& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  RemoveProgress(RemoveProgress&& from) noexcept
+    : RemoveProgress() {
+    *this = ::std::move(from);
+  }
+
+  inline RemoveProgress& operator=(RemoveProgress&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const RemoveProgress& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const RemoveProgress* internal_default_instance() {
+    return reinterpret_cast<const RemoveProgress*>(
+               &_RemoveProgress_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  void Swap(RemoveProgress* other);
+  friend void swap(RemoveProgress& a, RemoveProgress& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline RemoveProgress* New() const final {
+    return CreateMaybeMessage<RemoveProgress>(NULL);
+  }
+
+  RemoveProgress* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<RemoveProgress>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const RemoveProgress& from);
+  void MergeFrom(const RemoveProgress& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(RemoveProgress* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef RemoveProgress_Failure Failure;
+
+  // accessors -------------------------------------------------------
+
+  // repeated .aspia.proto.file_transfer.RemoveProgress.Failure failure = 4;
+  int failure_size() const;
+  void clear_failure();
+  static const int kFailureFieldNumber = 4;
+  ::aspia::proto::file_transfer::RemoveProgress_Failure* mutable_failure(int index);
+  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::RemoveProgress_Failure >*
+      mutable_failure();
+  const ::aspia::proto::file_transfer::RemoveProgress_Failure& failure(int index) const;
+  ::aspia::proto::file_transfer::RemoveProgress_Failure* add_failure();
+  const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::RemoveProgress_Failure >&
+      failure() const;
+
+  // string current_path = 3;
+  void clear_current_path();
+  static const int kCurrentPathFieldNumber = 3;
+  const ::std::string& current_path() const;
+  void set_current_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_current_path(::std::string&& value);
+  #endif
+  void set_current_path(const char* value);
+  void set_current_path(const char* value, size_t size);
+  ::std::string* mutable_current_path();
+  ::std::string* release_current_path();
+  void set_allocated_current_path(::std::string* current_path);
+
+  // uint32 total = 1;
+  void clear_total();
+  static const int kTotalFieldNumber = 1;
+  ::google::protobuf::uint32 total() const;
+  void set_total(::google::protobuf::uint32 value);
+
+  // uint32 processed = 2;
+  void clear_processed();
+  static const int kProcessedFieldNumber = 2;
+  ::google::protobuf::uint32 processed() const;
+  void set_processed(::google::protobuf::uint32 value);
+
+  // uint64 continuation = 5;
+  void clear_continuation();
+  static const int kContinuationFieldNumber = 5;
+  ::google::protobuf::uint64 continuation() const;
+  void set_continuation(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.RemoveProgress)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::RemoveProgress_Failure > failure_;
+  ::google::protobuf::internal::ArenaStringPtr current_path_;
+  ::google::protobuf::uint32 total_;
+  ::google::protobuf::uint32 processed_;
+  ::google::protobuf::uint64 continuation_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class CopyRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.CopyRequest) */ {
+ public:
+  CopyRequest();
+  virtual ~CopyRequest();
+
+  CopyRequest(const CopyRequest& from);
+
+  inline CopyRequest& operator=(const CopyRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  CopyRequest(CopyRequest&& from) noexcept
+    : CopyRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CopyRequest& operator=(CopyRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const CopyRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const CopyRequest* internal_default_instance() {
+    return reinterpret_cast<const CopyRequest*>(
+               &_CopyRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  void Swap(CopyRequest* other);
+  friend void swap(CopyRequest& a, CopyRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CopyRequest* New() const final {
+    return CreateMaybeMessage<CopyRequest>(NULL);
+  }
+
+  CopyRequest* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<CopyRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const CopyRequest& from);
+  void MergeFrom(const CopyRequest& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(CopyRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string source_path = 1;
+  void clear_source_path();
+  static const int kSourcePathFieldNumber = 1;
+  const ::std::string& source_path() const;
+  void set_source_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_source_path(::std::string&& value);
+  #endif
+  void set_source_path(const char* value);
+  void set_source_path(const char* value, size_t size);
+  ::std::string* mutable_source_path();
+  ::std::string* release_source_path();
+  void set_allocated_source_path(::std::string* source_path);
+
+  // string target_path = 2;
+  void clear_target_path();
+  static const int kTargetPathFieldNumber = 2;
+  const ::std::string& target_path() const;
+  void set_target_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_target_path(::std::string&& value);
+  #endif
+  void set_target_path(const char* value);
+  void set_target_path(const char* value, size_t size);
+  ::std::string* mutable_target_path();
+  ::std::string* release_target_path();
+  void set_allocated_target_path(::std::string* target_path);
+
+  // uint64 continuation = 3;
+  void clear_continuation();
+  static const int kContinuationFieldNumber = 3;
+  ::google::protobuf::uint64 continuation() const;
+  void set_continuation(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.CopyRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr source_path_;
+  ::google::protobuf::internal::ArenaStringPtr target_path_;
+  ::google::protobuf::uint64 continuation_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class MoveRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.MoveRequest) */ {
+ public:
+  MoveRequest();
+  virtual ~MoveRequest();
+
+  MoveRequest(const MoveRequest& from);
+
+  inline MoveRequest& operator=(const MoveRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  MoveRequest(MoveRequest&& from) noexcept
+    : MoveRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MoveRequest& operator=(MoveRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const MoveRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MoveRequest* internal_default_instance() {
+    return reinterpret_cast<const MoveRequest*>(
+               &_MoveRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  void Swap(MoveRequest* other);
+  friend void swap(MoveRequest& a, MoveRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MoveRequest* New() const final {
+    return CreateMaybeMessage<MoveRequest>(NULL);
+  }
+
+  MoveRequest* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<MoveRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const MoveRequest& from);
+  void MergeFrom(const MoveRequest& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(MoveRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string source_path = 1;
+  void clear_source_path();
+  static const int kSourcePathFieldNumber = 1;
+  const ::std::string& source_path() const;
+  void set_source_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_source_path(::std::string&& value);
+  #endif
+  void set_source_path(const char* value);
+  void set_source_path(const char* value, size_t size);
+  ::std::string* mutable_source_path();
+  ::std::string* release_source_path();
+  void set_allocated_source_path(::std::string* source_path);
+
+  // string target_path = 2;
+  void clear_target_path();
+  static const int kTargetPathFieldNumber = 2;
+  const ::std::string& target_path() const;
+  void set_target_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_target_path(::std::string&& value);
+  #endif
+  void set_target_path(const char* value);
+  void set_target_path(const char* value, size_t size);
+  ::std::string* mutable_target_path();
+  ::std::string* release_target_path();
+  void set_allocated_target_path(::std::string* target_path);
+
+  // uint64 continuation = 3;
+  void clear_continuation();
+  static const int kContinuationFieldNumber = 3;
+  ::google::protobuf::uint64 continuation() const;
+  void set_continuation(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.MoveRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr source_path_;
+  ::google::protobuf::internal::ArenaStringPtr target_path_;
+  ::google::protobuf::uint64 continuation_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class CopyProgress : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.CopyProgress) */ {
+ public:
+  CopyProgress();
+  virtual ~CopyProgress();
+
+  CopyProgress(const CopyProgress& from);
+
+  inline CopyProgress& operator=(const CopyProgress& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  CopyProgress(CopyProgress&& from) noexcept
+    : CopyProgress() {
+    *this = ::std::move(from);
+  }
+
+  inline CopyProgress& operator=(CopyProgress&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const CopyProgress& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const CopyProgress* internal_default_instance() {
+    return reinterpret_cast<const CopyProgress*>(
+               &_CopyProgress_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  void Swap(CopyProgress* other);
+  friend void swap(CopyProgress& a, CopyProgress& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CopyProgress* New() const final {
+    return CreateMaybeMessage<CopyProgress>(NULL);
+  }
+
+  CopyProgress* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<CopyProgress>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const CopyProgress& from);
+  void MergeFrom(const CopyProgress& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(CopyProgress* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string current_path = 3;
+  void clear_current_path();
+  static const int kCurrentPathFieldNumber = 3;
+  const ::std::string& current_path() const;
+  void set_current_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_current_path(::std::string&& value);
+  #endif
+  void set_current_path(const char* value);
+  void set_current_path(const char* value, size_t size);
+  ::std::string* mutable_current_path();
+  ::std::string* release_current_path();
+  void set_allocated_current_path(::std::string* current_path);
+
+  // uint64 total_size = 1;
+  void clear_total_size();
+  static const int kTotalSizeFieldNumber = 1;
+  ::google::protobuf::uint64 total_size() const;
+  void set_total_size(::google::protobuf::uint64 value);
+
+  // uint64 copied_size = 2;
+  void clear_copied_size();
+  static const int kCopiedSizeFieldNumber = 2;
+  ::google::protobuf::uint64 copied_size() const;
+  void set_copied_size(::google::protobuf::uint64 value);
+
+  // uint64 continuation = 4;
+  void clear_continuation();
+  static const int kContinuationFieldNumber = 4;
+  ::google::protobuf::uint64 continuation() const;
+  void set_continuation(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.CopyProgress)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr current_path_;
+  ::google::protobuf::uint64 total_size_;
+  ::google::protobuf::uint64 copied_size_;
+  ::google::protobuf::uint64 continuation_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class Reply : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Reply) */ {
+ public:
+  Reply();
+  virtual ~Reply();
+
+  Reply(const Reply& from);
+
+  inline Reply& operator=(const Reply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  Reply(Reply&& from) noexcept
+    : Reply() {
+    *this = ::std::move(from);
+  }
+
+  inline Reply& operator=(Reply&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const Reply& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Reply* internal_default_instance() {
+    return reinterpret_cast<const Reply*>(
+               &_Reply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  void Swap(Reply* other);
+  friend void swap(Reply& a, Reply& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Reply* New() const final {
+    return CreateMaybeMessage<Reply>(NULL);
+  }
+
+  Reply* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<Reply>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const Reply& from);
+  void MergeFrom(const Reply& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Reply* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // bytes tail_hash = 10;
+  void clear_tail_hash();
+  static const int kTailHashFieldNumber = 10;
+  const ::std::string& tail_hash() const;
+  void set_tail_hash(const ::std::string& value);
+  #if LANG_CXX11
+  void set_tail_hash(::std::string&& value);
+  #endif
+  void set_tail_hash(const char* value);
+  void set_tail_hash(const void* value, size_t size);
+  ::std::string* mutable_tail_hash();
+  ::std::string* release_tail_hash();
+  void set_allocated_tail_hash(::std::string* tail_hash);
+
+  // .aspia.proto.file_transfer.DriveList drive_list = 2;
+  bool has_drive_list() const;
+  void clear_drive_list();
+  static const int kDriveListFieldNumber = 2;
+  private:
+  const ::aspia::proto::file_transfer::DriveList& _internal_drive_list() const;
+  public:
+  const ::aspia::proto::file_transfer::DriveList& drive_list() const;
+  ::aspia::proto::file_transfer::DriveList* release_drive_list();
+  ::aspia::proto::file_transfer::DriveList* mutable_drive_list();
+  void set_allocated_drive_list(::aspia::proto::file_transfer::DriveList* drive_list);
+
+  // .aspia.proto.file_transfer.FileList file_list = 3;
+  bool has_file_list() const;
+  void clear_file_list();
+  static const int kFileListFieldNumber = 3;
+  private:
+  const ::aspia::proto::file_transfer::FileList& _internal_file_list() const;
+  public:
+  const ::aspia::proto::file_transfer::FileList& file_list() const;
+  ::aspia::proto::file_transfer::FileList* release_file_list();
+  ::aspia::proto::file_transfer::FileList* mutable_file_list();
+  void set_allocated_file_list(::aspia::proto::file_transfer::FileList* file_list);
+
+  // .aspia.proto.file_transfer.Packet packet = 4;
+  bool has_packet() const;
+  void clear_packet();
+  static const int kPacketFieldNumber = 4;
+  private:
+  const ::aspia::proto::file_transfer::Packet& _internal_packet() const;
+  public:
+  const ::aspia::proto::file_transfer::Packet& packet() const;
+  ::aspia::proto::file_transfer::Packet* release_packet();
+  ::aspia::proto::file_transfer::Packet* mutable_packet();
+  void set_allocated_packet(::aspia::proto::file_transfer::Packet* packet);
+
+  // .aspia.proto.file_transfer.BlockChecksums block_checksums = 8;
+  bool has_block_checksums() const;
+  void clear_block_checksums();
+  static const int kBlockChecksumsFieldNumber = 8;
+  private:
+  const ::aspia::proto::file_transfer::BlockChecksums& _internal_block_checksums() const;
+  public:
+  const ::aspia::proto::file_transfer::BlockChecksums& block_checksums() const;
+  ::aspia::proto::file_transfer::BlockChecksums* release_block_checksums();
+  ::aspia::proto::file_transfer::BlockChecksums* mutable_block_checksums();
+  void set_allocated_block_checksums(::aspia::proto::file_transfer::BlockChecksums* block_checksums);
+
+  // .aspia.proto.file_transfer.Bundle bundle_failures = 12;
+  bool has_bundle_failures() const;
+  void clear_bundle_failures();
+  static const int kBundleFailuresFieldNumber = 12;
+  private:
+  const ::aspia::proto::file_transfer::Bundle& _internal_bundle_failures() const;
+  public:
+  const ::aspia::proto::file_transfer::Bundle& bundle_failures() const;
+  ::aspia::proto::file_transfer::Bundle* release_bundle_failures();
+  ::aspia::proto::file_transfer::Bundle* mutable_bundle_failures();
+  void set_allocated_bundle_failures(::aspia::proto::file_transfer::Bundle* bundle_failures);
+
+  // .aspia.proto.file_transfer.RemoveProgress remove_progress = 14;
+  bool has_remove_progress() const;
+  void clear_remove_progress();
+  static const int kRemoveProgressFieldNumber = 14;
+  private:
+  const ::aspia::proto::file_transfer::RemoveProgress& _internal_remove_progress() const;
+  public:
+  const ::aspia::proto::file_transfer::RemoveProgress& remove_progress() const;
+  ::aspia::proto::file_transfer::RemoveProgress* release_remove_progress();
+  ::aspia::proto::file_transfer::RemoveProgress* mutable_remove_progress();
+  void set_allocated_remove_progress(::aspia::proto::file_transfer::RemoveProgress* remove_progress);
+
+  // .aspia.proto.file_transfer.CopyProgress copy_progress = 15;
+  bool has_copy_progress() const;
+  void clear_copy_progress();
+  static const int kCopyProgressFieldNumber = 15;
+  private:
+  const ::aspia::proto::file_transfer::CopyProgress& _internal_copy_progress() const;
+  public:
+  const ::aspia::proto::file_transfer::CopyProgress& copy_progress() const;
+  ::aspia::proto::file_transfer::CopyProgress* release_copy_progress();
+  ::aspia::proto::file_transfer::CopyProgress* mutable_copy_progress();
+  void set_allocated_copy_progress(::aspia::proto::file_transfer::CopyProgress* copy_progress);
+
+  // .aspia.proto.file_transfer.Status status = 1;
+  void clear_status();
+  static const int kStatusFieldNumber = 1;
+  ::aspia::proto::file_transfer::Status status() const;
+  void set_status(::aspia::proto::file_transfer::Status value);
+
+  // uint32 window_size = 5;
+  void clear_window_size();
+  static const int kWindowSizeFieldNumber = 5;
+  ::google::protobuf::uint32 window_size() const;
+  void set_window_size(::google::protobuf::uint32 value);
+
+  // uint64 file_size = 6;
+  void clear_file_size();
+  static const int kFileSizeFieldNumber = 6;
+  ::google::protobuf::uint64 file_size() const;
+  void set_file_size(::google::protobuf::uint64 value);
+
+  // uint64 offset = 9;
+  void clear_offset();
+  static const int kOffsetFieldNumber = 9;
+  ::google::protobuf::uint64 offset() const;
+  void set_offset(::google::protobuf::uint64 value);
+
+  // .aspia.proto.file_transfer.Compression compression = 7;
+  void clear_compression();
+  static const int kCompressionFieldNumber = 7;
+  ::aspia::proto::file_transfer::Compression compression() const;
+  void set_compression(::aspia::proto::file_transfer::Compression value);
+
+  // uint32 max_streams = 11;
+  void clear_max_streams();
+  static const int kMaxStreamsFieldNumber = 11;
+  ::google::protobuf::uint32 max_streams() const;
+  void set_max_streams(::google::protobuf::uint32 value);
+
+  // uint64 modification_time = 16;
+  void clear_modification_time();
+  static const int kModificationTimeFieldNumber = 16;
+  ::google::protobuf::uint64 modification_time() const;
+  void set_modification_time(::google::protobuf::uint64 value);
+
+  // bool bundles = 13;
+  void clear_bundles();
+  static const int kBundlesFieldNumber = 13;
+  bool bundles() const;
+  void set_bundles(bool value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Reply)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr tail_hash_;
+  ::aspia::proto::file_transfer::DriveList* drive_list_;
+  ::aspia::proto::file_transfer::FileList* file_list_;
+  ::aspia::proto::file_transfer::Packet* packet_;
+  ::aspia::proto::file_transfer::BlockChecksums* block_checksums_;
+  ::aspia::proto::file_transfer::Bundle* bundle_failures_;
+  ::aspia::proto::file_transfer::RemoveProgress* remove_progress_;
+  ::aspia::proto::file_transfer::CopyProgress* copy_progress_;
+  int status_;
+  ::google::protobuf::uint32 window_size_;
+  ::google::protobuf::uint64 file_size_;
+  ::google::protobuf::uint64 offset_;
+  int compression_;
+  ::google::protobuf::uint32 max_streams_;
+  ::google::protobuf::uint64 modification_time_;
+  bool bundles_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class Request : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Request) */ {
+ public:
+  Request();
+  virtual ~Request();
+
+  Request(const Request& from);
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
+
+  inline Request& operator=(Request&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const Request& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  void Swap(Request* other);
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Request* New() const final {
+    return CreateMaybeMessage<Request>(NULL);
+  }
+
+  Request* New(::google::protobuf::Arena* arena) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    final;
+  void CopyFrom(const Request& from);
+  void MergeFrom(const Request& from);
+  void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) final;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Request* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .aspia.proto.file_transfer.DriveListRequest drive_list_request = 1;
+  bool has_drive_list_request() const;
+  void clear_drive_list_request();
+  static const int kDriveListRequestFieldNumber = 1;
+  private:
+  const ::aspia::proto::file_transfer::DriveListRequest& _internal_drive_list_request() const;
+  public:
+  const ::aspia::proto::file_transfer::DriveListRequest& drive_list_request() const;
+  ::aspia::proto::file_transfer::DriveListRequest* release_drive_list_request();
+  ::aspia::proto::file_transfer::DriveListRequest* mutable_drive_list_request();
+  void set_allocated_drive_list_request(::aspia::proto::file_transfer::DriveListRequest* drive_list_request);
+
+  // .aspia.proto.file_transfer.FileListRequest file_list_request = 2;
+  bool has_file_list_request() const;
+  void clear_file_list_request();
+  static const int kFileListRequestFieldNumber = 2;
+  private:
+  const ::aspia::proto::file_transfer::FileListRequest& _internal_file_list_request() const;
+  public:
+  const ::aspia::proto::file_transfer::FileListRequest& file_list_request() const;
+  ::aspia::proto::file_transfer::FileListRequest* release_file_list_request();
+  ::aspia::proto::file_transfer::FileListRequest* mutable_file_list_request();
+  void set_allocated_file_list_request(::aspia::proto::file_transfer::FileListRequest* file_list_request);
+
+  // .aspia.proto.file_transfer.CreateDirectoryRequest create_directory_request = 3;
+  bool has_create_directory_request() const;
+  void clear_create_directory_request();
+  static const int kCreateDirectoryRequestFieldNumber = 3;
+  private:
+  const ::aspia::proto::file_transfer::CreateDirectoryRequest& _internal_create_directory_request() const;
+  public:
+  const ::aspia::proto::file_transfer::CreateDirectoryRequest& create_directory_request() const;
+  ::aspia::proto::file_transfer::CreateDirectoryRequest* release_create_directory_request();
+  ::aspia::proto::file_transfer::CreateDirectoryRequest* mutable_create_directory_request();
+  void set_allocated_create_directory_request(::aspia::proto::file_transfer::CreateDirectoryRequest* create_directory_request);
+
+  // .aspia.proto.file_transfer.RenameRequest rename_request = 4;
+  bool has_rename_request() const;
+  void clear_rename_request();
+  static const int kRenameRequestFieldNumber = 4;
+  private:
+  const ::aspia::proto::file_transfer::RenameRequest& _internal_rename_request() const;
+  public:
+  const ::aspia::proto::file_transfer::RenameRequest& rename_request() const;
+  ::aspia::proto::file_transfer::RenameRequest* release_rename_request();
+  ::aspia::proto::file_transfer::RenameRequest* mutable_rename_request();
+  void set_allocated_rename_request(::aspia::proto::file_transfer::RenameRequest* rename_request);
+
+  // .aspia.proto.file_transfer.RemoveRequest remove_request = 5;
+  bool has_remove_request() const;
+  void clear_remove_request();
+  static const int kRemoveRequestFieldNumber = 5;
+  private:
+  const ::aspia::proto::file_transfer::RemoveRequest& _internal_remove_request() const;
+  public:
+  const ::aspia::proto::file_transfer::RemoveRequest& remove_request() const;
+  ::aspia::proto::file_transfer::RemoveRequest* release_remove_request();
+  ::aspia::proto::file_transfer::RemoveRequest* mutable_remove_request();
+  void set_allocated_remove_request(::aspia::proto::file_transfer::RemoveRequest* remove_request);
+
+  // .aspia.proto.file_transfer.DownloadRequest download_request = 6;
+  bool has_download_request() const;
+  void clear_download_request();
+  static const int kDownloadRequestFieldNumber = 6;
+  private:
+  const ::aspia::proto::file_transfer::DownloadRequest& _internal_download_request() const;
+  public:
+  const ::aspia::proto::file_transfer::DownloadRequest& download_request() const;
+  ::aspia::proto::file_transfer::DownloadRequest* release_download_request();
+  ::aspia::proto::file_transfer::DownloadRequest* mutable_download_request();
+  void set_allocated_download_request(::aspia::proto::file_transfer::DownloadRequest* download_request);
+
+  // .aspia.proto.file_transfer.UploadRequest upload_request = 7;
+  bool has_upload_request() const;
+  void clear_upload_request();
+  static const int kUploadRequestFieldNumber = 7;
+  private:
+  const ::aspia::proto::file_transfer::UploadRequest& _internal_upload_request() const;
+  public:
+  const ::aspia::proto::file_transfer::UploadRequest& upload_request() const;
+  ::aspia::proto::file_transfer::UploadRequest* release_upload_request();
+  ::aspia::proto::file_transfer::UploadRequest* mutable_upload_request();
+  void set_allocated_upload_request(::aspia::proto::file_transfer::UploadRequest* upload_request);
+
+  // .aspia.proto.file_transfer.PacketRequest packet_request = 8;
+  bool has_packet_request() const;
+  void clear_packet_request();
+  static const int kPacketRequestFieldNumber = 8;
+  private:
+  const ::aspia::proto::file_transfer::PacketRequest& _internal_packet_request() const;
+  public:
+  const ::aspia::proto::file_transfer::PacketRequest& packet_request() const;
+  ::aspia::proto::file_transfer::PacketRequest* release_packet_request();
+  ::aspia::proto::file_transfer::PacketRequest* mutable_packet_request();
+  void set_allocated_packet_request(::aspia::proto::file_transfer::PacketRequest* packet_request);
+
+  // .aspia.proto.file_transfer.Packet packet = 9;
+  bool has_packet() const;
+  void clear_packet();
+  static const int kPacketFieldNumber = 9;
+  private:
+  const ::aspia::proto::file_transfer::Packet& _internal_packet() const;
+  public:
+  const ::aspia::proto::file_transfer::Packet& packet() const;
+  ::aspia::proto::file_transfer::Packet* release_packet();
+  ::aspia::proto::file_transfer::Packet* mutable_packet();
+  void set_allocated_packet(::aspia::proto::file_transfer::Packet* packet);
+
+  // .aspia.proto.file_transfer.BlockChecksumsRequest block_checksums_request = 10;
+  bool has_block_checksums_request() const;
+  void clear_block_checksums_request();
+  static const int kBlockChecksumsRequestFieldNumber = 10;
+  private:
+  const ::aspia::proto::file_transfer::BlockChecksumsRequest& _internal_block_checksums_request() const;
+  public:
+  const ::aspia::proto::file_transfer::BlockChecksumsRequest& block_checksums_request() const;
+  ::aspia::proto::file_transfer::BlockChecksumsRequest* release_block_checksums_request();
+  ::aspia::proto::file_transfer::BlockChecksumsRequest* mutable_block_checksums_request();
+  void set_allocated_block_checksums_request(::aspia::proto::file_transfer::BlockChecksumsRequest* block_checksums_request);
+
+  // .aspia.proto.file_transfer.ResumeRequest resume_request = 11;
+  bool has_resume_request() const;
+  void clear_resume_request();
+  static const int kResumeRequestFieldNumber = 11;
+  private:
+  const ::aspia::proto::file_transfer::ResumeRequest& _internal_resume_request() const;
+  public:
+  const ::aspia::proto::file_transfer::ResumeRequest& resume_request() const;
+  ::aspia::proto::file_transfer::ResumeRequest* release_resume_request();
+  ::aspia::proto::file_transfer::ResumeRequest* mutable_resume_request();
+  void set_allocated_resume_request(::aspia::proto::file_transfer::ResumeRequest* resume_request);
+
+  // .aspia.proto.file_transfer.CopyRequest copy_request = 13;
+  bool has_copy_request() const;
+  void clear_copy_request();
+  static const int kCopyRequestFieldNumber = 13;
+  private:
+  const ::aspia::proto::file_transfer::CopyRequest& _internal_copy_request() const;
+  public:
+  const ::aspia::proto::file_transfer::CopyRequest& copy_request() const;
+  ::aspia::proto::file_transfer::CopyRequest* release_copy_request();
+  ::aspia::proto::file_transfer::CopyRequest* mutable_copy_request();
+  void set_allocated_copy_request(::aspia::proto::file_transfer::CopyRequest* copy_request);
+
+  // .aspia.proto.file_transfer.MoveRequest move_request = 14;
+  bool has_move_request() const;
+  void clear_move_request();
+  static const int kMoveRequestFieldNumber = 14;
+  private:
+  const ::aspia::proto::file_transfer::MoveRequest& _internal_move_request() const;
+  public:
+  const ::aspia::proto::file_transfer::MoveRequest& move_request() const;
+  ::aspia::proto::file_transfer::MoveRequest* release_move_request();
+  ::aspia::proto::file_transfer::MoveRequest* mutable_move_request();
+  void set_allocated_move_request(::aspia::proto::file_transfer::MoveRequest* move_request);
+
+  // uint32 stream_id = 12;
+  void clear_stream_id();
+  static const int kStreamIdFieldNumber = 12;
+  ::google::protobuf::uint32 stream_id() const;
+  void set_stream_id(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Request)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::aspia::proto::file_transfer::DriveListRequest* drive_list_request_;
+  ::aspia::proto::file_transfer::FileListRequest* file_list_request_;
+  ::aspia::proto::file_transfer::CreateDirectoryRequest* create_directory_request_;
+  ::aspia::proto::file_transfer::RenameRequest* rename_request_;
+  ::aspia::proto::file_transfer::RemoveRequest* remove_request_;
+  ::aspia::proto::file_transfer::DownloadRequest* download_request_;
+  ::aspia::proto::file_transfer::UploadRequest* upload_request_;
+  ::aspia::proto::file_transfer::PacketRequest* packet_request_;
+  ::aspia::proto::file_transfer::Packet* packet_;
+  ::aspia::proto::file_transfer::BlockChecksumsRequest* block_checksums_request_;
+  ::aspia::proto::file_transfer::ResumeRequest* resume_request_;
+  ::aspia::proto::file_transfer::CopyRequest* copy_request_;
+  ::aspia::proto::file_transfer::MoveRequest* move_request_;
+  ::google::protobuf::uint32 stream_id_;
+  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// DriveList_Item
+
+// .aspia.proto.file_transfer.DriveList.Item.Type type = 1;
+inline void DriveList_Item::clear_type() {
+  type_ = 0;
+}
+inline ::aspia::proto::file_transfer::DriveList_Item_Type DriveList_Item::type() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.Item.type)
+  return static_cast< ::aspia::proto::file_transfer::DriveList_Item_Type >(type_);
+}
+inline void DriveList_Item::set_type(::aspia::proto::file_transfer::DriveList_Item_Type value) {
+  
+  type_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveList.Item.type)
+}
+
+// string path = 2;
+inline void DriveList_Item::clear_path() {
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& DriveList_Item::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.Item.path)
+  return path_.GetNoArena();
+}
+inline void DriveList_Item::set_path(const ::std::string& value) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveList.Item.path)
+}
+#if LANG_CXX11
+inline void DriveList_Item::set_path(::std::string&& value) {
+  
+  path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.DriveList.Item.path)
+}
+#endif
+inline void DriveList_Item::set_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.DriveList.Item.path)
+}
+inline void DriveList_Item::set_path(const char* value, size_t size) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.DriveList.Item.path)
+}
+inline ::std::string* DriveList_Item::mutable_path() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DriveList.Item.path)
+  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* DriveList_Item::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.DriveList.Item.path)
+  
+  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void DriveList_Item::set_allocated_path(::std::string* path) {
+  if (path != NULL) {
+    
+  } else {
+    
+  }
+  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.DriveList.Item.path)
+}
+
+// -------------------------------------------------------------------
+
+// DriveList
+
+// repeated .aspia.proto.file_transfer.DriveList.Item item = 1;
+inline int DriveList::item_size() const {
+  return item_.size();
+}
+inline void DriveList::clear_item() {
+  item_.Clear();
+}
+inline ::aspia::proto::file_transfer::DriveList_Item* DriveList::mutable_item(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DriveList.item)
+  return item_.Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >*
+DriveList::mutable_item() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.DriveList.item)
+  return &item_;
+}
+inline const ::aspia::proto::file_transfer::DriveList_Item& DriveList::item(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.item)
+  return item_.Get(index);
+}
+inline ::aspia::proto::file_transfer::DriveList_Item* DriveList::add_item() {
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.DriveList.item)
+  return item_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >&
+DriveList::item() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.DriveList.item)
+  return item_;
+}
+
+// -------------------------------------------------------------------
+
+// DriveListRequest
+
+// uint32 dummy = 1;
+inline void DriveListRequest::clear_dummy() {
+  dummy_ = 0u;
+}
+inline ::google::protobuf::uint32 DriveListRequest::dummy() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveListRequest.dummy)
+  return dummy_;
+}
+inline void DriveListRequest::set_dummy(::google::protobuf::uint32 value) {
+  
+  dummy_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveListRequest.dummy)
+}
+
+// -------------------------------------------------------------------
+
+// FileList_Item
+
+// string name = 1;
+inline void FileList_Item::clear_name() {
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& FileList_Item::name() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.name)
+  return name_.GetNoArena();
+}
+inline void FileList_Item::set_name(const ::std::string& value) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.name)
+}
+#if LANG_CXX11
+inline void FileList_Item::set_name(::std::string&& value) {
+  
+  name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.FileList.Item.name)
+}
+#endif
+inline void FileList_Item::set_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.FileList.Item.name)
+}
+inline void FileList_Item::set_name(const char* value, size_t size) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.FileList.Item.name)
+}
+inline ::std::string* FileList_Item::mutable_name() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileList.Item.name)
+  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* FileList_Item::release_name() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.FileList.Item.name)
+  
+  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void FileList_Item::set_allocated_name(::std::string* name) {
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.FileList.Item.name)
+}
+
+// uint64 size = 2;
+inline void FileList_Item::clear_size() {
+  size_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 FileList_Item::size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.size)
+  return size_;
+}
+inline void FileList_Item::set_size(::google::protobuf::uint64 value) {
+  
+  size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.size)
+}
+
+// int64 modification_time = 3;
+inline void FileList_Item::clear_modification_time() {
+  modification_time_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 FileList_Item::modification_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.modification_time)
+  return modification_time_;
+}
+inline void FileList_Item::set_modification_time(::google::protobuf::int64 value) {
+  
+  modification_time_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.modification_time)
+}
+
+// bool is_directory = 4;
+inline void FileList_Item::clear_is_directory() {
+  is_directory_ = false;
+}
+inline bool FileList_Item::is_directory() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.is_directory)
+  return is_directory_;
+}
+inline void FileList_Item::set_is_directory(bool value) {
+  
+  is_directory_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.is_directory)
+}
+
+// -------------------------------------------------------------------
+
+// FileList
+
+// repeated .aspia.proto.file_transfer.FileList.Item item = 1;
+inline int FileList::item_size() const {
+  return item_.size();
+}
+inline void FileList::clear_item() {
+  item_.Clear();
+}
+inline ::aspia::proto::file_transfer::FileList_Item* FileList::mutable_item(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileList.item)
+  return item_.Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >*
+FileList::mutable_item() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.FileList.item)
+  return &item_;
+}
+inline const ::aspia::proto::file_transfer::FileList_Item& FileList::item(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.item)
+  return item_.Get(index);
+}
+inline ::aspia::proto::file_transfer::FileList_Item* FileList::add_item() {
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.FileList.item)
+  return item_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >&
+FileList::item() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.FileList.item)
+  return item_;
+}
+
+// bool recursive = 2;
+inline void FileList::clear_recursive() {
+  recursive_ = false;
+}
+inline bool FileList::recursive() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.recursive)
+  return recursive_;
+}
+inline void FileList::set_recursive(bool value) {
+  
+  recursive_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.recursive)
+}
+
+// uint64 continuation = 3;
+inline void FileList::clear_continuation() {
+  continuation_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 FileList::continuation() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.continuation)
+  return continuation_;
+}
+inline void FileList::set_continuation(::google::protobuf::uint64 value) {
+  
+  continuation_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.continuation)
+}
+
+// uint64 version = 4;
+inline void FileList::clear_version() {
+  version_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 FileList::version() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.version)
+  return version_;
+}
+inline void FileList::set_version(::google::protobuf::uint64 value) {
+  
+  version_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.version)
+}
+
+// bool not_modified = 5;
+inline void FileList::clear_not_modified() {
+  not_modified_ = false;
+}
+inline bool FileList::not_modified() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.not_modified)
+  return not_modified_;
+}
+inline void FileList::set_not_modified(bool value) {
+  
+  not_modified_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.not_modified)
+}
+
+// bool delta = 6;
+inline void FileList::clear_delta() {
+  delta_ = false;
+}
+inline bool FileList::delta() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.delta)
+  return delta_;
+}
+inline void FileList::set_delta(bool value) {
+  
+  delta_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.delta)
+}
+
+// repeated .aspia.proto.file_transfer.FileList.Item removed_item = 7;
+inline int FileList::removed_item_size() const {
+  return removed_item_.size();
+}
+inline void FileList::clear_removed_item() {
+  removed_item_.Clear();
+}
+inline ::aspia::proto::file_transfer::FileList_Item* FileList::mutable_removed_item(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileList.removed_item)
+  return removed_item_.Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >*
+FileList::mutable_removed_item() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.FileList.removed_item)
+  return &removed_item_;
+}
+inline const ::aspia::proto::file_transfer::FileList_Item& FileList::removed_item(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.removed_item)
+  return removed_item_.Get(index);
+}
+inline ::aspia::proto::file_transfer::FileList_Item* FileList::add_removed_item() {
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.FileList.removed_item)
+  return removed_item_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >&
+FileList::removed_item() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.FileList.removed_item)
+  return removed_item_;
+}
+
+// -------------------------------------------------------------------
+
+// FileListRequest
+
+// string path = 1;
+inline void FileListRequest::clear_path() {
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& FileListRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.path)
+  return path_.GetNoArena();
+}
+inline void FileListRequest::set_path(const ::std::string& value) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.path)
+}
+#if LANG_CXX11
+inline void FileListRequest::set_path(::std::string&& value) {
+  
+  path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.FileListRequest.path)
+}
+#endif
+inline void FileListRequest::set_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.FileListRequest.path)
+}
+inline void FileListRequest::set_path(const char* value, size_t size) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.FileListRequest.path)
+}
+inline ::std::string* FileListRequest::mutable_path() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileListRequest.path)
+  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* FileListRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.FileListRequest.path)
+  
+  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void FileListRequest::set_allocated_path(::std::string* path) {
+  if (path != NULL) {
+    
+  } else {
+    
+  }
+  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.FileListRequest.path)
+}
+
+// bool recursive = 2;
+inline void FileListRequest::clear_recursive() {
+  recursive_ = false;
+}
+inline bool FileListRequest::recursive() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.recursive)
+  return recursive_;
+}
+inline void FileListRequest::set_recursive(bool value) {
+  
+  recursive_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.recursive)
+}
+
+// uint64 continuation = 3;
+inline void FileListRequest::clear_continuation() {
+  continuation_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 FileListRequest::continuation() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.continuation)
+  return continuation_;
+}
+inline void FileListRequest::set_continuation(::google::protobuf::uint64 value) {
+  
+  continuation_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.continuation)
+}
+
+// bool paged = 4;
+inline void FileListRequest::clear_paged() {
+  paged_ = false;
+}
+inline bool FileListRequest::paged() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.paged)
+  return paged_;
+}
+inline void FileListRequest::set_paged(bool value) {
+  
+  paged_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.paged)
+}
+
+// uint64 cached_version = 5;
+inline void FileListRequest::clear_cached_version() {
+  cached_version_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 FileListRequest::cached_version() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.cached_version)
+  return cached_version_;
+}
+inline void FileListRequest::set_cached_version(::google::protobuf::uint64 value) {
+  
+  cached_version_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.cached_version)
+}
+
+// -------------------------------------------------------------------
+
+// BlockChecksums_Checksum
+
+// uint32 weak = 1;
+inline void BlockChecksums_Checksum::clear_weak() {
+  weak_ = 0u;
+}
+inline ::google::protobuf::uint32 BlockChecksums_Checksum::weak() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BlockChecksums.Checksum.weak)
+  return weak_;
+}
+inline void BlockChecksums_Checksum::set_weak(::google::protobuf::uint32 value) {
+  
+  weak_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BlockChecksums.Checksum.weak)
+}
+
+// bytes strong = 2;
+inline void BlockChecksums_Checksum::clear_strong() {
+  strong_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& BlockChecksums_Checksum::strong() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BlockChecksums.Checksum.strong)
+  return strong_.GetNoArena();
+}
+inline void BlockChecksums_Checksum::set_strong(const ::std::string& value) {
+  
+  strong_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BlockChecksums.Checksum.strong)
+}
+#if LANG_CXX11
+inline void BlockChecksums_Checksum::set_strong(::std::string&& value) {
+  
+  strong_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.BlockChecksums.Checksum.strong)
+}
+#endif
+inline void BlockChecksums_Checksum::set_strong(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  strong_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.BlockChecksums.Checksum.strong)
+}
+inline void BlockChecksums_Checksum::set_strong(const void* value, size_t size) {
+  
+  strong_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.BlockChecksums.Checksum.strong)
+}
+inline ::std::string* BlockChecksums_Checksum::mutable_strong() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.BlockChecksums.Checksum.strong)
+  return strong_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* BlockChecksums_Checksum::release_strong() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.BlockChecksums.Checksum.strong)
+  
+  return strong_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void BlockChecksums_Checksum::set_allocated_strong(::std::string* strong) {
+  if (strong != NULL) {
+    
+  } else {
+    
+  }
+  strong_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), strong);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.BlockChecksums.Checksum.strong)
+}
+
+// -------------------------------------------------------------------
+
+// BlockChecksums
+
+// uint32 block_size = 1;
+inline void BlockChecksums::clear_block_size() {
+  block_size_ = 0u;
+}
+inline ::google::protobuf::uint32 BlockChecksums::block_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BlockChecksums.block_size)
+  return block_size_;
+}
+inline void BlockChecksums::set_block_size(::google::protobuf::uint32 value) {
+  
+  block_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BlockChecksums.block_size)
+}
+
+// repeated .aspia.proto.file_transfer.BlockChecksums.Checksum checksum = 2;
+inline int BlockChecksums::checksum_size() const {
+  return checksum_.size();
+}
+inline void BlockChecksums::clear_checksum() {
+  checksum_.Clear();
+}
+inline ::aspia::proto::file_transfer::BlockChecksums_Checksum* BlockChecksums::mutable_checksum(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.BlockChecksums.checksum)
+  return checksum_.Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::BlockChecksums_Checksum >*
+BlockChecksums::mutable_checksum() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.BlockChecksums.checksum)
+  return &checksum_;
+}
+inline const ::aspia::proto::file_transfer::BlockChecksums_Checksum& BlockChecksums::checksum(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BlockChecksums.checksum)
+  return checksum_.Get(index);
+}
+inline ::aspia::proto::file_transfer::BlockChecksums_Checksum* BlockChecksums::add_checksum() {
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.BlockChecksums.checksum)
+  return checksum_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::BlockChecksums_Checksum >&
+BlockChecksums::checksum() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.BlockChecksums.checksum)
+  return checksum_;
+}
+
+// -------------------------------------------------------------------
+
+// BlockChecksumsRequest
+
+// string path = 1;
+inline void BlockChecksumsRequest::clear_path() {
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& BlockChecksumsRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BlockChecksumsRequest.path)
+  return path_.GetNoArena();
+}
+inline void BlockChecksumsRequest::set_path(const ::std::string& value) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BlockChecksumsRequest.path)
+}
+#if LANG_CXX11
+inline void BlockChecksumsRequest::set_path(::std::string&& value) {
+  
+  path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.BlockChecksumsRequest.path)
+}
+#endif
+inline void BlockChecksumsRequest::set_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.BlockChecksumsRequest.path)
+}
+inline void BlockChecksumsRequest::set_path(const char* value, size_t size) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.BlockChecksumsRequest.path)
+}
+inline ::std::string* BlockChecksumsRequest::mutable_path() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.BlockChecksumsRequest.path)
+  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* BlockChecksumsRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.BlockChecksumsRequest.path)
+  
+  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void BlockChecksumsRequest::set_allocated_path(::std::string* path) {
+  if (path != NULL) {
+    
+  } else {
+    
+  }
+  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.BlockChecksumsRequest.path)
+}
+
+// -------------------------------------------------------------------
+
+// BundleEntry
+
+// uint32 index = 1;
+inline void BundleEntry::clear_index() {
+  index_ = 0u;
+}
+inline ::google::protobuf::uint32 BundleEntry::index() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BundleEntry.index)
+  return index_;
+}
+inline void BundleEntry::set_index(::google::protobuf::uint32 value) {
+  
+  index_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BundleEntry.index)
+}
+
+// string source_path = 2;
+inline void BundleEntry::clear_source_path() {
+  source_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& BundleEntry::source_path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BundleEntry.source_path)
+  return source_path_.GetNoArena();
+}
+inline void BundleEntry::set_source_path(const ::std::string& value) {
+  
+  source_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BundleEntry.source_path)
+}
+#if LANG_CXX11
+inline void BundleEntry::set_source_path(::std::string&& value) {
+  
+  source_path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.BundleEntry.source_path)
+}
+#endif
+inline void BundleEntry::set_source_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  source_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.BundleEntry.source_path)
+}
+inline void BundleEntry::set_source_path(const char* value, size_t size) {
+  
+  source_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.BundleEntry.source_path)
+}
+inline ::std::string* BundleEntry::mutable_source_path() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.BundleEntry.source_path)
+  return source_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* BundleEntry::release_source_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.BundleEntry.source_path)
+  
+  return source_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void BundleEntry::set_allocated_source_path(::std::string* source_path) {
+  if (source_path != NULL) {
+    
+  } else {
+    
+  }
+  source_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), source_path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.BundleEntry.source_path)
+}
+
+// string target_path = 3;
+inline void BundleEntry::clear_target_path() {
+  target_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& BundleEntry::target_path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BundleEntry.target_path)
+  return target_path_.GetNoArena();
+}
+inline void BundleEntry::set_target_path(const ::std::string& value) {
+  
+  target_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BundleEntry.target_path)
+}
+#if LANG_CXX11
+inline void BundleEntry::set_target_path(::std::string&& value) {
+  
+  target_path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.BundleEntry.target_path)
+}
+#endif
+inline void BundleEntry::set_target_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  target_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.BundleEntry.target_path)
+}
+inline void BundleEntry::set_target_path(const char* value, size_t size) {
+  
+  target_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.BundleEntry.target_path)
+}
+inline ::std::string* BundleEntry::mutable_target_path() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.BundleEntry.target_path)
+  return target_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* BundleEntry::release_target_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.BundleEntry.target_path)
+  
+  return target_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void BundleEntry::set_allocated_target_path(::std::string* target_path) {
+  if (target_path != NULL) {
+    
+  } else {
+    
+  }
+  target_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), target_path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.BundleEntry.target_path)
+}
+
+// uint64 size = 4;
+inline void BundleEntry::clear_size() {
+  size_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 BundleEntry::size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BundleEntry.size)
+  return size_;
+}
+inline void BundleEntry::set_size(::google::protobuf::uint64 value) {
+  
+  size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BundleEntry.size)
+}
+
+// int64 modification_time = 5;
+inline void BundleEntry::clear_modification_time() {
+  modification_time_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 BundleEntry::modification_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BundleEntry.modification_time)
+  return modification_time_;
+}
+inline void BundleEntry::set_modification_time(::google::protobuf::int64 value) {
+  
+  modification_time_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BundleEntry.modification_time)
+}
+
+// bool is_directory = 6;
+inline void BundleEntry::clear_is_directory() {
+  is_directory_ = false;
+}
+inline bool BundleEntry::is_directory() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BundleEntry.is_directory)
+  return is_directory_;
+}
+inline void BundleEntry::set_is_directory(bool value) {
+  
+  is_directory_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BundleEntry.is_directory)
+}
+
+// .aspia.proto.file_transfer.Status status = 7;
+inline void BundleEntry::clear_status() {
+  status_ = 0;
+}
+inline ::aspia::proto::file_transfer::Status BundleEntry::status() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BundleEntry.status)
+  return static_cast< ::aspia::proto::file_transfer::Status >(status_);
+}
+inline void BundleEntry::set_status(::aspia::proto::file_transfer::Status value) {
+  
+  status_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BundleEntry.status)
+}
+
+// -------------------------------------------------------------------
+
+// Bundle
+
+// repeated .aspia.proto.file_transfer.BundleEntry entry = 1;
+inline int Bundle::entry_size() const {
+  return entry_.size();
+}
+inline void Bundle::clear_entry() {
+  entry_.Clear();
+}
+inline ::aspia::proto::file_transfer::BundleEntry* Bundle::mutable_entry(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Bundle.entry)
+  return entry_.Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::BundleEntry >*
+Bundle::mutable_entry() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.Bundle.entry)
+  return &entry_;
+}
+inline const ::aspia::proto::file_transfer::BundleEntry& Bundle::entry(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Bundle.entry)
+  return entry_.Get(index);
+}
+inline ::aspia::proto::file_transfer::BundleEntry* Bundle::add_entry() {
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.Bundle.entry)
+  return entry_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::BundleEntry >&
+Bundle::entry() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.Bundle.entry)
+  return entry_;
+}
+
+// -------------------------------------------------------------------
+
+// UploadRequest
+
+// string path = 1;
+inline void UploadRequest::clear_path() {
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& UploadRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.path)
+  return path_.GetNoArena();
+}
+inline void UploadRequest::set_path(const ::std::string& value) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.path)
+}
+#if LANG_CXX11
+inline void UploadRequest::set_path(::std::string&& value) {
+  
+  path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.UploadRequest.path)
+}
+#endif
+inline void UploadRequest::set_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.UploadRequest.path)
+}
+inline void UploadRequest::set_path(const char* value, size_t size) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.UploadRequest.path)
+}
+inline ::std::string* UploadRequest::mutable_path() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.UploadRequest.path)
+  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* UploadRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.UploadRequest.path)
+  
+  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void UploadRequest::set_allocated_path(::std::string* path) {
+  if (path != NULL) {
+    
+  } else {
+    
+  }
+  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.UploadRequest.path)
+}
+
+// bool overwrite = 2;
+inline void UploadRequest::clear_overwrite() {
+  overwrite_ = false;
+}
+inline bool UploadRequest::overwrite() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.overwrite)
+  return overwrite_;
+}
+inline void UploadRequest::set_overwrite(bool value) {
+  
+  overwrite_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.overwrite)
+}
+
+// uint32 window_size = 3;
+inline void UploadRequest::clear_window_size() {
+  window_size_ = 0u;
+}
+inline ::google::protobuf::uint32 UploadRequest::window_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.window_size)
+  return window_size_;
+}
+inline void UploadRequest::set_window_size(::google::protobuf::uint32 value) {
+  
+  window_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.window_size)
+}
+
+// uint32 delta_block_size = 4;
+inline void UploadRequest::clear_delta_block_size() {
+  delta_block_size_ = 0u;
+}
+inline ::google::protobuf::uint32 UploadRequest::delta_block_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.delta_block_size)
+  return delta_block_size_;
+}
+inline void UploadRequest::set_delta_block_size(::google::protobuf::uint32 value) {
+  
+  delta_block_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.delta_block_size)
+}
+
+// uint64 offset = 5;
+inline void UploadRequest::clear_offset() {
+  offset_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 UploadRequest::offset() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.offset)
+  return offset_;
+}
+inline void UploadRequest::set_offset(::google::protobuf::uint64 value) {
+  
+  offset_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.offset)
+}
+
+// uint64 file_size = 6;
+inline void UploadRequest::clear_file_size() {
+  file_size_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 UploadRequest::file_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.file_size)
+  return file_size_;
+}
+inline void UploadRequest::set_file_size(::google::protobuf::uint64 value) {
+  
+  file_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.file_size)
+}
+
+// bool bundle = 7;
+inline void UploadRequest::clear_bundle() {
+  bundle_ = false;
+}
+inline bool UploadRequest::bundle() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.bundle)
+  return bundle_;
+}
+inline void UploadRequest::set_bundle(bool value) {
+  
+  bundle_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.bundle)
+}
+
+// uint64 modification_time = 8;
+inline void UploadRequest::clear_modification_time() {
+  modification_time_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 UploadRequest::modification_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.modification_time)
+  return modification_time_;
+}
+inline void UploadRequest::set_modification_time(::google::protobuf::uint64 value) {
+  
+  modification_time_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.modification_time)
+}
+
+// -------------------------------------------------------------------
+
+// ResumeRequest
+
+// string path = 1;
+inline void ResumeRequest::clear_path() {
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& ResumeRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.ResumeRequest.path)
+  return path_.GetNoArena();
+}
+inline void ResumeRequest::set_path(const ::std::string& value) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.ResumeRequest.path)
+}
+#if LANG_CXX11
+inline void ResumeRequest::set_path(::std::string&& value) {
+  
+  path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.ResumeRequest.path)
+}
+#endif
+inline void ResumeRequest::set_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.ResumeRequest.path)
+}
+inline void ResumeRequest::set_path(const char* value, size_t size) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.ResumeRequest.path)
+}
+inline ::std::string* ResumeRequest::mutable_path() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.ResumeRequest.path)
+  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* ResumeRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.ResumeRequest.path)
+  
+  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void ResumeRequest::set_allocated_path(::std::string* path) {
+  if (path != NULL) {
+    
+  } else {
+    
+  }
+  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.ResumeRequest.path)
+}
+
+// uint64 file_size = 2;
+inline void ResumeRequest::clear_file_size() {
+  file_size_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 ResumeRequest::file_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.ResumeRequest.file_size)
+  return file_size_;
+}
+inline void ResumeRequest::set_file_size(::google::protobuf::uint64 value) {
+  
+  file_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.ResumeRequest.file_size)
+}
+
+// uint64 modification_time = 3;
+inline void ResumeRequest::clear_modification_time() {
+  modification_time_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 ResumeRequest::modification_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.ResumeRequest.modification_time)
+  return modification_time_;
+}
+inline void ResumeRequest::set_modification_time(::google::protobuf::uint64 value) {
+  
+  modification_time_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.ResumeRequest.modification_time)
+}
+
+// -------------------------------------------------------------------
+
+// DownloadRequest
+
+// string path = 1;
+inline void DownloadRequest::clear_path() {
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& DownloadRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.path)
+  return path_.GetNoArena();
+}
+inline void DownloadRequest::set_path(const ::std::string& value) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DownloadRequest.path)
+}
+#if LANG_CXX11
+inline void DownloadRequest::set_path(::std::string&& value) {
+  
+  path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.DownloadRequest.path)
+}
+#endif
+inline void DownloadRequest::set_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.DownloadRequest.path)
+}
+inline void DownloadRequest::set_path(const char* value, size_t size) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.DownloadRequest.path)
+}
+inline ::std::string* DownloadRequest::mutable_path() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DownloadRequest.path)
+  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* DownloadRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.DownloadRequest.path)
+  
+  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void DownloadRequest::set_allocated_path(::std::string* path) {
+  if (path != NULL) {
+    
+  } else {
+    
+  }
+  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.DownloadRequest.path)
+}
+
+// uint32 window_size = 2;
+inline void DownloadRequest::clear_window_size() {
+  window_size_ = 0u;
+}
+inline ::google::protobuf::uint32 DownloadRequest::window_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.window_size)
+  return window_size_;
+}
+inline void DownloadRequest::set_window_size(::google::protobuf::uint32 value) {
+  
+  window_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DownloadRequest.window_size)
+}
+
+// .aspia.proto.file_transfer.BlockChecksums block_checksums = 3;
+inline bool DownloadRequest::has_block_checksums() const {
+  return this != internal_default_instance() && block_checksums_ != NULL;
+}
+inline void DownloadRequest::clear_block_checksums() {
+  if (GetArenaNoVirtual() == NULL && block_checksums_ != NULL) {
+    delete block_checksums_;
+  }
+  block_checksums_ = NULL;
+}
+inline const ::aspia::proto::file_transfer::BlockChecksums& DownloadRequest::_internal_block_checksums() const {
+  return *block_checksums_;
+}
+inline const ::aspia::proto::file_transfer::BlockChecksums& DownloadRequest::block_checksums() const {
+  const ::aspia::proto::file_transfer::BlockChecksums* p = block_checksums_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.block_checksums)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::BlockChecksums*>(
+      &::aspia::proto::file_transfer::_BlockChecksums_default_instance_);
+}
+inline ::aspia::proto::file_transfer::BlockChecksums* DownloadRequest::release_block_checksums() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.DownloadRequest.block_checksums)
+  
+  ::aspia::proto::file_transfer::BlockChecksums* temp = block_checksums_;
+  block_checksums_ = NULL;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::BlockChecksums* DownloadRequest::mutable_block_checksums() {
+  
+  if (block_checksums_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::BlockChecksums>(GetArenaNoVirtual());
+    block_checksums_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DownloadRequest.block_checksums)
+  return block_checksums_;
+}
+inline void DownloadRequest::set_allocated_block_checksums(::aspia::proto::file_transfer::BlockChecksums* block_checksums) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete block_checksums_;
+  }
+  if (block_checksums) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      block_checksums = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, block_checksums, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  block_checksums_ = block_checksums;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.DownloadRequest.block_checksums)
+}
+
+// uint64 offset = 4;
+inline void DownloadRequest::clear_offset() {
+  offset_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 DownloadRequest::offset() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.offset)
+  return offset_;
+}
+inline void DownloadRequest::set_offset(::google::protobuf::uint64 value) {
+  
+  offset_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DownloadRequest.offset)
+}
+
+// bytes tail_hash = 5;
+inline void DownloadRequest::clear_tail_hash() {
+  tail_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& DownloadRequest::tail_hash() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.tail_hash)
+  return tail_hash_.GetNoArena();
+}
+inline void DownloadRequest::set_tail_hash(const ::std::string& value) {
+  
+  tail_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DownloadRequest.tail_hash)
+}
+#if LANG_CXX11
+inline void DownloadRequest::set_tail_hash(::std::string&& value) {
+  
+  tail_hash_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.DownloadRequest.tail_hash)
+}
+#endif
+inline void DownloadRequest::set_tail_hash(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  tail_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.DownloadRequest.tail_hash)
+}
+inline void DownloadRequest::set_tail_hash(const void* value, size_t size) {
+  
+  tail_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.DownloadRequest.tail_hash)
+}
+inline ::std::string* DownloadRequest::mutable_tail_hash() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DownloadRequest.tail_hash)
+  return tail_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* DownloadRequest::release_tail_hash() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.DownloadRequest.tail_hash)
+  
+  return tail_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void DownloadRequest::set_allocated_tail_hash(::std::string* tail_hash) {
+  if (tail_hash != NULL) {
+    
+  } else {
+    
+  }
+  tail_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), tail_hash);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.DownloadRequest.tail_hash)
+}
+
+// .aspia.proto.file_transfer.Bundle bundle = 6;
+inline bool DownloadRequest::has_bundle() const {
+  return this != internal_default_instance() && bundle_ != NULL;
+}
+inline void DownloadRequest::clear_bundle() {
+  if (GetArenaNoVirtual() == NULL && bundle_ != NULL) {
+    delete bundle_;
+  }
+  bundle_ = NULL;
+}
+inline const ::aspia::proto::file_transfer::Bundle& DownloadRequest::_internal_bundle() const {
+  return *bundle_;
+}
+inline const ::aspia::proto::file_transfer::Bundle& DownloadRequest::bundle() const {
+  const ::aspia::proto::file_transfer::Bundle* p = bundle_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.bundle)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::Bundle*>(
+      &::aspia::proto::file_transfer::_Bundle_default_instance_);
+}
+inline ::aspia::proto::file_transfer::Bundle* DownloadRequest::release_bundle() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.DownloadRequest.bundle)
+  
+  ::aspia::proto::file_transfer::Bundle* temp = bundle_;
+  bundle_ = NULL;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::Bundle* DownloadRequest::mutable_bundle() {
+  
+  if (bundle_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::Bundle>(GetArenaNoVirtual());
+    bundle_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DownloadRequest.bundle)
+  return bundle_;
+}
+inline void DownloadRequest::set_allocated_bundle(::aspia::proto::file_transfer::Bundle* bundle) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete bundle_;
+  }
+  if (bundle) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      bundle = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, bundle, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  bundle_ = bundle;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.DownloadRequest.bundle)
+}
+
+// -------------------------------------------------------------------
+
+// PacketRequest
+
+// uint32 dummy = 1;
+inline void PacketRequest::clear_dummy() {
+  dummy_ = 0u;
+}
+inline ::google::protobuf::uint32 PacketRequest::dummy() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PacketRequest.dummy)
+  return dummy_;
+}
+inline void PacketRequest::set_dummy(::google::protobuf::uint32 value) {
+  
+  dummy_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.PacketRequest.dummy)
+}
+
+// uint32 size = 2;
+inline void PacketRequest::clear_size() {
+  size_ = 0u;
+}
+inline ::google::protobuf::uint32 PacketRequest::size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PacketRequest.size)
+  return size_;
+}
+inline void PacketRequest::set_size(::google::protobuf::uint32 value) {
+  
+  size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.PacketRequest.size)
+}
+
+// .aspia.proto.file_transfer.Compression compression = 3;
+inline void PacketRequest::clear_compression() {
+  compression_ = 0;
+}
+inline ::aspia::proto::file_transfer::Compression PacketRequest::compression() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PacketRequest.compression)
+  return static_cast< ::aspia::proto::file_transfer::Compression >(compression_);
+}
+inline void PacketRequest::set_compression(::aspia::proto::file_transfer::Compression value) {
+  
+  compression_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.PacketRequest.compression)
+}
+
+// -------------------------------------------------------------------
+
+// DeltaOperation
+
+// uint32 literal_size = 1;
+inline void DeltaOperation::clear_literal_size() {
+  literal_size_ = 0u;
+}
+inline ::google::protobuf::uint32 DeltaOperation::literal_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DeltaOperation.literal_size)
+  return literal_size_;
+}
+inline void DeltaOperation::set_literal_size(::google::protobuf::uint32 value) {
+  
+  literal_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DeltaOperation.literal_size)
+}
+
+// uint32 block_index = 2;
+inline void DeltaOperation::clear_block_index() {
+  block_index_ = 0u;
+}
+inline ::google::protobuf::uint32 DeltaOperation::block_index() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DeltaOperation.block_index)
+  return block_index_;
+}
+inline void DeltaOperation::set_block_index(::google::protobuf::uint32 value) {
+  
+  block_index_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DeltaOperation.block_index)
+}
+
+// uint32 block_count = 3;
+inline void DeltaOperation::clear_block_count() {
+  block_count_ = 0u;
+}
+inline ::google::protobuf::uint32 DeltaOperation::block_count() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DeltaOperation.block_count)
+  return block_count_;
+}
+inline void DeltaOperation::set_block_count(::google::protobuf::uint32 value) {
+  
+  block_count_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DeltaOperation.block_count)
+}
+
+// -------------------------------------------------------------------
+
+// Packet
+
+// uint32 flags = 1;
+inline void Packet::clear_flags() {
+  flags_ = 0u;
+}
+inline ::google::protobuf::uint32 Packet::flags() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.flags)
+  return flags_;
+}
+inline void Packet::set_flags(::google::protobuf::uint32 value) {
+  
+  flags_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.flags)
+}
+
+// uint64 file_size = 2;
+inline void Packet::clear_file_size() {
+  file_size_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 Packet::file_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.file_size)
+  return file_size_;
+}
+inline void Packet::set_file_size(::google::protobuf::uint64 value) {
+  
+  file_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.file_size)
+}
+
+// bytes data = 3;
+inline void Packet::clear_data() {
+  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& Packet::data() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.data)
+  return data_.GetNoArena();
+}
+inline void Packet::set_data(const ::std::string& value) {
+  
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.data)
+}
+#if LANG_CXX11
+inline void Packet::set_data(::std::string&& value) {
+  
+  data_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.Packet.data)
+}
+#endif
+inline void Packet::set_data(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.Packet.data)
+}
+inline void Packet::set_data(const void* value, size_t size) {
+  
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.Packet.data)
+}
+inline ::std::string* Packet::mutable_data() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Packet.data)
+  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* Packet::release_data() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Packet.data)
+  
+  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Packet::set_allocated_data(::std::string* data) {
+  if (data != NULL) {
+    
+  } else {
+    
+  }
+  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Packet.data)
+}
+
+// .aspia.proto.file_transfer.Compression compression = 4;
+inline void Packet::clear_compression() {
+  compression_ = 0;
+}
+inline ::aspia::proto::file_transfer::Compression Packet::compression() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.compression)
+  return static_cast< ::aspia::proto::file_transfer::Compression >(compression_);
+}
+inline void Packet::set_compression(::aspia::proto::file_transfer::Compression value) {
+  
+  compression_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.compression)
+}
+
+// uint32 uncompressed_size = 5;
+inline void Packet::clear_uncompressed_size() {
+  uncompressed_size_ = 0u;
+}
+inline ::google::protobuf::uint32 Packet::uncompressed_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.uncompressed_size)
+  return uncompressed_size_;
+}
+inline void Packet::set_uncompressed_size(::google::protobuf::uint32 value) {
+  
+  uncompressed_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.uncompressed_size)
+}
+
+// repeated .aspia.proto.file_transfer.DeltaOperation operation = 6;
+inline int Packet::operation_size() const {
+  return operation_.size();
+}
+inline void Packet::clear_operation() {
+  operation_.Clear();
+}
+inline ::aspia::proto::file_transfer::DeltaOperation* Packet::mutable_operation(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Packet.operation)
+  return operation_.Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DeltaOperation >*
+Packet::mutable_operation() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.Packet.operation)
+  return &operation_;
+}
+inline const ::aspia::proto::file_transfer::DeltaOperation& Packet::operation(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.operation)
+  return operation_.Get(index);
+}
+inline ::aspia::proto::file_transfer::DeltaOperation* Packet::add_operation() {
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.Packet.operation)
+  return operation_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DeltaOperation >&
+Packet::operation() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.Packet.operation)
+  return operation_;
+}
+
+// uint32 delta_size = 7;
+inline void Packet::clear_delta_size() {
+  delta_size_ = 0u;
+}
+inline ::google::protobuf::uint32 Packet::delta_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.delta_size)
+  return delta_size_;
+}
+inline void Packet::set_delta_size(::google::protobuf::uint32 value) {
+  
+  delta_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.delta_size)
+}
+
+// bytes digest = 8;
+inline void Packet::clear_digest() {
+  digest_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& Packet::digest() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.digest)
+  return digest_.GetNoArena();
+}
+inline void Packet::set_digest(const ::std::string& value) {
+  
+  digest_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.digest)
+}
+#if LANG_CXX11
+inline void Packet::set_digest(::std::string&& value) {
+  
+  digest_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.Packet.digest)
+}
+#endif
+inline void Packet::set_digest(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  digest_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.Packet.digest)
+}
+inline void Packet::set_digest(const void* value, size_t size) {
+  
+  digest_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.Packet.digest)
+}
+inline ::std::string* Packet::mutable_digest() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Packet.digest)
+  return digest_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* Packet::release_digest() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Packet.digest)
+  
+  return digest_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Packet::set_allocated_digest(::std::string* digest) {
+  if (digest != NULL) {
+    
+  } else {
+    
+  }
+  digest_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), digest);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Packet.digest)
+}
+
+// -------------------------------------------------------------------
+
+// CreateDirectoryRequest
+
+// string path = 1;
+inline void CreateDirectoryRequest::clear_path() {
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& CreateDirectoryRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+  return path_.GetNoArena();
+}
+inline void CreateDirectoryRequest::set_path(const ::std::string& value) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+}
+#if LANG_CXX11
+inline void CreateDirectoryRequest::set_path(::std::string&& value) {
+  
+  path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+}
+#endif
+inline void CreateDirectoryRequest::set_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+}
+inline void CreateDirectoryRequest::set_path(const char* value, size_t size) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+}
+inline ::std::string* CreateDirectoryRequest::mutable_path() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* CreateDirectoryRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+  
+  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void CreateDirectoryRequest::set_allocated_path(::std::string* path) {
+  if (path != NULL) {
+    
+  } else {
+    
+  }
+  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+}
+
+// -------------------------------------------------------------------
+
+// RenameRequest
+
+// string old_name = 1;
+inline void RenameRequest::clear_old_name() {
+  old_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& RenameRequest::old_name() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RenameRequest.old_name)
+  return old_name_.GetNoArena();
+}
+inline void RenameRequest::set_old_name(const ::std::string& value) {
+  
+  old_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RenameRequest.old_name)
+}
+#if LANG_CXX11
+inline void RenameRequest::set_old_name(::std::string&& value) {
+  
+  old_name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.RenameRequest.old_name)
+}
+#endif
+inline void RenameRequest::set_old_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  old_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.RenameRequest.old_name)
+}
+inline void RenameRequest::set_old_name(const char* value, size_t size) {
+  
+  old_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.RenameRequest.old_name)
+}
+inline ::std::string* RenameRequest::mutable_old_name() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RenameRequest.old_name)
+  return old_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* RenameRequest::release_old_name() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RenameRequest.old_name)
+  
+  return old_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void RenameRequest::set_allocated_old_name(::std::string* old_name) {
+  if (old_name != NULL) {
+    
+  } else {
+    
+  }
+  old_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), old_name);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RenameRequest.old_name)
+}
 
-// .aspia.proto.file_transfer.DriveList.Item.Type type = 1;
-inline void DriveList_Item::clear_type() {
-  type_ = 0;
+// string new_name = 2;
+inline void RenameRequest::clear_new_name() {
+  new_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::aspia::proto::file_transfer::DriveList_Item_Type DriveList_Item::type() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.Item.type)
-  return static_cast< ::aspia::proto::file_transfer::DriveList_Item_Type >(type_);
+inline const ::std::string& RenameRequest::new_name() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RenameRequest.new_name)
+  return new_name_.GetNoArena();
 }
-inline void DriveList_Item::set_type(::aspia::proto::file_transfer::DriveList_Item_Type value) {
+inline void RenameRequest::set_new_name(const ::std::string& value) {
   
-  type_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveList.Item.type)
+  new_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RenameRequest.new_name)
+}
+#if LANG_CXX11
+inline void RenameRequest::set_new_name(::std::string&& value) {
+  
+  new_name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.RenameRequest.new_name)
+}
+#endif
+inline void RenameRequest::set_new_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  new_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.RenameRequest.new_name)
+}
+inline void RenameRequest::set_new_name(const char* value, size_t size) {
+  
+  new_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.RenameRequest.new_name)
+}
+inline ::std::string* RenameRequest::mutable_new_name() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RenameRequest.new_name)
+  return new_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* RenameRequest::release_new_name() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RenameRequest.new_name)
+  
+  return new_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void RenameRequest::set_allocated_new_name(::std::string* new_name) {
+  if (new_name != NULL) {
+    
+  } else {
+    
+  }
+  new_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), new_name);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RenameRequest.new_name)
 }
 
-// string path = 2;
-inline void DriveList_Item::clear_path() {
+// -------------------------------------------------------------------
+
+// RemoveRequest
+
+// string path = 1;
+inline void RemoveRequest::clear_path() {
   path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& DriveList_Item::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.Item.path)
+inline const ::std::string& RemoveRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveRequest.path)
   return path_.GetNoArena();
 }
-inline void DriveList_Item::set_path(const ::std::string& value) {
+inline void RemoveRequest::set_path(const ::std::string& value) {
   
   path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveList.Item.path)
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveRequest.path)
 }
 #if LANG_CXX11
-inline void DriveList_Item::set_path(::std::string&& value) {
+inline void RemoveRequest::set_path(::std::string&& value) {
   
   path_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.DriveList.Item.path)
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.RemoveRequest.path)
 }
 #endif
-inline void DriveList_Item::set_path(const char* value) {
+inline void RemoveRequest::set_path(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
   path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.DriveList.Item.path)
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.RemoveRequest.path)
 }
-inline void DriveList_Item::set_path(const char* value, size_t size) {
+inline void RemoveRequest::set_path(const char* value, size_t size) {
   
   path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.DriveList.Item.path)
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.RemoveRequest.path)
 }
-inline ::std::string* DriveList_Item::mutable_path() {
+inline ::std::string* RemoveRequest::mutable_path() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DriveList.Item.path)
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoveRequest.path)
   return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* DriveList_Item::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.DriveList.Item.path)
+inline ::std::string* RemoveRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RemoveRequest.path)
   
   return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void DriveList_Item::set_allocated_path(::std::string* path) {
+inline void RemoveRequest::set_allocated_path(::std::string* path) {
   if (path != NULL) {
     
   } else {
     
   }
   path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.DriveList.Item.path)
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RemoveRequest.path)
 }
 
-// -------------------------------------------------------------------
-
-// DriveList
-
-// repeated .aspia.proto.file_transfer.DriveList.Item item = 1;
-inline int DriveList::item_size() const {
-  return item_.size();
-}
-inline void DriveList::clear_item() {
-  item_.Clear();
-}
-inline ::aspia::proto::file_transfer::DriveList_Item* DriveList::mutable_item(int index) {
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DriveList.item)
-  return item_.Mutable(index);
+// bool recursive = 2;
+inline void RemoveRequest::clear_recursive() {
+  recursive_ = false;
 }
-inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >*
-DriveList::mutable_item() {
-  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.DriveList.item)
-  return &item_;
-}
-inline const ::aspia::proto::file_transfer::DriveList_Item& DriveList::item(int index) const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.item)
-  return item_.Get(index);
+inline bool RemoveRequest::recursive() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveRequest.recursive)
+  return recursive_;
 }
-inline ::aspia::proto::file_transfer::DriveList_Item* DriveList::add_item() {
-  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.DriveList.item)
-  return item_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >&
-DriveList::item() const {
-  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.DriveList.item)
-  return item_;
+inline void RemoveRequest::set_recursive(bool value) {
+  
+  recursive_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveRequest.recursive)
 }
 
-// -------------------------------------------------------------------
-
-// DriveListRequest
-
-// uint32 dummy = 1;
-inline void DriveListRequest::clear_dummy() {
-  dummy_ = 0u;
+// uint64 continuation = 3;
+inline void RemoveRequest::clear_continuation() {
+  continuation_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::uint32 DriveListRequest::dummy() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveListRequest.dummy)
-  return dummy_;
+inline ::google::protobuf::uint64 RemoveRequest::continuation() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveRequest.continuation)
+  return continuation_;
 }
-inline void DriveListRequest::set_dummy(::google::protobuf::uint32 value) {
+inline void RemoveRequest::set_continuation(::google::protobuf::uint64 value) {
   
-  dummy_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveListRequest.dummy)
+  continuation_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveRequest.continuation)
 }
 
 // -------------------------------------------------------------------
 
-// FileList_Item
+// RemoveProgress_Failure
 
-// string name = 1;
-inline void FileList_Item::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string path = 1;
+inline void RemoveProgress_Failure::clear_path() {
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& FileList_Item::name() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.name)
-  return name_.GetNoArena();
+inline const ::std::string& RemoveProgress_Failure::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveProgress.Failure.path)
+  return path_.GetNoArena();
 }
-inline void FileList_Item::set_name(const ::std::string& value) {
+inline void RemoveProgress_Failure::set_path(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.name)
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveProgress.Failure.path)
 }
 #if LANG_CXX11
-inline void FileList_Item::set_name(::std::string&& value) {
+inline void RemoveProgress_Failure::set_path(::std::string&& value) {
   
-  name_.SetNoArena(
+  path_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.FileList.Item.name)
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.RemoveProgress.Failure.path)
 }
 #endif
-inline void FileList_Item::set_name(const char* value) {
+inline void RemoveProgress_Failure::set_path(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.FileList.Item.name)
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.RemoveProgress.Failure.path)
 }
-inline void FileList_Item::set_name(const char* value, size_t size) {
+inline void RemoveProgress_Failure::set_path(const char* value, size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.FileList.Item.name)
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.RemoveProgress.Failure.path)
 }
-inline ::std::string* FileList_Item::mutable_name() {
+inline ::std::string* RemoveProgress_Failure::mutable_path() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileList.Item.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoveProgress.Failure.path)
+  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* FileList_Item::release_name() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.FileList.Item.name)
+inline ::std::string* RemoveProgress_Failure::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RemoveProgress.Failure.path)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void FileList_Item::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void RemoveProgress_Failure::set_allocated_path(::std::string* path) {
+  if (path != NULL) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.FileList.Item.name)
+  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RemoveProgress.Failure.path)
 }
 
-// uint64 size = 2;
-inline void FileList_Item::clear_size() {
-  size_ = GOOGLE_ULONGLONG(0);
+// .aspia.proto.file_transfer.Status status = 2;
+inline void RemoveProgress_Failure::clear_status() {
+  status_ = 0;
 }
-inline ::google::protobuf::uint64 FileList_Item::size() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.size)
-  return size_;
+inline ::aspia::proto::file_transfer::Status RemoveProgress_Failure::status() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveProgress.Failure.status)
+  return static_cast< ::aspia::proto::file_transfer::Status >(status_);
 }
-inline void FileList_Item::set_size(::google::protobuf::uint64 value) {
+inline void RemoveProgress_Failure::set_status(::aspia::proto::file_transfer::Status value) {
   
-  size_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.size)
+  status_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveProgress.Failure.status)
 }
 
-// int64 modification_time = 3;
-inline void FileList_Item::clear_modification_time() {
-  modification_time_ = GOOGLE_LONGLONG(0);
+// -------------------------------------------------------------------
+
+// RemoveProgress
+
+// uint32 total = 1;
+inline void RemoveProgress::clear_total() {
+  total_ = 0u;
 }
-inline ::google::protobuf::int64 FileList_Item::modification_time() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.modification_time)
-  return modification_time_;
+inline ::google::protobuf::uint32 RemoveProgress::total() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveProgress.total)
+  return total_;
 }
-inline void FileList_Item::set_modification_time(::google::protobuf::int64 value) {
+inline void RemoveProgress::set_total(::google::protobuf::uint32 value) {
   
-  modification_time_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.modification_time)
+  total_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveProgress.total)
 }
 
-// bool is_directory = 4;
-inline void FileList_Item::clear_is_directory() {
-  is_directory_ = false;
+// uint32 processed = 2;
+inline void RemoveProgress::clear_processed() {
+  processed_ = 0u;
 }
-inline bool FileList_Item::is_directory() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.is_directory)
-  return is_directory_;
+inline ::google::protobuf::uint32 RemoveProgress::processed() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveProgress.processed)
+  return processed_;
 }
-inline void FileList_Item::set_is_directory(bool value) {
+inline void RemoveProgress::set_processed(::google::protobuf::uint32 value) {
   
-  is_directory_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.is_directory)
+  processed_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveProgress.processed)
 }
 
-// -------------------------------------------------------------------
-
-// FileList
+// string current_path = 3;
+inline void RemoveProgress::clear_current_path() {
+  current_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& RemoveProgress::current_path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveProgress.current_path)
+  return current_path_.GetNoArena();
+}
+inline void RemoveProgress::set_current_path(const ::std::string& value) {
+  
+  current_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveProgress.current_path)
+}
+#if LANG_CXX11
+inline void RemoveProgress::set_current_path(::std::string&& value) {
+  
+  current_path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.RemoveProgress.current_path)
+}
+#endif
+inline void RemoveProgress::set_current_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  current_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.RemoveProgress.current_path)
+}
+inline void RemoveProgress::set_current_path(const char* value, size_t size) {
+  
+  current_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.RemoveProgress.current_path)
+}
+inline ::std::string* RemoveProgress::mutable_current_path() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoveProgress.current_path)
+  return current_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* RemoveProgress::release_current_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RemoveProgress.current_path)
+  
+  return current_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void RemoveProgress::set_allocated_current_path(::std::string* current_path) {
+  if (current_path != NULL) {
+    
+  } else {
+    
+  }
+  current_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), current_path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RemoveProgress.current_path)
+}
 
-// repeated .aspia.proto.file_transfer.FileList.Item item = 1;
-inline int FileList::item_size() const {
-  return item_.size();
+// repeated .aspia.proto.file_transfer.RemoveProgress.Failure failure = 4;
+inline int RemoveProgress::failure_size() const {
+  return failure_.size();
 }
-inline void FileList::clear_item() {
-  item_.Clear();
+inline void RemoveProgress::clear_failure() {
+  failure_.Clear();
 }
-inline ::aspia::proto::file_transfer::FileList_Item* FileList::mutable_item(int index) {
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileList.item)
-  return item_.Mutable(index);
+inline ::aspia::proto::file_transfer::RemoveProgress_Failure* RemoveProgress::mutable_failure(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoveProgress.failure)
+  return failure_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >*
-FileList::mutable_item() {
-  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.FileList.item)
-  return &item_;
+inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::RemoveProgress_Failure >*
+RemoveProgress::mutable_failure() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.RemoveProgress.failure)
+  return &failure_;
+}
+inline const ::aspia::proto::file_transfer::RemoveProgress_Failure& RemoveProgress::failure(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveProgress.failure)
+  return failure_.Get(index);
+}
+inline ::aspia::proto::file_transfer::RemoveProgress_Failure* RemoveProgress::add_failure() {
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.RemoveProgress.failure)
+  return failure_.Add();
 }
-inline const ::aspia::proto::file_transfer::FileList_Item& FileList::item(int index) const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.item)
-  return item_.Get(index);
+inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::RemoveProgress_Failure >&
+RemoveProgress::failure() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.RemoveProgress.failure)
+  return failure_;
 }
-inline ::aspia::proto::file_transfer::FileList_Item* FileList::add_item() {
-  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.FileList.item)
-  return item_.Add();
+
+// uint64 continuation = 5;
+inline void RemoveProgress::clear_continuation() {
+  continuation_ = GOOGLE_ULONGLONG(0);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >&
-FileList::item() const {
-  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.FileList.item)
-  return item_;
+inline ::google::protobuf::uint64 RemoveProgress::continuation() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveProgress.continuation)
+  return continuation_;
+}
+inline void RemoveProgress::set_continuation(::google::protobuf::uint64 value) {
+  
+  continuation_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveProgress.continuation)
 }
 
 // -------------------------------------------------------------------
 
-// FileListRequest
+// CopyRequest
 
-// string path = 1;
-inline void FileListRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string source_path = 1;
+inline void CopyRequest::clear_source_path() {
+  source_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& FileListRequest::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.path)
-  return path_.GetNoArena();
+inline const ::std::string& CopyRequest::source_path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.CopyRequest.source_path)
+  return source_path_.GetNoArena();
 }
-inline void FileListRequest::set_path(const ::std::string& value) {
+inline void CopyRequest::set_source_path(const ::std::string& value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.path)
+  source_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.CopyRequest.source_path)
 }
 #if LANG_CXX11
-inline void FileListRequest::set_path(::std::string&& value) {
+inline void CopyRequest::set_source_path(::std::string&& value) {
   
-  path_.SetNoArena(
+  source_path_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.FileListRequest.path)
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.CopyRequest.source_path)
 }
 #endif
-inline void FileListRequest::set_path(const char* value) {
+inline void CopyRequest::set_source_path(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.FileListRequest.path)
+  source_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.CopyRequest.source_path)
 }
-inline void FileListRequest::set_path(const char* value, size_t size) {
+inline void CopyRequest::set_source_path(const char* value, size_t size) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  source_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.FileListRequest.path)
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.CopyRequest.source_path)
 }
-inline ::std::string* FileListRequest::mutable_path() {
+inline ::std::string* CopyRequest::mutable_source_path() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileListRequest.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.CopyRequest.source_path)
+  return source_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* FileListRequest::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.FileListRequest.path)
+inline ::std::string* CopyRequest::release_source_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.CopyRequest.source_path)
   
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return source_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void FileListRequest::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void CopyRequest::set_allocated_source_path(::std::string* source_path) {
+  if (source_path != NULL) {
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.FileListRequest.path)
+  source_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), source_path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.CopyRequest.source_path)
 }
 
-// -------------------------------------------------------------------
-
-// UploadRequest
-
-// string path = 1;
-inline void UploadRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string target_path = 2;
+inline void CopyRequest::clear_target_path() {
+  target_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& UploadRequest::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.path)
-  return path_.GetNoArena();
+inline const ::std::string& CopyRequest::target_path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.CopyRequest.target_path)
+  return target_path_.GetNoArena();
 }
-inline void UploadRequest::set_path(const ::std::string& value) {
+inline void CopyRequest::set_target_path(const ::std::string& value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.path)
+  target_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.CopyRequest.target_path)
 }
 #if LANG_CXX11
-inline void UploadRequest::set_path(::std::string&& value) {
+inline void CopyRequest::set_target_path(::std::string&& value) {
   
-  path_.SetNoArena(
+  target_path_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.UploadRequest.path)
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.CopyRequest.target_path)
 }
 #endif
-inline void UploadRequest::set_path(const char* value) {
+inline void CopyRequest::set_target_path(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.UploadRequest.path)
+  target_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.CopyRequest.target_path)
 }
-inline void UploadRequest::set_path(const char* value, size_t size) {
+inline void CopyRequest::set_target_path(const char* value, size_t size) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  target_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.UploadRequest.path)
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.CopyRequest.target_path)
 }
-inline ::std::string* UploadRequest::mutable_path() {
+inline ::std::string* CopyRequest::mutable_target_path() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.UploadRequest.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.CopyRequest.target_path)
+  return target_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* UploadRequest::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.UploadRequest.path)
+inline ::std::string* CopyRequest::release_target_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.CopyRequest.target_path)
   
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return target_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void UploadRequest::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void CopyRequest::set_allocated_target_path(::std::string* target_path) {
+  if (target_path != NULL) {
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.UploadRequest.path)
+  target_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), target_path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.CopyRequest.target_path)
 }
 
-// bool overwrite = 2;
-inline void UploadRequest::clear_overwrite() {
-  overwrite_ = false;
+// uint64 continuation = 3;
+inline void CopyRequest::clear_continuation() {
+  continuation_ = GOOGLE_ULONGLONG(0);
 }
-inline bool UploadRequest::overwrite() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.overwrite)
-  return overwrite_;
+inline ::google::protobuf::uint64 CopyRequest::continuation() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.CopyRequest.continuation)
+  return continuation_;
 }
-inline void UploadRequest::set_overwrite(bool value) {
+inline void CopyRequest::set_continuation(::google::protobuf::uint64 value) {
   
-  overwrite_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.overwrite)
+  continuation_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.CopyRequest.continuation)
 }
 
 // -------------------------------------------------------------------
 
-// DownloadRequest
+// MoveRequest
 
-// string path = 1;
-inline void DownloadRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string source_path = 1;
+inline void MoveRequest::clear_source_path() {
+  source_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& DownloadRequest::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.path)
-  return path_.GetNoArena();
+inline const ::std::string& MoveRequest::source_path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.MoveRequest.source_path)
+  return source_path_.GetNoArena();
 }
-inline void DownloadRequest::set_path(const ::std::string& value) {
+inline void MoveRequest::set_source_path(const ::std::string& value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DownloadRequest.path)
+  source_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.MoveRequest.source_path)
 }
 #if LANG_CXX11
-inline void DownloadRequest::set_path(::std::string&& value) {
+inline void MoveRequest::set_source_path(::std::string&& value) {
   
-  path_.SetNoArena(
+  source_path_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.DownloadRequest.path)
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.MoveRequest.source_path)
 }
 #endif
-inline void DownloadRequest::set_path(const char* value) {
+inline void MoveRequest::set_source_path(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.DownloadRequest.path)
+  source_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.MoveRequest.source_path)
 }
-inline void DownloadRequest::set_path(const char* value, size_t size) {
+inline void MoveRequest::set_source_path(const char* value, size_t size) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  source_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.DownloadRequest.path)
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.MoveRequest.source_path)
 }
-inline ::std::string* DownloadRequest::mutable_path() {
+inline ::std::string* MoveRequest::mutable_source_path() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DownloadRequest.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.MoveRequest.source_path)
+  return source_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* DownloadRequest::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.DownloadRequest.path)
+inline ::std::string* MoveRequest::release_source_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.MoveRequest.source_path)
   
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return source_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void DownloadRequest::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void MoveRequest::set_allocated_source_path(::std::string* source_path) {
+  if (source_path != NULL) {
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.DownloadRequest.path)
+  source_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), source_path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.MoveRequest.source_path)
 }
 
-// -------------------------------------------------------------------
-
-// PacketRequest
+// string target_path = 2;
+inline void MoveRequest::clear_target_path() {
+  target_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& MoveRequest::target_path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.MoveRequest.target_path)
+  return target_path_.GetNoArena();
+}
+inline void MoveRequest::set_target_path(const ::std::string& value) {
+  
+  target_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.MoveRequest.target_path)
+}
+#if LANG_CXX11
+inline void MoveRequest::set_target_path(::std::string&& value) {
+  
+  target_path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.MoveRequest.target_path)
+}
+#endif
+inline void MoveRequest::set_target_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  target_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.MoveRequest.target_path)
+}
+inline void MoveRequest::set_target_path(const char* value, size_t size) {
+  
+  target_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.MoveRequest.target_path)
+}
+inline ::std::string* MoveRequest::mutable_target_path() {
+  
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.MoveRequest.target_path)
+  return target_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* MoveRequest::release_target_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.MoveRequest.target_path)
+  
+  return target_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void MoveRequest::set_allocated_target_path(::std::string* target_path) {
+  if (target_path != NULL) {
+    
+  } else {
+    
+  }
+  target_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), target_path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.MoveRequest.target_path)
+}
 
-// uint32 dummy = 1;
-inline void PacketRequest::clear_dummy() {
-  dummy_ = 0u;
+// uint64 continuation = 3;
+inline void MoveRequest::clear_continuation() {
+  continuation_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::uint32 PacketRequest::dummy() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PacketRequest.dummy)
-  return dummy_;
+inline ::google::protobuf::uint64 MoveRequest::continuation() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.MoveRequest.continuation)
+  return continuation_;
 }
-inline void PacketRequest::set_dummy(::google::protobuf::uint32 value) {
+inline void MoveRequest::set_continuation(::google::protobuf::uint64 value) {
   
-  dummy_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.PacketRequest.dummy)
+  continuation_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.MoveRequest.continuation)
 }
 
 // -------------------------------------------------------------------
 
-// Packet
+// CopyProgress
 
-// uint32 flags = 1;
-inline void Packet::clear_flags() {
-  flags_ = 0u;
+// uint64 total_size = 1;
+inline void CopyProgress::clear_total_size() {
+  total_size_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::uint32 Packet::flags() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.flags)
-  return flags_;
+inline ::google::protobuf::uint64 CopyProgress::total_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.CopyProgress.total_size)
+  return total_size_;
 }
-inline void Packet::set_flags(::google::protobuf::uint32 value) {
+inline void CopyProgress::set_total_size(::google::protobuf::uint64 value) {
   
-  flags_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.flags)
+  total_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.CopyProgress.total_size)
 }
 
-// uint64 file_size = 2;
-inline void Packet::clear_file_size() {
-  file_size_ = GOOGLE_ULONGLONG(0);
+// uint64 copied_size = 2;
+inline void CopyProgress::clear_copied_size() {
+  copied_size_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::uint64 Packet::file_size() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.file_size)
-  return file_size_;
+inline ::google::protobuf::uint64 CopyProgress::copied_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.CopyProgress.copied_size)
+  return copied_size_;
 }
-inline void Packet::set_file_size(::google::protobuf::uint64 value) {
+inline void CopyProgress::set_copied_size(::google::protobuf::uint64 value) {
   
-  file_size_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.file_size)
+  copied_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.CopyProgress.copied_size)
 }
 
-// bytes data = 3;
-inline void Packet::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string current_path = 3;
+inline void CopyProgress::clear_current_path() {
+  current_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& Packet::data() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.data)
-  return data_.GetNoArena();
+inline const ::std::string& CopyProgress::current_path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.CopyProgress.current_path)
+  return current_path_.GetNoArena();
 }
-inline void Packet::set_data(const ::std::string& value) {
+inline void CopyProgress::set_current_path(const ::std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.data)
+  current_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.CopyProgress.current_path)
 }
 #if LANG_CXX11
-inline void Packet::set_data(::std::string&& value) {
+inline void CopyProgress::set_current_path(::std::string&& value) {
   
-  data_.SetNoArena(
+  current_path_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.Packet.data)
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.CopyProgress.current_path)
 }
 #endif
-inline void Packet::set_data(const char* value) {
+inline void CopyProgress::set_current_path(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.Packet.data)
+  current_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.CopyProgress.current_path)
 }
-inline void Packet::set_data(const void* value, size_t size) {
+inline void CopyProgress::set_current_path(const char* value, size_t size) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  current_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.Packet.data)
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.CopyProgress.current_path)
 }
-inline ::std::string* Packet::mutable_data() {
+inline ::std::string* CopyProgress::mutable_current_path() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Packet.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.CopyProgress.current_path)
+  return current_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* Packet::release_data() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Packet.data)
+inline ::std::string* CopyProgress::release_current_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.CopyProgress.current_path)
   
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return current_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Packet::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void CopyProgress::set_allocated_current_path(::std::string* current_path) {
+  if (current_path != NULL) {
+    
+  } else {
+    
+  }
+  current_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), current_path);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.CopyProgress.current_path)
+}
+
+// uint64 continuation = 4;
+inline void CopyProgress::clear_continuation() {
+  continuation_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 CopyProgress::continuation() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.CopyProgress.continuation)
+  return continuation_;
+}
+inline void CopyProgress::set_continuation(::google::protobuf::uint64 value) {
+  
+  continuation_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.CopyProgress.continuation)
+}
+
+// -------------------------------------------------------------------
+
+// Reply
+
+// .aspia.proto.file_transfer.Status status = 1;
+inline void Reply::clear_status() {
+  status_ = 0;
+}
+inline ::aspia::proto::file_transfer::Status Reply::status() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.status)
+  return static_cast< ::aspia::proto::file_transfer::Status >(status_);
+}
+inline void Reply::set_status(::aspia::proto::file_transfer::Status value) {
+  
+  status_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.status)
+}
+
+// .aspia.proto.file_transfer.DriveList drive_list = 2;
+inline bool Reply::has_drive_list() const {
+  return this != internal_default_instance() && drive_list_ != NULL;
+}
+inline void Reply::clear_drive_list() {
+  if (GetArenaNoVirtual() == NULL && drive_list_ != NULL) {
+    delete drive_list_;
+  }
+  drive_list_ = NULL;
+}
+inline const ::aspia::proto::file_transfer::DriveList& Reply::_internal_drive_list() const {
+  return *drive_list_;
+}
+inline const ::aspia::proto::file_transfer::DriveList& Reply::drive_list() const {
+  const ::aspia::proto::file_transfer::DriveList* p = drive_list_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.drive_list)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::DriveList*>(
+      &::aspia::proto::file_transfer::_DriveList_default_instance_);
+}
+inline ::aspia::proto::file_transfer::DriveList* Reply::release_drive_list() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.drive_list)
+  
+  ::aspia::proto::file_transfer::DriveList* temp = drive_list_;
+  drive_list_ = NULL;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::DriveList* Reply::mutable_drive_list() {
+  
+  if (drive_list_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::DriveList>(GetArenaNoVirtual());
+    drive_list_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.drive_list)
+  return drive_list_;
+}
+inline void Reply::set_allocated_drive_list(::aspia::proto::file_transfer::DriveList* drive_list) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete drive_list_;
+  }
+  if (drive_list) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      drive_list = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, drive_list, submessage_arena);
+    }
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Packet.data)
+  drive_list_ = drive_list;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.drive_list)
 }
 
-// -------------------------------------------------------------------
-
-// CreateDirectoryRequest
-
-// string path = 1;
-inline void CreateDirectoryRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& CreateDirectoryRequest::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.CreateDirectoryRequest.path)
-  return path_.GetNoArena();
-}
-inline void CreateDirectoryRequest::set_path(const ::std::string& value) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+// .aspia.proto.file_transfer.FileList file_list = 3;
+inline bool Reply::has_file_list() const {
+  return this != internal_default_instance() && file_list_ != NULL;
 }
-#if LANG_CXX11
-inline void CreateDirectoryRequest::set_path(::std::string&& value) {
-  
-  path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+inline void Reply::clear_file_list() {
+  if (GetArenaNoVirtual() == NULL && file_list_ != NULL) {
+    delete file_list_;
+  }
+  file_list_ = NULL;
 }
-#endif
-inline void CreateDirectoryRequest::set_path(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+inline const ::aspia::proto::file_transfer::FileList& Reply::_internal_file_list() const {
+  return *file_list_;
 }
-inline void CreateDirectoryRequest::set_path(const char* value, size_t size) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+inline const ::aspia::proto::file_transfer::FileList& Reply::file_list() const {
+  const ::aspia::proto::file_transfer::FileList* p = file_list_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.file_list)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::FileList*>(
+      &::aspia::proto::file_transfer::_FileList_default_instance_);
 }
-inline ::std::string* CreateDirectoryRequest::mutable_path() {
+inline ::aspia::proto::file_transfer::FileList* Reply::release_file_list() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.file_list)
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.CreateDirectoryRequest.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::aspia::proto::file_transfer::FileList* temp = file_list_;
+  file_list_ = NULL;
+  return temp;
 }
-inline ::std::string* CreateDirectoryRequest::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+inline ::aspia::proto::file_transfer::FileList* Reply::mutable_file_list() {
   
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (file_list_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::FileList>(GetArenaNoVirtual());
+    file_list_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.file_list)
+  return file_list_;
 }
-inline void CreateDirectoryRequest::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void Reply::set_allocated_file_list(::aspia::proto::file_transfer::FileList* file_list) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete file_list_;
+  }
+  if (file_list) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      file_list = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, file_list, submessage_arena);
+    }
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+  file_list_ = file_list;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.file_list)
 }
 
-// -------------------------------------------------------------------
-
-// RenameRequest
-
-// string old_name = 1;
-inline void RenameRequest::clear_old_name() {
-  old_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& RenameRequest::old_name() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RenameRequest.old_name)
-  return old_name_.GetNoArena();
-}
-inline void RenameRequest::set_old_name(const ::std::string& value) {
-  
-  old_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RenameRequest.old_name)
+// .aspia.proto.file_transfer.Packet packet = 4;
+inline bool Reply::has_packet() const {
+  return this != internal_default_instance() && packet_ != NULL;
 }
-#if LANG_CXX11
-inline void RenameRequest::set_old_name(::std::string&& value) {
-  
-  old_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.RenameRequest.old_name)
+inline void Reply::clear_packet() {
+  if (GetArenaNoVirtual() == NULL && packet_ != NULL) {
+    delete packet_;
+  }
+  packet_ = NULL;
 }
-#endif
-inline void RenameRequest::set_old_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  old_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.RenameRequest.old_name)
+inline const ::aspia::proto::file_transfer::Packet& Reply::_internal_packet() const {
+  return *packet_;
 }
-inline void RenameRequest::set_old_name(const char* value, size_t size) {
-  
-  old_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.RenameRequest.old_name)
+inline const ::aspia::proto::file_transfer::Packet& Reply::packet() const {
+  const ::aspia::proto::file_transfer::Packet* p = packet_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.packet)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::Packet*>(
+      &::aspia::proto::file_transfer::_Packet_default_instance_);
 }
-inline ::std::string* RenameRequest::mutable_old_name() {
+inline ::aspia::proto::file_transfer::Packet* Reply::release_packet() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.packet)
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RenameRequest.old_name)
-  return old_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::aspia::proto::file_transfer::Packet* temp = packet_;
+  packet_ = NULL;
+  return temp;
 }
-inline ::std::string* RenameRequest::release_old_name() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RenameRequest.old_name)
+inline ::aspia::proto::file_transfer::Packet* Reply::mutable_packet() {
   
-  return old_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (packet_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::Packet>(GetArenaNoVirtual());
+    packet_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.packet)
+  return packet_;
 }
-inline void RenameRequest::set_allocated_old_name(::std::string* old_name) {
-  if (old_name != NULL) {
+inline void Reply::set_allocated_packet(::aspia::proto::file_transfer::Packet* packet) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete packet_;
+  }
+  if (packet) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      packet = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, packet, submessage_arena);
+    }
     
   } else {
     
   }
-  old_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), old_name);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RenameRequest.old_name)
+  packet_ = packet;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.packet)
 }
 
-// string new_name = 2;
-inline void RenameRequest::clear_new_name() {
-  new_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// uint32 window_size = 5;
+inline void Reply::clear_window_size() {
+  window_size_ = 0u;
 }
-inline const ::std::string& RenameRequest::new_name() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RenameRequest.new_name)
-  return new_name_.GetNoArena();
+inline ::google::protobuf::uint32 Reply::window_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.window_size)
+  return window_size_;
 }
-inline void RenameRequest::set_new_name(const ::std::string& value) {
+inline void Reply::set_window_size(::google::protobuf::uint32 value) {
   
-  new_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RenameRequest.new_name)
+  window_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.window_size)
 }
-#if LANG_CXX11
-inline void RenameRequest::set_new_name(::std::string&& value) {
-  
-  new_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.RenameRequest.new_name)
+
+// uint64 file_size = 6;
+inline void Reply::clear_file_size() {
+  file_size_ = GOOGLE_ULONGLONG(0);
 }
-#endif
-inline void RenameRequest::set_new_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline ::google::protobuf::uint64 Reply::file_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.file_size)
+  return file_size_;
+}
+inline void Reply::set_file_size(::google::protobuf::uint64 value) {
   
-  new_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.RenameRequest.new_name)
+  file_size_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.file_size)
 }
-inline void RenameRequest::set_new_name(const char* value, size_t size) {
+
+// .aspia.proto.file_transfer.Compression compression = 7;
+inline void Reply::clear_compression() {
+  compression_ = 0;
+}
+inline ::aspia::proto::file_transfer::Compression Reply::compression() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.compression)
+  return static_cast< ::aspia::proto::file_transfer::Compression >(compression_);
+}
+inline void Reply::set_compression(::aspia::proto::file_transfer::Compression value) {
   
-  new_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.RenameRequest.new_name)
+  compression_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.compression)
 }
-inline ::std::string* RenameRequest::mutable_new_name() {
+
+// .aspia.proto.file_transfer.BlockChecksums block_checksums = 8;
+inline bool Reply::has_block_checksums() const {
+  return this != internal_default_instance() && block_checksums_ != NULL;
+}
+inline void Reply::clear_block_checksums() {
+  if (GetArenaNoVirtual() == NULL && block_checksums_ != NULL) {
+    delete block_checksums_;
+  }
+  block_checksums_ = NULL;
+}
+inline const ::aspia::proto::file_transfer::BlockChecksums& Reply::_internal_block_checksums() const {
+  return *block_checksums_;
+}
+inline const ::aspia::proto::file_transfer::BlockChecksums& Reply::block_checksums() const {
+  const ::aspia::proto::file_transfer::BlockChecksums* p = block_checksums_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.block_checksums)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::BlockChecksums*>(
+      &::aspia::proto::file_transfer::_BlockChecksums_default_instance_);
+}
+inline ::aspia::proto::file_transfer::BlockChecksums* Reply::release_block_checksums() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.block_checksums)
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RenameRequest.new_name)
-  return new_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::aspia::proto::file_transfer::BlockChecksums* temp = block_checksums_;
+  block_checksums_ = NULL;
+  return temp;
 }
-inline ::std::string* RenameRequest::release_new_name() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RenameRequest.new_name)
+inline ::aspia::proto::file_transfer::BlockChecksums* Reply::mutable_block_checksums() {
   
-  return new_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (block_checksums_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::BlockChecksums>(GetArenaNoVirtual());
+    block_checksums_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.block_checksums)
+  return block_checksums_;
 }
-inline void RenameRequest::set_allocated_new_name(::std::string* new_name) {
-  if (new_name != NULL) {
+inline void Reply::set_allocated_block_checksums(::aspia::proto::file_transfer::BlockChecksums* block_checksums) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete block_checksums_;
+  }
+  if (block_checksums) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      block_checksums = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, block_checksums, submessage_arena);
+    }
     
   } else {
     
   }
-  new_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), new_name);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RenameRequest.new_name)
+  block_checksums_ = block_checksums;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.block_checksums)
 }
 
-// -------------------------------------------------------------------
-
-// RemoveRequest
+// uint64 offset = 9;
+inline void Reply::clear_offset() {
+  offset_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 Reply::offset() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.offset)
+  return offset_;
+}
+inline void Reply::set_offset(::google::protobuf::uint64 value) {
+  
+  offset_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.offset)
+}
 
-// string path = 1;
-inline void RemoveRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bytes tail_hash = 10;
+inline void Reply::clear_tail_hash() {
+  tail_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& RemoveRequest::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveRequest.path)
-  return path_.GetNoArena();
+inline const ::std::string& Reply::tail_hash() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.tail_hash)
+  return tail_hash_.GetNoArena();
 }
-inline void RemoveRequest::set_path(const ::std::string& value) {
+inline void Reply::set_tail_hash(const ::std::string& value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveRequest.path)
+  tail_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.tail_hash)
 }
 #if LANG_CXX11
-inline void RemoveRequest::set_path(::std::string&& value) {
+inline void Reply::set_tail_hash(::std::string&& value) {
   
-  path_.SetNoArena(
+  tail_hash_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.RemoveRequest.path)
+  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.Reply.tail_hash)
 }
 #endif
-inline void RemoveRequest::set_path(const char* value) {
+inline void Reply::set_tail_hash(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.RemoveRequest.path)
+  tail_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.Reply.tail_hash)
 }
-inline void RemoveRequest::set_path(const char* value, size_t size) {
+inline void Reply::set_tail_hash(const void* value, size_t size) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  tail_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.RemoveRequest.path)
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.Reply.tail_hash)
 }
-inline ::std::string* RemoveRequest::mutable_path() {
+inline ::std::string* Reply::mutable_tail_hash() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoveRequest.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.tail_hash)
+  return tail_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* RemoveRequest::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RemoveRequest.path)
+inline ::std::string* Reply::release_tail_hash() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.tail_hash)
   
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return tail_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void RemoveRequest::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void Reply::set_allocated_tail_hash(::std::string* tail_hash) {
+  if (tail_hash != NULL) {
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RemoveRequest.path)
+  tail_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), tail_hash);
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.tail_hash)
 }
 
-// -------------------------------------------------------------------
-
-// Reply
-
-// .aspia.proto.file_transfer.Status status = 1;
-inline void Reply::clear_status() {
-  status_ = 0;
+// uint32 max_streams = 11;
+inline void Reply::clear_max_streams() {
+  max_streams_ = 0u;
 }
-inline ::aspia::proto::file_transfer::Status Reply::status() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.status)
-  return static_cast< ::aspia::proto::file_transfer::Status >(status_);
+inline ::google::protobuf::uint32 Reply::max_streams() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.max_streams)
+  return max_streams_;
 }
-inline void Reply::set_status(::aspia::proto::file_transfer::Status value) {
+inline void Reply::set_max_streams(::google::protobuf::uint32 value) {
   
-  status_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.status)
+  max_streams_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.max_streams)
 }
 
-// .aspia.proto.file_transfer.DriveList drive_list = 2;
-inline bool Reply::has_drive_list() const {
-  return this != internal_default_instance() && drive_list_ != NULL;
+// .aspia.proto.file_transfer.Bundle bundle_failures = 12;
+inline bool Reply::has_bundle_failures() const {
+  return this != internal_default_instance() && bundle_failures_ != NULL;
 }
-inline void Reply::clear_drive_list() {
-  if (GetArenaNoVirtual() == NULL && drive_list_ != NULL) {
-    delete drive_list_;
+inline void Reply::clear_bundle_failures() {
+  if (GetArenaNoVirtual() == NULL && bundle_failures_ != NULL) {
+    delete bundle_failures_;
   }
-  drive_list_ = NULL;
+  bundle_failures_ = NULL;
 }
-inline const ::aspia::proto::file_transfer::DriveList& Reply::_internal_drive_list() const {
-  return *drive_list_;
+inline const ::aspia::proto::file_transfer::Bundle& Reply::_internal_bundle_failures() const {
+  return *bundle_failures_;
 }
-inline const ::aspia::proto::file_transfer::DriveList& Reply::drive_list() const {
-  const ::aspia::proto::file_transfer::DriveList* p = drive_list_;
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.drive_list)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::DriveList*>(
-      &::aspia::proto::file_transfer::_DriveList_default_instance_);
+inline const ::aspia::proto::file_transfer::Bundle& Reply::bundle_failures() const {
+  const ::aspia::proto::file_transfer::Bundle* p = bundle_failures_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.bundle_failures)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::Bundle*>(
+      &::aspia::proto::file_transfer::_Bundle_default_instance_);
 }
-inline ::aspia::proto::file_transfer::DriveList* Reply::release_drive_list() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.drive_list)
+inline ::aspia::proto::file_transfer::Bundle* Reply::release_bundle_failures() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.bundle_failures)
   
-  ::aspia::proto::file_transfer::DriveList* temp = drive_list_;
-  drive_list_ = NULL;
+  ::aspia::proto::file_transfer::Bundle* temp = bundle_failures_;
+  bundle_failures_ = NULL;
   return temp;
 }
-inline ::aspia::proto::file_transfer::DriveList* Reply::mutable_drive_list() {
+inline ::aspia::proto::file_transfer::Bundle* Reply::mutable_bundle_failures() {
   
-  if (drive_list_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::DriveList>(GetArenaNoVirtual());
-    drive_list_ = p;
+  if (bundle_failures_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::Bundle>(GetArenaNoVirtual());
+    bundle_failures_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.drive_list)
-  return drive_list_;
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.bundle_failures)
+  return bundle_failures_;
 }
-inline void Reply::set_allocated_drive_list(::aspia::proto::file_transfer::DriveList* drive_list) {
+inline void Reply::set_allocated_bundle_failures(::aspia::proto::file_transfer::Bundle* bundle_failures) {
   ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == NULL) {
-    delete drive_list_;
+    delete bundle_failures_;
   }
-  if (drive_list) {
+  if (bundle_failures) {
     ::google::protobuf::Arena* submessage_arena = NULL;
     if (message_arena != submessage_arena) {
-      drive_list = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, drive_list, submessage_arena);
+      bundle_failures = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, bundle_failures, submessage_arena);
     }
     
   } else {
     
   }
-  drive_list_ = drive_list;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.drive_list)
+  bundle_failures_ = bundle_failures;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.bundle_failures)
 }
 
-// .aspia.proto.file_transfer.FileList file_list = 3;
-inline bool Reply::has_file_list() const {
-  return this != internal_default_instance() && file_list_ != NULL;
+// bool bundles = 13;
+inline void Reply::clear_bundles() {
+  bundles_ = false;
 }
-inline void Reply::clear_file_list() {
-  if (GetArenaNoVirtual() == NULL && file_list_ != NULL) {
-    delete file_list_;
+inline bool Reply::bundles() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.bundles)
+  return bundles_;
+}
+inline void Reply::set_bundles(bool value) {
+  
+  bundles_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.bundles)
+}
+
+// .aspia.proto.file_transfer.RemoveProgress remove_progress = 14;
+inline bool Reply::has_remove_progress() const {
+  return this != internal_default_instance() && remove_progress_ != NULL;
+}
+inline void Reply::clear_remove_progress() {
+  if (GetArenaNoVirtual() == NULL && remove_progress_ != NULL) {
+    delete remove_progress_;
   }
-  file_list_ = NULL;
+  remove_progress_ = NULL;
 }
-inline const ::aspia::proto::file_transfer::FileList& Reply::_internal_file_list() const {
-  return *file_list_;
+inline const ::aspia::proto::file_transfer::RemoveProgress& Reply::_internal_remove_progress() const {
+  return *remove_progress_;
 }
-inline const ::aspia::proto::file_transfer::FileList& Reply::file_list() const {
-  const ::aspia::proto::file_transfer::FileList* p = file_list_;
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.file_list)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::FileList*>(
-      &::aspia::proto::file_transfer::_FileList_default_instance_);
+inline const ::aspia::proto::file_transfer::RemoveProgress& Reply::remove_progress() const {
+  const ::aspia::proto::file_transfer::RemoveProgress* p = remove_progress_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.remove_progress)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::RemoveProgress*>(
+      &::aspia::proto::file_transfer::_RemoveProgress_default_instance_);
 }
-inline ::aspia::proto::file_transfer::FileList* Reply::release_file_list() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.file_list)
+inline ::aspia::proto::file_transfer::RemoveProgress* Reply::release_remove_progress() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.remove_progress)
   
-  ::aspia::proto::file_transfer::FileList* temp = file_list_;
-  file_list_ = NULL;
+  ::aspia::proto::file_transfer::RemoveProgress* temp = remove_progress_;
+  remove_progress_ = NULL;
   return temp;
 }
-inline ::aspia::proto::file_transfer::FileList* Reply::mutable_file_list() {
+inline ::aspia::proto::file_transfer::RemoveProgress* Reply::mutable_remove_progress() {
   
-  if (file_list_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::FileList>(GetArenaNoVirtual());
-    file_list_ = p;
+  if (remove_progress_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::RemoveProgress>(GetArenaNoVirtual());
+    remove_progress_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.file_list)
-  return file_list_;
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.remove_progress)
+  return remove_progress_;
 }
-inline void Reply::set_allocated_file_list(::aspia::proto::file_transfer::FileList* file_list) {
+inline void Reply::set_allocated_remove_progress(::aspia::proto::file_transfer::RemoveProgress* remove_progress) {
   ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == NULL) {
-    delete file_list_;
+    delete remove_progress_;
   }
-  if (file_list) {
+  if (remove_progress) {
     ::google::protobuf::Arena* submessage_arena = NULL;
     if (message_arena != submessage_arena) {
-      file_list = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, file_list, submessage_arena);
+      remove_progress = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, remove_progress, submessage_arena);
     }
     
   } else {
     
   }
-  file_list_ = file_list;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.file_list)
+  remove_progress_ = remove_progress;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.remove_progress)
 }
 
-// .aspia.proto.file_transfer.Packet packet = 4;
-inline bool Reply::has_packet() const {
-  return this != internal_default_instance() && packet_ != NULL;
+// .aspia.proto.file_transfer.CopyProgress copy_progress = 15;
+inline bool Reply::has_copy_progress() const {
+  return this != internal_default_instance() && copy_progress_ != NULL;
 }
-inline void Reply::clear_packet() {
-  if (GetArenaNoVirtual() == NULL && packet_ != NULL) {
-    delete packet_;
+inline void Reply::clear_copy_progress() {
+  if (GetArenaNoVirtual() == NULL && copy_progress_ != NULL) {
+    delete copy_progress_;
   }
-  packet_ = NULL;
+  copy_progress_ = NULL;
 }
-inline const ::aspia::proto::file_transfer::Packet& Reply::_internal_packet() const {
-  return *packet_;
+inline const ::aspia::proto::file_transfer::CopyProgress& Reply::_internal_copy_progress() const {
+  return *copy_progress_;
 }
-inline const ::aspia::proto::file_transfer::Packet& Reply::packet() const {
-  const ::aspia::proto::file_transfer::Packet* p = packet_;
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.packet)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::Packet*>(
-      &::aspia::proto::file_transfer::_Packet_default_instance_);
+inline const ::aspia::proto::file_transfer::CopyProgress& Reply::copy_progress() const {
+  const ::aspia::proto::file_transfer::CopyProgress* p = copy_progress_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.copy_progress)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::CopyProgress*>(
+      &::aspia::proto::file_transfer::_CopyProgress_default_instance_);
 }
-inline ::aspia::proto::file_transfer::Packet* Reply::release_packet() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.packet)
+inline ::aspia::proto::file_transfer::CopyProgress* Reply::release_copy_progress() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.copy_progress)
   
-  ::aspia::proto::file_transfer::Packet* temp = packet_;
-  packet_ = NULL;
+  ::aspia::proto::file_transfer::CopyProgress* temp = copy_progress_;
+  copy_progress_ = NULL;
   return temp;
 }
-inline ::aspia::proto::file_transfer::Packet* Reply::mutable_packet() {
+inline ::aspia::proto::file_transfer::CopyProgress* Reply::mutable_copy_progress() {
   
-  if (packet_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::Packet>(GetArenaNoVirtual());
-    packet_ = p;
+  if (copy_progress_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::CopyProgress>(GetArenaNoVirtual());
+    copy_progress_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.packet)
-  return packet_;
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.copy_progress)
+  return copy_progress_;
 }
-inline void Reply::set_allocated_packet(::aspia::proto::file_transfer::Packet* packet) {
+inline void Reply::set_allocated_copy_progress(::aspia::proto::file_transfer::CopyProgress* copy_progress) {
   ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == NULL) {
-    delete packet_;
+    delete copy_progress_;
   }
-  if (packet) {
+  if (copy_progress) {
     ::google::protobuf::Arena* submessage_arena = NULL;
     if (message_arena != submessage_arena) {
-      packet = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, packet, submessage_arena);
+      copy_progress = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, copy_progress, submessage_arena);
     }
     
   } else {
     
   }
-  packet_ = packet;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.packet)
+  copy_progress_ = copy_progress;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.copy_progress)
+}
+
+// uint64 modification_time = 16;
+inline void Reply::clear_modification_time() {
+  modification_time_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 Reply::modification_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.modification_time)
+  return modification_time_;
+}
+inline void Reply::set_modification_time(::google::protobuf::uint64 value) {
+  
+  modification_time_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.modification_time)
 }
 
 // -------------------------------------------------------------------
@@ -3478,6 +7505,236 @@ inline void Request::set_allocated_packet(::aspia::proto::file_transfer::Packet*
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.packet)
 }
 
+// .aspia.proto.file_transfer.BlockChecksumsRequest block_checksums_request = 10;
+inline bool Request::has_block_checksums_request() const {
+  return this != internal_default_instance() && block_checksums_request_ != NULL;
+}
+inline void Request::clear_block_checksums_request() {
+  if (GetArenaNoVirtual() == NULL && block_checksums_request_ != NULL) {
+    delete block_checksums_request_;
+  }
+  block_checksums_request_ = NULL;
+}
+inline const ::aspia::proto::file_transfer::BlockChecksumsRequest& Request::_internal_block_checksums_request() const {
+  return *block_checksums_request_;
+}
+inline const ::aspia::proto::file_transfer::BlockChecksumsRequest& Request::block_checksums_request() const {
+  const ::aspia::proto::file_transfer::BlockChecksumsRequest* p = block_checksums_request_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.block_checksums_request)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::BlockChecksumsRequest*>(
+      &::aspia::proto::file_transfer::_BlockChecksumsRequest_default_instance_);
+}
+inline ::aspia::proto::file_transfer::BlockChecksumsRequest* Request::release_block_checksums_request() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.block_checksums_request)
+  
+  ::aspia::proto::file_transfer::BlockChecksumsRequest* temp = block_checksums_request_;
+  block_checksums_request_ = NULL;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::BlockChecksumsRequest* Request::mutable_block_checksums_request() {
+  
+  if (block_checksums_request_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::BlockChecksumsRequest>(GetArenaNoVirtual());
+    block_checksums_request_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.block_checksums_request)
+  return block_checksums_request_;
+}
+inline void Request::set_allocated_block_checksums_request(::aspia::proto::file_transfer::BlockChecksumsRequest* block_checksums_request) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete block_checksums_request_;
+  }
+  if (block_checksums_request) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      block_checksums_request = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, block_checksums_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  block_checksums_request_ = block_checksums_request;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.block_checksums_request)
+}
+
+// .aspia.proto.file_transfer.ResumeRequest resume_request = 11;
+inline bool Request::has_resume_request() const {
+  return this != internal_default_instance() && resume_request_ != NULL;
+}
+inline void Request::clear_resume_request() {
+  if (GetArenaNoVirtual() == NULL && resume_request_ != NULL) {
+    delete resume_request_;
+  }
+  resume_request_ = NULL;
+}
+inline const ::aspia::proto::file_transfer::ResumeRequest& Request::_internal_resume_request() const {
+  return *resume_request_;
+}
+inline const ::aspia::proto::file_transfer::ResumeRequest& Request::resume_request() const {
+  const ::aspia::proto::file_transfer::ResumeRequest* p = resume_request_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.resume_request)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::ResumeRequest*>(
+      &::aspia::proto::file_transfer::_ResumeRequest_default_instance_);
+}
+inline ::aspia::proto::file_transfer::ResumeRequest* Request::release_resume_request() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.resume_request)
+  
+  ::aspia::proto::file_transfer::ResumeRequest* temp = resume_request_;
+  resume_request_ = NULL;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::ResumeRequest* Request::mutable_resume_request() {
+  
+  if (resume_request_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::ResumeRequest>(GetArenaNoVirtual());
+    resume_request_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.resume_request)
+  return resume_request_;
+}
+inline void Request::set_allocated_resume_request(::aspia::proto::file_transfer::ResumeRequest* resume_request) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete resume_request_;
+  }
+  if (resume_request) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      resume_request = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, resume_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  resume_request_ = resume_request;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.resume_request)
+}
+
+// uint32 stream_id = 12;
+inline void Request::clear_stream_id() {
+  stream_id_ = 0u;
+}
+inline ::google::protobuf::uint32 Request::stream_id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.stream_id)
+  return stream_id_;
+}
+inline void Request::set_stream_id(::google::protobuf::uint32 value) {
+  
+  stream_id_ = value;
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Request.stream_id)
+}
+
+// .aspia.proto.file_transfer.CopyRequest copy_request = 13;
+inline bool Request::has_copy_request() const {
+  return this != internal_default_instance() && copy_request_ != NULL;
+}
+inline void Request::clear_copy_request() {
+  if (GetArenaNoVirtual() == NULL && copy_request_ != NULL) {
+    delete copy_request_;
+  }
+  copy_request_ = NULL;
+}
+inline const ::aspia::proto::file_transfer::CopyRequest& Request::_internal_copy_request() const {
+  return *copy_request_;
+}
+inline const ::aspia::proto::file_transfer::CopyRequest& Request::copy_request() const {
+  const ::aspia::proto::file_transfer::CopyRequest* p = copy_request_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.copy_request)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::CopyRequest*>(
+      &::aspia::proto::file_transfer::_CopyRequest_default_instance_);
+}
+inline ::aspia::proto::file_transfer::CopyRequest* Request::release_copy_request() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.copy_request)
+  
+  ::aspia::proto::file_transfer::CopyRequest* temp = copy_request_;
+  copy_request_ = NULL;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::CopyRequest* Request::mutable_copy_request() {
+  
+  if (copy_request_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::CopyRequest>(GetArenaNoVirtual());
+    copy_request_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.copy_request)
+  return copy_request_;
+}
+inline void Request::set_allocated_copy_request(::aspia::proto::file_transfer::CopyRequest* copy_request) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete copy_request_;
+  }
+  if (copy_request) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      copy_request = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, copy_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  copy_request_ = copy_request;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.copy_request)
+}
+
+// .aspia.proto.file_transfer.MoveRequest move_request = 14;
+inline bool Request::has_move_request() const {
+  return this != internal_default_instance() && move_request_ != NULL;
+}
+inline void Request::clear_move_request() {
+  if (GetArenaNoVirtual() == NULL && move_request_ != NULL) {
+    delete move_request_;
+  }
+  move_request_ = NULL;
+}
+inline const ::aspia::proto::file_transfer::MoveRequest& Request::_internal_move_request() const {
+  return *move_request_;
+}
+inline const ::aspia::proto::file_transfer::MoveRequest& Request::move_request() const {
+  const ::aspia::proto::file_transfer::MoveRequest* p = move_request_;
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.move_request)
+  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::MoveRequest*>(
+      &::aspia::proto::file_transfer::_MoveRequest_default_instance_);
+}
+inline ::aspia::proto::file_transfer::MoveRequest* Request::release_move_request() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.move_request)
+  
+  ::aspia::proto::file_transfer::MoveRequest* temp = move_request_;
+  move_request_ = NULL;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::MoveRequest* Request::mutable_move_request() {
+  
+  if (move_request_ == NULL) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::MoveRequest>(GetArenaNoVirtual());
+    move_request_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.move_request)
+  return move_request_;
+}
+inline void Request::set_allocated_move_request(::aspia::proto::file_transfer::MoveRequest* move_request) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete move_request_;
+  }
+  if (move_request) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      move_request = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, move_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  move_request_ = move_request;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.move_request)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -3509,6 +7766,30 @@ inline void Request::set_allocated_packet(::aspia::proto::file_transfer::Packet*
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3522,6 +7803,7 @@ namespace protobuf {
 template <> struct is_proto_enum< ::aspia::proto::file_transfer::DriveList_Item_Type> : ::std::true_type {};
 template <> struct is_proto_enum< ::aspia::proto::file_transfer::Packet_Flags> : ::std::true_type {};
 template <> struct is_proto_enum< ::aspia::proto::file_transfer::Status> : ::std::true_type {};
+template <> struct is_proto_enum< ::aspia::proto::file_transfer::Compression> : ::std::true_type {};
 
 }  // namespace protobuf
 }  // namespace google